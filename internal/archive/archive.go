@@ -0,0 +1,374 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+// Package archive stores decoded trice records column wise per trice ID for fast offline queries.
+//
+// An archive is a directory with a manifest and for each trice ID a sub-directory with column files:
+//
+//	manifest.json     IDs, blocks, block statistics and column sizes
+//	3713/seq.col      record sequence numbers over all IDs, delta coded uvarints
+//	3713/host.col     host reception times in ns, delta coded varints
+//	3713/stamp.col    target stamps, delta coded varints (only with target stamps)
+//	3713/chan.col     channels as uvarint index into the block channel list
+//	3713/n.col        value counts as uvarints
+//	3713/v0.col ...   typed values, one column per parameter position
+//	3713/msg.col      messages, flate compressed per block
+//
+// Each column file is a sequence of blocks with up to BlockRows records. The manifest keeps for each block the
+// host time, target stamp and numeric value ranges, the channels and the column sizes. A query reads the
+// manifest and then only the blocks, which can contain matching records.
+package archive
+
+import (
+	"bytes"
+	"compress/flate"
+	"encoding/binary"
+	"encoding/json"
+	"fmt"
+	"math"
+	"os"
+	"path/filepath"
+	"sort"
+	"strconv"
+
+	"github.com/rokath/trice/internal/decoder"
+	"github.com/rokath/trice/internal/id"
+	"github.com/spf13/afero"
+)
+
+var (
+	// Dir is the archive directory.
+	Dir = "trice.archive"
+
+	// BlockRows is the maximum record count of a block.
+	BlockRows = 4096
+)
+
+const (
+	manifestName = "manifest.json"
+	version      = 1
+
+	// maxBlockBytes ends a block also before BlockRows records, to bound the writer memory with many IDs.
+	maxBlockBytes = 64 * 1024
+)
+
+// Manifest describes an archive.
+type Manifest struct {
+	Version   int
+	BlockRows int
+	Records   int                       // Records is the record count of all IDs.
+	IDs       map[id.TriceID]*IDRecords // IDs holds the blocks of each ID. Decoder messages have ID 0.
+}
+
+// IDRecords describes the records of one ID.
+type IDRecords struct {
+	Records int
+	File    string `json:",omitempty"` // File is the location of the first record.
+	Line    int    `json:",omitempty"` // Line is the location of the first record.
+	Blocks  []Block
+}
+
+// Block describes a block of records of one ID.
+type Block struct {
+	Records   int
+	HostMin   int64            // HostMin is the earliest host reception time in ns.
+	HostMax   int64            // HostMax is the latest host reception time in ns.
+	StampSize int              `json:",omitempty"` // StampSize is the target stamp size of the first record. With 0 there is no stamp column.
+	StampMin  uint64           `json:",omitempty"`
+	StampMax  uint64           `json:",omitempty"`
+	Channels  []string         `json:",omitempty"` // Channels are the different record channels.
+	Values    []ValueRange     `json:",omitempty"` // Values are the ranges of the value columns.
+	Sizes     map[string]int64 // Sizes are the byte counts of the block inside the column files.
+
+	offsets map[string]int64 // offsets are the block positions inside the column files.
+}
+
+// ValueRange is the range of the numeric values of a value column block. Bools count as 0 and 1.
+// Strings and NaNs are not part of the range. Numeric is false, when there is no numeric value.
+type ValueRange struct {
+	Numeric bool    `json:",omitempty"`
+	Min     float64 `json:",omitempty"`
+	Max     float64 `json:",omitempty"`
+}
+
+// add extends r with the value v.
+func (r *ValueRange) add(v interface{}) {
+	f, ok := numeric(v)
+	if !ok || math.IsNaN(f) {
+		return
+	}
+	f = math.Max(-math.MaxFloat64, math.Min(f, math.MaxFloat64)) // JSON has no infinity
+	if !r.Numeric {
+		r.Numeric, r.Min, r.Max = true, f, f
+		return
+	}
+	r.Min = math.Min(r.Min, f)
+	r.Max = math.Max(r.Max, f)
+}
+
+// numeric returns v as float64, if v is a number or bool.
+func numeric(v interface{}) (float64, bool) {
+	switch x := v.(type) {
+	case uint64:
+		return float64(x), true
+	case int64:
+		return float64(x), true
+	case float32:
+		return float64(x), true
+	case float64:
+		return x, true
+	case bool:
+		if x {
+			return 1, true
+		}
+		return 0, true
+	}
+	return 0, false
+}
+
+// Writer writes decoded records into a new archive. Close completes the archive.
+type Writer struct {
+	fSys      *afero.Afero
+	dir       string
+	blockRows int
+	seq       uint64
+	m         Manifest
+	ids       map[id.TriceID]*idWriter
+	zip       *flate.Writer
+	zipped    bytes.Buffer
+}
+
+// idWriter collects the columns of the actual block of one ID.
+type idWriter struct {
+	records  *IDRecords
+	block    Block
+	size     int // size is about the byte count of the columns.
+	lastSeq  uint64
+	lastHost int64
+	lastStmp uint64
+	seq      []byte
+	host     []byte
+	stamp    []byte
+	chans    []byte
+	n        []byte
+	msg      []byte
+	values   [][]byte
+}
+
+// Create returns a writer for a new archive in dir with up to blockRows records per block.
+// dir is created and must be empty, if it exists.
+func Create(fSys *afero.Afero, dir string, blockRows int) (*Writer, error) {
+	if blockRows < 1 {
+		blockRows = 1
+	}
+	if exists, _ := fSys.DirExists(dir); exists {
+		if entries, err := fSys.ReadDir(dir); err != nil || len(entries) > 0 {
+			return nil, fmt.Errorf("archive directory %s is not empty", dir)
+		}
+	}
+	if err := fSys.MkdirAll(dir, 0755); err != nil {
+		return nil, err
+	}
+	zip, _ := flate.NewWriter(nil, flate.BestSpeed) // The error is only for invalid levels.
+	return &Writer{
+		fSys:      fSys,
+		dir:       dir,
+		blockRows: blockRows,
+		m:         Manifest{Version: version, BlockRows: blockRows, IDs: make(map[id.TriceID]*IDRecords)},
+		ids:       make(map[id.TriceID]*idWriter),
+		zip:       zip,
+	}, nil
+}
+
+// Records returns the count of the written records.
+func (p *Writer) Records() int {
+	return p.m.Records
+}
+
+// Write adds r to the block of its ID and writes the block into the column files, when it is full.
+func (p *Writer) Write(r *decoder.Record) error {
+	x := p.ids[r.ID]
+	if x == nil {
+		x = &idWriter{records: &IDRecords{File: r.File, Line: r.Line}}
+		p.ids[r.ID] = x
+		p.m.IDs[r.ID] = x.records
+	}
+	x.add(p.seq, r)
+	p.seq++
+	p.m.Records++
+	if x.block.Records == p.blockRows || x.size >= maxBlockBytes {
+		return p.writeBlock(r.ID, x)
+	}
+	return nil
+}
+
+// Flush does nothing. The blocks are written, when they are full, and on Close.
+func (p *Writer) Flush() error {
+	return nil
+}
+
+// add appends r with the sequence number seq to the columns.
+func (x *idWriter) add(seq uint64, r *decoder.Record) {
+	b := &x.block
+	host := r.Host.UnixNano()
+	if b.Records == 0 {
+		*b = Block{HostMin: host, HostMax: host, StampSize: r.StampSize, StampMin: r.Stamp, StampMax: r.Stamp}
+		x.lastSeq, x.lastHost, x.lastStmp = 0, 0, 0
+	}
+	x.seq = binary.AppendUvarint(x.seq, seq-x.lastSeq)
+	x.lastSeq = seq
+	x.host = binary.AppendVarint(x.host, host-x.lastHost)
+	x.lastHost = host
+	if host < b.HostMin {
+		b.HostMin = host
+	}
+	if host > b.HostMax {
+		b.HostMax = host
+	}
+	if b.StampSize != 0 {
+		x.stamp = binary.AppendVarint(x.stamp, int64(r.Stamp-x.lastStmp))
+		x.lastStmp = r.Stamp
+		if r.Stamp < b.StampMin {
+			b.StampMin = r.Stamp
+		}
+		if r.Stamp > b.StampMax {
+			b.StampMax = r.Stamp
+		}
+	}
+	ch := 0
+	for ch < len(b.Channels) && b.Channels[ch] != r.Channel {
+		ch++
+	}
+	if ch == len(b.Channels) {
+		b.Channels = append(b.Channels, r.Channel)
+	}
+	x.chans = binary.AppendUvarint(x.chans, uint64(ch))
+	x.n = binary.AppendUvarint(x.n, uint64(len(r.Values)))
+	for i, v := range r.Values {
+		if i == len(x.values) {
+			x.values = append(x.values, nil)
+		}
+		if i == len(b.Values) {
+			b.Values = append(b.Values, ValueRange{})
+		}
+		l := len(x.values[i])
+		x.values[i] = appendValue(x.values[i], v)
+		x.size += len(x.values[i]) - l
+		b.Values[i].add(v)
+	}
+	x.msg = appendString(x.msg, r.Msg)
+	x.size += 12 + len(r.Msg)
+	b.Records++
+}
+
+// appendValue appends the kind and value of v: 'u' uvarint, 'i' varint, 'g' float32 and 'f' float64 little endian,
+// 'b' one byte, 's' uvarint length and bytes.
+func appendValue(b []byte, v interface{}) []byte {
+	switch x := v.(type) {
+	case uint64:
+		return binary.AppendUvarint(append(b, 'u'), x)
+	case int64:
+		return binary.AppendVarint(append(b, 'i'), x)
+	case float32:
+		return binary.LittleEndian.AppendUint32(append(b, 'g'), math.Float32bits(x))
+	case float64:
+		return binary.LittleEndian.AppendUint64(append(b, 'f'), math.Float64bits(x))
+	case bool:
+		if x {
+			return append(b, 'b', 1)
+		}
+		return append(b, 'b', 0)
+	case string:
+		return appendString(append(b, 's'), x)
+	}
+	return appendString(append(b, 's'), fmt.Sprint(v))
+}
+
+// appendString appends the length of s as uvarint and s.
+func appendString(b []byte, s string) []byte {
+	return append(binary.AppendUvarint(b, uint64(len(s))), s...)
+}
+
+// writeBlock appends the actual block of x to the column files of tid and resets x.
+func (p *Writer) writeBlock(tid id.TriceID, x *idWriter) error {
+	dir := filepath.Join(p.dir, strconv.Itoa(int(tid)))
+	if len(x.records.Blocks) == 0 {
+		if err := p.fSys.MkdirAll(dir, 0755); err != nil {
+			return err
+		}
+	}
+	p.zipped.Reset()
+	p.zip.Reset(&p.zipped)
+	p.zip.Write(x.msg) //nolint:errcheck // a bytes.Buffer does not fail
+	p.zip.Close()      //nolint:errcheck
+
+	b := x.block
+	b.Sizes = make(map[string]int64, 6+len(x.values))
+	columns := []struct {
+		name string
+		data []byte
+	}{{"seq", x.seq}, {"host", x.host}, {"stamp", x.stamp}, {"chan", x.chans}, {"n", x.n}, {"msg", p.zipped.Bytes()}}
+	for i, v := range x.values {
+		columns = append(columns, struct {
+			name string
+			data []byte
+		}{valueColumn(i), v})
+	}
+	for _, c := range columns {
+		if len(c.data) == 0 {
+			continue
+		}
+		if err := appendFile(p.fSys, filepath.Join(dir, c.name+".col"), c.data); err != nil {
+			return err
+		}
+		b.Sizes[c.name] = int64(len(c.data))
+	}
+	x.records.Blocks = append(x.records.Blocks, b)
+	x.records.Records += b.Records
+
+	x.block.Records, x.size = 0, 0
+	x.seq, x.host, x.stamp, x.chans, x.n, x.msg = x.seq[:0], x.host[:0], x.stamp[:0], x.chans[:0], x.n[:0], x.msg[:0]
+	for i := range x.values {
+		x.values[i] = x.values[i][:0]
+	}
+	return nil
+}
+
+// valueColumn returns the column name for the value at position i.
+func valueColumn(i int) string {
+	return "v" + strconv.Itoa(i)
+}
+
+// appendFile appends data to the file name.
+func appendFile(fSys *afero.Afero, name string, data []byte) error {
+	f, err := fSys.OpenFile(name, os.O_APPEND|os.O_CREATE|os.O_WRONLY, 0644)
+	if err != nil {
+		return err
+	}
+	if _, err = f.Write(data); err != nil {
+		f.Close()
+		return err
+	}
+	return f.Close()
+}
+
+// Close writes the not full blocks and the manifest.
+func (p *Writer) Close() error {
+	tids := make([]id.TriceID, 0, len(p.ids))
+	for tid := range p.ids {
+		tids = append(tids, tid)
+	}
+	sort.Slice(tids, func(i, j int) bool { return tids[i] < tids[j] })
+	for _, tid := range tids {
+		if x := p.ids[tid]; x.block.Records > 0 {
+			if err := p.writeBlock(tid, x); err != nil {
+				return err
+			}
+		}
+	}
+	b, err := json.Marshal(&p.m)
+	if err != nil {
+		return err
+	}
+	return p.fSys.WriteFile(filepath.Join(p.dir, manifestName), b, 0644)
+}
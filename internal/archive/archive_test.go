@@ -0,0 +1,180 @@
+// white-box test
+package archive
+
+import (
+	"bytes"
+	"fmt"
+	"testing"
+	"time"
+
+	"github.com/rokath/trice/internal/decoder"
+	"github.com/rokath/trice/internal/id"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// testRecords returns n records of the IDs 0, 10, 20 and 30 with ascending host times.
+func testRecords(n int) []decoder.Record {
+	channels := []string{"msg", "err", ""}
+	rs := make([]decoder.Record, n)
+	for i := range rs {
+		r := &rs[i]
+		r.ID = id.TriceID(10 * (i % 4))
+		r.Host = time.Unix(1700000000, 0).Add(time.Duration(i) * time.Millisecond)
+		r.Channel = channels[i%3]
+		switch r.ID {
+		case 0:
+			r.Msg = fmt.Sprint("decoder message ", i)
+		case 10:
+			r.StampSize, r.Stamp = 4, uint64(1000*i)
+			r.Values = []interface{}{uint64(i), int64(-i)}
+			r.File, r.Line = "main.c", 12
+			r.Msg = fmt.Sprint("u=", i, " i=", -i)
+		case 20:
+			state := "idle"
+			if i%3 == 0 {
+				state = "busy"
+			}
+			r.StampSize, r.Stamp = 8, uint64(i)<<40
+			r.Values = []interface{}{float32(i) / 4, state, i%2 == 0, float64(i) * 1.5}
+			r.Msg = fmt.Sprint("f=", float32(i)/4, " ", state)
+		case 30:
+			r.Msg = "no values"
+		}
+	}
+	return rs
+}
+
+// ndjson returns the records as NDJSON.
+func ndjson(t *testing.T, rs []decoder.Record) string {
+	var b bytes.Buffer
+	rw, err := decoder.NewRecordWriter(&b, "ndjson")
+	assert.Nil(t, err)
+	for i := range rs {
+		assert.Nil(t, rw.Write(&rs[i]))
+	}
+	assert.Nil(t, rw.Flush())
+	return b.String()
+}
+
+// writeTestArchive writes rs into a new archive in a memory file system and opens it.
+func writeTestArchive(t *testing.T, rs []decoder.Record, blockRows int) *Archive {
+	fSys := &afero.Afero{Fs: afero.NewMemMapFs()}
+	w, err := Create(fSys, "arc", blockRows)
+	assert.Nil(t, err)
+	for i := range rs {
+		assert.Nil(t, w.Write(&rs[i]))
+	}
+	assert.Nil(t, w.Close())
+	assert.Equal(t, len(rs), w.Records())
+	_, err = Create(fSys, "arc", blockRows)
+	assert.NotNil(t, err) // not empty
+	a, err := Open(fSys, "arc")
+	assert.Nil(t, err)
+	return a
+}
+
+// TestQuery compares archive queries with the filtered original records.
+func TestQuery(t *testing.T) {
+	rs := testRecords(1000)
+	a := writeTestArchive(t, rs, 16)
+	host := func(i int) time.Time { return rs[i].Host }
+	tt := []struct {
+		where string
+		q     Query
+		sel   func(r *decoder.Record) bool
+		prune bool // prune is true, when the query must skip blocks.
+	}{
+		{"", Query{}, func(r *decoder.Record) bool { return true }, false},
+		{"", Query{IDs: []id.TriceID{10, 30}}, func(r *decoder.Record) bool { return r.ID == 10 || r.ID == 30 }, false},
+		{"", Query{IDs: []id.TriceID{0}, Channel: "err"}, func(r *decoder.Record) bool { return r.ID == 0 && r.Channel == "err" }, false},
+		{"", Query{From: host(500), To: host(520)}, func(r *decoder.Record) bool {
+			return !r.Host.Before(host(500)) && r.Host.Before(host(520))
+		}, true},
+		{"", Query{StampFrom: 100000, StampTo: 200000}, func(r *decoder.Record) bool {
+			return r.StampSize != 0 && r.Stamp >= 100000 && r.Stamp < 200000
+		}, true},
+		{"", Query{IDs: []id.TriceID{20}, StampFrom: 900 << 40}, func(r *decoder.Record) bool { return r.ID == 20 && r.Stamp >= 900<<40 }, true},
+		{"", Query{IDs: []id.TriceID{0, 30}, StampTo: 1 << 62}, func(r *decoder.Record) bool { return false }, true},
+		{"v0>=900", Query{}, func(r *decoder.Record) bool { return r.ID == 10 && r.Values[0].(uint64) >= 900 }, true},
+		{"v1<-990", Query{IDs: []id.TriceID{10}}, func(r *decoder.Record) bool { return r.ID == 10 && r.Values[1].(int64) < -990 }, true},
+		{"v0<5.5", Query{IDs: []id.TriceID{20}}, func(r *decoder.Record) bool { return r.ID == 20 && r.Values[0].(float32) < 5.5 }, true},
+		{"v1==busy,v2==true", Query{}, func(r *decoder.Record) bool {
+			return r.ID == 20 && r.Values[1] == "busy" && r.Values[2] == true
+		}, false},
+		{"v3>1400", Query{}, func(r *decoder.Record) bool { return r.ID == 20 && r.Values[3].(float64) > 1400 }, true},
+		{"v0!=3", Query{IDs: []id.TriceID{30}}, func(r *decoder.Record) bool { return false }, true},
+	}
+	for _, x := range tt {
+		q := x.q
+		var err error
+		q.Where, err = ParseWhere(x.where)
+		assert.Nil(t, err)
+		var exp, act []decoder.Record
+		for i := range rs {
+			if x.sel(&rs[i]) {
+				exp = append(exp, rs[i])
+			}
+		}
+		stats, err := a.Query(q, func(r *decoder.Record) error {
+			c := *r
+			c.Values = append([]interface{}(nil), r.Values...)
+			act = append(act, c)
+			return nil
+		})
+		assert.Nil(t, err)
+		assert.Equal(t, ndjson(t, exp), ndjson(t, act), fmt.Sprintf("%+v %s", x.q, x.where))
+		assert.Equal(t, len(exp), stats.Records)
+		if x.prune {
+			assert.True(t, stats.BlocksRead < stats.Blocks, fmt.Sprintf("%+v %s: %+v", x.q, x.where, stats))
+		}
+	}
+}
+
+// TestQueryStop checks, that an error of the record function ends the query.
+func TestQueryStop(t *testing.T) {
+	a := writeTestArchive(t, testRecords(100), 16)
+	stop := fmt.Errorf("stop")
+	var n int
+	_, err := a.Query(Query{}, func(r *decoder.Record) error {
+		n++
+		if n == 3 {
+			return stop
+		}
+		return nil
+	})
+	assert.Equal(t, stop, err)
+	assert.Equal(t, 3, n)
+}
+
+// TestParseWhere checks the condition syntax.
+func TestParseWhere(t *testing.T) {
+	p, err := ParseWhere(" v0 > 100 , v12==idle")
+	assert.Nil(t, err)
+	assert.Equal(t, 2, len(p))
+	assert.Equal(t, 0, p[0].Index)
+	assert.Equal(t, ">", p[0].Op)
+	assert.Equal(t, "100", p[0].Value)
+	assert.Equal(t, 12, p[1].Index)
+	assert.Equal(t, "==", p[1].Op)
+	assert.Equal(t, "idle", p[1].Value)
+	for _, s := range []string{"x0>1", "v>1", "v0", "v0=1", "v-1<2"} {
+		_, err := ParseWhere(s)
+		assert.NotNil(t, err, s)
+	}
+}
+
+// TestParseTime checks the time formats of the query range.
+func TestParseTime(t *testing.T) {
+	ts, err := ParseTime("")
+	assert.Nil(t, err)
+	assert.True(t, ts.IsZero())
+	ts, err = ParseTime("1700000000123456789")
+	assert.Nil(t, err)
+	assert.Equal(t, int64(1700000000123456789), ts.UnixNano())
+	ts, err = ParseTime("2023-11-14T22:13:20.5Z")
+	assert.Nil(t, err)
+	assert.Equal(t, int64(1700000000500000000), ts.UnixNano())
+	_, err = ParseTime("yesterday")
+	assert.NotNil(t, err)
+}
@@ -0,0 +1,591 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package archive
+
+// archive queries
+
+import (
+	"bytes"
+	"compress/flate"
+	"container/heap"
+	"encoding/binary"
+	"encoding/json"
+	"errors"
+	"fmt"
+	"io"
+	"math"
+	"path/filepath"
+	"sort"
+	"strconv"
+	"strings"
+	"time"
+
+	"github.com/rokath/trice/internal/decoder"
+	"github.com/rokath/trice/internal/id"
+	"github.com/spf13/afero"
+)
+
+// errCorrupt is returned for inconsistent column data.
+var errCorrupt = errors.New("inconsistent archive column data")
+
+// Archive is an opened archive.
+type Archive struct {
+	Manifest
+	fSys *afero.Afero
+	dir  string
+}
+
+// Open reads the manifest of the archive in dir.
+func Open(fSys *afero.Afero, dir string) (*Archive, error) {
+	b, err := fSys.ReadFile(filepath.Join(dir, manifestName))
+	if err != nil {
+		return nil, err
+	}
+	a := &Archive{fSys: fSys, dir: dir}
+	if err := json.Unmarshal(b, &a.Manifest); err != nil {
+		return nil, err
+	}
+	if a.Version != version {
+		return nil, fmt.Errorf("archive version %d is not supported", a.Version)
+	}
+	for _, r := range a.IDs {
+		offsets := make(map[string]int64)
+		for i := range r.Blocks {
+			b := &r.Blocks[i]
+			b.offsets = make(map[string]int64, len(b.Sizes))
+			for name, size := range b.Sizes {
+				b.offsets[name] = offsets[name]
+				offsets[name] += size
+			}
+		}
+	}
+	return a, nil
+}
+
+// Query selects records. Zero values select all.
+type Query struct {
+	IDs                []id.TriceID // IDs are the wanted IDs.
+	Channel            string       // Channel is the wanted channel like "err".
+	From, To           time.Time    // From and To are the host reception time range. To is excluded.
+	StampFrom, StampTo uint64       // StampFrom and StampTo are the target stamp range. StampTo is excluded. When set, records without stamp do not match.
+	Where              []Predicate  // Where are conditions for the values. All must match.
+}
+
+// stampRange reports, if q selects a target stamp range.
+func (q *Query) stampRange() bool {
+	return q.StampFrom != 0 || q.StampTo != 0
+}
+
+// ParseIDs parses comma separated trice IDs like "3713,935".
+func ParseIDs(s string) (ids []id.TriceID, err error) {
+	for _, f := range strings.Split(s, ",") {
+		if f = strings.TrimSpace(f); f == "" {
+			continue
+		}
+		n, err := strconv.ParseUint(f, 10, 16)
+		if err != nil {
+			return nil, fmt.Errorf("invalid ID %q", f)
+		}
+		ids = append(ids, id.TriceID(n))
+	}
+	return
+}
+
+// ParseTime parses s as RFC 3339 time or as ns since 1970. An empty s is the zero time.
+func ParseTime(s string) (time.Time, error) {
+	if s == "" {
+		return time.Time{}, nil
+	}
+	if ns, err := strconv.ParseInt(s, 10, 64); err == nil {
+		return time.Unix(0, ns), nil
+	}
+	return time.Parse(time.RFC3339Nano, s)
+}
+
+// QueryStats reports the effort of a query.
+type QueryStats struct {
+	Blocks     int   // Blocks is the block count of the selected IDs.
+	BlocksRead int   // BlocksRead is the count of blocks read after the check of the block statistics.
+	BytesRead  int64 // BytesRead is the count of read column bytes.
+	Records    int   // Records is the count of matching records.
+}
+
+// Predicate compares the value at position Index of a record with a constant.
+//
+// Numbers, bools (as 0 and 1) and strings are comparable with constants of the same kind.
+// Integers are compared exactly, other combinations as float64. A missing value does not match.
+type Predicate struct {
+	Index int    // Index is the value position, "v0" is the first value.
+	Op    string // Op is one of "==", "!=", "<", "<=", ">", ">=".
+	Value string // Value is the constant.
+
+	num bool    // num is true, if Value is a finite number.
+	f   float64 // f is Value as float64.
+	isU bool    // isU is true, if Value is an uint64.
+	u   uint64  // u is Value as uint64.
+	isI bool    // isI is true, if Value is an int64.
+	i   int64   // i is Value as int64.
+	isB bool    // isB is true, if Value is "true" or "false".
+}
+
+// ParseWhere parses comma separated conditions like "v0>100,v2==idle" into predicates.
+func ParseWhere(s string) (p []Predicate, err error) {
+	if strings.TrimSpace(s) == "" {
+		return nil, nil
+	}
+	for _, c := range strings.Split(s, ",") {
+		c = strings.TrimSpace(c)
+		i := strings.IndexAny(c, "=!<>")
+		if !strings.HasPrefix(c, "v") || i < 2 {
+			return nil, fmt.Errorf("condition %q is not like \"v0>100\"", c)
+		}
+		var x Predicate
+		if x.Index, err = strconv.Atoi(strings.TrimSpace(c[1:i])); err != nil || x.Index < 0 {
+			return nil, fmt.Errorf("condition %q has no valid value index", c)
+		}
+		for _, op := range []string{"==", "!=", "<=", ">=", "<", ">"} {
+			if strings.HasPrefix(c[i:], op) {
+				x.Op = op
+				break
+			}
+		}
+		if x.Op == "" {
+			return nil, fmt.Errorf("condition %q has no valid operator", c)
+		}
+		x.Value = strings.TrimSpace(c[i+len(x.Op):])
+		x.parse()
+		p = append(p, x)
+	}
+	return
+}
+
+// parse evaluates p.Value.
+func (p *Predicate) parse() {
+	switch p.Value {
+	case "true":
+		p.num, p.f, p.isU, p.u, p.isI, p.i, p.isB = true, 1, true, 1, true, 1, true
+		return
+	case "false":
+		p.num, p.isU, p.isI, p.isB = true, true, true, true
+		return
+	}
+	f, err := strconv.ParseFloat(p.Value, 64)
+	p.num = err == nil && !math.IsInf(f, 0) && !math.IsNaN(f)
+	p.f = f
+	p.u, err = strconv.ParseUint(p.Value, 0, 64)
+	p.isU = err == nil
+	p.i, err = strconv.ParseInt(p.Value, 0, 64)
+	p.isI = err == nil
+	if (p.isU || p.isI) && !p.num { // like 0x10
+		p.num = true
+		if p.isU {
+			p.f = float64(p.u)
+		} else {
+			p.f = float64(p.i)
+		}
+	}
+}
+
+// compare returns -1, 0 or 1 for v less, equal or greater than the constant and false, when not comparable.
+func (p *Predicate) compare(v interface{}) (int, bool) {
+	switch x := v.(type) {
+	case string:
+		if p.num && !p.isB {
+			return 0, false
+		}
+		return strings.Compare(x, p.Value), true
+	case bool:
+		if x {
+			v = uint64(1)
+		} else {
+			v = uint64(0)
+		}
+	}
+	if !p.num {
+		return 0, false
+	}
+	switch x := v.(type) {
+	case uint64:
+		if p.isU {
+			return compareOrdered(x, p.u), true
+		}
+		if p.isI { // negative constant
+			return 1, true
+		}
+	case int64:
+		if p.isI {
+			return compareOrdered(x, p.i), true
+		}
+		if p.isU { // constant above int64 range
+			return -1, true
+		}
+	}
+	f, ok := numeric(v)
+	if !ok || math.IsNaN(f) {
+		return 0, false
+	}
+	return compareOrdered(f, p.f), true
+}
+
+// compareOrdered returns -1, 0 or 1 for a less, equal or greater than b.
+func compareOrdered[T uint64 | int64 | float64](a, b T) int {
+	switch {
+	case a < b:
+		return -1
+	case a > b:
+		return 1
+	}
+	return 0
+}
+
+// Match reports, if the values v fulfill p.
+func (p *Predicate) Match(v []interface{}) bool {
+	if p.Index >= len(v) {
+		return false
+	}
+	c, ok := p.compare(v[p.Index])
+	if !ok {
+		return p.Op == "!="
+	}
+	switch p.Op {
+	case "==":
+		return c == 0
+	case "!=":
+		return c != 0
+	case "<":
+		return c < 0
+	case "<=":
+		return c <= 0
+	case ">":
+		return c > 0
+	}
+	return c >= 0
+}
+
+// mayMatch reports, if the block b can contain values fulfilling p according to the block statistics.
+// Because float64 rounding is monotonic, the float64 ranges never exclude a matching integer.
+func (p *Predicate) mayMatch(b *Block) bool {
+	if p.Index >= len(b.Values) { // no record has this value
+		return false
+	}
+	if !p.num || p.Op == "!=" {
+		return true
+	}
+	r := b.Values[p.Index]
+	if !r.Numeric {
+		return p.isB // strings "true" and "false"
+	}
+	switch p.Op {
+	case "==":
+		return r.Min <= p.f && p.f <= r.Max
+	case "<", "<=":
+		return r.Min <= p.f
+	}
+	return r.Max >= p.f // ">", ">="
+}
+
+// mayMatch reports, if the block b can contain records for q according to the block statistics.
+func (q *Query) mayMatch(b *Block) bool {
+	if !q.From.IsZero() && b.HostMax < q.From.UnixNano() {
+		return false
+	}
+	if !q.To.IsZero() && b.HostMin >= q.To.UnixNano() {
+		return false
+	}
+	if q.stampRange() && (b.StampSize == 0 || b.StampMax < q.StampFrom || q.StampTo != 0 && b.StampMin >= q.StampTo) {
+		return false
+	}
+	if q.Channel != "" {
+		found := false
+		for _, c := range b.Channels {
+			found = found || c == q.Channel
+		}
+		if !found {
+			return false
+		}
+	}
+	for i := range q.Where {
+		if !q.Where[i].mayMatch(b) {
+			return false
+		}
+	}
+	return true
+}
+
+// match reports, if r is a record for q.
+func (q *Query) match(r *decoder.Record) bool {
+	if !q.From.IsZero() && r.Host.Before(q.From) {
+		return false
+	}
+	if !q.To.IsZero() && !r.Host.Before(q.To) {
+		return false
+	}
+	if q.stampRange() && (r.StampSize == 0 || r.Stamp < q.StampFrom || q.StampTo != 0 && r.Stamp >= q.StampTo) {
+		return false
+	}
+	if q.Channel != "" && r.Channel != q.Channel {
+		return false
+	}
+	for i := range q.Where {
+		if !q.Where[i].Match(r.Values) {
+			return false
+		}
+	}
+	return true
+}
+
+// Query calls fn for each record matching q in the original record order and returns the effort.
+// The record passed to fn is valid only during the call.
+func (a *Archive) Query(q Query, fn func(*decoder.Record) error) (stats QueryStats, err error) {
+	q.Channel = strings.ToLower(q.Channel)
+	tids := q.IDs
+	if len(tids) == 0 {
+		for tid := range a.IDs {
+			tids = append(tids, tid)
+		}
+		sort.Slice(tids, func(i, j int) bool { return tids[i] < tids[j] })
+	}
+	var h iteratorHeap
+	for _, tid := range tids {
+		r, ok := a.IDs[tid]
+		if !ok {
+			continue
+		}
+		it := &iterator{a: a, q: &q, tid: tid, records: r, stats: &stats}
+		for i := range r.Blocks {
+			stats.Blocks++
+			if q.mayMatch(&r.Blocks[i]) {
+				it.blocks = append(it.blocks, &r.Blocks[i])
+			}
+		}
+		if ok, err := it.next(); err != nil {
+			return stats, err
+		} else if ok {
+			h = append(h, it)
+		}
+	}
+	heap.Init(&h)
+	for len(h) > 0 {
+		it := h[0]
+		stats.Records++
+		if err := fn(&it.rows[it.i].Record); err != nil {
+			return stats, err
+		}
+		if ok, err := it.next(); err != nil {
+			return stats, err
+		} else if ok {
+			heap.Fix(&h, 0)
+		} else {
+			heap.Pop(&h)
+		}
+	}
+	return stats, nil
+}
+
+// row is a decoded record with its sequence number.
+type row struct {
+	decoder.Record
+	seq uint64
+}
+
+// iterator walks through the matching records of one ID.
+type iterator struct {
+	a       *Archive
+	q       *Query
+	tid     id.TriceID
+	records *IDRecords
+	blocks  []*Block // blocks are the not yet read blocks, which can contain matching records.
+	rows    []row    // rows are the records of the actual block.
+	i       int      // i is the actual row, -1 before the first.
+	stats   *QueryStats
+}
+
+// next moves to the next matching record and returns false at the end.
+func (it *iterator) next() (bool, error) {
+	for {
+		for it.i++; it.i < len(it.rows); it.i++ {
+			if it.q.match(&it.rows[it.i].Record) {
+				return true, nil
+			}
+		}
+		if len(it.blocks) == 0 {
+			return false, nil
+		}
+		var err error
+		if it.rows, err = it.read(it.blocks[0]); err != nil {
+			return false, err
+		}
+		it.blocks = it.blocks[1:]
+		it.i = -1
+	}
+}
+
+// column reads the column name of block b.
+func (it *iterator) column(b *Block, name string) ([]byte, error) {
+	size := b.Sizes[name]
+	if size == 0 {
+		return nil, nil
+	}
+	f, err := it.a.fSys.Open(filepath.Join(it.a.dir, strconv.Itoa(int(it.tid)), name+".col"))
+	if err != nil {
+		return nil, err
+	}
+	defer f.Close()
+	data := make([]byte, size)
+	if _, err := f.ReadAt(data, b.offsets[name]); err != nil {
+		return nil, err
+	}
+	it.stats.BytesRead += size
+	return data, nil
+}
+
+// read decodes the records of block b.
+func (it *iterator) read(b *Block) ([]row, error) {
+	it.stats.BlocksRead++
+	var c [6][]byte
+	for i, name := range []string{"seq", "host", "stamp", "chan", "n", "msg"} {
+		var err error
+		if c[i], err = it.column(b, name); err != nil {
+			return nil, err
+		}
+	}
+	msgs, err := io.ReadAll(flate.NewReader(bytes.NewReader(c[5])))
+	if err != nil {
+		return nil, err
+	}
+	seq, host, stamp, chans, n, msg := columnReader{b: c[0]}, columnReader{b: c[1]}, columnReader{b: c[2]}, columnReader{b: c[3]}, columnReader{b: c[4]}, columnReader{b: msgs}
+	values := make([]columnReader, len(b.Values))
+	for i := range values {
+		if values[i].b, err = it.column(b, valueColumn(i)); err != nil {
+			return nil, err
+		}
+	}
+
+	rows := make([]row, b.Records)
+	var lastSeq, lastStamp uint64
+	var lastHost int64
+	for i := range rows {
+		r := &rows[i]
+		lastSeq += seq.uvarint()
+		lastHost += host.varint()
+		r.seq = lastSeq
+		r.ID = it.tid
+		r.Host = time.Unix(0, lastHost)
+		r.File, r.Line = it.records.File, it.records.Line
+		if b.StampSize != 0 {
+			lastStamp += uint64(stamp.varint())
+			r.StampSize, r.Stamp = b.StampSize, lastStamp
+		}
+		if ch := chans.uvarint(); ch < uint64(len(b.Channels)) {
+			r.Channel = b.Channels[ch]
+		} else {
+			chans.err = errCorrupt
+		}
+		count := n.uvarint()
+		if count > uint64(len(values)) {
+			return nil, errCorrupt
+		}
+		if count > 0 {
+			r.Values = make([]interface{}, count)
+			for k := range r.Values {
+				r.Values[k] = values[k].value()
+			}
+		}
+		r.Msg = msg.string()
+	}
+	for _, x := range append(values, seq, host, stamp, chans, n, msg) {
+		if x.err != nil || len(x.b) != 0 {
+			return nil, errCorrupt
+		}
+	}
+	return rows, nil
+}
+
+// columnReader consumes column data. After the first error all results are zero.
+type columnReader struct {
+	b   []byte
+	err error
+}
+
+func (d *columnReader) uvarint() uint64 {
+	v, n := binary.Uvarint(d.b)
+	if n <= 0 {
+		d.err = errCorrupt
+		return 0
+	}
+	d.b = d.b[n:]
+	return v
+}
+
+func (d *columnReader) varint() int64 {
+	v, n := binary.Varint(d.b)
+	if n <= 0 {
+		d.err = errCorrupt
+		return 0
+	}
+	d.b = d.b[n:]
+	return v
+}
+
+func (d *columnReader) bytes(n uint64) []byte {
+	if n > uint64(len(d.b)) {
+		d.err = errCorrupt
+		d.b = nil
+		return nil
+	}
+	b := d.b[:n]
+	d.b = d.b[n:]
+	return b
+}
+
+func (d *columnReader) string() string {
+	return string(d.bytes(d.uvarint()))
+}
+
+// value reads a value written by appendValue.
+func (d *columnReader) value() interface{} {
+	kind := d.bytes(1)
+	if kind == nil {
+		return nil
+	}
+	switch kind[0] {
+	case 'u':
+		return d.uvarint()
+	case 'i':
+		return d.varint()
+	case 'g':
+		if b := d.bytes(4); b != nil {
+			return math.Float32frombits(binary.LittleEndian.Uint32(b))
+		}
+	case 'f':
+		if b := d.bytes(8); b != nil {
+			return math.Float64frombits(binary.LittleEndian.Uint64(b))
+		}
+	case 'b':
+		if b := d.bytes(1); b != nil {
+			return b[0] != 0
+		}
+	case 's':
+		return d.string()
+	default:
+		d.err = errCorrupt
+	}
+	return nil
+}
+
+// iteratorHeap orders the iterators by the sequence number of their actual record.
+type iteratorHeap []*iterator
+
+func (h iteratorHeap) Len() int { return len(h) }
+func (h iteratorHeap) Less(i, j int) bool {
+	return h[i].rows[h[i].i].seq < h[j].rows[h[j].i].seq
+}
+func (h iteratorHeap) Swap(i, j int)       { h[i], h[j] = h[j], h[i] }
+func (h *iteratorHeap) Push(x interface{}) { *h = append(*h, x.(*iterator)) }
+func (h *iteratorHeap) Pop() interface{} {
+	old := *h
+	x := old[len(old)-1]
+	*h = old[:len(old)-1]
+	return x
+}
@@ -10,9 +10,9 @@ import (
 	"fmt"
 	"io"
 	"os"
-	"sync"
 	"time"
 
+	"github.com/rokath/trice/internal/archive"
 	"github.com/rokath/trice/internal/com"
 	"github.com/rokath/trice/internal/decoder"
 	"github.com/rokath/trice/internal/do"
@@ -98,6 +98,10 @@ func Handler(w io.Writer, fSys *afero.Afero, args []string) error {
 	//  	msg.OnErr(fsScClean.Parse(subArgs))
 	//  	w = do.DistributeArgs(w, fSys, logfileName, verbose)
 	//  	return id.ScIdClean(w, fSys, fsScZero)
+	case "g", "generate":
+		msg.OnErr(fsScGenerate.Parse(subArgs))
+		w = do.DistributeArgs(w, fSys, logfileName, verbose)
+		return id.SubCmdGenerate(w, fSys)
 	case "sd", "shutdown":
 		msg.OnErr(fsScSdSv.Parse(subArgs))
 		w = do.DistributeArgs(w, fSys, logfileName, verbose)
@@ -106,10 +110,19 @@ func Handler(w io.Writer, fSys *afero.Afero, args []string) error {
 		msg.OnErr(fsScSv.Parse(subArgs))
 		w = do.DistributeArgs(w, fSys, logfileName, verbose)
 		return emitter.ScDisplayServer(w) // endless loop
+	case "archive":
+		msg.OnErr(fsScArchive.Parse(subArgs))
+		w = do.DistributeArgs(w, fSys, logfileName, verbose)
+		return scArchive(w, fSys)
+	case "query":
+		msg.OnErr(fsScQuery.Parse(subArgs))
+		w = do.DistributeArgs(w, fSys, logfileName, verbose)
+		return scQuery(w, fSys)
 	case "l", "log":
 		id.Logging = true
 		msg.OnErr(fsScLog.Parse(subArgs))
 		decoder.TargetTimeStampUnitPassed = isLogFlagPassed("ts")
+		decoder.ShowTargetStamp64Passed = isLogFlagPassed("ts64")
 		decoder.ShowTargetStamp32Passed = isLogFlagPassed("ts32")
 		decoder.ShowTargetStamp16Passed = isLogFlagPassed("ts16")
 		decoder.ShowTargetStamp0Passed = isLogFlagPassed("ts0")
@@ -162,13 +175,15 @@ func logLoop(w io.Writer, fSys *afero.Afero) {
 	} else {
 		ilu = id.NewLut(w, fSys, id.FnJSON) // lut is a map, that means a pointer
 	}
-	m := new(sync.RWMutex) // m is a pointer to a read write mutex for lu
-	m.Lock()
 	ilu.AddFmtCount(w)
-	m.Unlock()
-	// Just in case the id list file FnJSON gets updated, the file watcher updates lut.
+	lut := id.NewLutSnapshot(ilu) // the decoders read lut without locks
+	// Just in case the id list file FnJSON gets updated, the file watcher replaces the lut snapshot.
 	// This way trice needs NOT to be restarted during development process.
-	////////////////////////////////////////// go ilu.FileWatcher(w, fSys, m)
+	// A predefined buffer ends anyway and a memory file system has no change notifications.
+	if _, osFs := fSys.Fs.(*afero.OsFs); osFs && id.FnJSON != "emptyFile" && receiver.Port != "BUFFER" {
+		stop := lut.FileWatcher(w, fSys, id.FnJSON)
+		defer stop()
+	}
 
 	var li id.TriceIDLookUpLI // nil
 
@@ -214,13 +229,68 @@ func logLoop(w io.Writer, fSys *afero.Afero) {
 		if receiver.BinaryLogfileName != "off" && receiver.BinaryLogfileName != "none" {
 			rwc = receiver.NewBinaryLogger(w, fSys, rwc)
 		}
-		e = translator.Translate(w, sw, ilu, m, li, rwc)
+		e = translator.Translate(w, sw, lut, li, rwc)
 		if io.EOF == e {
 			return // end of predefined buffer
 		}
 	}
 }
 
+// scArchive is sub-command 'archive'. It decodes the binary capture file captureName into the archive archive.Dir.
+func scArchive(w io.Writer, fSys *afero.Afero) error {
+	aw, err := archive.Create(fSys, archive.Dir, archive.BlockRows)
+	if err != nil {
+		return err
+	}
+	receiver.Port = "FILEBUFFER"
+	receiver.PortArguments = captureName
+	translator.Encoding = "TREX"
+	decoder.LogFormat = "archive"
+	translator.Records = aw
+	logLoop(w, fSys)
+	translator.Records = nil
+	if err := aw.Close(); err != nil {
+		return err
+	}
+	fmt.Fprintln(w, aw.Records(), "records archived into", archive.Dir)
+	return nil
+}
+
+// scQuery is sub-command 'query'. It writes the selected records of the archive archive.Dir in the format queryFormat.
+func scQuery(w io.Writer, fSys *afero.Afero) (err error) {
+	var q archive.Query
+	q.Channel = queryChannel
+	if q.IDs, err = archive.ParseIDs(queryIDs); err != nil {
+		return err
+	}
+	if q.From, err = archive.ParseTime(queryFrom); err != nil {
+		return err
+	}
+	if q.To, err = archive.ParseTime(queryTo); err != nil {
+		return err
+	}
+	q.StampFrom, q.StampTo = queryStampFrom, queryStampTo
+	if q.Where, err = archive.ParseWhere(queryWhere); err != nil {
+		return err
+	}
+	rw, err := decoder.NewRecordWriter(w, queryFormat)
+	if err != nil {
+		return err
+	}
+	a, err := archive.Open(fSys, archive.Dir)
+	if err != nil {
+		return err
+	}
+	stats, err := a.Query(q, rw.Write)
+	if e := rw.Flush(); err == nil {
+		err = e
+	}
+	if verbose {
+		fmt.Fprintf(w, "%d records, %d of %d blocks read, %d bytes\n", stats.Records, stats.BlocksRead, stats.Blocks, stats.BytesRead)
+	}
+	return err
+}
+
 // scVersion is sub-command 'version'. It prints version information.
 func scVersion(w io.Writer) error {
 	if verbose {
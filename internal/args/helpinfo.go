@@ -33,6 +33,9 @@ func scHelp(w io.Writer) error {
 		{allHelp || insertIDsHelp, insertIDsInfo},
 		{allHelp || zeroIDsHelp, zeroIDsInfo},
 		{allHelp || cleanIDsHelp, cleanIDsInfo},
+		{allHelp || generateHelp, generateInfo},
+		{allHelp || archiveHelp, archiveInfo},
+		{allHelp || queryHelp, queryInfo},
 	}
 	for _, z := range x {
 		if z.flag {
@@ -186,3 +189,32 @@ func renewInfo(w io.Writer) error {
 	fsScRenew.PrintDefaults()
 	return e
 }
+
+func generateInfo(w io.Writer) error {
+	_, e := fmt.Fprintln(w, `sub-command 'g|generate': Generate C code for trice macros with more than 12 values.
+#	"trice generate" writes the files triceMaxParams.h and triceMaxParams.c with the trice macros and functions for 13 up to max values.
+#	Copy them into your project next to trice.h and set TRICE_MAX_PARAM_COUNT inside triceConfig.h to a value up to max.
+#	Example: 'trice g -max 16 -dst ./src': Generate C code for trice macros with up to 16 values into the ./src folder.`)
+	fsScGenerate.SetOutput(w)
+	fsScGenerate.PrintDefaults()
+	return e
+}
+
+func archiveInfo(w io.Writer) error {
+	_, e := fmt.Fprintln(w, `sub-command 'archive': Decode a binary trice capture once into a column wise archive for fast queries with "trice query".
+#	Each trice ID gets its own column files for host times, target stamps, channels, values and messages in blocks.
+#	A manifest keeps the time and value ranges of each block, so a query reads only the blocks it needs.
+#	Example: 'trice archive -capture trice.bin -archive ./trice.archive': Archive the trices inside trice.bin.`)
+	fsScArchive.SetOutput(w)
+	fsScArchive.PrintDefaults()
+	return e
+}
+
+func queryInfo(w io.Writer) error {
+	_, e := fmt.Fprintln(w, `sub-command 'query': Select records from an archive written by "trice archive" and print them as NDJSON or binary records.
+#	Example: 'trice query -id 3713 -from 2024-01-02T15:00:00Z -where "v0>100"': Show all records of ID 3713 after 15:00 UTC with a first value above 100.
+#	Example: 'trice query -stampFrom 1000000 -stampTo 2000000': Show all records with target stamps from 1000000 to 1999999.`)
+	fsScQuery.SetOutput(w)
+	fsScQuery.PrintDefaults()
+	return e
+}
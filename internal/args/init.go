@@ -7,11 +7,13 @@ import (
 	"flag"
 	"fmt"
 
+	"github.com/rokath/trice/internal/archive"
 	"github.com/rokath/trice/internal/com"
 	"github.com/rokath/trice/internal/decoder"
 	"github.com/rokath/trice/internal/do"
 	"github.com/rokath/trice/internal/emitter"
 	"github.com/rokath/trice/internal/id"
+	"github.com/rokath/trice/internal/link"
 	"github.com/rokath/trice/internal/receiver"
 	"github.com/rokath/trice/internal/translator"
 	"github.com/rokath/trice/internal/trexDecoder"
@@ -49,6 +51,9 @@ func FlagsInit() {
 	zeroInit()
 	insertIDsInit()
 	cleanIDsInit()
+	generateInit()
+	archiveInit()
+	queryInit()
 	versionInit()
 	dsInit()
 	scanInit()
@@ -81,6 +86,10 @@ func helpInit() {
 	fsScHelp.BoolVar(&zeroIDsHelp, "z", false, "Show zeroSourceTreeIds specific help.")
 	fsScHelp.BoolVar(&cleanIDsHelp, "cleanSourceTreeIds", false, "Show cleanSourceTreeIds specific help.")
 	fsScHelp.BoolVar(&cleanIDsHelp, "c", false, "Show cleanSourceTreeIds specific help.")
+	fsScHelp.BoolVar(&generateHelp, "generate", false, "Show g|generate specific help.")
+	fsScHelp.BoolVar(&generateHelp, "g", false, "Show g|generate specific help.")
+	fsScHelp.BoolVar(&archiveHelp, "archive", false, "Show archive specific help.")
+	fsScHelp.BoolVar(&queryHelp, "query", false, "Show query specific help.")
 	flagLogfile(fsScHelp)
 	flagVerbosity(fsScHelp)
 }
@@ -105,6 +114,7 @@ Encryption is recommended if you deliver firmware to customers and want protect
 	fsScLog.BoolVar(&cipher.ShowKey, "showKey", false, `Show encryption key. Use this switch for creating your own password keys. If applied together with "-password MySecret" it shows the encryption key.
 Simply copy this key than into the line "#define ENCRYPT XTEA_KEY( ea, bb, ec, 6f, 31, 80, 4e, b9, 68, e2, fa, ea, ae, f1, 50, 54 ); //!< -password MySecret" inside triceConfig.h.
 `+boolInfo)
+	fsScLog.StringVar(&decoder.LogFormat, "logFormat", "text", `Log output format, options: "text" for the human readable lines, "ndjson" for one JSON object per trice with id, host and target stamp, channel, location, typed values and message, "binary" for length prefixed binary records (see decoder.ReadRecord). The structured formats need the TREX encoding and skip colors, prefixes and the display server.`)
 	fsScLog.StringVar(&emitter.LogLevel, "logLevel", "all", `Level based log filtering. "off" suppresses everything. If equal to a channel specifier all with a bigger index inside emitter.ColorChannels is not shown.`)
 	fsScLog.StringVar(&id.DefaultTriceBitWidth, "defaultTRICEBitwidth", "32", `The expected value bit width for TRICE macros. Options: 8, 16, 32, 64. Must be in sync with the 'TRICE_DEFAULT_PARAMETER_BIT_WIDTH' setting inside triceConfig.h`)
 	fsScLog.StringVar(&emitter.HostStamp, "hs", "LOCmicro",
@@ -113,9 +123,15 @@ This timestamp switch generates the timestamps on the PC only (reception time),
 "LOCmicro" means local time with microseconds. "UTCmicro" shows timestamps in universal time. When set to "off" no PC timestamps displayed.`) // flag
 	fsScLog.StringVar(&decoder.ShowID, "showID", "", `Format string for displaying first trice ID at start of each line. Example: "debug:%7d ". Default is "". If several trices form a log line only the first trice ID ist displayed.`)
 	fsScLog.StringVar(&decoder.LocationInformationFormatString, "liFmt", "info:%21s %5d ", `Target location format string at start of each line, if target location existent (configured). Use "off" or "none" to suppress existing target location. If several trices form a log line only the location of first trice ist displayed.`)
-	fsScLog.StringVar(&decoder.TargetStamp, "ts", "µs", `Target timestamp general format string at start of each line, if target timestamps existent (configured). Choose between "µs" (or "us") and "ms", use "" or 'off' or 'none' to suppress existing target timestamps. Sets ts0, ts16, ts32 if these not passed. If several trices form a log line only the timestamp of first trice ist displayed.`)
+	fsScLog.StringVar(&decoder.TargetStamp, "ts", "µs", `Target timestamp general format string at start of each line, if target timestamps existent (configured). Choose between "µs" (or "us") and "ms", use "" or 'off' or 'none' to suppress existing target timestamps. Sets ts0, ts16, ts32, ts64 if these not passed. If several trices form a log line only the timestamp of first trice ist displayed.`)
+	fsScLog.StringVar(&decoder.TargetStamp64, "ts64", "us", `64-bit Target stamp format string at start of each line, if 64-bit target stamps existent (configured). Choose between "µs" (or "us") and "ms", use "" to suppress or use s.th. like "...%d...". If several trices form a log line only the timestamp of first trice ist displayed. Only when this switch is passed, trices with the extended X0 type bits are decoded as trices with 64-bit stamps (target TRICE_STAMP64 == 1), otherwise they are not supported and get discarded.`)
 	fsScLog.StringVar(&decoder.TargetStamp32, "ts32", "ms", `32-bit Target stamp format string at start of each line, if 32-bit target stamps existent (configured). Choose between "µs" (or "us") and "ms", use "" to suppress or use s.th. like "...%d...". If several trices form a log line only the timestamp of first trice ist displayed.`)
 	fsScLog.StringVar(&decoder.TargetStamp16, "ts16", "ms", `16-bit Target stamp format string at start of each line, if 16-bit target stamps existent (configured). Choose between "µs" (or "us") and "ms", use "" to suppress or use s.th. like "...%d...". If several trices form a log line only the timestamp of first trice ist displayed.`)
+	fsScLog.BoolVar(&decoder.TargetStampAbsolute, "tsAbs", false, `Display target stamps as absolute host times. The 16- and 32-bit target stamps are unwrapped into a 64-bit timeline and a running linear fit against the host reception times corrects the target clock drift. The ts16, ts32 and ts64 values "ms" or "us" select the nominal target tick. `+boolInfo)
+	fsScLog.StringVar(&decoder.CoreFormat, "coreFormat", "core%d ", `Core format string at start of each line, if the target transmits core tags (TRICE_CORE_COUNT > 1). Use "off" or "none" to suppress the core display.`)
+	fsScLog.BoolVar(&decoder.CoreSort, "coreSort", false, `Sort the trices of different target cores by their timestamps. Each core needs increasing stamps. Pending trices are released, when all cores delivered later stamps, when the input ends or after -coreSortHold. Needs package framing. `+boolInfo)
+	fsScLog.DurationVar(&decoder.CoreSortHold, "coreSortHold", decoder.CoreSortHold, `Max time like "200ms", a trice waits with -coreSort for later stamps of the other cores, before it is released anyway.`)
+	fsScLog.StringVar(&decoder.PayloadCodec, "payloadCodec", "none", `Target payload encoding (TRICE_PAYLOAD_CODEC). Use "varint" for TRICE_CODEC_VARINT or "delta" for TRICE_CODEC_DELTA. The delta decoding needs all trices since the target start or since a TriceCodecReset call. Needs package framing.`)
 	fsScLog.StringVar(&decoder.TargetStamp0, "ts0", translator.DefaultTargetStamp0, `Target stamp format string at start of each line, if no target stamps existent (configured). Use "" to suppress existing target timestamps. If several trices form a log line only the timestamp of first trice ist displayed.`)
 	fsScLog.BoolVar(&decoder.DebugOut, "debug", false, "Show additional debug information")
 	fsScLog.StringVar(&translator.TriceEndianness, "triceEndianness", "littleEndian", `Target endianness trice data stream. Option: "bigEndian".`)
@@ -135,6 +151,10 @@ It is the only setup parameter. The other values default to 8N1 (8 data bits, no
 	fsScLog.IntVar(&com.DataBits, "databits", 8, `Set the serial port databits, options: 7, 9`)
 	fsScLog.StringVar(&com.Parity, "parity", "none", `Serial port bit parity value, options: odd, even`) // flag
 	fsScLog.StringVar(&com.StopBits, "stopbits", "1", `Serial port stopbit, options: 1.5, 2`)            // flag
+	fsScLog.IntVar(&com.ReadBufferSize, "comBuffer", 4096, `Serial port user space read buffer size in bytes. Bigger buffers take more received bytes in one system call.`)
+	fsScLog.DurationVar(&com.ReadTimeout, "comTimeout", 0, `Serial port read timeout like "10ms", similar to VTIME. A read returns after this time without received bytes. 0 waits for bytes.`)
+	fsScLog.BoolVar(&com.LowLatency, "comLowLatency", false, `Set the serial driver low latency flag (ASYNC_LOW_LATENCY, Linux only). The driver then passes received bytes immediately. `+boolInfo)
+	fsScLog.BoolVar(&com.Reader, "comReader", false, `Read the serial port in a dedicated goroutine into -comBuffer sized buffers, which avoids overruns at high baud rates during slow output. Each read gets a reception timestamp, used by -tsAbs. `+boolInfo)
 	linkArgsInfo := `
 	The -RTTSearchRanges "..." need to be written without "" and with _ instead of space.
 	For args options see JLinkRTTLogger in SEGGER UM08001_JLink.pdf.`
@@ -153,7 +173,10 @@ port "TCP4": default="`, receiver.DefaultTCP4Args, `", use any IP:port endpoint
 	execInfo := fmt.Sprint(`Use to pass an additional command line for port TCP4 (like gdbserver start).`)
 
 	fsScLog.StringVar(&receiver.PortArguments, "args", "default", argsInfo)
-	fsScLog.StringVar(&do.TCPOutAddr, "tcp", "", `TCP address for an external log receiver like Putty. Example: 1st: "trice log -p COM1 -tcp localhost:64000", 2nd "putty". In "Terminal" enable "Implicit CR in every LF", In "Session" Connection type:"Other:Telnet", specify "hostname:port" here like "localhost:64000".`)
+	fsScLog.StringVar(&do.TCPOutAddr, "tcp", "", `TCP address for an external log receiver like Putty. Example: 1st: "trice log -p COM1 -tcp localhost:64000", 2nd "putty". In "Terminal" enable "Implicit CR in every LF", In "Session" Connection type:"Other:Telnet", specify "hostname:port" here like "localhost:64000". Any number of clients can connect at any time.`)
+	fsScLog.IntVar(&do.TCPQueueSize, "tcpQueue", 1000, `Line count, a TCP client can lag behind, before -tcpDrop applies. A slow client never slows down the trice output.`)
+	fsScLog.StringVar(&do.TCPDropPolicy, "tcpDrop", "oldest", `Drop policy for a TCP client lagging -tcpQueue lines behind, options: "oldest" drops the oldest queued line, "newest" drops the new line, "disconnect" closes the client connection.`)
+	fsScLog.IntVar(&do.TCPReplay, "tcpReplay", 0, `Count of last lines, each new TCP client gets first.`)
 	fsScLog.BoolVar(&emitter.DisplayRemote, "displayserver", false, `Send trice lines to displayserver @ ipa:ipp.
 Example: "trice l -port COM38 -ds -ipa 192.168.178.44" sends trice output to a previously started display server in the same network.`)
 	fsScLog.BoolVar(&emitter.DisplayRemote, "ds", false, "Short for '-displayserver'.")
@@ -161,6 +184,8 @@ Example: "trice l -port COM38 -ds -ipa 192.168.178.44" sends trice output to a p
 	fsScLog.BoolVar(&trexDecoder.Doubled16BitID, "d16", false, "Short for '-Doubled16BitID'.")
 
 	fsScLog.StringVar(&receiver.ExecCommand, "exec", "", execInfo)
+	fsScLog.StringVar(&link.Logger, "rttLogger", "", `RTT logger executable for port "J-LINK" or "ST-LINK". Default is "JLinkRTTLogger" or "stRttLogger" found in the path.`)
+	fsScLog.StringVar(&link.Transfer, "rttTransfer", "file", `Transfer of the RTT logger data for port "J-LINK" or "ST-LINK", options: "file" reads a growing temporary binary logfile inside ./temp, "fifo" reads a named pipe blocking with lower latency and without disk usage (not on Windows).`)
 
 	//  	fsScLog.BoolVar(&emitter.Autostart, "autostart", false, `Autostart displayserver @ ipa:ipp.
 	//  Works not perfect with windows, because of cmd and powershell color issues and missing cli params in wt and gitbash.
@@ -184,6 +209,15 @@ Example: "trice l -port COM38 -ds -ipa 192.168.178.44" sends trice output to a p
 Example: "-ban dbg:wrn -ban diag" results in suppressing all as debug, diag and warning tagged messages. Not usable in conjunction with "-pick".`) // multi flag
 	fsScLog.Var(&emitter.Pick, "pick", `Channel(s) to display. This is a multi-flag switch. It can be used several times with a colon separated list of channel descriptors only to display.
 Example: "-pick err:wrn -pick default" results in suppressing all messages despite of as error, warning and default tagged messages. Not usable in conjunction with "-ban".`) // multi flag
+	fsScLog.Var(&emitter.Include, "include", `Text to display. This is a multi-flag switch. It can be used several times with one text each.
+Only trice messages containing at least one of the texts are displayed. The texts are searched case sensitive inside the message including the channel like "err:".
+Example: "-include sensor -include err:" results in displaying only messages containing "sensor" or starting with "err:".`) // multi flag
+	fsScLog.Var(&emitter.Exclude, "exclude", `Text to ignore. This is a multi-flag switch. It can be used several times with one text each.
+Trice messages containing one of the texts are not displayed. Usable in conjunction with "-include".`) // multi flag
+	fsScLog.Var(&decoder.BanIDs, "banID", `Trice IDs to ignore. This is a multi-flag switch. It can be used several times with a comma separated list of IDs and ID ranges.
+The trices with these IDs are skipped by the decoder without formatting. Example: "-banID 100,200-299".`) // multi flag
+	fsScLog.Var(&decoder.PickIDs, "pickID", `Trice IDs to display. This is a multi-flag switch. It can be used several times with a comma separated list of IDs and ID ranges.
+All trices with other IDs are skipped by the decoder without formatting. Example: "-pickID 100,200-299". Usable in conjunction with "-banID".`) // multi flag
 	fsScLog.StringVar(&decoder.PackageFraming, "packageFraming", "TCOBSv1", `Use "none" or "COBS" as alternative. "COBS" needs "#define TRICE_FRAMING TRICE_FRAMING_COBS" inside "triceConfig.h".`)
 	fsScLog.StringVar(&decoder.PackageFraming, "pf", "TCOBSv1", "Short for '-packageFraming'.")
 }
@@ -220,6 +254,7 @@ func insertIDsInit() {
 	fsScInsert.IntVar(&id.DefaultStampSize, "defaultStampSize", 32, "Default stamp size for written TRICE macros without id(0), Id(0 or ID(0). Valid values are 0, 16 or 32.")
 	fsScInsert.StringVar(&id.SearchMethod, "IDMethod", "random", "Search method for new ID's in range- Options are 'upward', 'downward' & 'random'.")
 	fsScInsert.BoolVar(&id.ExtendMacrosWithParamCount, "addParamCount", false, "Extend TRICE macro names with the parameter count _n to enable compile time checks.")
+	fsScInsert.BoolVar(&id.InlineStrings, "inlineStrings", false, "Move string literal values of TRICE_S statements into the format strings.\nExample: 'TRICE_S( ID(7), \"msg:%s\\n\", \"Hello\" )' gets 'TRICE( ID(n), \"msg:Hello\\n\" )'.\nThis way constant strings are only inside til.json and not transmitted anymore.")
 }
 
 func zeroInit() {
@@ -232,6 +267,47 @@ func cleanIDsInit() {
 	flagsRefreshAndUpdate(fsScClean)
 }
 
+func generateInit() {
+	fsScGenerate = flag.NewFlagSet("generate", flag.ExitOnError) // sub-command
+	flagDryRun(fsScGenerate)
+	flagVerbosity(fsScGenerate)
+	fsScGenerate.IntVar(&id.GenerateMaxParamCount, "max", id.MaxParamCount, "Biggest value count for the generated trice macros. Valid values are 13 up to the default value.")
+	fsScGenerate.StringVar(&id.GenerateDir, "dst", id.GenerateDir, "Destination folder for the generated C files, usually the trice src folder.")
+}
+
+func archiveInit() {
+	fsScArchive = flag.NewFlagSet("archive", flag.ExitOnError) // sub-command
+	fsScArchive.StringVar(&captureName, "capture", "trice.bin", `Binary trice capture file, like written with "trice log -binaryLogfile trice.bin". It is decoded with the TREX encoding.`)
+	flagArchiveDir(fsScArchive)
+	fsScArchive.IntVar(&archive.BlockRows, "blockRows", archive.BlockRows, `Maximum record count of an archive block. Smaller blocks let queries skip more data, but enlarge the manifest.`)
+	fsScArchive.StringVar(&decoder.PackageFraming, "packageFraming", "TCOBSv1", `Use "none" or "COBS" as alternative. Must match the target configuration like for "trice log".`)
+	fsScArchive.StringVar(&decoder.PackageFraming, "pf", "TCOBSv1", "Short for '-packageFraming'.")
+	fsScArchive.StringVar(&translator.TriceEndianness, "triceEndianness", "littleEndian", `Target endianness trice data stream. Option: "bigEndian".`)
+	flagLogfile(fsScArchive)
+	flagVerbosity(fsScArchive)
+	flagIDList(fsScArchive)
+	flagLIList(fsScArchive)
+}
+
+func queryInit() {
+	fsScQuery = flag.NewFlagSet("query", flag.ExitOnError) // sub-command
+	flagArchiveDir(fsScQuery)
+	fsScQuery.StringVar(&queryIDs, "id", "", `Comma separated trice IDs like "3713,935". Default are all IDs. ID 0 selects the decoder messages.`)
+	fsScQuery.StringVar(&queryChannel, "channel", "", `Channel like "err". Default are all channels.`)
+	fsScQuery.StringVar(&queryFrom, "from", "", `Earliest host reception time as RFC 3339 time like "2024-01-02T15:04:05.5+01:00" or in ns since 1970.`)
+	fsScQuery.StringVar(&queryTo, "to", "", `Host reception time behind the last wanted record, in the same format as -from.`)
+	fsScQuery.Uint64Var(&queryStampFrom, "stampFrom", 0, `Smallest target stamp of the wanted records. With -stampFrom or -stampTo records without target stamp are not selected.`)
+	fsScQuery.Uint64Var(&queryStampTo, "stampTo", 0, `Target stamp behind the last wanted record. 0 means no upper limit.`)
+	fsScQuery.StringVar(&queryWhere, "where", "", `Comma separated value conditions, which all must match, like "v0>100,v1==idle". v0 is the first trice value. Operators are ==, !=, <, <=, > and >=.`)
+	fsScQuery.StringVar(&queryFormat, "format", "ndjson", `Output format: "ndjson" or "binary", see "trice log -logFormat".`)
+	flagLogfile(fsScQuery)
+	flagVerbosity(fsScQuery)
+}
+
+func flagArchiveDir(p *flag.FlagSet) {
+	p.StringVar(&archive.Dir, "archive", "trice.archive", `Archive directory. "trice archive" creates it and it must be empty, if it exists.`)
+}
+
 func versionInit() {
 	fsScVersion = flag.NewFlagSet("version", flag.ContinueOnError) // sub-command
 	flagLogfile(fsScVersion)
@@ -50,6 +50,8 @@ sub-command 'h|help': For command line usage.
 #	Example 'trice h -log': Print log help.
   -all
     	Show all help.
+  -archive
+    	Show archive specific help.
   -c	Show cleanSourceTreeIds specific help.
   -cleanSourceTreeIds
     	Show cleanSourceTreeIds specific help.
@@ -57,6 +59,9 @@ sub-command 'h|help': For command line usage.
     	Show ds|displayserver specific help.
   -ds
     	Show ds|displayserver specific help.
+  -g	Show g|generate specific help.
+  -generate
+    	Show g|generate specific help.
   -h	Show h|help specific help.
   -help
     	Show h|help specific help.
@@ -77,6 +82,8 @@ sub-command 'h|help': For command line usage.
     	All trice output of the appropriate subcommands is appended per default into the logfile trice additionally to the normal output.
     	Change the filename with "-logfile myName.txt" or switch logging off with "-logfile none".
     	 (default "off")
+  -query
+    	Show query specific help.
   -r	Show r|refresh specific help.
   -refresh
     	Show r|refresh specific help.
@@ -126,6 +133,9 @@ sub-command 'l|log': For displaying trice logs coming from port. With "trice log
   -ban value
     	Channel(s) to ignore. This is a multi-flag switch. It can be used several times with a colon separated list of channel descriptors not to display.
     	Example: "-ban dbg:wrn -ban diag" results in suppressing all as debug, diag and warning tagged messages. Not usable in conjunction with "-pick".
+  -banID value
+    	Trice IDs to ignore. This is a multi-flag switch. It can be used several times with a comma separated list of IDs and ID ranges.
+    	The trices with these IDs are skipped by the decoder without formatting. Example: "-banID 100,200-299".
   -baud int
     	Set the serial port baudrate.
     	It is the only setup parameter. The other values default to 8N1 (8 data bits, no parity, one stopbit).
@@ -148,6 +158,20 @@ sub-command 'l|log': For displaying trice logs coming from port. With "trice log
     	"none": Disable ANSI color. The lower case channel information is removed: "w:x"-> "x"
     	"default|color": Use ANSI color codes for known upper and lower case channel info are inserted and lower case channel information is removed.
     	 (default "default")
+  -comBuffer int
+    	Serial port user space read buffer size in bytes. Bigger buffers take more received bytes in one system call. (default 4096)
+  -comLowLatency
+    	Set the serial driver low latency flag (ASYNC_LOW_LATENCY, Linux only). The driver then passes received bytes immediately. This is a bool switch. It has no parameters. Its default value is false. If the switch is applied its value is true. You can also set it explicit: =false or =true.
+  -comReader
+    	Read the serial port in a dedicated goroutine into -comBuffer sized buffers, which avoids overruns at high baud rates during slow output. Each read gets a reception timestamp, used by -tsAbs. This is a bool switch. It has no parameters. Its default value is false. If the switch is applied its value is true. You can also set it explicit: =false or =true.
+  -comTimeout duration
+    	Serial port read timeout like "10ms", similar to VTIME. A read returns after this time without received bytes. 0 waits for bytes.
+  -coreFormat string
+    	Core format string at start of each line, if the target transmits core tags (TRICE_CORE_COUNT > 1). Use "off" or "none" to suppress the core display. (default "core%d ")
+  -coreSort
+    	Sort the trices of different target cores by their timestamps. Each core needs increasing stamps. Pending trices are released, when all cores delivered later stamps, when the input ends or after -coreSortHold. Needs package framing. This is a bool switch. It has no parameters. Its default value is false. If the switch is applied its value is true. You can also set it explicit: =false or =true.
+  -coreSortHold duration
+    	Max time like "200ms", a trice waits with -coreSort for later stamps of the other cores, before it is released anyway. (default 1s)
   -d16
     	Short for '-Doubled16BitID'.
   -databits int
@@ -175,6 +199,9 @@ sub-command 'l|log': For displaying trice logs coming from port. With "trice log
     			  COBS = TLE (obsolete naming)
     			  DUMP prints the received bytes as hex code (see switch -dc too).
     	 (default "TREX")
+  -exclude value
+    	Text to ignore. This is a multi-flag switch. It can be used several times with one text each.
+    	Trice messages containing one of the texts are not displayed. Usable in conjunction with "-include".
   -exec string
     	Use to pass an additional command line for port TCP4 (like gdbserver start).
   -hs string
@@ -191,6 +218,10 @@ sub-command 'l|log': For displaying trice logs coming from port. With "trice log
     	The trice ID list file.
     	The specified JSON file is needed to display the ID coded trices during runtime and should be under version control.
     	 (default "til.json")
+  -include value
+    	Text to display. This is a multi-flag switch. It can be used several times with one text each.
+    	Only trice messages containing at least one of the texts are displayed. The texts are searched case sensitive inside the message including the channel like "err:".
+    	Example: "-include sensor -include err:" results in displaying only messages containing "sensor" or starting with "err:".
   -ipa string
     	IP address like '127.0.0.1'.
     	You can specify this switch if you intend to use the remote display option to show the output on a different PC in the network.
@@ -218,6 +249,8 @@ sub-command 'l|log': For displaying trice logs coming from port. With "trice log
     	With "off" or "none" suppress the display or generation of the location information. Avoid shared ID's for correct 
     	location information. See information for the -SharedIDs switch for additionals hints. See -tLocFmt for formatting.
     	 (default "li.json")
+  -logFormat string
+    	Log output format, options: "text" for the human readable lines, "ndjson" for one JSON object per trice with id, host and target stamp, channel, location, typed values and message, "binary" for length prefixed binary records (see decoder.ReadRecord). The structured formats need the TREX encoding and skip colors, prefixes and the display server. (default "text")
   -logLevel string
     	Level based log filtering. "off" suppresses everything. If equal to a channel specifier all with a bigger index inside emitter.ColorChannels is not shown. (default "all")
   -logfile string
@@ -240,11 +273,16 @@ sub-command 'l|log': For displaying trice logs coming from port. With "trice log
   -password string
     	The decrypt passphrase. If you change this value you need to compile the target with the appropriate key (see -showKeys).
     	Encryption is recommended if you deliver firmware to customers and want protect the trice log output. This does work right now only with flex and flexL format.
+  -payloadCodec string
+    	Target payload encoding (TRICE_PAYLOAD_CODEC). Use "varint" for TRICE_CODEC_VARINT or "delta" for TRICE_CODEC_DELTA. The delta decoding needs all trices since the target start or since a TriceCodecReset call. Needs package framing. (default "none")
   -pf string
     	Short for '-packageFraming'. (default "TCOBSv1")
   -pick value
     	Channel(s) to display. This is a multi-flag switch. It can be used several times with a colon separated list of channel descriptors only to display.
     	Example: "-pick err:wrn -pick default" results in suppressing all messages despite of as error, warning and default tagged messages. Not usable in conjunction with "-ban".
+  -pickID value
+    	Trice IDs to display. This is a multi-flag switch. It can be used several times with a comma separated list of IDs and ID ranges.
+    	All trices with other IDs are skipped by the decoder without formatting. Example: "-pickID 100,200-299". Usable in conjunction with "-banID".
   -port string
     	receiver device: 'BUFFER|DUMP|FILE|FILEBUFFER|JLINK|STLINK|TCP4|serial name. 
     	The serial name is like 'COM12' for Windows or a Linux name like '/dev/tty/usb12'. 
@@ -254,6 +292,10 @@ sub-command 'l|log': For displaying trice logs coming from port. With "trice log
     	Line prefix, options: any string or 'off|none' or 'source:' followed by 0-12 spaces, 'source:' will be replaced by source value e.g., 'COM17:'. (default "source: ")
   -pw string
     	Short for -password.
+  -rttLogger string
+    	RTT logger executable for port "J-LINK" or "ST-LINK". Default is "JLinkRTTLogger" or "stRttLogger" found in the path.
+  -rttTransfer string
+    	Transfer of the RTT logger data for port "J-LINK" or "ST-LINK", options: "file" reads a growing temporary binary logfile inside ./temp, "fifo" reads a named pipe blocking with lower latency and without disk usage (not on Windows). (default "file")
   -s	Short for '-showInputBytes'.
   -showID string
     	Format string for displaying first trice ID at start of each line. Example: "debug:%7d ". Default is "". If several trices form a log line only the first trice ID ist displayed.
@@ -269,7 +311,13 @@ sub-command 'l|log': For displaying trice logs coming from port. With "trice log
   -suffix string
     	Append suffix to all lines, options: any string.
   -tcp string
-    	TCP address for an external log receiver like Putty. Example: 1st: "trice log -p COM1 -tcp localhost:64000", 2nd "putty". In "Terminal" enable "Implicit CR in every LF", In "Session" Connection type:"Other:Telnet", specify "hostname:port" here like "localhost:64000".
+    	TCP address for an external log receiver like Putty. Example: 1st: "trice log -p COM1 -tcp localhost:64000", 2nd "putty". In "Terminal" enable "Implicit CR in every LF", In "Session" Connection type:"Other:Telnet", specify "hostname:port" here like "localhost:64000". Any number of clients can connect at any time.
+  -tcpDrop string
+    	Drop policy for a TCP client lagging -tcpQueue lines behind, options: "oldest" drops the oldest queued line, "newest" drops the new line, "disconnect" closes the client connection. (default "oldest")
+  -tcpQueue int
+    	Line count, a TCP client can lag behind, before -tcpDrop applies. A slow client never slows down the trice output. (default 1000)
+  -tcpReplay int
+    	Count of last lines, each new TCP client gets first.
   -testTable
     	Generate testTable output and ignore -prefix, -suffix, -ts, -color. This is a bool switch. It has no parameters. Its default value is false. If the switch is applied its value is true. You can also set it explicit: =false or =true.
   -til string
@@ -278,13 +326,17 @@ sub-command 'l|log': For displaying trice logs coming from port. With "trice log
   -triceEndianness string
     	Target endianness trice data stream. Option: "bigEndian". (default "littleEndian")
   -ts string
-    	Target timestamp general format string at start of each line, if target timestamps existent (configured). Choose between "µs" (or "us") and "ms", use "" or 'off' or 'none' to suppress existing target timestamps. Sets ts0, ts16, ts32 if these not passed. If several trices form a log line only the timestamp of first trice ist displayed. (default "µs")
+    	Target timestamp general format string at start of each line, if target timestamps existent (configured). Choose between "µs" (or "us") and "ms", use "" or 'off' or 'none' to suppress existing target timestamps. Sets ts0, ts16, ts32, ts64 if these not passed. If several trices form a log line only the timestamp of first trice ist displayed. (default "µs")
   -ts0 string
     	Target stamp format string at start of each line, if no target stamps existent (configured). Use "" to suppress existing target timestamps. If several trices form a log line only the timestamp of first trice ist displayed. (default "time:            ")
   -ts16 string
     	16-bit Target stamp format string at start of each line, if 16-bit target stamps existent (configured). Choose between "µs" (or "us") and "ms", use "" to suppress or use s.th. like "...%d...". If several trices form a log line only the timestamp of first trice ist displayed. (default "ms")
   -ts32 string
     	32-bit Target stamp format string at start of each line, if 32-bit target stamps existent (configured). Choose between "µs" (or "us") and "ms", use "" to suppress or use s.th. like "...%d...". If several trices form a log line only the timestamp of first trice ist displayed. (default "ms")
+  -ts64 string
+    	64-bit Target stamp format string at start of each line, if 64-bit target stamps existent (configured). Choose between "µs" (or "us") and "ms", use "" to suppress or use s.th. like "...%d...". If several trices form a log line only the timestamp of first trice ist displayed. Only when this switch is passed, trices with the extended X0 type bits are decoded as trices with 64-bit stamps (target TRICE_STAMP64 == 1), otherwise they are not supported and get discarded. (default "us")
+  -tsAbs
+    	Display target stamps as absolute host times. The 16- and 32-bit target stamps are unwrapped into a 64-bit timeline and a running linear fit against the host reception times corrects the target clock drift. The ts16, ts32 and ts64 values "ms" or "us" select the nominal target tick. This is a bool switch. It has no parameters. Its default value is false. If the switch is applied its value is true. You can also set it explicit: =false or =true.
   -u	Short for '-unsigned'. (default true)
   -unsigned
     	Hex, Octal and Bin values are printed as unsigned values. (default true)
@@ -668,6 +720,120 @@ sub-command 'c|clean': Set all [id|Id|ID](n) inside source tree dir to [id|Id|ID
     	Gives more informal output if used. Can be helpful during setup.
     	For example "trice u -dry-run -v" is the same as "trice u -dry-run" but with more descriptive output.
     	This is a bool switch. It has no parameters. Its default value is false. If the switch is applied its value is true. You can also set it explicit: =false or =true.
+sub-command 'g|generate': Generate C code for trice macros with more than 12 values.
+#	"trice generate" writes the files triceMaxParams.h and triceMaxParams.c with the trice macros and functions for 13 up to max values.
+#	Copy them into your project next to trice.h and set TRICE_MAX_PARAM_COUNT inside triceConfig.h to a value up to max.
+#	Example: 'trice g -max 16 -dst ./src': Generate C code for trice macros with up to 16 values into the ./src folder.
+  -dry-run
+    	No changes applied but output shows what would happen.
+    	"trice generate -dry-run" will change nothing but show changes it would perform without the "-dry-run" switch.
+    	This is a bool switch. It has no parameters. Its default value is false. If the switch is applied its value is true. You can also set it explicit: =false or =true.
+  -dst string
+    	Destination folder for the generated C files, usually the trice src folder. (default "./")
+  -max int
+    	Biggest value count for the generated trice macros. Valid values are 13 up to the default value. (default 32)
+  -v	short for verbose
+  -verbose
+    	Gives more informal output if used. Can be helpful during setup.
+    	For example "trice u -dry-run -v" is the same as "trice u -dry-run" but with more descriptive output.
+    	This is a bool switch. It has no parameters. Its default value is false. If the switch is applied its value is true. You can also set it explicit: =false or =true.
+sub-command 'archive': Decode a binary trice capture once into a column wise archive for fast queries with "trice query".
+#	Each trice ID gets its own column files for host times, target stamps, channels, values and messages in blocks.
+#	A manifest keeps the time and value ranges of each block, so a query reads only the blocks it needs.
+#	Example: 'trice archive -capture trice.bin -archive ./trice.archive': Archive the trices inside trice.bin.
+  -archive string
+    	Archive directory. "trice archive" creates it and it must be empty, if it exists. (default "trice.archive")
+  -blockRows int
+    	Maximum record count of an archive block. Smaller blocks let queries skip more data, but enlarge the manifest. (default 4096)
+  -capture string
+    	Binary trice capture file, like written with "trice log -binaryLogfile trice.bin". It is decoded with the TREX encoding. (default "trice.bin")
+  -i string
+    	Short for '-idlist'.
+    	 (default "til.json")
+  -idList string
+    	Alternate for '-idlist'.
+    	 (default "til.json")
+  -idlist string
+    	The trice ID list file.
+    	The specified JSON file is needed to display the ID coded trices during runtime and should be under version control.
+    	 (default "til.json")
+  -lf string
+    	Short for logfile (default "off")
+  -li string
+    	Short for '-locationInformation'.
+    	 (default "li.json")
+  -liPathIsRelative
+    	Use this flag, if your project has trices inside files with identical names in different folders to distinguish them in the location information.
+    	The default is to use only the files basename.
+  -locationInformation string
+    	The trice location list file.
+    	The specified JSON file is needed to display the location information for each ID during runtime and needs no version control. 
+    	It is regenerated on each refresh, update or renew trice run. When trice log finds a location information file, it is used for 
+    	log output with location information. Otherwise no location information is displayed, what usually is wanted in the field.
+    	This way the newest til.json can be used also with legacy firmware, but the li.json must match the current firmware version.
+    	With "off" or "none" suppress the display or generation of the location information. Avoid shared ID's for correct 
+    	location information. See information for the -SharedIDs switch for additionals hints. See -tLocFmt for formatting.
+    	 (default "li.json")
+  -logfile string
+    	Append all output to logfile. Options are: 'off|none|filename|auto':
+    	"off": no logfile (same as "none")
+    	"none": no logfile (same as "off")
+    	"my/path/auto": Use as logfile name "my/path/2006-01-02_1504-05_trice.log" with actual time. "my/path/" must exist.
+    	"filename": Any other string than "auto", "none" or "off" is treated as a filename. If the file exists, logs are appended.
+    	All trice output of the appropriate subcommands is appended per default into the logfile trice additionally to the normal output.
+    	Change the filename with "-logfile myName.txt" or switch logging off with "-logfile none".
+    	 (default "off")
+  -packageFraming string
+    	Use "none" or "COBS" as alternative. Must match the target configuration like for "trice log". (default "TCOBSv1")
+  -pf string
+    	Short for '-packageFraming'. (default "TCOBSv1")
+  -til string
+    	Short for '-idlist'.
+    	 (default "til.json")
+  -triceEndianness string
+    	Target endianness trice data stream. Option: "bigEndian". (default "littleEndian")
+  -v	short for verbose
+  -verbose
+    	Gives more informal output if used. Can be helpful during setup.
+    	For example "trice u -dry-run -v" is the same as "trice u -dry-run" but with more descriptive output.
+    	This is a bool switch. It has no parameters. Its default value is false. If the switch is applied its value is true. You can also set it explicit: =false or =true.
+sub-command 'query': Select records from an archive written by "trice archive" and print them as NDJSON or binary records.
+#	Example: 'trice query -id 3713 -from 2024-01-02T15:00:00Z -where "v0>100"': Show all records of ID 3713 after 15:00 UTC with a first value above 100.
+#	Example: 'trice query -stampFrom 1000000 -stampTo 2000000': Show all records with target stamps from 1000000 to 1999999.
+  -archive string
+    	Archive directory. "trice archive" creates it and it must be empty, if it exists. (default "trice.archive")
+  -channel string
+    	Channel like "err". Default are all channels.
+  -format string
+    	Output format: "ndjson" or "binary", see "trice log -logFormat". (default "ndjson")
+  -from string
+    	Earliest host reception time as RFC 3339 time like "2024-01-02T15:04:05.5+01:00" or in ns since 1970.
+  -id string
+    	Comma separated trice IDs like "3713,935". Default are all IDs. ID 0 selects the decoder messages.
+  -lf string
+    	Short for logfile (default "off")
+  -logfile string
+    	Append all output to logfile. Options are: 'off|none|filename|auto':
+    	"off": no logfile (same as "none")
+    	"none": no logfile (same as "off")
+    	"my/path/auto": Use as logfile name "my/path/2006-01-02_1504-05_trice.log" with actual time. "my/path/" must exist.
+    	"filename": Any other string than "auto", "none" or "off" is treated as a filename. If the file exists, logs are appended.
+    	All trice output of the appropriate subcommands is appended per default into the logfile trice additionally to the normal output.
+    	Change the filename with "-logfile myName.txt" or switch logging off with "-logfile none".
+    	 (default "off")
+  -stampFrom uint
+    	Smallest target stamp of the wanted records. With -stampFrom or -stampTo records without target stamp are not selected.
+  -stampTo uint
+    	Target stamp behind the last wanted record. 0 means no upper limit.
+  -to string
+    	Host reception time behind the last wanted record, in the same format as -from.
+  -v	short for verbose
+  -verbose
+    	Gives more informal output if used. Can be helpful during setup.
+    	For example "trice u -dry-run -v" is the same as "trice u -dry-run" but with more descriptive output.
+    	This is a bool switch. It has no parameters. Its default value is false. If the switch is applied its value is true. You can also set it explicit: =false or =true.
+  -where string
+    	Comma separated value conditions, which all must match, like "v0>100,v1==idle". v0 is the first trice value. Operators are ==, !=, <, <=, > and >=.
 `
 	id.FnJSON = "til.json"
 	execHelper(t, input, expect)
@@ -58,6 +58,28 @@ var (
 	// fsScClean is flag set for sub command 'clean' for clearing IDs in source tree.
 	fsScClean *flag.FlagSet
 
+	// fsScGenerate is flag set for sub command 'generate' for generating trice macro C code.
+	fsScGenerate *flag.FlagSet
+
+	// fsScArchive is flag set for sub command 'archive' for decoding a binary capture into an archive.
+	fsScArchive *flag.FlagSet
+
+	// fsScQuery is flag set for sub command 'query' for selecting records from an archive.
+	fsScQuery *flag.FlagSet
+
+	// captureName is the binary capture file for sub command 'archive'.
+	captureName string
+
+	// The query* variables hold the record selection of sub command 'query'.
+	queryIDs       string
+	queryChannel   string
+	queryFrom      string
+	queryTo        string
+	queryStampFrom uint64
+	queryStampTo   uint64
+	queryWhere     string
+	queryFormat    string
+
 	// pSrcZ is a string pointer to the safety string for scZero.
 	// pSrcZ *string
 
@@ -74,4 +96,7 @@ var (
 	versionHelp       bool // flag for partial help
 	zeroIDsHelp       bool // flag for partial help
 	cleanIDsHelp      bool // flag for partial help
+	generateHelp      bool // flag for partial help
+	archiveHelp       bool // flag for partial help
+	queryHelp         bool // flag for partial help
 )
@@ -6,7 +6,6 @@ package charDecoder
 
 import (
 	"io"
-	"sync"
 
 	"github.com/rokath/trice/internal/decoder"
 	"github.com/rokath/trice/internal/id"
@@ -18,13 +17,12 @@ type char struct {
 }
 
 // New provides a character terminal output option for the trice tool.
-func New(w io.Writer, lut id.TriceIDLookUp, m *sync.RWMutex, li id.TriceIDLookUpLI, in io.Reader, endian bool) decoder.Decoder {
+func New(w io.Writer, lut *id.LutSnapshot, li id.TriceIDLookUpLI, in io.Reader, endian bool) decoder.Decoder {
 	p := &char{}
 	p.W = w
 	p.In = in
 	p.IBuf = make([]byte, 0, decoder.DefaultSize)
 	p.Lut = lut
-	p.LutMutex = m
 	p.Endian = endian
 	return p
 }
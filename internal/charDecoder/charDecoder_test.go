@@ -23,7 +23,7 @@ func doCHARableTest(t *testing.T, out io.Writer, f decoder.New, endianness bool,
 	//assert.Nil(t, ilu.FromJSON([]byte(idl)))
 	//lu.AddFmtCount(os.Stdout)
 	buf := make([]byte, decoder.DefaultSize)
-	dec := f(out, nil, nil, nil, nil, endianness) // a new decoder instance
+	dec := f(out, nil, nil, nil, endianness) // a new decoder instance
 	for _, x := range teTa {
 		in := ioutil.NopCloser(bytes.NewBuffer(x.In))
 		dec.SetInput(in)
@@ -0,0 +1,102 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package com
+
+import (
+	"io"
+	"os"
+	"time"
+)
+
+// chunkReader reads in a dedicated goroutine into reusable buffers and timestamps each chunk.
+//
+// The goroutine reads on, while the decoding of the previous chunks is still in progress.
+// That keeps the driver buffer empty at high baud rates. When all buffers are in use, it waits for the consumer.
+type chunkReader struct {
+	free   chan []byte // free holds the unused buffers.
+	chunks chan chunk  // chunks holds the read chunks in their order.
+	done   chan struct{}
+	cur    chunk // cur is the chunk, Read consumes.
+	pos    int   // pos is the read position inside cur.
+}
+
+// chunk is the result of one read.
+type chunk struct {
+	b   []byte
+	t   time.Time // t is the time after the read returned.
+	err error
+}
+
+// newChunkReader starts reading from r into count buffers with size bytes each.
+func newChunkReader(r io.Reader, size, count int) *chunkReader {
+	if count < 1 {
+		count = 1
+	}
+	c := &chunkReader{
+		free:   make(chan []byte, count),
+		chunks: make(chan chunk, count),
+		done:   make(chan struct{}),
+	}
+	for i := 0; i < count; i++ {
+		c.free <- make([]byte, size)
+	}
+	go c.run(r)
+	return c
+}
+
+// run reads from r until an error occurs or Close is called.
+func (c *chunkReader) run(r io.Reader) {
+	for {
+		var b []byte
+		select {
+		case b = <-c.free:
+		case <-c.done:
+			return
+		}
+		n, err := r.Read(b)
+		select {
+		case c.chunks <- chunk{b: b[:n], t: time.Now(), err: err}:
+		case <-c.done:
+			return
+		}
+		if err != nil {
+			return
+		}
+	}
+}
+
+// Read copies the next bytes of the actual chunk into b and waits for the next chunk, if the actual one is consumed.
+// The error of a chunk is returned together with its last bytes and then with each further Read.
+func (c *chunkReader) Read(b []byte) (n int, err error) {
+	if c.pos == len(c.cur.b) {
+		if c.cur.err != nil {
+			return 0, c.cur.err
+		}
+		if c.cur.b != nil {
+			c.free <- c.cur.b[:cap(c.cur.b)]
+		}
+		select {
+		case c.cur = <-c.chunks:
+			c.pos = 0
+		case <-c.done:
+			return 0, os.ErrClosed
+		}
+	}
+	n = copy(b, c.cur.b[c.pos:])
+	c.pos += n
+	if c.pos == len(c.cur.b) {
+		err = c.cur.err
+	}
+	return
+}
+
+// ReceptionTime returns the time, when the chunk of the last Read was received.
+func (c *chunkReader) ReceptionTime() time.Time {
+	return c.cur.t
+}
+
+// Close stops the goroutine, after the underlying reader returned. The caller needs to close the underlying reader.
+func (c *chunkReader) Close() {
+	close(c.done)
+}
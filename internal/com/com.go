@@ -6,11 +6,13 @@
 package com
 
 import (
+	"bufio"
 	"fmt"
 	"io"
 	"log"
 	"os"
 	"strings"
+	"time"
 
 	"go.bug.st/serial"
 )
@@ -33,6 +35,22 @@ var (
 
 	// Verbose shows additional information if set true.
 	Verbose = false
+
+	// ReadBufferSize is the byte count of the reusable user space read buffers. Big buffers take all
+	// received bytes in one system call and avoid driver overruns at high baud rates.
+	ReadBufferSize = 4096
+
+	// ReadTimeout lets a read return after this time without received bytes, what is similar to VTIME. 0 means wait.
+	ReadTimeout time.Duration
+
+	// LowLatency sets the Linux ASYNC_LOW_LATENCY flag of the serial driver.
+	LowLatency bool
+
+	// Reader reads in a dedicated goroutine into ReaderChunks buffers and timestamps each chunk.
+	Reader bool
+
+	// ReaderChunks is the buffer count for the dedicated reader goroutine.
+	ReaderChunks = 16
 )
 
 // COMport is the comport interface type to use different COMports.
@@ -50,6 +68,8 @@ type port struct {
 	serialHandle serial.Port
 	serialMode   serial.Mode
 	w            io.Writer
+	buffered     *bufio.Reader // buffered reads big chunks into a reusable buffer, if Reader is false.
+	chunks       *chunkReader  // chunks reads in a dedicated goroutine, if Reader is true.
 }
 
 // NewPort creates an instance of a serial device type trice receiver
@@ -105,7 +125,18 @@ func NewPort(w io.Writer, comPortName string, verbose bool) *port {
 // It stores data received from the serial port into the provided byte array
 // buffer. The function returns the number of bytes read.
 func (p *port) Read(buf []byte) (int, error) {
-	return p.serialHandle.Read(buf)
+	if p.chunks != nil {
+		return p.chunks.Read(buf)
+	}
+	return p.buffered.Read(buf)
+}
+
+// ReceptionTime returns the reception time of the last read bytes, if Reader is true, or the actual time.
+func (p *port) ReceptionTime() time.Time {
+	if p.chunks != nil {
+		return p.chunks.ReceptionTime()
+	}
+	return time.Now()
 }
 
 func (p *port) Write(buf []byte) (int, error) {
@@ -117,6 +148,9 @@ func (p *port) Close() error {
 	if p.verbose {
 		fmt.Fprintln(p.w, "Closing COM port")
 	}
+	if p.chunks != nil {
+		p.chunks.Close()
+	}
 	return p.serialHandle.Close()
 }
 
@@ -132,6 +166,25 @@ func (p *port) Open() bool {
 		}
 		return false
 	}
+	if ReadTimeout > 0 {
+		if err = p.serialHandle.SetReadTimeout(ReadTimeout); err != nil {
+			fmt.Fprintln(p.w, "Ignoring read timeout:", err)
+		}
+	}
+	if LowLatency {
+		if err = setLowLatency(p.port); err != nil {
+			fmt.Fprintln(p.w, "Ignoring low latency mode:", err)
+		}
+	}
+	size := ReadBufferSize
+	if size < 16 {
+		size = 16 // bufio minimum
+	}
+	if Reader {
+		p.chunks = newChunkReader(p.serialHandle, size, ReaderChunks)
+	} else {
+		p.buffered = bufio.NewReaderSize(p.serialHandle, size)
+	}
 	return true
 }
 
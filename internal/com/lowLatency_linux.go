@@ -0,0 +1,56 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package com
+
+import (
+	"os"
+	"syscall"
+	"unsafe"
+)
+
+const (
+	tiocgserial      = 0x541E // TIOCGSERIAL from <asm-generic/ioctls.h>
+	tiocsserial      = 0x541F // TIOCSSERIAL
+	asyncLowLatency  = 1 << 13
+	serialFlagsIndex = 4 // serialFlagsIndex is the index of flags in struct serial_struct behind type, line, port and irq.
+)
+
+// setLowLatency sets the ASYNC_LOW_LATENCY flag of the serial driver for the device name.
+// The driver then passes received bytes immediately to the tty layer instead of collecting them for some milliseconds.
+// The setting stays, until the device is reset. Drivers without serial_struct support, like pseudo terminals, return an error.
+func setLowLatency(name string) error {
+	f, err := os.OpenFile(name, os.O_RDWR|syscall.O_NOCTTY|syscall.O_NONBLOCK, 0)
+	if err != nil {
+		return err
+	}
+	defer f.Close()
+	var ss [32]int32 // struct serial_struct is 72 bytes on 64-bit systems.
+	if err := ioctl(f, tiocgserial, &ss); err != nil {
+		return err
+	}
+	if ss[serialFlagsIndex]&asyncLowLatency != 0 {
+		return nil
+	}
+	ss[serialFlagsIndex] |= asyncLowLatency
+	return ioctl(f, tiocsserial, &ss)
+}
+
+// ioctl performs request on f with ss as argument.
+func ioctl(f *os.File, request uintptr, ss *[32]int32) error {
+	c, err := f.SyscallConn()
+	if err != nil {
+		return err
+	}
+	var errno syscall.Errno
+	err = c.Control(func(fd uintptr) {
+		_, _, errno = syscall.Syscall(syscall.SYS_IOCTL, fd, request, uintptr(unsafe.Pointer(ss)))
+	})
+	if err != nil {
+		return err
+	}
+	if errno != 0 {
+		return errno
+	}
+	return nil
+}
@@ -0,0 +1,14 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+//go:build !linux
+// +build !linux
+
+package com
+
+import "errors"
+
+// setLowLatency is supported only on Linux.
+func setLowLatency(name string) error {
+	return errors.New("low latency mode is supported only on Linux")
+}
@@ -0,0 +1,123 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+// Package com_test is a black-box test.
+package com_test
+
+import (
+	"fmt"
+	"io"
+	"os"
+	"sync/atomic"
+	"syscall"
+	"testing"
+	"time"
+	"unsafe"
+
+	"github.com/rokath/trice/internal/com"
+	"github.com/tj/assert"
+)
+
+// openPty returns the master side of a new pseudo terminal pair, the slave name and the slave side in raw mode.
+// The raw mode stays active as long as the returned slave file is open.
+func openPty(t *testing.T) (master *os.File, name string, slave *os.File) {
+	master, err := os.OpenFile("/dev/ptmx", os.O_RDWR|syscall.O_NOCTTY, 0)
+	if err != nil {
+		t.Skip("no pseudo terminals:", err)
+	}
+	var unlock int32
+	assert.Nil(t, ioctl(master, syscall.TIOCSPTLCK, unsafe.Pointer(&unlock)))
+	var n uint32
+	assert.Nil(t, ioctl(master, syscall.TIOCGPTN, unsafe.Pointer(&n)))
+	name = fmt.Sprintf("/dev/pts/%d", n)
+	slave, err = os.OpenFile(name, os.O_RDWR|syscall.O_NOCTTY, 0)
+	assert.Nil(t, err)
+
+	var tio syscall.Termios
+	assert.Nil(t, ioctl(slave, syscall.TCGETS, unsafe.Pointer(&tio)))
+	tio.Iflag &^= syscall.IGNBRK | syscall.BRKINT | syscall.PARMRK | syscall.ISTRIP | syscall.INLCR | syscall.IGNCR | syscall.ICRNL | syscall.IXON
+	tio.Oflag &^= syscall.OPOST
+	tio.Lflag &^= syscall.ECHO | syscall.ECHONL | syscall.ICANON | syscall.ISIG | syscall.IEXTEN
+	tio.Cflag &^= syscall.CSIZE | syscall.PARENB
+	tio.Cflag |= syscall.CS8
+	tio.Cc[syscall.VMIN] = 1
+	tio.Cc[syscall.VTIME] = 0
+	assert.Nil(t, ioctl(slave, syscall.TCSETS, unsafe.Pointer(&tio)))
+	return
+}
+
+// ioctl performs request on f with the argument p.
+func ioctl(f *os.File, request uintptr, p unsafe.Pointer) error {
+	if _, _, errno := syscall.Syscall(syscall.SYS_IOCTL, f.Fd(), request, uintptr(p)); errno != 0 {
+		return errno
+	}
+	return nil
+}
+
+// TestPtyThroughput pushes 2 MB in 1 KB blocks at about 4 MB/s through a pseudo terminal,
+// reads it with small reads like the decoders and checks, that no byte is lost and the latency stays bounded.
+func TestPtyThroughput(t *testing.T) {
+	const (
+		blockSize = 1024
+		blocks    = 2048
+		interval  = 250 * time.Microsecond
+	)
+	defer func(size int, timeout time.Duration, low, reader bool) {
+		com.ReadBufferSize, com.ReadTimeout, com.LowLatency, com.Reader = size, timeout, low, reader
+	}(com.ReadBufferSize, com.ReadTimeout, com.LowLatency, com.Reader)
+	com.BaudRate, com.DataBits, com.Parity, com.StopBits = 3000000, 8, "none", "1"
+	com.ReadBufferSize = 65536
+	com.LowLatency = true // not supported by pseudo terminals, only reported
+
+	for _, reader := range []bool{false, true} {
+		t.Run(fmt.Sprint("reader=", reader), func(t *testing.T) {
+			com.Reader = reader
+			master, name, slave := openPty(t)
+			defer master.Close()
+			defer slave.Close()
+			p := com.NewPort(io.Discard, name, false)
+			assert.True(t, p.Open())
+
+			sent := make([]int64, blocks) // sent holds the write times in nanoseconds.
+			go func() {
+				b := make([]byte, blockSize)
+				next := time.Now()
+				for k := 0; k < blocks; k++ {
+					for i := range b {
+						b[i] = byte(k*blockSize + i)
+					}
+					atomic.StoreInt64(&sent[k], time.Now().UnixNano())
+					if _, err := master.Write(b); err != nil {
+						return
+					}
+					next = next.Add(interval)
+					time.Sleep(time.Until(next))
+				}
+			}()
+
+			var maxLatency, sumLatency time.Duration
+			buf := make([]byte, 64)
+			count, measured := 0, 0
+			for count < blocks*blockSize {
+				n, err := p.Read(buf)
+				assert.Nil(t, err)
+				for i := 0; i < n; i++ {
+					if buf[i] != byte(count+i) {
+						t.Fatal("byte", count+i, "is", buf[i])
+					}
+				}
+				count += n
+				for ; measured < count/blockSize; measured++ { // block measured is completely received
+					latency := time.Since(time.Unix(0, atomic.LoadInt64(&sent[measured])))
+					sumLatency += latency
+					if latency > maxLatency {
+						maxLatency = latency
+					}
+				}
+			}
+			assert.Nil(t, p.Close())
+			t.Log("max latency", maxLatency, "mean latency", sumLatency/blocks)
+			assert.True(t, maxLatency < 500*time.Millisecond, fmt.Sprint(maxLatency))
+		})
+	}
+}
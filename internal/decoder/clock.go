@@ -0,0 +1,143 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package decoder
+
+import (
+	"time"
+)
+
+// TargetClock is a host side model of a target clock delivering timestamps with a limited bit width.
+//
+// The 16-bit and 32-bit target stamps wrap often within seconds or minutes. Unwrap extends them
+// into a monotonic 64-bit timeline, assuming not more than one wrap between 2 consecutive stamps.
+// Add pairs each unwrapped stamp with its host reception time and updates a running least squares
+// fit host = offset + slope * ticks. The slope is the target tick duration as measured with the host
+// clock and its deviation from the nominal tick duration is the target clock drift.
+// The fit origin is the first added stamp, so Time returns absolute host times corrected by the fit.
+type TargetClock struct {
+	Tick time.Duration // Tick is the nominal target tick duration, used as slope until a fit is possible.
+
+	mask    uint64 // mask has the lower bits set, which are delivered by the target.
+	started bool   // started is true after the first stamp.
+	last    uint64 // last is the last raw stamp.
+	ticks   uint64 // ticks is the last unwrapped stamp.
+
+	n           float64   // n is the number of added stamps.
+	originTicks uint64    // originTicks is the unwrapped first added stamp.
+	originHost  time.Time // originHost is the host reception time of the first added stamp.
+	meanX       float64   // meanX is the running mean of the ticks since origin.
+	meanY       float64   // meanY is the running mean of the host seconds since origin.
+	cxx         float64   // cxx is the running sum of squared ticks deviations.
+	cxy         float64   // cxy is the running sum of ticks and host seconds deviation products.
+}
+
+// NewTargetClock returns a clock model for target stamps with bits valid bits and a nominal tick duration.
+func NewTargetClock(bits uint, tick time.Duration) *TargetClock {
+	c := &TargetClock{Tick: tick, mask: ^uint64(0)}
+	if bits < 64 {
+		c.mask = 1<<bits - 1
+	}
+	return c
+}
+
+// Unwrap returns stamp extended to a monotonic 64-bit value.
+//
+// A stamp smaller than its predecessor is interpreted as a single wrap.
+func (c *TargetClock) Unwrap(stamp uint64) uint64 {
+	stamp &= c.mask
+	if c.started {
+		c.ticks += (stamp - c.last) & c.mask
+	} else {
+		c.ticks = stamp
+		c.started = true
+	}
+	c.last = stamp
+	return c.ticks
+}
+
+// Add unwraps stamp, updates the fit with the host reception time host and returns the corrected absolute time.
+func (c *TargetClock) Add(stamp uint64, host time.Time) time.Time {
+	ticks := c.Unwrap(stamp)
+	if c.n == 0 {
+		c.originTicks = ticks
+		c.originHost = host
+	}
+	x := float64(ticks - c.originTicks)
+	y := host.Sub(c.originHost).Seconds()
+	c.n++
+	dx := x - c.meanX
+	c.meanX += dx / c.n
+	c.meanY += (y - c.meanY) / c.n
+	c.cxx += dx * (x - c.meanX)
+	c.cxy += dx * (y - c.meanY)
+	return c.Time(ticks)
+}
+
+// Slope returns the fitted host seconds per target tick or the nominal tick duration, when no fit is possible yet.
+func (c *TargetClock) Slope() float64 {
+	if c.n < 2 || c.cxx == 0 {
+		return c.Tick.Seconds()
+	}
+	return c.cxy / c.cxx
+}
+
+// Drift returns the target clock deviation in ppm. Positive values mean a too fast running target clock.
+func (c *TargetClock) Drift() float64 {
+	return (c.Tick.Seconds()/c.Slope() - 1) * 1e6
+}
+
+// Time returns the absolute host time for the unwrapped target stamp ticks according to the actual fit.
+func (c *TargetClock) Time(ticks uint64) time.Time {
+	slope := c.Slope()
+	offset := c.meanY - slope*c.meanX
+	x := float64(int64(ticks - c.originTicks))
+	return c.originHost.Add(time.Duration((offset + slope*x) * float64(time.Second)))
+}
+
+// targetClocks holds the clock models for 16-, 32- and 64-bit target stamps, created on first use.
+var targetClocks = map[int]*TargetClock{}
+
+// ResetTargetClocks drops the clock models. The next target stamps start new timelines.
+func ResetTargetClocks() {
+	targetClocks = map[int]*TargetClock{}
+}
+
+// ReceptionTime returns the host reception time of the actually decoded bytes.
+// Receivers timestamping their reads replace it, so the clock model does not include the decoding delay.
+var ReceptionTime = time.Now
+
+// targetTick returns the nominal tick duration for the target stamp format string f.
+func targetTick(f string) time.Duration {
+	switch f {
+	case "ms", "hh:mm:ss,ms", "s,ms":
+		return time.Millisecond
+	}
+	return time.Microsecond
+}
+
+// TrackTargetTimestamp passes TargetTimestamp to the clock model for TargetTimestampSize and sets TargetTime,
+// when TargetStampAbsolute is true, and TargetStampUnwrapped. The decoders call it after reading a target stamp.
+func TrackTargetTimestamp() {
+	if TargetTimestampSize == 0 || !TargetStampAbsolute && LogFormat == "text" {
+		return
+	}
+	c, ok := targetClocks[TargetTimestampSize]
+	if !ok {
+		f := TargetStamp32
+		switch TargetTimestampSize {
+		case 2:
+			f = TargetStamp16
+		case 8:
+			f = TargetStamp64
+		}
+		c = NewTargetClock(uint(8*TargetTimestampSize), targetTick(f))
+		targetClocks[TargetTimestampSize] = c
+	}
+	if TargetStampAbsolute {
+		TargetTime = c.Add(TargetTimestamp, ReceptionTime())
+	} else {
+		c.Unwrap(TargetTimestamp)
+	}
+	TargetStampUnwrapped = c.ticks
+}
@@ -0,0 +1,61 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package decoder
+
+import (
+	"math"
+	"math/rand"
+	"testing"
+	"time"
+
+	"github.com/tj/assert"
+)
+
+// TestTargetClockUnwrap16 checks a wrapping 16-bit stamp stream gets a monotonic 64-bit timeline.
+func TestTargetClockUnwrap16(t *testing.T) {
+	c := NewTargetClock(16, time.Microsecond)
+	var ticks uint64 = 0xff00
+	var last uint64
+	for i := 0; i < 10000; i++ {
+		ticks += 0x1234
+		u := c.Unwrap(ticks & 0xffff)
+		if i > 0 {
+			assert.True(t, u > last)
+			assert.Equal(t, uint64(0x1234), u-last)
+		}
+		last = u
+	}
+	assert.Equal(t, ticks-0x10000, last) // first stamp 0x11134 is seen as 0x1134
+}
+
+// TestTargetClockUnwrap32 checks a wrapping 32-bit stamp stream gets a monotonic 64-bit timeline.
+func TestTargetClockUnwrap32(t *testing.T) {
+	c := NewTargetClock(32, time.Microsecond)
+	exp := []uint64{0xfffffff0, 0x100000010, 0x1fffffff0, 0x200000000}
+	for _, x := range exp {
+		assert.Equal(t, x, c.Unwrap(x&0xffffffff))
+	}
+}
+
+// TestTargetClockDrift feeds synthetic wrapped 16-bit and 32-bit stamp streams of a target clock running 100 ppm too fast
+// with jittered host reception times and checks the fitted drift and the corrected absolute times.
+func TestTargetClockDrift(t *testing.T) {
+	for _, bits := range []uint{16, 32} {
+		r := rand.New(rand.NewSource(1))
+		c := NewTargetClock(bits, time.Microsecond)
+		start := time.Date(2023, 1, 1, 12, 0, 0, 0, time.UTC)
+		const ppm = 100.0
+		var real time.Duration // real is the true time since start
+		var corrected time.Time
+		for i := 0; i < 20000; i++ {
+			real += time.Duration(1000+r.Intn(9000)) * time.Microsecond
+			stamp := uint64(float64(real/time.Microsecond) * (1 + ppm/1e6)) // target ticks
+			jitter := time.Duration(r.Intn(200)) * time.Microsecond         // reception latency
+			corrected = c.Add(stamp, start.Add(real+jitter))
+		}
+		assert.True(t, math.Abs(c.Drift()-ppm) < 1, c.Drift())
+		delta := corrected.Sub(start.Add(real))
+		assert.True(t, delta > -50*time.Microsecond && delta < 250*time.Microsecond, delta)
+	}
+}
@@ -10,7 +10,7 @@ import (
 	"io"
 	"regexp"
 	"strings"
-	"sync"
+	"time"
 
 	"github.com/rokath/trice/internal/id"
 )
@@ -113,10 +113,12 @@ var (
 	TargetTimestamp                 uint64  // targetTimestamp contains target specific timestamp value.
 	TargetLocation                  uint32  // targetLocation contains 16 bit file id in high and 16 bit line number in low part.
 	TargetStamp                     string  // TargetTimeStampUnit is the target timestamps time base for default formatting.
+	TargetStamp64                   string  // ShowTargetStamp64 is the format string for target timestamps.
 	TargetStamp32                   string  // ShowTargetStamp32 is the format string for target timestamps.
 	TargetStamp16                   string  // ShowTargetStamp16 is the format string for target timestamps.
 	TargetStamp0                    string  // ShowTargetStamp0 is the format string for target timestamps.
 	TargetTimeStampUnitPassed       bool    // TargetTimeStampUnitPassed is true when flag was TargetTimeStampUnit passed.
+	ShowTargetStamp64Passed         bool    // ShowTargetStamp64Passed is true when flag was TargetTimeStamp64 passed.
 	ShowTargetStamp32Passed         bool    // ShowTargetStamp32Passed is true when flag was TargetTimeStamp32 passed.
 	ShowTargetStamp16Passed         bool    // ShowTargetStamp16Passed is true when flag was TargetTimeStamp16 passed.
 	ShowTargetStamp0Passed          bool    // ShowTargetStamp0Passed is true when flag was TargetTimeStamp0 passed.
@@ -127,10 +129,54 @@ var (
 	PackageFraming string // Framing is used for packing. Valid values COBS, TCOBS, TCOBSv1 (same as TCOBS)
 	IDBits         = 14   // IDBits holds count of bits used for ID (used at least in trexDecoder)
 	NewlineIndent  = -1   // Used for trice messages containing several newlines in format string for formatting.
+
+	TargetStampAbsolute bool      // TargetStampAbsolute is true, when target stamps are displayed as by a clock model corrected host times.
+	TargetTime          time.Time // TargetTime is the by the clock model corrected absolute time of TargetTimestamp.
+
+	TargetCore   = -1          // TargetCore is the core ID from the last core tag trice or -1, when the target transmits no core tags.
+	CoreFormat   string        // CoreFormat is the format string for TargetCore at the start of each line.
+	CoreSort     bool          // CoreSort is true, when the trices of different target cores are sorted by their timestamps.
+	CoreSortHold = time.Second // CoreSortHold is the max time, a sorted trice waits for later stamps of the other cores.
+
+	PayloadCodec string // PayloadCodec is the target payload encoding (TRICE_PAYLOAD_CODEC): "none", "varint" or "delta".
+
+	LogFormat            = "text"      // LogFormat is the log output format: "text", "ndjson", "binary" or "archive" for the archive sub-command.
+	TargetStampUnwrapped uint64        // TargetStampUnwrapped is TargetTimestamp extended to 64 bits, when TargetStampAbsolute is true or LogFormat is not "text".
+	LastTriceStart       = -1          // LastTriceStart is the position of the last trice message inside the last decoder Read result or -1.
+	LastTriceEnd         int           // LastTriceEnd is the position behind the last trice message inside the last decoder Read result.
+	LastTriceValues      []interface{} // LastTriceValues are the parameter values of the last trice, see SetLastTriceValues.
 )
 
+// SetLastTriceValues stores the trice parameter values v in LastTriceValues as uint64, int64, float32, float64, bool or string,
+// when LogFormat is not "text".
+func SetLastTriceValues(v ...interface{}) {
+	if LogFormat == "text" {
+		return
+	}
+	LastTriceValues = LastTriceValues[:0]
+	for _, x := range v {
+		switch y := x.(type) {
+		case uint8:
+			x = uint64(y)
+		case uint16:
+			x = uint64(y)
+		case uint32:
+			x = uint64(y)
+		case int8:
+			x = int64(y)
+		case int16:
+			x = int64(y)
+		case int32:
+			x = int64(y)
+		case []byte:
+			x = string(y)
+		}
+		LastTriceValues = append(LastTriceValues, x)
+	}
+}
+
 // New abstracts the function type for a new decoder.
-type New func(out io.Writer, lut id.TriceIDLookUp, m *sync.RWMutex, li id.TriceIDLookUpLI, in io.Reader, endian bool) Decoder
+type New func(out io.Writer, lut *id.LutSnapshot, li id.TriceIDLookUpLI, in io.Reader, endian bool) Decoder
 
 // Decoder is providing a byte reader returning decoded trice's.
 // SetInput allows switching the input stream to a different source.
@@ -151,8 +197,7 @@ type DecoderData struct {
 	TriceSize   int                // trice head and payload size as number of bytes
 	ParamSpace  int                // trice payload size after head
 	SLen        int                // string length for TRICE_S
-	Lut         id.TriceIDLookUp   // id look-up map for translation
-	LutMutex    *sync.RWMutex      // to avoid concurrent map read and map write during map refresh triggered by filewatcher
+	Lut         *id.LutSnapshot    // id look-up map for translation, replaced as a whole on ID list file changes
 	Li          id.TriceIDLookUpLI // location information map
 	Trice       id.TriceFmt        // id.TriceFmt // received trice
 }
@@ -0,0 +1,142 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package decoder
+
+import (
+	"fmt"
+	"strconv"
+	"strings"
+
+	"github.com/rokath/trice/internal/id"
+)
+
+var (
+	// BanIDs holds the IDs of the -banID switch. The decoder skips their trices without formatting them.
+	BanIDs IDSet
+
+	// PickIDs holds the IDs of the -pickID switch. If not empty, the decoder formats only their trices and skips the others.
+	PickIDs IDSet
+
+	// SkipHidden lets the decoder skip also the trices, which the channel filters would suppress after formatting.
+	SkipHidden = true
+
+	// LineOpen is set by the text output before each Read, when its actual line is not complete.
+	// Then the decoder formats a trice hidden by the log level nevertheless, because its line end is needed.
+	LineOpen bool
+)
+
+// idSetSize is the count of the 14-bit trice IDs.
+const idSetSize = 1 << 14
+
+// IDSet is a bitmap of trice IDs and usable as multi flag.
+type IDSet struct {
+	bits  [idSetSize / 64]uint64
+	count int
+}
+
+// String method is the needed for interface satisfaction.
+func (p *IDSet) String() string {
+	var ids []string
+	for i := 0; i < idSetSize; i++ {
+		if p.Has(id.TriceID(i)) {
+			ids = append(ids, strconv.Itoa(i))
+		}
+	}
+	return strings.Join(ids, ",")
+}
+
+// Set is a needed method for multi flags. It adds a comma separated list of IDs and ID ranges like "100,200-299".
+func (p *IDSet) Set(value string) error {
+	for _, f := range strings.Split(value, ",") {
+		if f = strings.TrimSpace(f); f == "" {
+			continue
+		}
+		first, last, isRange := strings.Cut(f, "-")
+		lo, err := strconv.ParseUint(strings.TrimSpace(first), 10, 14)
+		hi := lo
+		if err == nil && isRange {
+			hi, err = strconv.ParseUint(strings.TrimSpace(last), 10, 14)
+		}
+		if err != nil || hi < lo {
+			return fmt.Errorf("invalid ID or ID range %q", f)
+		}
+		for i := lo; i <= hi; i++ {
+			p.Add(id.TriceID(i))
+		}
+	}
+	return nil
+}
+
+// Add inserts tid into p.
+func (p *IDSet) Add(tid id.TriceID) {
+	if !p.Has(tid) {
+		p.bits[tid%idSetSize/64] |= 1 << (tid % 64)
+		p.count++
+	}
+}
+
+// Has reports, if tid is inside p.
+func (p *IDSet) Has(tid id.TriceID) bool {
+	return p.bits[tid%idSetSize/64]&(1<<(tid%64)) != 0
+}
+
+// Len returns the ID count of p.
+func (p *IDSet) Len() int {
+	return p.count
+}
+
+// IDVisible reports, if trices with tid are to be formatted according to BanIDs and PickIDs.
+func IDVisible(tid id.TriceID) bool {
+	return !BanIDs.Has(tid) && (PickIDs.count == 0 || PickIDs.Has(tid))
+}
+
+// VisibleIDs holds for each ID the decision, if the decoder formats its trices.
+// It is resolved once per ID look-up table, so hidden trices cost no formatting and no filtering later.
+type VisibleIDs struct {
+	hidden  IDSet // hidden are the IDs not to format.
+	byLevel IDSet // byLevel are the hidden IDs, which the log level hides. They count nevertheless as channel events.
+}
+
+// NewVisibleIDs resolves the visibility of all IDs according to BanIDs and PickIDs and
+// for the IDs inside lut additionally with filter, which gets the ID format string.
+func NewVisibleIDs(lut id.TriceIDLookUp, filter func(strg string) (visible, byLevel bool)) *VisibleIDs {
+	v := new(VisibleIDs)
+	if BanIDs.count > 0 || PickIDs.count > 0 {
+		for i := 0; i < idSetSize; i++ {
+			if !IDVisible(id.TriceID(i)) {
+				v.hidden.Add(id.TriceID(i))
+			}
+		}
+	}
+	if filter == nil {
+		return v
+	}
+	for tid, f := range lut {
+		if v.hidden.Has(tid) {
+			continue
+		}
+		if visible, byLevel := filter(f.Strg); !visible {
+			v.hidden.Add(tid)
+			if byLevel {
+				v.byLevel.Add(tid)
+			}
+		}
+	}
+	return v
+}
+
+// Visible reports, if trices with tid are to be formatted.
+func (p *VisibleIDs) Visible(tid id.TriceID) bool {
+	return !p.hidden.Has(tid)
+}
+
+// ByLevel reports, if the log level hides the trices with tid.
+func (p *VisibleIDs) ByLevel(tid id.TriceID) bool {
+	return p.byLevel.Has(tid)
+}
+
+// Hidden returns the count of hidden IDs.
+func (p *VisibleIDs) Hidden() int {
+	return p.hidden.count
+}
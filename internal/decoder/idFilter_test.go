@@ -0,0 +1,36 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package decoder
+
+import (
+	"testing"
+
+	"github.com/rokath/trice/internal/id"
+	"github.com/tj/assert"
+)
+
+func TestIDSet(t *testing.T) {
+	var s IDSet
+	assert.Nil(t, s.Set("100, 200-203"))
+	assert.Nil(t, s.Set("16383,101,100"))
+	assert.Equal(t, 7, s.Len())
+	assert.Equal(t, "100,101,200,201,202,203,16383", s.String())
+	assert.True(t, s.Has(202))
+	assert.False(t, s.Has(199))
+	for _, v := range []string{"x", "5-3", "16384", "1-", "-3"} {
+		assert.NotNil(t, s.Set(v), v)
+	}
+}
+
+func TestIDVisible(t *testing.T) {
+	defer func() { BanIDs, PickIDs = IDSet{}, IDSet{} }()
+	assert.True(t, IDVisible(100))
+	assert.Nil(t, BanIDs.Set("100"))
+	assert.False(t, IDVisible(100))
+	assert.True(t, IDVisible(101))
+	assert.Nil(t, PickIDs.Set("100-102"))
+	assert.False(t, IDVisible(id.TriceID(100)))
+	assert.True(t, IDVisible(101))
+	assert.False(t, IDVisible(103))
+}
@@ -0,0 +1,345 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package decoder
+
+// structured trice output
+
+import (
+	"bufio"
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"io"
+	"math"
+	"strconv"
+	"time"
+	"unicode/utf8"
+
+	"github.com/rokath/trice/internal/id"
+)
+
+// Record is a decoded trice for the structured output formats.
+//
+// Decoder messages like cycle errors are records with ID 0.
+type Record struct {
+	ID        id.TriceID    // ID is the trice ID.
+	Host      time.Time     // Host is the host reception time.
+	StampSize int           // StampSize is the target stamp byte count 0, 2, 4 or 8. With 0 Stamp is not valid.
+	Stamp     uint64        // Stamp is the target stamp unwrapped into a 64-bit timeline.
+	Channel   string        // Channel is the lower case channel like "err" or "msg" or empty.
+	File      string        // File is the source file from the location information or empty.
+	Line      int           // Line is the source line from the location information or 0.
+	Values    []interface{} // Values are the typed trice parameter values: uint64, int64, float32, float64, bool or string.
+	Msg       string        // Msg is the formatted message without channel and line end.
+}
+
+// RecordWriter writes records as NDJSON or length prefixed binary data.
+//
+// NDJSON is one JSON object per line. Fields with zero values, except "id", "host" and "msg", are omitted:
+//
+//	{"id":3713,"host":1700000000123456789,"stamp":4711,"channel":"msg","file":"main.c","line":12,"values":[440],"msg":"START select = 440"}
+//
+// The binary form is per record a uvarint byte count followed by the fields, all integers as uvarint,
+// signed ones zig-zag encoded like encoding/binary.PutVarint, strings as uvarint length and bytes:
+//
+//	id, host nanoseconds (varint), stamp size, [stamp,] channel, file, line, value count, values, msg
+//
+// Each value is a kind byte ('u', 'i', 'f', 'b', 's') followed by an uvarint, varint, 8 bytes little endian IEEE 754,
+// 1 byte or string. ReadRecord decodes it. float32 values become float64 values in the binary form.
+type RecordWriter struct {
+	w      *bufio.Writer
+	binary bool
+	buf    []byte // buf is reused for each record.
+}
+
+// NewRecordWriter returns a buffered record writer for format "ndjson" or "binary". Flush writes the buffered records.
+func NewRecordWriter(w io.Writer, format string) (*RecordWriter, error) {
+	p := &RecordWriter{w: bufio.NewWriterSize(w, 64*1024), buf: make([]byte, 0, 1024)}
+	switch format {
+	case "ndjson":
+	case "binary":
+		p.binary = true
+	default:
+		return nil, fmt.Errorf("unknown record format %q", format)
+	}
+	return p, nil
+}
+
+// Write encodes r into the buffered writer.
+func (p *RecordWriter) Write(r *Record) error {
+	if p.binary {
+		p.buf = appendRecordBinary(p.buf[:0], r)
+		var head [binary.MaxVarintLen64]byte
+		if _, err := p.w.Write(head[:binary.PutUvarint(head[:], uint64(len(p.buf)))]); err != nil {
+			return err
+		}
+	} else {
+		p.buf = appendRecordJSON(p.buf[:0], r)
+	}
+	_, err := p.w.Write(p.buf)
+	return err
+}
+
+// Flush writes the buffered records to the underlying writer.
+func (p *RecordWriter) Flush() error {
+	return p.w.Flush()
+}
+
+// appendRecordJSON appends r as JSON object and a newline to b.
+func appendRecordJSON(b []byte, r *Record) []byte {
+	b = append(b, `{"id":`...)
+	b = strconv.AppendUint(b, uint64(r.ID), 10)
+	b = append(b, `,"host":`...)
+	b = strconv.AppendInt(b, r.Host.UnixNano(), 10)
+	if r.StampSize != 0 {
+		b = append(b, `,"stamp":`...)
+		b = strconv.AppendUint(b, r.Stamp, 10)
+	}
+	if r.Channel != "" {
+		b = append(b, `,"channel":`...)
+		b = appendJSONString(b, r.Channel)
+	}
+	if r.File != "" {
+		b = append(b, `,"file":`...)
+		b = appendJSONString(b, r.File)
+		b = append(b, `,"line":`...)
+		b = strconv.AppendInt(b, int64(r.Line), 10)
+	}
+	if len(r.Values) > 0 {
+		b = append(b, `,"values":[`...)
+		for i, v := range r.Values {
+			if i > 0 {
+				b = append(b, ',')
+			}
+			b = appendJSONValue(b, v)
+		}
+		b = append(b, ']')
+	}
+	b = append(b, `,"msg":`...)
+	b = appendJSONString(b, r.Msg)
+	return append(b, "}\n"...)
+}
+
+// appendJSONValue appends v as JSON value to b. Not finite floats are appended as strings.
+func appendJSONValue(b []byte, v interface{}) []byte {
+	switch x := v.(type) {
+	case uint64:
+		return strconv.AppendUint(b, x, 10)
+	case int64:
+		return strconv.AppendInt(b, x, 10)
+	case float32:
+		return appendJSONFloat(b, float64(x), 32)
+	case float64:
+		return appendJSONFloat(b, x, 64)
+	case bool:
+		return strconv.AppendBool(b, x)
+	case string:
+		return appendJSONString(b, x)
+	}
+	return appendJSONString(b, fmt.Sprint(v))
+}
+
+// appendJSONFloat appends f with the shortest representation for bitSize as JSON number or as string, when f is not finite.
+func appendJSONFloat(b []byte, f float64, bitSize int) []byte {
+	if math.IsNaN(f) || math.IsInf(f, 0) {
+		return appendJSONString(b, strconv.FormatFloat(f, 'g', -1, bitSize))
+	}
+	return strconv.AppendFloat(b, f, 'g', -1, bitSize)
+}
+
+// appendJSONString appends s as quoted JSON string to b. Invalid UTF-8 is replaced by U+FFFD.
+func appendJSONString(b []byte, s string) []byte {
+	const hex = "0123456789abcdef"
+	b = append(b, '"')
+	start := 0
+	for i := 0; i < len(s); {
+		c := s[i]
+		if c >= 0x20 && c != '"' && c != '\\' && c < utf8.RuneSelf {
+			i++
+			continue
+		}
+		if c < utf8.RuneSelf {
+			b = append(b, s[start:i]...)
+			switch c {
+			case '"', '\\':
+				b = append(b, '\\', c)
+			case '\n':
+				b = append(b, '\\', 'n')
+			case '\r':
+				b = append(b, '\\', 'r')
+			case '\t':
+				b = append(b, '\\', 't')
+			default:
+				b = append(b, '\\', 'u', '0', '0', hex[c>>4], hex[c&0xF])
+			}
+			i++
+			start = i
+			continue
+		}
+		r, size := utf8.DecodeRuneInString(s[i:])
+		if r == utf8.RuneError && size == 1 {
+			b = append(b, s[start:i]...)
+			b = append(b, `�`...)
+			i++
+			start = i
+			continue
+		}
+		i += size
+	}
+	b = append(b, s[start:]...)
+	return append(b, '"')
+}
+
+// appendRecordBinary appends the binary record fields of r without the leading byte count to b.
+func appendRecordBinary(b []byte, r *Record) []byte {
+	b = binary.AppendUvarint(b, uint64(r.ID))
+	b = binary.AppendVarint(b, r.Host.UnixNano())
+	b = binary.AppendUvarint(b, uint64(r.StampSize))
+	if r.StampSize != 0 {
+		b = binary.AppendUvarint(b, r.Stamp)
+	}
+	b = appendBinaryString(b, r.Channel)
+	b = appendBinaryString(b, r.File)
+	b = binary.AppendUvarint(b, uint64(r.Line))
+	b = binary.AppendUvarint(b, uint64(len(r.Values)))
+	for _, v := range r.Values {
+		switch x := v.(type) {
+		case uint64:
+			b = binary.AppendUvarint(append(b, 'u'), x)
+		case int64:
+			b = binary.AppendVarint(append(b, 'i'), x)
+		case float32:
+			b = binary.LittleEndian.AppendUint64(append(b, 'f'), math.Float64bits(float64(x)))
+		case float64:
+			b = binary.LittleEndian.AppendUint64(append(b, 'f'), math.Float64bits(x))
+		case bool:
+			if x {
+				b = append(b, 'b', 1)
+			} else {
+				b = append(b, 'b', 0)
+			}
+		default:
+			s, ok := v.(string)
+			if !ok {
+				s = fmt.Sprint(v)
+			}
+			b = appendBinaryString(append(b, 's'), s)
+		}
+	}
+	return appendBinaryString(b, r.Msg)
+}
+
+// appendBinaryString appends the length of s as uvarint and s to b.
+func appendBinaryString(b []byte, s string) []byte {
+	return append(binary.AppendUvarint(b, uint64(len(s))), s...)
+}
+
+// errRecord is returned by ReadRecord for inconsistent binary records.
+var errRecord = errors.New("inconsistent binary record")
+
+// ReadRecord reads the next binary record written by a RecordWriter from r into rec.
+// It returns io.EOF, when r has no more records.
+func ReadRecord(r *bufio.Reader, rec *Record) error {
+	size, err := binary.ReadUvarint(r)
+	if err != nil {
+		return err
+	}
+	b := make([]byte, size)
+	if _, err := io.ReadFull(r, b); err != nil {
+		return io.ErrUnexpectedEOF
+	}
+	d := recordDecoder{b: b}
+	*rec = Record{}
+	rec.ID = id.TriceID(d.uvarint())
+	rec.Host = time.Unix(0, d.varint())
+	rec.StampSize = int(d.uvarint())
+	if rec.StampSize != 0 {
+		rec.Stamp = d.uvarint()
+	}
+	rec.Channel = d.string()
+	rec.File = d.string()
+	rec.Line = int(d.uvarint())
+	count := d.uvarint()
+	if count > uint64(len(b)) {
+		return errRecord
+	}
+	for i := uint64(0); i < count && d.err == nil; i++ {
+		switch d.byte() {
+		case 'u':
+			rec.Values = append(rec.Values, d.uvarint())
+		case 'i':
+			rec.Values = append(rec.Values, d.varint())
+		case 'f':
+			rec.Values = append(rec.Values, math.Float64frombits(d.uint64()))
+		case 'b':
+			rec.Values = append(rec.Values, d.byte() != 0)
+		case 's':
+			rec.Values = append(rec.Values, d.string())
+		default:
+			d.err = errRecord
+		}
+	}
+	rec.Msg = d.string()
+	if d.err == nil && len(d.b) != 0 {
+		d.err = errRecord
+	}
+	return d.err
+}
+
+// recordDecoder consumes the fields of a binary record. After the first error all results are zero.
+type recordDecoder struct {
+	b   []byte
+	err error
+}
+
+func (d *recordDecoder) uvarint() uint64 {
+	v, n := binary.Uvarint(d.b)
+	if n <= 0 || d.err != nil {
+		d.err = errRecord
+		return 0
+	}
+	d.b = d.b[n:]
+	return v
+}
+
+func (d *recordDecoder) varint() int64 {
+	v, n := binary.Varint(d.b)
+	if n <= 0 || d.err != nil {
+		d.err = errRecord
+		return 0
+	}
+	d.b = d.b[n:]
+	return v
+}
+
+func (d *recordDecoder) byte() byte {
+	if len(d.b) < 1 || d.err != nil {
+		d.err = errRecord
+		return 0
+	}
+	c := d.b[0]
+	d.b = d.b[1:]
+	return c
+}
+
+func (d *recordDecoder) uint64() uint64 {
+	if len(d.b) < 8 || d.err != nil {
+		d.err = errRecord
+		return 0
+	}
+	v := binary.LittleEndian.Uint64(d.b)
+	d.b = d.b[8:]
+	return v
+}
+
+func (d *recordDecoder) string() string {
+	n := d.uvarint()
+	if n > uint64(len(d.b)) || d.err != nil {
+		d.err = errRecord
+		return ""
+	}
+	s := string(d.b[:n])
+	d.b = d.b[n:]
+	return s
+}
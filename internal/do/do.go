@@ -24,7 +24,17 @@ import (
 )
 
 var (
+	// TCPOutAddr is the address, where trice listens for TCP clients receiving the trice output.
 	TCPOutAddr = ""
+
+	// TCPQueueSize is the line count, a TCP client can lag behind, before lines get dropped.
+	TCPQueueSize = 1000
+
+	// TCPDropPolicy tells, what happens, when a TCP client lags TCPQueueSize lines behind: "oldest", "newest" or "disconnect".
+	TCPDropPolicy = "oldest"
+
+	// TCPReplay is the count of last lines, each new TCP client gets first.
+	TCPReplay = 0
 )
 
 // distributeArgs is distributing values used in several packages.
@@ -92,34 +102,22 @@ func evaluateColorPalette(w io.Writer) {
 	}
 }
 
+// tcpWriter returns a tcpHub listening on TCPOutAddr or ioutil.Discard, if TCPOutAddr is empty.
 func tcpWriter() io.Writer {
 	if TCPOutAddr == "" {
 		return ioutil.Discard
 	}
+	switch TCPDropPolicy {
+	case "oldest", "newest", "disconnect":
+	default:
+		fmt.Println("Ignoring unknown -tcpDrop", TCPDropPolicy, "using oldest.")
+		TCPDropPolicy = "oldest"
+	}
 	// The net.Listen() function makes the program a TCP server. This functions returns a Listener variable, which is a generic network listener for stream-oriented protocols.
 	fmt.Println("Listening on " + TCPOutAddr + "...")
 	listen, err := net.Listen("tcp", TCPOutAddr)
 	if err != nil {
 		log.Fatal(err)
 	}
-	defer listen.Close()
-
-	// t is only after a successful call to Accept() that the TCP server can begin to interact with TCP clients.
-	TCPConn, err := listen.Accept()
-	fmt.Println("Accepting connection:", TCPConn)
-	if err != nil {
-		log.Fatal(err)
-	}
-	// Make a buffer to hold incoming data.
-	buf := make([]byte, 1024)
-	reqLen, err := TCPConn.Read(buf)
-	if err != nil {
-		fmt.Println("Error reading:", err.Error())
-	}
-	fmt.Println(string(buf[:reqLen]))
-	TCPConn.Write([]byte("Trice connected...\r\n"))
-
-	//defer TCPConn.Close()
-	return TCPConn
-
+	return newTCPHub(listen, TCPQueueSize, TCPDropPolicy, TCPReplay)
 }
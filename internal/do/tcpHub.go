@@ -0,0 +1,220 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package do
+
+// TCP output for any number of clients
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"net"
+	"sync"
+)
+
+// tcpGreeting is sent to each new client first.
+const tcpGreeting = "Trice connected...\r\n"
+
+// tcpHub is an io.Writer, which distributes the written trice output line by line to all connected TCP clients.
+//
+// Clients can connect and disconnect at any time. Each client has its own bounded line queue and goroutine
+// for the network writes, so Write never waits for a client. When a client queue is full, the drop policy decides:
+//   - "oldest": The oldest queued line is dropped to make room for the new one.
+//   - "newest": The new line is dropped.
+//   - "disconnect": The client is disconnected.
+type tcpHub struct {
+	ln        net.Listener
+	queueSize int
+	policy    string
+
+	mu      sync.Mutex
+	clients map[*tcpClient]struct{}
+	partial []byte   // partial is the not yet terminated last line.
+	replay  [][]byte // replay is a ring buffer with the last written lines for late joiners.
+	next    int      // next is the replay index for the next line, when the ring buffer is full.
+	closed  bool
+}
+
+// tcpClient is a connected TCP client.
+type tcpClient struct {
+	conn    net.Conn
+	queue   chan []byte
+	done    chan struct{}
+	dropped int // dropped is the count of lines not sent to the client.
+}
+
+// newTCPHub returns a hub accepting clients on ln. queueSize is the line count, each client can lag behind,
+// policy is the drop policy and each new client gets the last replayLines lines first.
+func newTCPHub(ln net.Listener, queueSize int, policy string, replayLines int) *tcpHub {
+	if queueSize < 1 {
+		queueSize = 1
+	}
+	if replayLines < 0 {
+		replayLines = 0
+	}
+	h := &tcpHub{
+		ln:        ln,
+		queueSize: queueSize,
+		policy:    policy,
+		clients:   make(map[*tcpClient]struct{}),
+		replay:    make([][]byte, 0, replayLines),
+	}
+	go h.accept()
+	return h
+}
+
+// accept serves new clients until the listener is closed.
+func (h *tcpHub) accept() {
+	for {
+		conn, err := h.ln.Accept()
+		if err != nil {
+			return
+		}
+		c := &tcpClient{conn: conn, queue: make(chan []byte, h.queueSize), done: make(chan struct{})}
+		h.mu.Lock()
+		if h.closed {
+			h.mu.Unlock()
+			conn.Close()
+			return
+		}
+		backlog := h.replayLines()
+		h.clients[c] = struct{}{}
+		h.mu.Unlock()
+		fmt.Println("Accepting connection from", conn.RemoteAddr())
+		go h.send(c, backlog)
+		go h.discardInput(c)
+	}
+}
+
+// replayLines returns the lines in the replay buffer in their order. h.mu must be locked.
+func (h *tcpHub) replayLines() [][]byte {
+	lines := make([][]byte, 0, len(h.replay))
+	lines = append(lines, h.replay[h.next:]...)
+	return append(lines, h.replay[:h.next]...)
+}
+
+// send writes the greeting, the backlog and then the queued lines to c.
+// It collects all queued lines into one network write to keep the system calls low with many clients.
+func (h *tcpHub) send(c *tcpClient, backlog [][]byte) {
+	buf := []byte(tcpGreeting)
+	for _, line := range backlog {
+		buf = append(buf, line...)
+	}
+	for {
+		if len(buf) > 0 {
+			if _, err := c.conn.Write(buf); err != nil {
+				h.remove(c)
+				return
+			}
+			buf = buf[:0]
+		}
+		select {
+		case <-c.done:
+			return
+		case line := <-c.queue:
+			buf = append(buf, line...)
+		}
+		for more := true; more; {
+			select {
+			case line := <-c.queue:
+				buf = append(buf, line...)
+			default:
+				more = false
+			}
+		}
+	}
+}
+
+// discardInput reads and ignores the client input, like the telnet negotiation of Putty, until the client disconnects.
+func (h *tcpHub) discardInput(c *tcpClient) {
+	io.Copy(io.Discard, c.conn) //nolint:errcheck
+	h.remove(c)
+}
+
+// remove disconnects c.
+func (h *tcpHub) remove(c *tcpClient) {
+	h.mu.Lock()
+	defer h.mu.Unlock()
+	h.removeLocked(c)
+}
+
+// removeLocked disconnects c. h.mu must be locked.
+func (h *tcpHub) removeLocked(c *tcpClient) {
+	if _, ok := h.clients[c]; !ok {
+		return
+	}
+	delete(h.clients, c)
+	close(c.done)
+	c.conn.Close()
+	if c.dropped > 0 {
+		fmt.Println("Closing connection from", c.conn.RemoteAddr(), "after dropping", c.dropped, "lines")
+	} else {
+		fmt.Println("Closing connection from", c.conn.RemoteAddr())
+	}
+}
+
+// Write distributes the complete lines inside b to all clients and keeps an unterminated rest for the next call.
+// It never blocks on a client and never fails.
+func (h *tcpHub) Write(b []byte) (n int, err error) {
+	h.mu.Lock()
+	defer h.mu.Unlock()
+	n = len(b)
+	for len(b) > 0 {
+		i := bytes.IndexByte(b, '\n')
+		if i < 0 {
+			h.partial = append(h.partial, b...)
+			return
+		}
+		line := make([]byte, 0, len(h.partial)+i+1) // Each line is a new slice, shared read-only by the client queues.
+		line = append(append(line, h.partial...), b[:i+1]...)
+		h.partial = h.partial[:0]
+		b = b[i+1:]
+		h.distribute(line)
+	}
+	return
+}
+
+// distribute queues line for each client and keeps it for replay. h.mu must be locked.
+func (h *tcpHub) distribute(line []byte) {
+	if cap(h.replay) > 0 {
+		if len(h.replay) < cap(h.replay) {
+			h.replay = append(h.replay, line)
+		} else {
+			h.replay[h.next] = line
+			h.next = (h.next + 1) % len(h.replay)
+		}
+	}
+	for c := range h.clients {
+		select {
+		case c.queue <- line:
+			continue
+		default:
+		}
+		switch h.policy {
+		case "newest":
+			c.dropped++
+		case "disconnect":
+			c.dropped++
+			h.removeLocked(c)
+		default: // "oldest"
+			select {
+			case <-c.queue:
+				c.dropped++
+			default: // The send goroutine took a line meanwhile.
+			}
+			c.queue <- line // Only Write sends, so there is room now.
+		}
+	}
+}
+
+// Close stops accepting new clients and disconnects all clients.
+func (h *tcpHub) Close() error {
+	h.mu.Lock()
+	defer h.mu.Unlock()
+	h.closed = true
+	for c := range h.clients {
+		h.removeLocked(c)
+	}
+	return h.ln.Close()
+}
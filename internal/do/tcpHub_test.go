@@ -0,0 +1,182 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+// white-box test
+package do
+
+import (
+	"bufio"
+	"fmt"
+	"io"
+	"net"
+	"strings"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/tj/assert"
+)
+
+// startHub returns a hub listening on a free loopback port.
+func startHub(t testing.TB, queueSize int, policy string, replayLines int) *tcpHub {
+	ln, err := net.Listen("tcp", "127.0.0.1:0")
+	assert.Nil(t, err)
+	return newTCPHub(ln, queueSize, policy, replayLines)
+}
+
+// dial connects to h, reads the greeting and waits until h knows the client.
+func dial(t testing.TB, h *tcpHub) (net.Conn, *bufio.Reader) {
+	h.mu.Lock()
+	n := len(h.clients)
+	h.mu.Unlock()
+	conn, err := net.Dial("tcp", h.ln.Addr().String())
+	assert.Nil(t, err)
+	r := bufio.NewReader(conn)
+	assert.Equal(t, tcpGreeting, readLine(t, conn, r))
+	waitClients(t, h, n+1)
+	return conn, r
+}
+
+// readLine reads one line from r with a timeout.
+func readLine(t testing.TB, conn net.Conn, r *bufio.Reader) string {
+	conn.SetReadDeadline(time.Now().Add(5 * time.Second))
+	s, err := r.ReadString('\n')
+	assert.Nil(t, err)
+	return s
+}
+
+// waitClients waits until h has n clients.
+func waitClients(t testing.TB, h *tcpHub, n int) {
+	deadline := time.Now().Add(5 * time.Second)
+	for {
+		h.mu.Lock()
+		m := len(h.clients)
+		h.mu.Unlock()
+		if m == n {
+			return
+		}
+		if time.Now().After(deadline) {
+			t.Fatal("expected", n, "clients, have", m)
+		}
+		time.Sleep(time.Millisecond)
+	}
+}
+
+// TestTCPHubClients checks, that all clients get the same lines, partial lines get completed and late joiners get the replay.
+func TestTCPHubClients(t *testing.T) {
+	h := startHub(t, 100, "oldest", 2)
+	defer h.Close()
+	h.Write([]byte("before 1\nbefore 2\nbefore 3\n"))
+
+	c0, r0 := dial(t, h)
+	assert.Equal(t, "before 2\n", readLine(t, c0, r0))
+	assert.Equal(t, "before 3\n", readLine(t, c0, r0))
+
+	h.Write([]byte("a "))
+	h.Write([]byte("b"))
+	c1, r1 := dial(t, h)
+	assert.Equal(t, "before 2\n", readLine(t, c1, r1))
+	assert.Equal(t, "before 3\n", readLine(t, c1, r1))
+	h.Write([]byte(" c\nd\n"))
+	for _, c := range []struct {
+		conn net.Conn
+		r    *bufio.Reader
+	}{{c0, r0}, {c1, r1}} {
+		assert.Equal(t, "a b c\n", readLine(t, c.conn, c.r))
+		assert.Equal(t, "d\n", readLine(t, c.conn, c.r))
+	}
+
+	c0.Close()
+	waitClients(t, h, 1)
+	h.Write([]byte("e\n"))
+	assert.Equal(t, "e\n", readLine(t, c1, r1))
+}
+
+// TestTCPHubSlowClient writes much more data, than a not reading client and the socket buffers can take.
+// The writes must not block, the fast client must get all lines and the slow client loses lines or
+// its connection according to the drop policy. The writer waits now and then for the fast client
+// to keep it inside its queue also on a slow test machine.
+func TestTCPHubSlowClient(t *testing.T) {
+	for _, policy := range []string{"oldest", "newest", "disconnect"} {
+		t.Run(policy, func(t *testing.T) {
+			h := startHub(t, 2000, policy, 0)
+			defer h.Close()
+			slow, _ := dial(t, h)
+			defer slow.Close()
+			fast, r := dial(t, h)
+			defer fast.Close()
+
+			var count int64
+			received := make(chan error)
+			go func() {
+				for {
+					fast.SetReadDeadline(time.Now().Add(5 * time.Second))
+					s, err := r.ReadString('\n')
+					if err != nil {
+						received <- err
+						return
+					}
+					if s == "end\n" {
+						received <- nil
+						return
+					}
+					atomic.AddInt64(&count, 1)
+				}
+			}()
+
+			const lines = 50000 // 50 MB
+			line := []byte(strings.Repeat("x", 999) + "\n")
+			var inWrite time.Duration
+			for i := 0; i < lines; i++ {
+				if i%500 == 0 {
+					deadline := time.Now().Add(5 * time.Second)
+					for atomic.LoadInt64(&count) < int64(i-500) && time.Now().Before(deadline) {
+						time.Sleep(100 * time.Microsecond)
+					}
+				}
+				start := time.Now()
+				h.Write(line)
+				inWrite += time.Since(start)
+			}
+			assert.True(t, inWrite < 10*time.Second, fmt.Sprint(inWrite))
+
+			if policy == "disconnect" {
+				waitClients(t, h, 1)
+			} else {
+				dropped := 0
+				h.mu.Lock()
+				for c := range h.clients {
+					dropped += c.dropped
+				}
+				h.mu.Unlock()
+				assert.True(t, dropped > 0)
+			}
+			h.Write([]byte("end\n"))
+			assert.Nil(t, <-received)
+			assert.Equal(t, int64(lines), atomic.LoadInt64(&count))
+		})
+	}
+}
+
+// BenchmarkTCPHub measures the cost of the hub writes for the decode loop with 0, 1 and 32 reading clients.
+func BenchmarkTCPHub(b *testing.B) {
+	line := []byte("time:    12.345_678default: MSG: triceFifoMaxDepth = 144, select = 0\n")
+	for _, n := range []int{0, 1, 32} {
+		b.Run(fmt.Sprint(n, "clients"), func(b *testing.B) {
+			h := startHub(b, 1000, "oldest", 0)
+			defer h.Close()
+			for i := 0; i < n; i++ {
+				conn, err := net.Dial("tcp", h.ln.Addr().String())
+				assert.Nil(b, err)
+				defer conn.Close()
+				go io.Copy(io.Discard, conn) //nolint:errcheck
+			}
+			waitClients(b, h, n)
+			b.SetBytes(int64(len(line)))
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				h.Write(line)
+			}
+		})
+	}
+}
@@ -7,7 +7,6 @@ package dumpDecoder
 import (
 	"fmt"
 	"io"
-	"sync"
 
 	"github.com/rokath/trice/internal/decoder"
 	"github.com/rokath/trice/internal/id"
@@ -20,13 +19,12 @@ type dumpDec struct {
 }
 
 // New provides a hex dump option for incoming bytes.
-func New(w io.Writer, lut id.TriceIDLookUp, m *sync.RWMutex, li id.TriceIDLookUpLI, in io.Reader, endian bool) decoder.Decoder {
+func New(w io.Writer, lut *id.LutSnapshot, li id.TriceIDLookUpLI, in io.Reader, endian bool) decoder.Decoder {
 	p := &dumpDec{}
 	p.W = w
 	p.In = in
 	p.IBuf = make([]byte, 0, decoder.DefaultSize)
 	p.Lut = lut
-	p.LutMutex = m
 	p.Endian = endian
 	p.dumpCnt = 0 // needs =0 initialization for test table tests
 	return p
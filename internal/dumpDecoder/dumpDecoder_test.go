@@ -16,7 +16,7 @@ import (
 func doDUMPtableTest(t *testing.T, out io.Writer, f decoder.New, endianness bool, teTa decoder.TestTable) {
 	for _, x := range teTa {
 		buf := make([]byte, decoder.DefaultSize)
-		dec := f(out, nil, nil, nil, nil, endianness) // a new decoder instance
+		dec := f(out, nil, nil, nil, endianness) // a new decoder instance
 		in := ioutil.NopCloser(bytes.NewBuffer(x.In))
 		dec.SetInput(in)
 		var err error
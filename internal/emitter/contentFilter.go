@@ -0,0 +1,160 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package emitter
+
+// content filtering
+
+import (
+	"fmt"
+)
+
+var (
+	// Include holds the patterns of the -include switch. If not empty, only trice strings containing at least one of them are displayed.
+	Include ContentFilter
+
+	// Exclude holds the patterns of the -exclude switch. Trice strings containing one of them are not displayed.
+	Exclude ContentFilter
+)
+
+// ContentFilter is a multi flag collecting substring patterns, which are compiled once into an Aho-Corasick automaton.
+// It finds any of the patterns in a single pass over the trice string, independent of the pattern count.
+type ContentFilter struct {
+	patterns []string
+	m        *matcher // m is nil until the first match after a pattern change.
+}
+
+// String method is the needed for interface satisfaction.
+func (p *ContentFilter) String() string {
+	return fmt.Sprintf("%v", p.patterns)
+}
+
+// Set is a needed method for multi flags. Each call adds one pattern.
+func (p *ContentFilter) Set(pattern string) error {
+	p.patterns = append(p.patterns, pattern)
+	p.m = nil
+	return nil
+}
+
+// Patterns returns the patterns of p.
+func (p *ContentFilter) Patterns() []string {
+	return p.patterns
+}
+
+// Active reports, if p has patterns.
+func (p *ContentFilter) Active() bool {
+	return len(p.patterns) > 0
+}
+
+// Match reports, if b contains at least one pattern of p.
+func (p *ContentFilter) Match(b []byte) bool {
+	if p.m == nil {
+		p.m = newMatcher(p.patterns)
+	}
+	return p.m.match(b)
+}
+
+// contentFilter returns false, if b is to be suppressed according to Include and Exclude.
+func contentFilter(b []byte) bool {
+	if Include.Active() && !Include.Match(b) {
+		return false
+	}
+	return !Exclude.Active() || !Exclude.Match(b)
+}
+
+// matcher is an Aho-Corasick automaton, converted into a deterministic state machine.
+// The bytes not occurring in any pattern share one input class, which keeps the transition table small.
+type matcher struct {
+	class [256]uint8 // class maps each byte to its column in next. Column 0 is for all bytes not used in patterns.
+	width int        // width is the column count of next.
+	next  []int32    // next[state*width+class] is the following state. State 0 is the start state.
+	out   []bool     // out[state] is true, if a pattern ends in state or in one of its suffix states.
+}
+
+// newMatcher compiles patterns. An empty pattern matches everything.
+func newMatcher(patterns []string) *matcher {
+	var used [256]bool
+	count := 0
+	for _, s := range patterns {
+		for i := 0; i < len(s); i++ {
+			if !used[s[i]] {
+				used[s[i]] = true
+				count++
+			}
+		}
+	}
+	m := &matcher{width: 1}
+	for c := range used {
+		if count == 256 { // all bytes are used: one column per byte
+			m.class[c] = uint8(c)
+			m.width = 256
+		} else if used[c] {
+			m.class[c] = uint8(m.width)
+			m.width++
+		}
+	}
+
+	// trie
+	m.addState()
+	for _, s := range patterns {
+		state := int32(0)
+		for i := 0; i < len(s); i++ {
+			k := int(state)*m.width + int(m.class[s[i]])
+			if m.next[k] < 0 {
+				m.next[k] = m.addState()
+			}
+			state = m.next[k]
+		}
+		m.out[state] = true
+	}
+
+	// The breadth first traversal replaces the missing transitions by the transitions of the longest suffix state.
+	fail := make([]int32, len(m.out))
+	queue := make([]int32, 0, len(m.out))
+	for c := 0; c < m.width; c++ {
+		if t := m.next[c]; t < 0 {
+			m.next[c] = 0
+		} else {
+			queue = append(queue, t) // fail[t] is 0
+		}
+	}
+	for len(queue) > 0 {
+		s := queue[0]
+		queue = queue[1:]
+		m.out[s] = m.out[s] || m.out[fail[s]]
+		row, failRow := int(s)*m.width, int(fail[s])*m.width
+		for c := 0; c < m.width; c++ {
+			if t := m.next[row+c]; t < 0 {
+				m.next[row+c] = m.next[failRow+c]
+			} else {
+				fail[t] = m.next[failRow+c]
+				queue = append(queue, t)
+			}
+		}
+	}
+	return m
+}
+
+// addState appends a state without transitions and returns its number.
+func (m *matcher) addState() int32 {
+	for c := 0; c < m.width; c++ {
+		m.next = append(m.next, -1)
+	}
+	m.out = append(m.out, false)
+	return int32(len(m.out) - 1)
+}
+
+// match reports, if b contains a pattern.
+func (m *matcher) match(b []byte) bool {
+	if m.out[0] {
+		return true
+	}
+	var state int32
+	for _, x := range b {
+		state = m.next[int(state)*m.width+int(m.class[x])]
+		if m.out[state] {
+			return true
+		}
+	}
+	return false
+}
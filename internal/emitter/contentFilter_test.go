@@ -0,0 +1,129 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package emitter
+
+import (
+	"fmt"
+	"math/rand"
+	"strings"
+	"testing"
+
+	"github.com/stretchr/testify/assert"
+)
+
+// containsAny is the reference implementation of matcher.match.
+func containsAny(s string, patterns []string) bool {
+	for _, p := range patterns {
+		if strings.Contains(s, p) {
+			return true
+		}
+	}
+	return false
+}
+
+// randomString returns a string of length n with bytes out of alphabet.
+func randomString(r *rand.Rand, alphabet string, n int) string {
+	b := make([]byte, n)
+	for i := range b {
+		b[i] = alphabet[r.Intn(len(alphabet))]
+	}
+	return string(b)
+}
+
+func TestMatcher(t *testing.T) {
+	tt := []struct {
+		patterns []string
+		s        string
+		exp      bool
+	}{
+		{nil, "abc", false},
+		{[]string{""}, "abc", true},
+		{[]string{"he", "she", "his", "hers"}, "ushers", true},
+		{[]string{"he", "she", "his", "hers"}, "ahis", true},
+		{[]string{"he", "she", "his", "hers"}, "shx", false},
+		{[]string{"abcd", "bc"}, "abce", true}, // match inside a failed longer pattern
+		{[]string{"aab"}, "aaab", true},
+		{[]string{"err:"}, "wrn:err", false},
+		{[]string{"\x00\xff"}, "a\x00\xffb", true},
+	}
+	for _, x := range tt {
+		assert.Equal(t, x.exp, newMatcher(x.patterns).match([]byte(x.s)), fmt.Sprint(x.patterns, " ", x.s))
+	}
+}
+
+// TestMatcherRandom compares the matcher with strings.Contains for random patterns over a small alphabet.
+func TestMatcherRandom(t *testing.T) {
+	r := rand.New(rand.NewSource(1))
+	for i := 0; i < 200; i++ {
+		patterns := make([]string, 1+r.Intn(20))
+		for k := range patterns {
+			patterns[k] = randomString(r, "abcd", 1+r.Intn(5))
+		}
+		m := newMatcher(patterns)
+		for k := 0; k < 50; k++ {
+			s := randomString(r, "abcde", r.Intn(30))
+			assert.Equal(t, containsAny(s, patterns), m.match([]byte(s)), fmt.Sprint(patterns, " ", s))
+		}
+	}
+}
+
+// TestMatcherAllBytes checks patterns using all 256 byte values.
+func TestMatcherAllBytes(t *testing.T) {
+	var patterns []string
+	for i := 0; i < 256; i += 2 {
+		patterns = append(patterns, string([]byte{byte(i), byte(i + 1)}))
+	}
+	m := newMatcher(patterns)
+	assert.Equal(t, 256, m.width)
+	assert.True(t, m.match([]byte{7, 6, 7}))
+	assert.False(t, m.match([]byte{7, 6, 5}))
+}
+
+func TestBanOrPickFilterContent(t *testing.T) {
+	defer func() { Include, Exclude = ContentFilter{}, ContentFilter{} }()
+	b := []byte("msg:sensor 7 ok")
+	assert.Equal(t, len(b), BanOrPickFilter(b))
+	assert.Nil(t, Include.Set("sensor"))
+	assert.Nil(t, Include.Set("err:"))
+	assert.Equal(t, len(b), BanOrPickFilter(b))
+	assert.Equal(t, 0, BanOrPickFilter([]byte("msg:motor 7 ok")))
+	assert.Nil(t, Exclude.Set(" ok"))
+	assert.Equal(t, 0, BanOrPickFilter(b))
+	assert.Equal(t, 17, BanOrPickFilter([]byte("err:motor 7 fails")))
+}
+
+// benchmarkPatterns returns n patterns like "sensor123:".
+func benchmarkPatterns(n int) []string {
+	p := make([]string, n)
+	for i := range p {
+		p[i] = fmt.Sprintf("sensor%d:", 1000+i)
+	}
+	return p
+}
+
+// benchmarkLine is a typical trice string without any of the benchmarkPatterns.
+var benchmarkLine = []byte("msg:sensor 4711: temperature = 23.5 degree, humidity = 47 percent, state = idle\n")
+
+// BenchmarkMatcher searches 1000 patterns inside a trice string with the Aho-Corasick automaton.
+func BenchmarkMatcher(b *testing.B) {
+	m := newMatcher(benchmarkPatterns(1000))
+	b.SetBytes(int64(len(benchmarkLine)))
+	for i := 0; i < b.N; i++ {
+		if m.match(benchmarkLine) {
+			b.Fatal("unexpected match")
+		}
+	}
+}
+
+// BenchmarkContainsAny searches 1000 patterns inside a trice string one by one for comparison.
+func BenchmarkContainsAny(b *testing.B) {
+	patterns := benchmarkPatterns(1000)
+	s := string(benchmarkLine)
+	b.SetBytes(int64(len(benchmarkLine)))
+	for i := 0; i < b.N; i++ {
+		if containsAny(s, patterns) {
+			b.Fatal("unexpected match")
+		}
+	}
+}
@@ -5,6 +5,7 @@
 package emitter
 
 import (
+	"bytes"
 	"fmt"
 	"io"
 	"os"
@@ -153,40 +154,95 @@ func setPrefix() {
 }
 
 // BanOrPickFilter returns len of b if b ist not filtered out, otherwise 0.
-// If Ban and Pick are nil nothing is filtered out.
+// If Ban and Pick are nil nothing is filtered out by channel.
 // If Ban and Pick are both not nil this is a fatal error (os.Exit).
 // If b starts with a known channel specifier existent in Ban 0, is returned.
 // If b starts with a known channel specifier existent in Pick len of b, is returned.
+// Additionally b is filtered out, if it does not contain an Include pattern or if it contains an Exclude pattern.
 func BanOrPickFilter(b []byte) (n int) {
-	return banOrPickFilter(Ban, Pick, b)
+	if banOrPickFilter(Ban, Pick, b) == 0 || !contentFilter(b) {
+		return 0
+	}
+	return len(b)
 }
 
 func banOrPickFilter(ban, pick channelArrayFlag, b []byte) int {
 	if ban == nil && pick == nil {
 		return len(b) // nothing to filter
 	}
-	msg.FatalInfoOnTrue(nil != Ban && nil != Pick, "switches -ban and -pick cannot be used together")
-	s := string(b)
-	sc := strings.SplitN(s, ":", 2) // example: "deb" -> []string{ "deb"} "deb:" -> []string{ "deb", "" }
-	if nil != Ban {
-		if len(sc) < 2 { // no color separator
+	msg.FatalInfoOnTrue(nil != ban && nil != pick, "switches -ban and -pick cannot be used together")
+	i := bytes.IndexByte(b, ':') // example: "deb" -> -1, "deb:" -> 3
+	if nil != ban {
+		if i < 0 { // no color separator
 			return len(b) // nothing to filter
 		}
-		for _, c := range Ban {
-			if sc[0] == c {
+		for _, c := range ban {
+			if string(b[:i]) == c { // no allocation
 				return 0 // filter match
 			}
 		}
 		return len(b) // no filter match
-	} else { // Pick is set
-		if len(sc) < 2 { // no color separator
+	} else { // pick is set
+		if i < 0 { // no color separator
 			return 0 // filter out
 		}
-		for _, c := range Pick {
-			if sc[0] == c {
+		for _, c := range pick {
+			if string(b[:i]) == c {
 				return len(b) // filter match
 			}
 		}
 		return 0 // no filter match
 	}
 }
+
+// TriceVisibility resolves, if a trice with the format string strg passes the channel filters -ban and -pick
+// and for text output also -logLevel. The trice values are not needed for that, when strg starts with a
+// constant channel like "err:" or has no channel at all. Otherwise visible is true and the filters apply later.
+// byLevel is true for a trice hidden by -logLevel. The text output counts it nevertheless as channel event
+// and its line end completes a started line, so it is hidden only at a line start.
+func TriceVisibility(strg string, text bool) (visible, byLevel bool) {
+	i := strings.IndexAny(strg, ":%")
+	if i >= 0 && strg[i] == '%' { // the channel could be a value
+		return true, false
+	}
+	if banOrPickFilter(Ban, Pick, []byte(strg)) == 0 {
+		return false, false
+	}
+	if !text || LogLevel == "all" {
+		return true, false
+	}
+	if LogLevel == "off" {
+		return false, false
+	}
+	if i < 0 { // no channel, no log level
+		return true, false
+	}
+	if j := strings.Index(strg, `\n`); j != len(strg)-2 { // the log level applies to each line and a missing line end continues the line
+		return true, false
+	}
+	var logLev, logThreshold int
+	for k, cc := range colorChannels { // like in colorize
+		for _, c := range cc.channel {
+			if c == strg[:i] {
+				logLev = k
+			}
+			if c == LogLevel {
+				logThreshold = k
+			}
+		}
+	}
+	return logLev <= logThreshold, logLev > logThreshold
+}
+
+// CountChannelEvent counts the channel event of the format string strg like the text output does for displayed trices.
+func CountChannelEvent(strg string) {
+	if i := strings.IndexByte(strg, ':'); i > 0 {
+		for k, cc := range colorChannels {
+			for _, c := range cc.channel {
+				if c == strg[:i] {
+					colorChannels[k].events++
+				}
+			}
+		}
+	}
+}
@@ -184,6 +184,20 @@ func isChannel(ch string) bool {
 	return cv != nil
 }
 
+// SplitChannel returns the lower case channel of s and the message without the channel prefix and line end.
+// If s does not start with a known channel like "msg:" or "ERR:", channel is empty and msg is s without line end.
+// The `\n` sequences, the decoders use as line ends like the trice format strings, are line ends as well.
+func SplitChannel(s string) (channel, msg string) {
+	msg = strings.TrimRight(strings.TrimSuffix(s, `\n`), "\r\n")
+	if strings.Contains(msg, `\n`) {
+		msg = strings.ReplaceAll(msg, `\n`, "\n")
+	}
+	if i := strings.IndexByte(msg, ':'); i > 0 && isChannel(msg[:i]) {
+		return strings.ToLower(msg[:i]), msg[i+1:]
+	}
+	return "", msg
+}
+
 // colorize prefixes s with an ansi color code according to these conditions:
 // If p.colorPalette is "off", do nothing.
 // If p.colorPalette is "none" remove only lower case channel info "col:"
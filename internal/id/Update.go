@@ -106,14 +106,14 @@ var (
 // text is the full file contents, which could be modified, therefore it is also returned with a modified flag
 func updateParamCountAndID0(w io.Writer, text string, extendMacroName bool) (string, bool) {
 	var modified bool
-	subs := text[:] // create a copy of text and assign it to subs
+	lx := newCLexer(text) // lx keeps the unmodified text
 	for {
-		loc := matchFullAnyTrice.FindStringIndex(subs) // find the next TRICE location in file
-		if nil == loc {
+		c, ok := lx.next() // find the next TRICE location in file
+		if !ok {
 			return text, modified // done
 		}
-		trice := subs[loc[0]:loc[1]] // the whole TRICE*(*);
-		triceC := trice              // make a copy
+		trice := lx.s[c.name[0] : c.close+1] // the whole TRICE*(*)
+		triceC := trice                      // make a copy
 		if extendMacroName {
 			locNoLen := matchTriceNoLen.FindStringIndex(trice) // find the next TRICE no len location in trice
 			if nil != locNoLen {                               // need to add len to trice name
@@ -157,7 +157,6 @@ func updateParamCountAndID0(w io.Writer, text string, extendMacroName bool) (str
 		if modified {
 			text = strings.Replace(text, trice, triceC, 1) // this works, because a trice gets changed only once
 		}
-		subs = subs[loc[1]:] // The replacement makes text not shorter, so next search can start at loc[1]
 	}
 }
 
@@ -220,12 +219,12 @@ func refreshList(w io.Writer, fSys *afero.Afero, root string, ilu TriceIDLookUp,
 // - replace.Type( Id(0), ...) with.Type( Id(n), ...)
 // - find duplicate.Type( Id(n), ...) and replace one of them if *Trices* are not identical
 // - extend file fnIDList
-func idsUpdate(w io.Writer, fSys *afero.Afero, root string, ilu TriceIDLookUp, flu triceFmtLookUp, pListModified *bool, lim TriceIDLookUpLI) {
+func idsUpdate(w io.Writer, fSys *afero.Afero, root string, ilu TriceIDLookUp, flu triceFmtLookUp, pListModified *bool, lim TriceIDLookUpLI, space *idSpace) {
 	if Verbose && FnJSON != "emptyFile" {
 		fmt.Fprintln(w, "dir=", root)
 		fmt.Fprintln(w, "List=", FnJSON)
 	}
-	msg.FatalInfoOnErr(fSys.Walk(root, visitUpdate(w, fSys, ilu, flu, pListModified, lim)), "failed to walk tree")
+	msg.FatalInfoOnErr(fSys.Walk(root, visitUpdate(w, fSys, ilu, flu, pListModified, lim, space)), "failed to walk tree")
 }
 
 func readFile(w io.Writer, fSys *afero.Afero, path string, fi os.FileInfo, err error) (string, error) {
@@ -272,7 +271,7 @@ func isCFile(path string) bool {
 	return false
 }
 
-func visitUpdate(w io.Writer, fSys *afero.Afero, ilu TriceIDLookUp, flu triceFmtLookUp, pListModified *bool, lim TriceIDLookUpLI) filepath.WalkFunc {
+func visitUpdate(w io.Writer, fSys *afero.Afero, ilu TriceIDLookUp, flu triceFmtLookUp, pListModified *bool, lim TriceIDLookUpLI, space *idSpace) filepath.WalkFunc {
 	// WalkFunc is the type of the function called for each file or directory
 	// visited by Walk. The path argument contains the argument to Walk as a
 	// prefix; that is, if Walk is called with "dir", which is a directory
@@ -296,9 +295,9 @@ func visitUpdate(w io.Writer, fSys *afero.Afero, ilu TriceIDLookUp, flu triceFmt
 		fileName := filepath.Base(path)
 
 		// todo: each file is parsed 3 times -> put this in one function
-		textN, fileModified0 := updateParamCountAndID0(w, text, ExtendMacrosWithParamCount)                                           // update parameter count: TRICE* to TRICE*_n
-		textU, fileModified1 := updateIDsUniqOrShared(w, false /*SharedIDs*/, Min, Max, SearchMethod, textN, ilu, flu, pListModified) // update IDs: Id(0) -> Id(M)
-		refreshIDs(w, fileName, textU, ilu, flu, lim)                                                                                 // workaround: do it again to update li.json.
+		textN, fileModified0 := updateParamCountAndID0(w, text, ExtendMacrosWithParamCount)                                        // update parameter count: TRICE* to TRICE*_n
+		textU, fileModified1 := updateIDsUniqOrShared(w, false /*SharedIDs*/, space, SearchMethod, textN, ilu, flu, pListModified) // update IDs: Id(0) -> Id(M)
+		refreshIDs(w, fileName, textU, ilu, flu, lim)                                                                              // workaround: do it again to update li.json.
 
 		// write out
 		fileModified := fileModified0 || fileModified1 /*|| fileModified2*/
@@ -392,20 +391,19 @@ func triceParse(t string) (nbID string, id TriceID, tf TriceFmt, found idType) {
 
 // refreshIDs parses text for valid trices tf and adds them to ilu & flu and updates location information map lim.
 func refreshIDs(w io.Writer, fileName, text string, ilu TriceIDLookUp, flu triceFmtLookUp, lim TriceIDLookUpLI) {
-	subs := text[:] // create a copy of text and assign it to subs
-	line := 1       // source code lines start with 1 for some reason
+	lx := newCLexer(text)
 	var li TriceLI
 	li.File = filepath.Base(fileName)
 	for {
-		loc := matchNbTRICE.FindStringSubmatchIndex(subs) // find the next TRICE location in file
-		if nil == loc {
+		c, ok := lx.next() // find the next TRICE location in file
+		if !ok {
 			return // done
 		}
-		line += strings.Count(subs[:loc[0]], "\n")
-		nbTRICE := subs[loc[0]:loc[1]] // full trice expression with Id(n)
-		// prepare subs for next loop
-		subs = subs[loc[1]:] // A possible Id(0) replacement makes subs not shorter, so next search can start at loc[1].
-		// A case like 'TRICE*( Id(                             0                              ), "");' is not expected.
+		if c.id < 0 {
+			continue // no Id(n)
+		}
+		nbTRICE := text[c.name[0] : c.close+1] // full trice expression with Id(n)
+		line := c.line
 
 		_, id, tf, _ /*found*/ := triceParse(nbTRICE)
 		//  if found == idTypeS8 {
@@ -456,18 +454,19 @@ const (
 // flu holds the tf in upper case.
 // ilu holds the tf in source code case. If in source code upper and lower case occur, than only one can be in ilu.
 // sharedIDs, if true, reuses IDs for identical format strings.
-func updateIDsUniqOrShared(w io.Writer, _ /*sharedIDs*/ bool, min, max TriceID, searchMethod string, text string, ilu TriceIDLookUp, flu triceFmtLookUp, pListModified *bool) (string, bool) {
+// space holds the free IDs. It is created once per update run and each ID used in text gets marked as used inside it.
+func updateIDsUniqOrShared(w io.Writer, _ /*sharedIDs*/ bool, space *idSpace, searchMethod string, text string, ilu TriceIDLookUp, flu triceFmtLookUp, pListModified *bool) (string, bool) {
 	var fileModified bool
-	subs := text[:] // create a copy of text and assign it to subs
+	lx := newCLexer(text) // lx keeps the unmodified text
 	for {
-		loc := matchNbTRICE.FindStringIndex(subs) // find the next TRICE location in file
-		if nil == loc {
+		c, ok := lx.next() // find the next TRICE location in file
+		if !ok {
 			return text, fileModified // done
 		}
-		nbTRICE := subs[loc[0]:loc[1]] // full trice expression with Id(n)
-		// prepare subs for next loop
-		subs = subs[loc[1]:] // A possible Id(0) replacement makes subs not shorter, so next search can start at loc[1].
-		// A case like 'TRICE*( Id(                             0                              ), "");' is not expected.
+		if c.id < 0 {
+			continue // no Id(n)
+		}
+		nbTRICE := lx.s[c.name[0] : c.close+1] // full trice expression with Id(n)
 
 		nbID, id, tf, idTypeResult := triceParse(nbTRICE)
 		//if idTypeResult == idTypeS8 {
@@ -502,7 +501,7 @@ func updateIDsUniqOrShared(w io.Writer, _ /*sharedIDs*/ bool, min, max TriceID,
 			//	msg.FatalInfoOnTrue(id == 0, "no id 0 allowed in map")
 			//} else
 			//{ // no, we need a new one
-			id = ilu.newID(w, min, max, searchMethod) // a prerequisite is an in a previous step refreshed lu
+			id = space.newID(w, searchMethod)
 			*pListModified = true
 			//}
 			var nID string // patch the id into text
@@ -530,6 +529,7 @@ func updateIDsUniqOrShared(w io.Writer, _ /*sharedIDs*/ bool, min, max TriceID,
 		// update map: That is needed after an invalid trice or if id:tf is valid but not inside ilu & flu yet, for example after manual code changes or forgotten refresh before update.
 		ilu[id] = tf
 		addID(tf, id, flu)
+		space.use(id)
 	}
 }
 
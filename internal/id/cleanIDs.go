@@ -68,9 +68,11 @@ func cleanTriceIDs(w io.Writer, path string, in []byte, a *ant.Admin) (out []byt
 	var delta int      // offset change cause by ID statement insertion
 	var t TriceFmt     // t is the actual located trice.
 	line := 1          // line counts source code lines, these start with 1.
+
+	m := newTriceMatcher(rest) // m delivers the trice statements of rest in file order.
 	for {
-		idn = 0                 // clear here
-		loc := matchTrice(rest) // loc is the position of the next trice type (statement name with opening parenthesis followed by a format string).
+		idn = 0         // clear here
+		loc := m.next() // loc is the position of the next trice type (statement name with opening parenthesis followed by a format string) inside rest.
 		if loc == nil {
 			break // done
 		}
@@ -6,7 +6,6 @@ package id
 import (
 	"fmt"
 	"io"
-	"sync"
 	"time"
 
 	"github.com/fsnotify/fsnotify"
@@ -14,50 +13,6 @@ import (
 	"github.com/spf13/afero"
 )
 
-// FileWatcher checks the id list file for changes.
-// taken from https://medium.com/@skdomino/watch-this-file-watching-in-go-5b5a247cf71f
-func (lu TriceIDLookUp) FileWatcher(w io.Writer, fSys *afero.Afero, m *sync.RWMutex) {
-
-	// creates a new file watcher
-	watcher, err := fsnotify.NewWatcher()
-	msg.FatalOnErr(err)
-	defer func() { msg.OnErr(watcher.Close()) }()
-
-	done := make(chan bool)
-	go func() {
-		var now, last time.Time
-		for {
-			select {
-			// watch for events
-			case event, ok := <-watcher.Events:
-				fmt.Fprintln(w, "EVENT:", event, ok, time.Now().UTC())
-
-				now = time.Now()
-				diff := now.Sub(last)
-				if diff > 5000*time.Millisecond {
-					fmt.Fprintln(w, "refreshing id.List")
-					m.Lock()
-					msg.FatalOnErr(lu.fromFile(fSys, FnJSON))
-					lu.AddFmtCount(w)
-					m.Unlock()
-					last = time.Now()
-				}
-
-			// watch for errors
-			case err := <-watcher.Errors:
-				fmt.Fprintln(w, "ERROR1", err, time.Now().UTC())
-			}
-		}
-	}()
-
-	// out of the box fsnotify can watch a single file, or a single directory
-	msg.InfoOnErr(watcher.Add(FnJSON), "ERROR2")
-	if Verbose {
-		fmt.Fprintln(w, FnJSON, "watched now for changes")
-	}
-	<-done
-}
-
 // FileWatcher checks the id location information file for changes.
 // taken from https://medium.com/@skdomino/watch-this-file-watching-in-go-5b5a247cf71f
 func (li TriceIDLookUpLI) FileWatcher(w io.Writer, fSys *afero.Afero) {
@@ -0,0 +1,275 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package id
+
+// C code generation for trice macros with more than 12 values
+
+import (
+	"fmt"
+	"io"
+	"path/filepath"
+	"strings"
+
+	"github.com/spf13/afero"
+)
+
+// MaxParamCount is the biggest value count of a trice macro the trice tool is able to decode.
+const MaxParamCount = 32
+
+const (
+	// generatedMinParamCount is the smallest value count needing generated C code. The trice8.h ... trice64.h files cover up to 12 values.
+	generatedMinParamCount = 13
+
+	// triceMaxParamsH is the file name of the generated macro header.
+	triceMaxParamsH = "triceMaxParams.h"
+
+	// triceMaxParamsC is the file name of the generated function wrappers.
+	triceMaxParamsC = "triceMaxParams.c"
+)
+
+var (
+	// GenerateMaxParamCount is the biggest value count the C code is generated for.
+	GenerateMaxParamCount = MaxParamCount
+
+	// GenerateDir is the folder, where the generated C files are written to.
+	GenerateDir = "./"
+
+	// generateBitWidths are the value bit widths the C code is generated for.
+	generateBitWidths = []int{8, 16, 32, 64}
+)
+
+// SubCmdGenerate writes the trice macros and the matching functions for 13 to GenerateMaxParamCount values into GenerateDir.
+func SubCmdGenerate(w io.Writer, fSys *afero.Afero) error {
+	if GenerateMaxParamCount < generatedMinParamCount || MaxParamCount < GenerateMaxParamCount {
+		return fmt.Errorf("invalid max value count %d, valid is %d...%d", GenerateMaxParamCount, generatedMinParamCount, MaxParamCount)
+	}
+	files := []struct {
+		name string
+		code string
+	}{
+		{triceMaxParamsH, generateMaxParamsHeader(GenerateMaxParamCount)},
+		{triceMaxParamsC, generateMaxParamsSource(GenerateMaxParamCount)},
+	}
+	for _, f := range files {
+		fn := filepath.Join(GenerateDir, f.name)
+		if Verbose {
+			fmt.Fprintln(w, "Generating", fn)
+		}
+		if DryRun {
+			continue
+		}
+		if err := fSys.WriteFile(fn, []byte(f.code), 0644); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+// paramList returns "v0, v1, ..., v<n-1>" with each value name optionally wrapped with a cast.
+func paramList(n int, cast string) string {
+	s := make([]string, n)
+	for i := range s {
+		if cast == "" {
+			s[i] = fmt.Sprintf("v%d", i)
+		} else {
+			s[i] = fmt.Sprintf("(%s)(v%d)", cast, i)
+		}
+	}
+	return strings.Join(s, ", ")
+}
+
+// paramDecl returns "typ v0, typ v1, ..., typ v<n-1>".
+func paramDecl(n int, typ string) string {
+	s := make([]string, n)
+	for i := range s {
+		s[i] = fmt.Sprintf("%s v%d", typ, i)
+	}
+	return strings.Join(s, ", ")
+}
+
+// putLines returns the TRICE_PUT statements for n values of bitWidth bits.
+func putLines(bitWidth, n int) (s []string) {
+	switch bitWidth {
+	case 8:
+		for i := 0; i < n; i += 4 {
+			var b []string
+			for k := min(4, n-i) - 1; k >= 0; k-- {
+				b = append(b, fmt.Sprintf("TRICE_BYTE%d(v%d)", k, i+k))
+			}
+			s = append(s, "TRICE_PUT( "+strings.Join(b, " | ")+" );")
+		}
+	case 16:
+		for i := 0; i < n; i += 2 {
+			if i+1 < n {
+				s = append(s, fmt.Sprintf("TRICE_PUT( TRICE_SHORT0(v%d) | TRICE_SHORT1(v%d) );", i, i+1))
+			} else {
+				s = append(s, fmt.Sprintf("TRICE_PUT( TRICE_SHORT0(v%d) );", i))
+			}
+		}
+	case 32:
+		for i := 0; i < n; i++ {
+			s = append(s, fmt.Sprintf("TRICE_PUT( (uint32_t)(v%d) );", i))
+		}
+	case 64:
+		for i := 0; i < n; i++ {
+			s = append(s, fmt.Sprintf("TRICE_PUT64( v%d );", i))
+		}
+	}
+	return
+}
+
+// min returns the smaller of a and b.
+func min(a, b int) int {
+	if a < b {
+		return a
+	}
+	return b
+}
+
+// macro returns a C macro definition with one statement per line.
+func macro(head string, lines []string) string {
+	var b strings.Builder
+	b.WriteString("#define " + head + " \\\n")
+	for i, line := range lines {
+		b.WriteString("    " + line)
+		if i < len(lines)-1 {
+			b.WriteString(" \\")
+		}
+		b.WriteString("\n")
+	}
+	return b.String()
+}
+
+// generateMaxParamsHeader returns the C header code with the trice macros for 13 to max values.
+func generateMaxParamsHeader(max int) string {
+	var b strings.Builder
+	fmt.Fprintf(&b, `//! \file %s
+//! ///////////////////////////////////////////////////////////////////////////
+
+//! generated code - do not edit! Created with "trice generate -max %d".
+//! The macros and functions here extend the trice8.h ... trice64.h definitions up to %d values.
+//! trice.h includes this file when TRICE_MAX_PARAM_COUNT is bigger than 12.
+
+#ifndef TRICE_MAX_PARAMS_H_
+#define TRICE_MAX_PARAMS_H_
+
+//! TRICE_GENERATED_MAX_PARAM_COUNT is the biggest value count of the trice macros generated here.
+#define TRICE_GENERATED_MAX_PARAM_COUNT %d
+
+`, triceMaxParamsH, max, max, max)
+
+	args := make([]string, max+2)
+	counts := make([]string, max+1)
+	for i := range args {
+		args[i] = fmt.Sprintf("a%d", i+1)
+	}
+	for i := range counts {
+		counts[i] = fmt.Sprint(max - i)
+	}
+	fmt.Fprintf(&b, "//! NTH_ARGUMENT just evaluates to the %dth argument.\n", max+2)
+	fmt.Fprintf(&b, "#define NTH_ARGUMENT(%s, ...) a%d\n\n", strings.Join(args, ", "), max+2)
+	fmt.Fprintf(&b, "//! COUNT_ARGUMENTS evaluates to the number of arguments that are passed to the macro, here up to %d.\n", max)
+	fmt.Fprintf(&b, "#define COUNT_ARGUMENTS(...) NTH_ARGUMENT(dummy, ## __VA_ARGS__, %s)\n", strings.Join(counts, ", "))
+
+	for _, w := range generateBitWidths {
+		typ := fmt.Sprintf("uint%d_t", w)
+		fmt.Fprintf(&b, "\n///////////////////////////////////////////////////////////////////////////////\n// %d-bit values\n//\n\n", w)
+		for n := generatedMinParamCount; n <= max; n++ {
+			size := n * w / 8 // payload byte count
+			v := paramList(n, "")
+			put := fmt.Sprintf("TRICE_PUT%d_%d( %s )", w, n, v)
+			fmt.Fprintf(&b, "//! TRICE_PUT%d_%d writes %d %d-bit values.\n", w, n, n, w)
+			b.WriteString(macro(put, putLines(w, n)) + "\n")
+
+			count := fmt.Sprintf("CNTC(%d);", size)
+			if size > 127 {
+				count = fmt.Sprintf("LCNT(%d);", size)
+			}
+			fmt.Fprintf(&b, "//! TRICE%d_%d writes trice data as fast as possible in a buffer.\n", w, n)
+			b.WriteString(macro(fmt.Sprintf("TRICE%d_%d( tid, pFmt, %s )", w, n, v), []string{"TRICE_ENTER tid; " + count, put, "TRICE_LEAVE"}) + "\n")
+
+			fmt.Fprintf(&b, "//! trice%dm_%d writes trice data as fast as possible in a buffer.\n", w, n)
+			b.WriteString(macro(fmt.Sprintf("trice%dm_%d( tid, %s )", w, n, v), []string{
+				"TRICE_ENTER",
+				fmt.Sprintf("TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(%d)<<16) | (0x4000|(tid)) );", size),
+				put,
+				"TRICE_LEAVE"}) + "\n")
+
+			fmt.Fprintf(&b, "//! Trice%dm_%d writes trice data with a 16-bit stamp as fast as possible in a buffer.\n", w, n)
+			b.WriteString(macro(fmt.Sprintf("Trice%dm_%d( tid, %s )", w, n, v), []string{
+				"TRICE_ENTER",
+				"uint16_t ts = TriceStamp16();",
+				"TRICE_PUT(0x80008000|(tid<<16)|tid);",
+				fmt.Sprintf("TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(%d)<<16) | ts );", size),
+				put,
+				"TRICE_LEAVE"}) + "\n")
+
+			fmt.Fprintf(&b, "//! TRice%dm_%d writes trice data with a 32-bit stamp as fast as possible in a buffer.\n", w, n)
+			b.WriteString(macro(fmt.Sprintf("TRice%dm_%d( tid, %s )", w, n, v), []string{
+				"TRICE_ENTER",
+				fmt.Sprintf("TRICE_PUT_ID_TS( tid, %d )", size),
+				put,
+				"TRICE_LEAVE"}) + "\n")
+		}
+
+		b.WriteString("#ifdef TRICE_CLEAN\n\n")
+		for _, name := range []string{"trice", "Trice", "TRice"} {
+			for n := generatedMinParamCount; n <= max; n++ {
+				fmt.Fprintf(&b, "#define %s%d_%d( fmt, %s ) //!< %s%d_%d is a macro calling a function to reduce code size.\n", name, w, n, paramList(n, ""), name, w, n)
+			}
+		}
+		b.WriteString("\n#else // #ifdef TRICE_CLEAN\n\n")
+		for _, name := range []string{"trice", "Trice", "TRice"} {
+			for n := generatedMinParamCount; n <= max; n++ {
+				fmt.Fprintf(&b, "#define %s%d_%d( tid, fmt, %s ) %s%dfn_%d( tid, %s ) //!< %s%d_%d is a macro calling a function to reduce code size.\n",
+					name, w, n, paramList(n, ""), name, w, n, paramList(n, typ), name, w, n)
+			}
+		}
+		b.WriteString("\n")
+		for _, name := range []string{"trice", "Trice", "TRice"} {
+			for n := generatedMinParamCount; n <= max; n++ {
+				fmt.Fprintf(&b, "void %s%dfn_%d( uint16_t tid, %s );\n", name, w, n, paramDecl(n, typ))
+			}
+		}
+		b.WriteString("\n#endif // #else // #ifdef TRICE_CLEAN\n\n")
+
+		fmt.Fprintf(&b, "#if TRICE_DEFAULT_PARAMETER_BIT_WIDTH == %d\n\n", w)
+		for _, name := range []string{"TRICE", "trice", "Trice", "TRice"} {
+			for n := generatedMinParamCount; n <= max; n++ {
+				fmt.Fprintf(&b, "#define %s_%d %s%d_%d //!< Default parameter bit width for %d parameter count %s is %d.\n", name, n, name, w, n, n, name, w)
+			}
+		}
+		fmt.Fprintf(&b, "\n#endif // #if TRICE_DEFAULT_PARAMETER_BIT_WIDTH == %d\n", w)
+	}
+	b.WriteString("\n#endif // #ifndef TRICE_MAX_PARAMS_H_\n")
+	return b.String()
+}
+
+// generateMaxParamsSource returns the C code with the trice functions for 13 to max values.
+func generateMaxParamsSource(max int) string {
+	var b strings.Builder
+	fmt.Fprintf(&b, `//! \file %s
+//! ///////////////////////////////////////////////////////////////////////////
+
+//! generated code - do not edit! Created with "trice generate -max %d".
+
+#include "trice.h"
+
+#if TRICE_MAX_PARAM_COUNT > 12
+`, triceMaxParamsC, max)
+	for _, w := range generateBitWidths {
+		typ := fmt.Sprintf("uint%d_t", w)
+		fmt.Fprintf(&b, "\n#if TRICE_%d_BIT_SUPPORT\n", w)
+		for n := generatedMinParamCount; n <= max; n++ {
+			fmt.Fprintf(&b, "\n#if TRICE_MAX_PARAM_COUNT >= %d\n", n)
+			for _, name := range []string{"trice", "Trice", "TRice"} {
+				fmt.Fprintf(&b, "\nvoid %s%dfn_%d( uint16_t tid, %s ){\n    TRICE_RATE_LIMIT_CHECK( tid )\n    %s%dm_%d( tid, %s );\n}\n", name, w, n, paramDecl(n, typ), name, w, n, paramList(n, ""))
+			}
+			fmt.Fprintf(&b, "\n#endif // #if TRICE_MAX_PARAM_COUNT >= %d\n", n)
+		}
+		fmt.Fprintf(&b, "\n#endif // #if TRICE_%d_BIT_SUPPORT\n", w)
+	}
+	b.WriteString("\n#endif // #if TRICE_MAX_PARAM_COUNT > 12\n")
+	return b.String()
+}
@@ -0,0 +1,37 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package id_test
+
+import (
+	"bytes"
+	"io"
+	"os"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// TestGenerate checks, if the generated files match the ones inside the src folder.
+func TestGenerate(t *testing.T) {
+	fSys := &afero.Afero{Fs: afero.NewMemMapFs()}
+	var b bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&b), fSys, []string{"trice", "generate", "-dst", "gen"}))
+	for _, fn := range []string{"triceMaxParams.h", "triceMaxParams.c"} {
+		exp, e := os.ReadFile("../../src/" + fn)
+		assert.Nil(t, e)
+		act, e := fSys.ReadFile("gen/" + fn)
+		assert.Nil(t, e)
+		assert.True(t, bytes.Equal(exp, act), fn+" differs, run 'trice generate -dst src' inside the repository root")
+	}
+}
+
+// TestGenerateInvalidMax checks, if an out of range value count is refused.
+func TestGenerateInvalidMax(t *testing.T) {
+	fSys := &afero.Afero{Fs: afero.NewMemMapFs()}
+	var b bytes.Buffer
+	assert.NotNil(t, args.Handler(io.Writer(&b), fSys, []string{"trice", "generate", "-max", "12"}))
+	assert.NotNil(t, args.Handler(io.Writer(&b), fSys, []string{"trice", "generate", "-max", "33"}))
+}
@@ -0,0 +1,152 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package id
+
+// free ID management
+
+import (
+	"math/bits"
+	"math/rand"
+)
+
+// randomTries is the count of random picks in idSpace.random before it selects among the free IDs directly.
+const randomTries = 8
+
+// idSpace is the set of free trice IDs inside the interval [min,max].
+//
+// Each ID has a bit in free, so marking an ID as used is O(1) and the lowest or highest free ID
+// is found with a word wise search, instead of scanning the whole look-up map for each new ID.
+type idSpace struct {
+	min, max TriceID
+	free     []uint64 // free holds for each ID min+i the bit i%64 in word i/64, which is set, when the ID is free.
+	count    int      // count is the number of free IDs.
+	lo, hi   int      // lo and hi are the first and last word index, which can contain free IDs. IDs get only used, never freed.
+}
+
+// newIDSpace returns an idSpace with all IDs inside [min,max] free.
+func newIDSpace(min, max TriceID) (s idSpace) {
+	s.min, s.max = min, max
+	if max < min {
+		return
+	}
+	n := int(max-min) + 1
+	s.free = make([]uint64, (n+63)/64)
+	for i := range s.free {
+		s.free[i] = ^uint64(0)
+	}
+	if r := n % 64; r != 0 {
+		s.free[len(s.free)-1] = 1<<r - 1
+	}
+	s.count = n
+	s.hi = len(s.free) - 1
+	return
+}
+
+// newIDSpaceFrom returns an idSpace for [min,max] without the IDs used in ilu or li. li can be nil.
+func newIDSpaceFrom(min, max TriceID, ilu TriceIDLookUp, li TriceIDLookUpLI) idSpace {
+	s := newIDSpace(min, max)
+	for id := range ilu {
+		s.use(id)
+	}
+	for id := range li {
+		s.use(id)
+	}
+	return s
+}
+
+// Len returns the number of free IDs.
+func (s *idSpace) Len() int {
+	return s.count
+}
+
+// isFree returns true, when id is inside [min,max] and not used so far.
+func (s *idSpace) isFree(id TriceID) bool {
+	if id < s.min || id > s.max {
+		return false
+	}
+	i := int(id - s.min)
+	return s.free[i/64]&(1<<(i%64)) != 0
+}
+
+// use marks id as used. IDs outside [min,max] are ignored.
+func (s *idSpace) use(id TriceID) {
+	if !s.isFree(id) {
+		return
+	}
+	i := int(id - s.min)
+	s.free[i/64] &^= 1 << (i % 64)
+	s.count--
+}
+
+// lowest returns the smallest free ID.
+func (s *idSpace) lowest() (TriceID, bool) {
+	for ; s.lo < len(s.free); s.lo++ {
+		if w := s.free[s.lo]; w != 0 {
+			return s.min + TriceID(s.lo*64+bits.TrailingZeros64(w)), true
+		}
+	}
+	return 0, false
+}
+
+// highest returns the biggest free ID.
+func (s *idSpace) highest() (TriceID, bool) {
+	if len(s.free) == 0 { // max < min
+		return 0, false
+	}
+	for ; s.hi >= 0; s.hi-- {
+		if w := s.free[s.hi]; w != 0 {
+			return s.min + TriceID(s.hi*64+63-bits.LeadingZeros64(w)), true
+		}
+	}
+	return 0, false
+}
+
+// random returns a random free ID.
+//
+// It picks randomly inside [min,max] first, what succeeds quickly in a sparsely used space.
+// In a densely used space it selects the n-th free ID with a random n instead.
+func (s *idSpace) random() (TriceID, bool) {
+	if s.count == 0 {
+		return 0, false
+	}
+	interval := int(s.max-s.min) + 1
+	for i := 0; i < randomTries; i++ {
+		if id := s.min + TriceID(rand.Intn(interval)); s.isFree(id) {
+			return id, true
+		}
+	}
+	n := rand.Intn(s.count)
+	for i, w := range s.free {
+		c := bits.OnesCount64(w)
+		if n >= c {
+			n -= c
+			continue
+		}
+		for ; n > 0; n-- {
+			w &= w - 1 // clear lowest set bit
+		}
+		return s.min + TriceID(i*64+bits.TrailingZeros64(w)), true
+	}
+	return 0, false
+}
+
+// get returns a free ID according to searchMethod ("random", "upward" or "downward") without marking it as used.
+func (s *idSpace) get(searchMethod string) (TriceID, bool) {
+	switch searchMethod {
+	case "random":
+		return s.random()
+	case "upward":
+		return s.lowest()
+	default:
+		return s.highest()
+	}
+}
+
+// take returns a free ID according to searchMethod and marks it as used.
+func (s *idSpace) take(searchMethod string) (id TriceID, ok bool) {
+	if id, ok = s.get(searchMethod); ok {
+		s.use(id)
+	}
+	return
+}
@@ -0,0 +1,133 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+// white-box test
+package id
+
+import (
+	"fmt"
+	"math/rand"
+	"testing"
+
+	"github.com/tj/assert"
+)
+
+// TestIDSpaceBounds checks the bit handling at the word borders.
+func TestIDSpaceBounds(t *testing.T) {
+	for _, n := range []int{1, 63, 64, 65, 128, 129} {
+		s := newIDSpace(1000, TriceID(1000+n-1))
+		assert.Equal(t, n, s.Len())
+		id, ok := s.lowest()
+		assert.True(t, ok && id == 1000)
+		id, ok = s.highest()
+		assert.True(t, ok && id == TriceID(1000+n-1))
+		assert.False(t, s.isFree(999))
+		assert.False(t, s.isFree(TriceID(1000+n)))
+		s.use(999) // ignored
+		s.use(TriceID(1000 + n))
+		assert.Equal(t, n, s.Len())
+	}
+	s := newIDSpace(5, 4)
+	assert.Equal(t, 0, s.Len())
+	for _, method := range []string{"random", "upward", "downward"} {
+		_, ok := s.take(method)
+		assert.False(t, ok, method)
+	}
+}
+
+// TestIDSpaceUnique fills randomly used spaces completely with each search method and checks,
+// that each delivered ID is inside the interval, was free and is delivered only once.
+func TestIDSpaceUnique(t *testing.T) {
+	rnd := rand.New(rand.NewSource(1))
+	for _, method := range []string{"random", "upward", "downward"} {
+		for round := 0; round < 50; round++ {
+			min := TriceID(1 + rnd.Intn(1000))
+			max := min + TriceID(rnd.Intn(300))
+			ilu := make(TriceIDLookUp)
+			li := make(TriceIDLookUpLI)
+			used := make(map[TriceID]bool)
+			density := rnd.Float64()
+			for id := min - 10; id <= max+10; id++ {
+				if rnd.Float64() < density {
+					if rnd.Intn(2) == 0 {
+						ilu[id] = TriceFmt{}
+					} else {
+						li[id] = TriceLI{}
+					}
+					used[id] = true
+				}
+			}
+			s := newIDSpaceFrom(min, max, ilu, li)
+			free := 0
+			for id := min; id <= max; id++ {
+				if !used[id] {
+					free++
+				}
+			}
+			assert.Equal(t, free, s.Len())
+
+			var last TriceID
+			for i := 0; i < free; i++ {
+				id, ok := s.take(method)
+				assert.True(t, ok, method)
+				assert.True(t, min <= id && id <= max, fmt.Sprint(method, min, max, id))
+				assert.False(t, used[id], fmt.Sprint(method, " ID ", id, " delivered twice"))
+				switch {
+				case i == 0:
+				case method == "upward":
+					assert.True(t, id > last)
+				case method == "downward":
+					assert.True(t, id < last)
+				}
+				used[id] = true
+				last = id
+			}
+			_, ok := s.take(method)
+			assert.False(t, ok)
+			assert.Equal(t, 0, s.Len())
+		}
+	}
+}
+
+// TestIDSpaceRandomSpread checks, that the fallback selection in a densely used space still reaches all free IDs.
+func TestIDSpaceRandomSpread(t *testing.T) {
+	rand.Seed(2)
+	s := newIDSpace(1, 1000)
+	for id := TriceID(1); id <= 1000; id++ {
+		if id%100 != 0 {
+			s.use(id)
+		}
+	}
+	seen := make(map[TriceID]bool)
+	for i := 0; i < 1000; i++ {
+		id, ok := s.random()
+		assert.True(t, ok && id%100 == 0)
+		seen[id] = true
+	}
+	assert.Equal(t, 10, len(seen))
+}
+
+// BenchmarkIDSpaceInsert10k gets 10000 new IDs inside a 90% used interval, as trice insert does for 10000 new trices.
+func BenchmarkIDSpaceInsert10k(b *testing.B) {
+	const (
+		min = TriceID(1)
+		max = TriceID(100000)
+	)
+	ilu := make(TriceIDLookUp)
+	rnd := rand.New(rand.NewSource(1))
+	for len(ilu) < 90000 {
+		ilu[min+TriceID(rnd.Intn(int(max-min+1)))] = TriceFmt{}
+	}
+	defer func(m string) { SearchMethod = m }(SearchMethod)
+	for _, method := range []string{"random", "upward", "downward"} {
+		b.Run(method, func(b *testing.B) {
+			SearchMethod = method
+			for i := 0; i < b.N; i++ {
+				p := idData{IDSpace: newIDSpaceFrom(min, max, ilu, nil)}
+				for k := 0; k < 10000; k++ {
+					p.newID()
+				}
+			}
+		})
+	}
+}
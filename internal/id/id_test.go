@@ -14,68 +14,63 @@ import (
 
 func TestNewID(t *testing.T) {
 	rand.Seed(0)
-	lut := make(TriceIDLookUp)
 	w := os.Stdout
-	id := lut.newID(w, 32768, 65535, "random")
+	s := newIDSpace(32768, 65535)
+	id := s.newID(w, "random")
 	assert.True(t, id == 45050)
-	id = lut.newID(w, 1, 65535, "downward")
+	s = newIDSpace(1, 65535)
+	id = s.newID(w, "downward")
 	assert.True(t, id == 65535)
-	id = lut.newID(w, 32768, 65535, "upward")
+	s = newIDSpace(32768, 65535)
+	id = s.newID(w, "upward")
 	assert.True(t, id == 32768)
-	id = lut.newID(w, 32768, 65535, "upward")
-	assert.True(t, id == 32768)
-	var i TriceFmt
-	lut[id] = i
-	id = lut.newID(w, 32768, 65535, "upward")
+	id = s.newID(w, "upward")
 	assert.True(t, id == 32769)
 }
 
 func TestNewUpwardID(t *testing.T) {
-	min := TriceID(97)
-	max := TriceID(100)
-	var i TriceFmt
-	lut := make(TriceIDLookUp, 4)
-	lut[98] = i // add
-	lut[99] = i // add
-	id := lut.newUpwardID(min, max)
+	lut := TriceIDLookUp{98: TriceFmt{}}
+	li := TriceIDLookUpLI{99: TriceLI{}}
+	s := newIDSpaceFrom(97, 100, lut, li)
+	id := s.newID(os.Stdout, "upward")
 	assert.True(t, id == 97)
-	lut[id] = i // add
-	id = lut.newUpwardID(min, max)
+	id = s.newID(os.Stdout, "upward")
 	assert.True(t, id == 100)
-	delete(lut, 98)
-	delete(lut, 99)
-	id = lut.newUpwardID(min, max)
-	assert.True(t, id == 98)
+	assert.Equal(t, 0, s.Len())
 }
 
 func TestNewDownwardID(t *testing.T) {
-	min := TriceID(97)
-	max := TriceID(100)
-	var i TriceFmt
-	lut := make(TriceIDLookUp, 4)
-	lut[98] = i // add
-	lut[99] = i // add
-	id := lut.newDownwardID(min, max)
+	lut := TriceIDLookUp{98: TriceFmt{}}
+	li := TriceIDLookUpLI{99: TriceLI{}}
+	s := newIDSpaceFrom(97, 100, lut, li)
+	id := s.newID(os.Stdout, "downward")
 	assert.True(t, id == 100)
-	lut[id] = i // add
-	id = lut.newDownwardID(min, max)
+	id = s.newID(os.Stdout, "downward")
 	assert.True(t, id == 97)
-	delete(lut, 98)
-	delete(lut, 99)
-	id = lut.newDownwardID(min, max)
-	assert.True(t, id == 99)
+	assert.Equal(t, 0, s.Len())
 }
 
 func TestNewRandomID(t *testing.T) {
 	rand.Seed(0)
-	min := TriceID(50)
-	max := TriceID(100)
-	lut := make(TriceIDLookUp, 4)
 	w := os.Stdout
-	id := lut.newRandomID(w, min, max)
+	s := newIDSpace(50, 100)
+	id := s.newID(w, "random")
 	assert.True(t, id == 56)
-	id = lut.newRandomID(w, min, max)
+	id = s.newID(w, "random")
 	assert.True(t, id == 92)
-	id = lut.newRandomID(w, 92, 92)
+	s = newIDSpace(92, 92)
+	id = s.newID(w, "random")
 	assert.True(t, id == 92)
 }
+
+// TestUpdateIDSpace checks, that an update run neither reuses an ID known only from li.json nor an ID used in the sources.
+func TestUpdateIDSpace(t *testing.T) {
+	ilu := make(TriceIDLookUp)
+	flu := ilu.reverseS()
+	space := newIDSpaceFrom(100, 102, ilu, TriceIDLookUpLI{100: {File: "old.c", Line: 7}})
+	var listModified bool
+	act, fileModified := updateIDsUniqOrShared(os.Stdout, false, &space, "upward", `trice( iD(101), "b\n" ); trice( iD(0), "a\n" );`, ilu, flu, &listModified)
+	assert.True(t, fileModified && listModified)
+	assert.Equal(t, `trice( iD(101), "b\n" ); trice( iD(  102), "a\n" );`, act)
+	assert.Equal(t, 0, space.Len())
+}
@@ -0,0 +1,79 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package id
+
+import "strings"
+
+// InlineStrings is set by the insert switch -inlineStrings. Then TRICE_S statements with a string literal
+// as value are rewritten into TRICE statements with the literal inside the format string. This way the
+// constant string gets part of til.json and is not transmitted anymore.
+var InlineStrings bool
+
+// inlineStringLiterals rewrites TRICE_S statements with a string literal value inside text into TRICE statements
+// and returns the result together with the count of rewritten statements. The statements are found with the cLexer,
+// so comments, literals and line continuations are handled the same way as during ID insertion.
+//
+// Example: `TRICE_S( ID(7), "msg:%s\n", "Hello" )` gets `TRICE( ID(0), "msg:Hello\n" )`.
+// The id value is set to 0 to get a new ID during insertion, because the format string changed.
+// A missing id stays missing, so the default stamp size applies as for any other TRICE.
+// Statements, where the format string contains other than exactly one plain %s, are left unchanged.
+func inlineStringLiterals(text string) (string, int) {
+	var b strings.Builder
+	var count int
+	done := 0 // done is the text position up to which text is copied into b.
+	lx := newCLexer(text)
+	for {
+		c, ok := lx.next()
+		if !ok {
+			break
+		}
+		if c.name[0] < done {
+			continue // a trice inside the parameters of the previous one
+		}
+		s, ok := inlineStringLiteral(text, c)
+		if !ok {
+			continue
+		}
+		b.WriteString(text[done:c.name[0]])
+		b.WriteString(s)
+		done = c.close + 1
+		count++
+	}
+	if count == 0 {
+		return text, 0
+	}
+	b.WriteString(text[done:])
+	return b.String(), count
+}
+
+// inlineStringLiteral returns the TRICE statement for the TRICE_S statement c inside text.
+// ok is false, when c is no TRICE_S statement with a format string and a string literal as the only arguments
+// or the format string does not contain exactly one plain %s.
+func inlineStringLiteral(text string, c triceCall) (s string, ok bool) {
+	f := c.id + 1 // f is the index of the format string in c.args.
+	if text[c.name[0]:c.name[1]] != "TRICE_S" || len(c.args) != f+2 || c.fmt[1] != c.args[f][1] {
+		return
+	}
+	v := c.args[f+1]
+	if v[0] == v[1] || text[v[0]] != '"' {
+		return
+	}
+	if l := newCLexer(text); l.literalEnd(v[0]) != v[1] || text[v[1]-1] != '"' || v[1]-v[0] < 2 {
+		return // no single string literal
+	}
+	format, value := text[c.fmt[0]+1:c.fmt[1]-1], text[v[0]+1:v[1]-1]
+	if strings.Count(strings.ReplaceAll(format, "%%", ""), "%") != 1 {
+		return
+	}
+	i := strings.Index(strings.ReplaceAll(format, "%%", "__"), "%s")
+	if i < 0 {
+		return
+	}
+	format = format[:i] + strings.ReplaceAll(value, "%", "%%") + format[i+2:]
+	if c.id < 0 {
+		return `TRICE( "` + format + `" )`, true
+	}
+	idName := text[c.args[c.id][0] : c.args[c.id][0]+2]
+	return `TRICE( ` + idName + `(0), "` + format + `" )`, true
+}
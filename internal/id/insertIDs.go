@@ -94,10 +94,18 @@ func insertTriceIDs(w io.Writer, liPath string, in []byte, a *ant.Admin) (out []
 	var delta int      // offset change cause by ID statement insertion
 	var t TriceFmt     // t is the actual located trice.
 	line := 1          // line counts source code lines, these start with 1.
+	if InlineStrings {
+		var n int
+		if rest, n = inlineStringLiterals(rest); n > 0 {
+			outs = rest
+			modified = true
+		}
+	}
+	m := newTriceMatcher(rest) // m delivers the trice statements of rest in file order.
 	for {
-		idn = 0                 // clear here
-		idN = 0                 // clear here
-		loc := matchTrice(rest) // loc is the position of the next trice type (statement name with opening parenthesis followed by a format string).
+		idn = 0         // clear here
+		idN = 0         // clear here
+		loc := m.next() // loc is the position of the next trice type (statement name with opening parenthesis followed by a format string) inside rest.
 		if loc == nil {
 			break // done
 		}
@@ -197,6 +205,7 @@ func insertTriceIDs(w io.Writer, liPath string, in []byte, a *ant.Admin) (out []
 				fmt.Fprintln(w, "ID found in", liPath, "and used for", t, "is used already in", FnJSON, "for", tt, "- assigning a new ID.")
 			} else { // idn in source is not used in til.json - add idn to til.json
 				idd.idToTrice[idn] = t
+				idd.IDSpace.use(idn) // no new ID for another trice
 				idN = idn
 			}
 		}
@@ -9,6 +9,7 @@ import (
 	"testing"
 
 	"github.com/rokath/trice/internal/args"
+	"github.com/rokath/trice/internal/id"
 	"github.com/spf13/afero"
 	"github.com/tj/assert"
 )
@@ -433,15 +434,47 @@ func TestInsertWithTickInComment(t *testing.T) {
 	var b bytes.Buffer
 	assert.Nil(t, args.Handler(io.Writer(&b), fSys, []string{"trice", "insert", "-IDMin", "100", "-IDMax", "999", "-IDMethod", "downward"}))
 
-	// check modified src file1
+	// check modified src file1: The unbalanced quotes inside the comments do not hide the first trice.
 	expSrc1 := `
 	//""'
 	//"
-	TRice( "x" );
-	//"
 	TRice( iD(999), "x" );
+	//"
+	TRice( iD(998), "x" );
 	`
 	actSrc1, e := fSys.ReadFile(sFn1)
 	assert.Nil(t, e)
 	assert.Equal(t, expSrc1, string(actSrc1))
 }
+
+func TestInsertInlineStrings(t *testing.T) {
+	fSys := &afero.Afero{Fs: afero.NewMemMapFs()}
+
+	assert.Nil(t, fSys.WriteFile("til.json", []byte(``), 0777))
+	assert.Nil(t, fSys.WriteFile("li.json", []byte(``), 0777))
+
+	// create src file
+	src := `
+	TRICE_S( ID(7), "msg:%s\n", "50% done" );
+	TRICE_S( id(0), "msg:%s %d\n", "keep" );
+	TRICE_S( "sig:%s\n", s );
+	TRICE_S( "sig:%s\n", "lit" );
+	`
+	assert.Nil(t, fSys.WriteFile("file.c", []byte(src), 0777))
+
+	// action
+	var b bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&b), fSys, []string{"trice", "insert", "-IDMin", "10", "-IDMax", "20", "-IDMethod", "upward", "-inlineStrings"}))
+	id.InlineStrings = false // The flag keeps its value for the following tests otherwise.
+
+	// check modified src file
+	expSrc := `
+	TRICE( ID(10), "msg:50%% done\n" );
+	TRICE_S( id(11), "msg:%s %d\n", "keep" );
+	TRICE_S( ID(12), "sig:%s\n", s );
+	TRICE( ID(13), "sig:lit\n" );
+	`
+	actSrc, e := fSys.ReadFile("file.c")
+	assert.Nil(t, e)
+	assert.Equal(t, expSrc, string(actSrc))
+}
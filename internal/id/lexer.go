@@ -0,0 +1,322 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package id
+
+// C source code lexer for trice statement discovery
+
+import "strings"
+
+// triceCall is a trice statement found in the source code.
+//
+// All locations are byte offsets into the lexed text. Examples:
+// - TRice( iD(999), "a %d", x )
+// - name  open      fmt         close
+type triceCall struct {
+	name  [2]int   // name is the location of the trice name like "TRice8_2".
+	open  int      // open is the position of the opening parenthesis.
+	close int      // close is the position of the closing parenthesis.
+	args  [][2]int // args are the locations of the comma separated arguments without surrounding white space.
+	id    int      // id is the index of the ID statement like "iD( 12 )" in args or -1, when there is none.
+	fmt   [2]int   // fmt is the location of the format string including the double quotes.
+	line  int      // line is the line number of the trice name, starting with 1.
+}
+
+// loc returns the location in the format of matchTrice.
+func (c triceCall) loc() []int {
+	idStart, idEnd := c.open+1, c.open+1
+	if c.id >= 0 {
+		idStart, idEnd = c.args[c.id][0], c.args[c.id][1]
+	}
+	return []int{c.name[0], c.name[1], c.open + 1, idStart, idEnd, c.fmt[0], c.fmt[1]}
+}
+
+// cLexer streams once through C source code and delivers the trice statements.
+//
+// It knows comments, string and character literals, line continuations and the parenthesis depth,
+// so parentheses or double quotes inside comments and literals do not disturb the parsing.
+// Trice statements inside comments are delivered too, because commented out trices are regarded intentionally.
+type cLexer struct {
+	s       string  // s is the lexed text.
+	pos     int     // pos is the actual read position.
+	end     int     // end is the end of the lexed region, which is len(s) or the end of a comment.
+	line    int     // line is the line number at linePos.
+	linePos int     // linePos is the position up to which the lines are counted.
+	sub     *cLexer // sub lexes the actual comment body.
+}
+
+// newCLexer returns a lexer for s.
+func newCLexer(s string) *cLexer {
+	return &cLexer{s: s, end: len(s), line: 1}
+}
+
+// lineAt returns the line number at pos, which must not be smaller than in the previous call.
+func (l *cLexer) lineAt(pos int) int {
+	l.line += strings.Count(l.s[l.linePos:pos], "\n")
+	l.linePos = pos
+	return l.line
+}
+
+// next returns the next trice statement. ok is false, when the text end is reached.
+func (l *cLexer) next() (c triceCall, ok bool) {
+	for {
+		if l.sub != nil {
+			if c, ok = l.sub.next(); ok {
+				return
+			}
+			l.sub = nil
+		}
+		if l.pos >= l.end {
+			return
+		}
+		b := l.s[l.pos]
+		switch {
+		case b == '/' && l.pos+1 < l.end && (l.s[l.pos+1] == '/' || l.s[l.pos+1] == '*'):
+			start := l.pos + 2
+			var bodyEnd int
+			if l.s[l.pos+1] == '/' {
+				bodyEnd = l.lineEnd(start)
+				l.pos = bodyEnd
+			} else if i := strings.Index(l.s[start:l.end], "*/"); i >= 0 {
+				bodyEnd = start + i
+				l.pos = bodyEnd + 2
+			} else {
+				bodyEnd = l.end
+				l.pos = bodyEnd
+			}
+			l.sub = &cLexer{s: l.s, pos: start, end: bodyEnd, line: l.lineAt(start), linePos: start}
+		case b == '"' || b == '\'':
+			l.pos = l.literalEnd(l.pos)
+		case isIdentChar(b):
+			start := l.pos
+			for l.pos < l.end && isIdentChar(l.s[l.pos]) {
+				l.pos++
+			}
+			if isTriceName(l.s[start:l.pos]) {
+				if c, ok = l.call(start, l.pos); ok {
+					l.pos = c.close + 1
+					return
+				}
+			}
+		default:
+			l.pos++
+		}
+	}
+}
+
+// call parses the trice statement with the name s[nameStart:nameEnd].
+// ok is false, if there is no parenthesized argument list or its first arguments are not an optional ID statement and a format string.
+func (l *cLexer) call(nameStart, nameEnd int) (c triceCall, ok bool) {
+	p := l.skipSpace(nameEnd)
+	if p >= l.end || l.s[p] != '(' {
+		return
+	}
+	c.name = [2]int{nameStart, nameEnd}
+	c.open = p
+	depth := 1
+	argStart := p + 1
+	for p++; p < l.end; {
+		switch b := l.s[p]; b {
+		case '"', '\'':
+			p = l.literalEnd(p)
+			continue
+		case '/':
+			if q := l.commentEnd(p); q != p {
+				p = q
+				continue
+			}
+		case '(', '[', '{':
+			depth++
+		case ')', ']', '}':
+			depth--
+			if depth == 0 {
+				c.args = append(c.args, l.trim(argStart, p))
+				c.close = p
+				return l.site(c)
+			}
+		case ',':
+			if depth == 1 {
+				c.args = append(c.args, l.trim(argStart, p))
+				argStart = p + 1
+			}
+		}
+		p++
+	}
+	return // no closing parenthesis
+}
+
+// site completes c and returns ok, when c has a format string, optionally preceded by a numeric ID statement.
+func (l *cLexer) site(c triceCall) (triceCall, bool) {
+	c.id = -1
+	f := 0
+	if isIDStatement(l.s[c.args[0][0]:c.args[0][1]]) {
+		c.id = 0
+		f = 1
+	}
+	if f >= len(c.args) {
+		return c, false
+	}
+	a := c.args[f]
+	if a[0] == a[1] || l.s[a[0]] != '"' {
+		return c, false
+	}
+	c.fmt = [2]int{a[0], l.literalEnd(a[0])}
+	if l.s[c.fmt[1]-1] != '"' || c.fmt[1]-c.fmt[0] < 2 {
+		return c, false // unterminated
+	}
+	c.line = l.lineAt(c.name[0])
+	return c, true
+}
+
+// literalEnd returns the position behind the string or character literal starting at p.
+// String literals can contain line breaks, as trice insert accepted them always. An unterminated character literal,
+// like an apostrophe in a comment, ends at the line end.
+func (l *cLexer) literalEnd(p int) int {
+	q := l.s[p]
+	for p++; p < l.end; p++ {
+		switch l.s[p] {
+		case '\\':
+			p++ // skip escaped character including a line continuation
+		case q:
+			return p + 1
+		case '\n':
+			if q == '\'' {
+				return p
+			}
+		}
+	}
+	return l.end
+}
+
+// lineEnd returns the position of the line end at or after p, regarding line continuations.
+func (l *cLexer) lineEnd(p int) int {
+	for ; p < l.end; p++ {
+		switch l.s[p] {
+		case '\\':
+			p++
+		case '\n':
+			return p
+		}
+	}
+	return l.end
+}
+
+// commentEnd returns the position behind the comment starting at p or p, if there is no comment.
+func (l *cLexer) commentEnd(p int) int {
+	if p+1 >= l.end {
+		return p
+	}
+	switch l.s[p+1] {
+	case '/':
+		return l.lineEnd(p + 2)
+	case '*':
+		if i := strings.Index(l.s[p+2:l.end], "*/"); i >= 0 {
+			return p + 2 + i + 2
+		}
+		return l.end
+	}
+	return p
+}
+
+// skipSpace returns the position of the next character at or after p, which is no white space and not inside a comment.
+func (l *cLexer) skipSpace(p int) int {
+	for p < l.end {
+		switch l.s[p] {
+		case ' ', '\t', '\r', '\n', '\v', '\f', '\\':
+			p++
+		case '/':
+			q := l.commentEnd(p)
+			if q == p {
+				return p
+			}
+			p = q
+		default:
+			return p
+		}
+	}
+	return p
+}
+
+// trim returns the location of s[start:end] without surrounding white space and leading comments.
+func (l *cLexer) trim(start, end int) [2]int {
+	if start = l.skipSpace(start); start > end {
+		start = end
+	}
+	for end > start && isSpace(l.s[end-1]) {
+		end--
+	}
+	return [2]int{start, end}
+}
+
+// isSpace returns true for white space and the line continuation character.
+func isSpace(b byte) bool {
+	switch b {
+	case ' ', '\t', '\r', '\n', '\v', '\f', '\\':
+		return true
+	}
+	return false
+}
+
+// isIdentChar returns true for characters, which can be part of an identifier or number.
+func isIdentChar(b byte) bool {
+	return b == '_' || '0' <= b && b <= '9' || 'a' <= b && b <= 'z' || 'A' <= b && b <= 'Z'
+}
+
+// isTriceName returns true, if the identifier s is a trice name like trice, Trice8, TRICE16_2 or TRice_S.
+// It matches the same names as patTypNameTRICE.
+func isTriceName(s string) bool {
+	if len(s) < 5 || !strings.EqualFold(s[:5], "trice") {
+		return false
+	}
+	s = s[5:]
+	if s == "0" {
+		return true
+	}
+	for {
+		switch {
+		case strings.HasPrefix(s, "8"):
+			s = s[1:]
+			continue
+		case strings.HasPrefix(s, "16"), strings.HasPrefix(s, "32"), strings.HasPrefix(s, "64"):
+			s = s[2:]
+			continue
+		}
+		break
+	}
+	for len(s) > 0 {
+		if s[0] != '_' {
+			return false
+		}
+		s = s[1:]
+		for len(s) > 0 && s[0] != '_' {
+			switch s[0] {
+			case '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 's', 'S', 'n', 'N', 'b', 'B', 'f', 'F':
+				s = s[1:]
+			default:
+				return false
+			}
+		}
+	}
+	return true
+}
+
+// isIDStatement returns true, if s is an ID statement with a decimal number like "iD( 12 )" in any letter case.
+func isIDStatement(s string) bool {
+	if len(s) < 4 || (s[0] != 'i' && s[0] != 'I') || (s[1] != 'd' && s[1] != 'D') {
+		return false
+	}
+	s = strings.TrimLeft(s[2:], " \t\r\n\\")
+	if len(s) == 0 || s[0] != '(' || s[len(s)-1] != ')' {
+		return false
+	}
+	s = strings.Trim(s[1:len(s)-1], " \t\r\n\\")
+	if s == "" {
+		return false
+	}
+	for i := 0; i < len(s); i++ {
+		if s[i] < '0' || s[i] > '9' {
+			return false
+		}
+	}
+	return true
+}
@@ -0,0 +1,303 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+// white-box test
+package id
+
+import (
+	"fmt"
+	"os"
+	"path/filepath"
+	"strings"
+	"testing"
+
+	"github.com/tj/assert"
+)
+
+// matchTriceRegex is the former regex based matchTrice and the reference for the differential tests.
+// It searches in s for the next trice statement. If not found loc is nil.
+// When found, s[loc[0]:loc[1]] is the typeName and at s[loc[2] is the opening parenthesis behind the typeName.
+// If the found trice statement contains an ID statement, it is s[loc[3]:loc[4]]. Otherwise is loc[3]==loc[4].
+// The associated format string is s[loc[5]:loc[6]].
+//
+// Examples:
+// - TRice( "a" )
+// - 0   12 5 6
+//
+// - TRice   ("a" )
+// - 0   1   25 6
+//
+// - TRice ( iD(999) ,  "a" )
+// - 0   1 2 3     4    5 6
+//
+// - TRice(example,example); "string" )
+// -                     `)`
+// - nil
+// - TRice(id,string); "string" )
+// -               `)`
+// - nil
+func matchTriceRegex(s string) (loc []int) {
+	var offset int
+	var clpIndex int
+start:
+	for {
+		triceStartloc := matchAnyTriceStart.FindStringIndex(s)
+		if triceStartloc == nil { // not found
+			return
+		}
+		for {
+			fmtLoc := matchFormatString(s)
+			if fmtLoc == nil { // not found
+				return
+			}
+			// Check, if there is a closing parenthesis after the format string
+			clpIndex = strings.Index(s[fmtLoc[1]:], `)`)
+			if clpIndex == -1 { // no closing parenthesis found after format string
+				return
+			}
+
+			if fmtLoc[1] < triceStartloc[1] { // formatString ends before typeName, continue with reduced string
+				cut := fmtLoc[1]
+				s = s[cut:]
+				triceStartloc[0] -= cut
+				triceStartloc[1] -= cut
+				offset += cut
+				continue // look for next format string
+			}
+
+			if fmtLoc[0] < triceStartloc[0] { // typeName is inside format string, start over with reduced string
+				cut := fmtLoc[1]
+				s = s[cut:]
+				triceStartloc[0] -= cut
+				triceStartloc[1] -= cut
+				offset += cut
+				goto start // look for next trice start
+			}
+
+			// formatString starts after typeName (normal case)
+			typeNameLoc := matchTypNameTRICE.FindStringIndex(s[triceStartloc[0]:triceStartloc[1]])
+			// now we have: triceStartloc[0], triceStartloc[0]+typeNameLoc[1], triceStartloc[1]:
+			//              TR________________ice                              (
+			rest := s[triceStartloc[1]:fmtLoc[0]]
+			idLoc := matchNbID.FindStringIndex(rest)
+			if idLoc == nil { // no ID statement
+				clpIndex = strings.Index(rest, `)`)
+				// - if `)` is located before format string starts, discard trice
+				// - ExampleY: trice(tid, fmt, ...) ... "y"   ... (y)
+				//  -          0   12 00                5 6
+				//  -                            `)`                       -> discard
+				if clpIndex != -1 { // a closing parenthesis was found before format string
+					return
+				}
+				loc = append(loc, triceStartloc[0], triceStartloc[0]+typeNameLoc[1], triceStartloc[1], 0, 0, fmtLoc[0], fmtLoc[1])
+			} else {
+				loc = append(loc, triceStartloc[0], triceStartloc[0]+typeNameLoc[1], triceStartloc[1], triceStartloc[1]+idLoc[0], triceStartloc[1]+idLoc[1], fmtLoc[0], fmtLoc[1])
+			}
+
+			if offset != 0 {
+				for i := range loc {
+					loc[i] = loc[i] + offset
+				}
+			}
+			return
+		}
+	}
+}
+
+// regexSites returns all trice statements of s found by matchTriceRegex as absolute locations, like insert walks through a file.
+func regexSites(s string) (sites [][]int) {
+	var offset int
+	for {
+		loc := matchTriceRegex(s[offset:])
+		if loc == nil {
+			return
+		}
+		for i := range loc {
+			loc[i] += offset
+		}
+		if loc[3] == loc[4] { // no ID statement
+			loc[3], loc[4] = -1, -1
+		}
+		sites = append(sites, loc)
+		offset = loc[6]
+	}
+}
+
+// lexerSites returns all trice statements of s found by the triceMatcher as absolute locations.
+func lexerSites(s string) (sites [][]int) {
+	m := newTriceMatcher(s)
+	var offset int
+	for {
+		loc := m.next()
+		if loc == nil {
+			return
+		}
+		for i := range loc {
+			loc[i] += offset
+		}
+		if loc[3] == loc[4] { // no ID statement
+			loc[3], loc[4] = -1, -1
+		}
+		sites = append(sites, loc)
+		offset = loc[6]
+	}
+}
+
+// sourceFiles returns the content of all C source files below the repository folders dirs.
+func sourceFiles(t testing.TB, dirs ...string) map[string]string {
+	files := make(map[string]string)
+	for _, d := range dirs {
+		err := filepath.Walk(filepath.Join("..", "..", d), func(path string, fi os.FileInfo, err error) error {
+			if err != nil || fi.IsDir() || !isSourceFile(fi) {
+				return err
+			}
+			b, err := os.ReadFile(path)
+			files[path] = string(b)
+			return err
+		})
+		assert.Nil(t, err)
+	}
+	return files
+}
+
+// siteString returns a readable form of a trice statement location.
+func siteString(s string, loc []int) string {
+	line := 1 + strings.Count(s[:loc[0]], "\n")
+	id := ""
+	if loc[3] >= 0 {
+		id = s[loc[3]:loc[4]] + ", "
+	}
+	return fmt.Sprintf("line %d: %s( %s%s", line, s[loc[0]:loc[1]], id, s[loc[5]:loc[6]])
+}
+
+// TestLexerDifferential compares the lexer with the former regex based parsing for all source files in test/ and examples/.
+// Both must find the same ID statements and format strings at the same locations, except when the regex parsing fails:
+//   - It stops at a trice like name with a parenthesis before the format string, like in a macro definition.
+//   - It loses sync after an unbalanced double quote inside a comment.
+//   - It combines a trice name inside a comment like "TRICE() is ..." with the ID and format string of the next trice.
+//
+// Therefore only the regex findings are checked and the additional lexer findings are logged.
+func TestLexerDifferential(t *testing.T) {
+	files := sourceFiles(t, "test", "examples")
+	assert.True(t, len(files) > 0)
+	var n, more, misparsed int
+	for path, s := range files {
+		ls := make(map[int][]int) // ls holds the lexer findings by format string position.
+		for _, loc := range lexerSites(s) {
+			ls[loc[5]] = loc
+		}
+		for _, loc := range regexSites(s) {
+			n++
+			lloc, ok := ls[loc[5]]
+			assert.True(t, ok, path+" "+siteString(s, loc))
+			if !ok {
+				continue
+			}
+			delete(ls, loc[5])
+			assert.Equal(t, loc[3:], lloc[3:], path+" "+siteString(s, loc))
+			if loc[0] != lloc[0] { // The regex took a trice name before the real one.
+				misparsed++
+				assert.True(t, loc[0] < lloc[0] && strings.Contains(s[loc[2]:lloc[0]], ")"), path+" "+siteString(s, loc))
+				if testing.Verbose() {
+					t.Log(path, "regex:", siteString(s, loc), "lexer:", siteString(s, lloc))
+				}
+			}
+		}
+		more += len(ls)
+		if testing.Verbose() {
+			for _, loc := range ls {
+				t.Log(path, "only lexer:", siteString(s, loc))
+			}
+		}
+	}
+	t.Log(len(files), "files,", n, "trices found by both,", misparsed, "of them with a wrong regex name,", more, "only by the lexer")
+}
+
+// TestLexerEdgeCases checks the cases, where the regex parsing failed.
+func TestLexerEdgeCases(t *testing.T) {
+	testSet := []struct {
+		text string
+		exp  []string // exp are the found format strings.
+	}{
+		{`#define TRice(tid, fmt, ...) f(tid, fmt) // "doc"` + "\n" + `TRice( "a" );`, []string{`"a"`}},
+		{`// A " quote` + "\n" + `TRice( "a" );` + "\n" + `// A " quote` + "\n" + `TRice( "b" );`, []string{`"a"`, `"b"`}},
+		{`char c = '"'; TRice( "a" ); s = "trice( \"x\" )";`, []string{`"a"`}},
+		{`TRice( iD(1), "a )" , f( x, ")" ), y ); trice( Id(2), "b" );`, []string{`"a )"`, `"b"`}},
+		{`/* TRice( "a" ); it's ok */ TRice( "b" );`, []string{`"a"`, `"b"`}},
+		{`TRice /* c */ ( /* iD(3), "c" */ "a" );`, []string{`"a"`}},
+		{`#define X \` + "\n" + `TRice( "a" )`, []string{`"a"`}},
+		{`TRice( iD(name), "a" ); TRiceX( "b" ); TRice8_2( "c", 1, 2 ); triceS( "d" ); Trice16( fmt )`, []string{`"c"`}},
+		{`TRice( "a"`, nil},
+	}
+	for _, x := range testSet {
+		var act []string
+		for _, loc := range lexerSites(x.text) {
+			act = append(act, x.text[loc[5]:loc[6]])
+		}
+		assert.Equal(t, x.exp, act, x.text)
+	}
+}
+
+// TestLexerCall checks the argument spans and line numbers.
+func TestLexerCall(t *testing.T) {
+	s := "// \"\n/* trice( \"x\" ) */\n  TRice16_2( id( 7 ),\n\t\"v=%d, %d\",\n\tf( a, b ), c );\n"
+	lx := newCLexer(s)
+	c, ok := lx.next()
+	assert.True(t, ok)
+	assert.Equal(t, `"x"`, s[c.fmt[0]:c.fmt[1]])
+	assert.Equal(t, 2, c.line)
+	c, ok = lx.next()
+	assert.True(t, ok)
+	assert.Equal(t, 3, c.line)
+	assert.Equal(t, "TRice16_2", s[c.name[0]:c.name[1]])
+	var args []string
+	for _, a := range c.args {
+		args = append(args, s[a[0]:a[1]])
+	}
+	assert.Equal(t, []string{"id( 7 )", `"v=%d, %d"`, "f( a, b )", "c"}, args)
+	assert.Equal(t, 0, c.id)
+	assert.Equal(t, byte(')'), s[c.close])
+	_, ok = lx.next()
+	assert.False(t, ok)
+}
+
+// TestInlineStringLiterals checks, that the TRICE_S rewriting uses the lexer rules.
+func TestInlineStringLiterals(t *testing.T) {
+	testSet := []struct {
+		text, exp string
+		count     int
+	}{
+		{`TRICE_S( iD(7), "a(%s)\n", "x, y)" );`, `TRICE( iD(0), "a(x, y))\n" );`, 1},
+		{`TRICE_S( /* ID(1), */ "a%s", "\"b\"" );`, `TRICE( "a\"b\"" );`, 1},
+		{`TRICE_S( ID(1), "a%s", \` + "\n" + `"b" );`, `TRICE( ID(0), "ab" );`, 1},
+		{`s = "TRICE_S( \"%s\", \"b\" )"; TRICE_S( "%s", "b" "c" ); TRICE_S( "%s", s );`, `s = "TRICE_S( \"%s\", \"b\" )"; TRICE_S( "%s", "b" "c" ); TRICE_S( "%s", s );`, 0},
+		{`TRice_S( "%s", "b" ); TRICE_S( "%s %s", "b" ); TRICE_S( "%s", "b", 1 );`, `TRice_S( "%s", "b" ); TRICE_S( "%s %s", "b" ); TRICE_S( "%s", "b", 1 );`, 0},
+	}
+	for _, x := range testSet {
+		act, count := inlineStringLiterals(x.text)
+		assert.Equal(t, x.exp, act, x.text)
+		assert.Equal(t, x.count, count, x.text)
+	}
+}
+
+// BenchmarkTriceDiscovery measures the throughput of the trice statement search over all source files in test/ and examples/.
+func BenchmarkTriceDiscovery(b *testing.B) {
+	files := sourceFiles(b, "test", "examples")
+	var size int64
+	for _, s := range files {
+		size += int64(len(s))
+	}
+	for _, x := range []struct {
+		name  string
+		sites func(string) [][]int
+	}{{"lexer", lexerSites}, {"regex", regexSites}} {
+		b.Run(x.name, func(b *testing.B) {
+			b.SetBytes(size)
+			for i := 0; i < b.N; i++ {
+				for _, s := range files {
+					x.sites(s)
+				}
+			}
+		})
+	}
+}
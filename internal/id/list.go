@@ -94,7 +94,16 @@ func SubCmdUpdate(w io.Writer, fSys *afero.Afero) error {
 	flu := ilu.reverseS()
 	var listModified bool
 	o := len(ilu)
-	walkSrcs(w, fSys, ilu, flu, &listModified, lim, idsUpdate)
+	li := make(TriceIDLookUpLI)
+	if LIFnJSON != "off" && LIFnJSON != "none" {
+		if b, err := fSys.ReadFile(LIFnJSON); err == nil { // A missing li.json gets created afterwards.
+			msg.FatalOnErr(li.FromJSON(b))
+		}
+	}
+	space := newIDSpaceFrom(Min, Max, ilu, li) // IDs used only in li.json are not reused for new trices.
+	walkSrcs(w, fSys, ilu, flu, &listModified, lim, func(w io.Writer, fSys *afero.Afero, root string, ilu TriceIDLookUp, flu triceFmtLookUp, pListModified *bool, lim TriceIDLookUpLI) {
+		idsUpdate(w, fSys, root, ilu, flu, pListModified, lim, &space)
+	})
 	if Verbose {
 		fmt.Fprintln(w, len(ilu), "ID's in List", FnJSON, "listModified=", listModified)
 	}
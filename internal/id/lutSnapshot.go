@@ -0,0 +1,143 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package id
+
+import (
+	"fmt"
+	"io"
+	"path/filepath"
+	"sync"
+	"sync/atomic"
+	"time"
+
+	"github.com/fsnotify/fsnotify"
+	"github.com/rokath/trice/pkg/msg"
+	"github.com/spf13/afero"
+)
+
+// WatchDelay is the quiet time after the last change of the ID list file, before it is reloaded.
+// Editors and trice insert often write a file in several steps.
+var WatchDelay = 200 * time.Millisecond
+
+// LutSnapshot publishes the ID look-up map for the decoders.
+//
+// A published map is never changed afterwards. A reload builds a new map and swaps the pointer,
+// so the decoders read without locks and see either the old or the new map but never a mix.
+type LutSnapshot struct {
+	p atomic.Pointer[TriceIDLookUp]
+}
+
+// NewLutSnapshot returns a snapshot publishing lu. lu must not be changed afterwards.
+func NewLutSnapshot(lu TriceIDLookUp) *LutSnapshot {
+	s := new(LutSnapshot)
+	s.Store(lu)
+	return s
+}
+
+// Load returns the actual look-up map, which must not be changed.
+// A nil s returns a nil map, what is an empty map for reading.
+func (s *LutSnapshot) Load() TriceIDLookUp {
+	if p := s.Current(); p != nil {
+		return *p
+	}
+	return nil
+}
+
+// Current returns the pointer to the actual look-up map or nil. Each Store publishes a new pointer,
+// so a decoder can keep data derived from the map until the pointer changes.
+func (s *LutSnapshot) Current() *TriceIDLookUp {
+	if s == nil {
+		return nil
+	}
+	return s.p.Load()
+}
+
+// Store publishes lu. lu must not be changed afterwards.
+func (s *LutSnapshot) Store(lu TriceIDLookUp) {
+	s.p.Store(&lu)
+}
+
+// Reload reads the ID list file fn into a new map and publishes it.
+// On error the actual map stays published, so a half written file does not disturb the decoding.
+func (s *LutSnapshot) Reload(w io.Writer, fSys *afero.Afero, fn string) error {
+	b, err := fSys.ReadFile(fn)
+	if err != nil {
+		return err
+	}
+	lu := make(TriceIDLookUp)
+	if err := lu.FromJSON(b); err != nil {
+		return err
+	}
+	lu.AddFmtCount(w)
+	s.Store(lu)
+	return nil
+}
+
+// FileWatcher reloads the ID list file fn into s on changes until the returned stop function is called.
+// This way trice needs NOT to be restarted during development process.
+//
+// The directory of fn is watched, because editors often replace a file instead of writing into it.
+func (s *LutSnapshot) FileWatcher(w io.Writer, fSys *afero.Afero, fn string) (stop func()) {
+	watcher, err := fsnotify.NewWatcher()
+	if err != nil {
+		fmt.Fprintln(w, "ID list file watcher:", err)
+		return func() {}
+	}
+	if err := watcher.Add(filepath.Dir(fn)); err != nil {
+		fmt.Fprintln(w, "ID list file watcher:", err)
+		msg.OnErr(watcher.Close())
+		return func() {}
+	}
+	if Verbose {
+		fmt.Fprintln(w, fn, "watched now for changes")
+	}
+	done := make(chan struct{})
+	go s.watch(w, fSys, fn, watcher.Events, watcher.Errors, done)
+	var once sync.Once
+	return func() {
+		once.Do(func() {
+			close(done)
+			msg.OnErr(watcher.Close())
+		})
+	}
+}
+
+// watch reloads fn WatchDelay after the last write or create event for it, until done is closed.
+func (s *LutSnapshot) watch(w io.Writer, fSys *afero.Afero, fn string, events <-chan fsnotify.Event, errs <-chan error, done <-chan struct{}) {
+	name := filepath.Clean(fn)
+	timer := time.NewTimer(WatchDelay)
+	timer.Stop()
+	defer timer.Stop()
+	for {
+		select {
+		case <-done:
+			return
+		case e, ok := <-events:
+			if !ok {
+				return
+			}
+			if filepath.Clean(e.Name) != name || e.Op&(fsnotify.Write|fsnotify.Create) == 0 {
+				continue
+			}
+			if !timer.Stop() {
+				select {
+				case <-timer.C:
+				default:
+				}
+			}
+			timer.Reset(WatchDelay)
+		case <-timer.C:
+			if err := s.Reload(w, fSys, fn); err != nil {
+				fmt.Fprintln(w, "ID list reload failed, keeping the previous one:", err)
+			} else if Verbose {
+				fmt.Fprintln(w, "Reloaded", fn, "with", len(s.Load()), "IDs")
+			}
+		case err, ok := <-errs:
+			if !ok {
+				return
+			}
+			fmt.Fprintln(w, "ID list file watcher:", err)
+		}
+	}
+}
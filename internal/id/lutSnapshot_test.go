@@ -0,0 +1,134 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+// white-box test
+package id
+
+import (
+	"bytes"
+	"fmt"
+	"sync"
+	"testing"
+	"time"
+
+	"github.com/fsnotify/fsnotify"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// TestLutSnapshotReload checks, that a reload publishes the new map and a failed reload keeps the old one.
+func TestLutSnapshotReload(t *testing.T) {
+	fSys := &afero.Afero{Fs: afero.NewMemMapFs()}
+	fn := "til.json"
+	assert.Nil(t, fSys.WriteFile(fn, []byte(`{"11":{"Type":"trice8","Strg":"v=%d"}}`), 0644))
+	s := NewLutSnapshot(sampleLut0())
+	old := s.Load()
+
+	var out bytes.Buffer
+	assert.Nil(t, s.Reload(&out, fSys, fn))
+	lu := s.Load()
+	assert.Equal(t, 1, len(lu))
+	assert.Equal(t, TriceFmt{Type: "trice8_1", Strg: "v=%d"}, lu[11])
+	assert.Equal(t, 2, len(old)) // the old snapshot is unchanged
+
+	assert.Nil(t, fSys.WriteFile(fn, []byte(`{"11":{"Type":"tri`), 0644)) // half written
+	assert.NotNil(t, s.Reload(&out, fSys, fn))
+	assert.Nil(t, fSys.Remove(fn))
+	assert.NotNil(t, s.Reload(&out, fSys, fn))
+	assert.Equal(t, lu, s.Load())
+
+	var n *LutSnapshot
+	assert.Equal(t, 0, len(n.Load()))
+}
+
+// TestLutSnapshotWatch checks, that several change events result in a single reload after WatchDelay and other files are ignored.
+func TestLutSnapshotWatch(t *testing.T) {
+	defer func(d time.Duration) { WatchDelay = d }(WatchDelay)
+	WatchDelay = 100 * time.Millisecond
+	fSys := &afero.Afero{Fs: afero.NewMemMapFs()}
+	fn := "/proj/til.json"
+	s := NewLutSnapshot(make(TriceIDLookUp))
+	events := make(chan fsnotify.Event)
+	errs := make(chan error)
+	done := make(chan struct{})
+	exited := make(chan struct{})
+	var out bytes.Buffer
+	go func() {
+		s.watch(&out, fSys, fn, events, errs, done)
+		close(exited)
+	}()
+
+	events <- fsnotify.Event{Name: "/proj/li.json", Op: fsnotify.Write}
+	assert.Nil(t, fSys.WriteFile(fn, []byte(`{"12":{"Type":"trice16","Strg":"%d, %d"}}`), 0644))
+	for i := 0; i < 5; i++ {
+		events <- fsnotify.Event{Name: fn, Op: fsnotify.Write}
+	}
+	events <- fsnotify.Event{Name: fn, Op: fsnotify.Chmod}
+	assert.Equal(t, 0, len(s.Load())) // debounced
+
+	deadline := time.Now().Add(2 * time.Second)
+	for len(s.Load()) == 0 && time.Now().Before(deadline) {
+		time.Sleep(5 * time.Millisecond)
+	}
+	assert.Equal(t, TriceFmt{Type: "trice16_2", Strg: "%d, %d"}, s.Load()[12])
+
+	close(done)
+	<-exited
+}
+
+// TestLutSnapshotNoTornReads swaps two maps while readers check, that each loaded map is internally consistent.
+// Run it with "go test -race": Reading a map, while a reload changes it, is reported as data race.
+func TestLutSnapshotNoTornReads(t *testing.T) {
+	const ids = 200
+	gen := func(v string) TriceIDLookUp {
+		lu := make(TriceIDLookUp, ids)
+		for i := 0; i < ids; i++ {
+			lu[TriceID(i)] = TriceFmt{Type: "trice8_1", Strg: v}
+		}
+		return lu
+	}
+	fSys := &afero.Afero{Fs: afero.NewMemMapFs()}
+	fn := "til.json"
+	assert.Nil(t, gen("c").toFile(fSys, fn))
+
+	s := NewLutSnapshot(gen("a"))
+	done := make(chan struct{})
+	var wg sync.WaitGroup
+	var torn sync.Map
+	for r := 0; r < 4; r++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for {
+				select {
+				case <-done:
+					return
+				default:
+				}
+				lu := s.Load()
+				first := lu[0].Strg
+				for i := 0; i < ids; i++ {
+					if lu[TriceID(i)].Strg != first {
+						torn.Store(fmt.Sprint(i, first, lu[TriceID(i)].Strg), true)
+					}
+				}
+			}
+		}()
+	}
+	var out bytes.Buffer
+	for i := 0; i < 90; i++ {
+		switch i % 3 {
+		case 0:
+			s.Store(gen("a"))
+		case 1:
+			s.Store(gen("b"))
+		case 2:
+			assert.Nil(t, s.Reload(&out, fSys, fn))
+		}
+	}
+	close(done)
+	wg.Wait()
+	count := 0
+	torn.Range(func(_, _ any) bool { count++; return true })
+	assert.Equal(t, 0, count)
+}
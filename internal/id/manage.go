@@ -10,8 +10,8 @@ import (
 	"encoding/json"
 	"fmt"
 	"io"
-	"math/rand"
 	"path/filepath"
+	"strconv"
 	"strings"
 
 	"github.com/rokath/trice/pkg/msg"
@@ -44,92 +44,25 @@ func NewLutLI(w io.Writer, fSys *afero.Afero, fn string) TriceIDLookUpLI {
 	return li
 }
 
-// newID() gets a new ID not used so far.
-// The delivered id is usable as key for lu, but not added. So calling fn twice without adding to ilu could give the same value back.
-// It is important that ilu was refreshed before with all sources to avoid finding as a new ID an ID which is already used in the source tree.
-func (ilu TriceIDLookUp) newID(w io.Writer, min, max TriceID, searchMethod string) TriceID {
+// newID takes a new ID not used so far from s according to searchMethod ("random", "upward" or "downward").
+// s is created once for an update run from til.json and li.json, so an ID known only from li.json is not reused.
+// The delivered ID is marked as used inside s.
+func (s *idSpace) newID(w io.Writer, searchMethod string) (id TriceID) {
 	if Verbose {
-		fmt.Fprintln(w, "IDMin=", min, "IDMax=", max, "IDMethod=", searchMethod)
+		fmt.Fprintln(w, "IDMin=", s.min, "IDMax=", s.max, "IDMethod=", searchMethod)
 	}
 	switch searchMethod {
 	case "random":
-		return ilu.newRandomID(w, min, max)
-	case "upward":
-		return ilu.newUpwardID(min, max)
-	case "downward":
-		return ilu.newDownwardID(min, max)
-	}
-	msg.Info(fmt.Sprint("ERROR:", searchMethod, "is unknown ID search method."))
-	return 0
-}
-
-// newRandomID provides a random free ID inside interval [min,max].
-// The delivered id is usable as key for lu, but not added. So calling fn twice without adding to ilu could give the same value back.
-func (ilu TriceIDLookUp) newRandomID(w io.Writer, min, max TriceID) (id TriceID) {
-	interval := int(max - min + 1)
-	freeIDs := interval - len(ilu)
-	msg.FatalInfoOnFalse(freeIDs > 0, "no new ID possible, "+fmt.Sprint(min, max, len(ilu)))
-	wrnLimit := interval >> 3 // 12.5%
-	msg.InfoOnTrue(freeIDs < wrnLimit, "WARNING: Less than 12.5% IDs free!")
-	id = min + TriceID(rand.Intn(interval))
-	if len(ilu) == 0 {
-		return
-	}
-	for {
-	nextTry:
-		for k := range ilu {
-			if id == k { // id used
-				fmt.Fprintln(w, "ID", id, "used, next try...")
-				id = min + TriceID(rand.Intn(interval))
-				goto nextTry
-			}
-		}
-		return
-	}
-}
-
-// newUpwardID provides the smallest free ID inside interval [min,max].
-// The delivered id is usable as key for lut, but not added. So calling fn twice without adding to ilu gives the same value back.
-func (ilu TriceIDLookUp) newUpwardID(min, max TriceID) (id TriceID) {
-	interval := int(max - min + 1)
-	freeIDs := interval - len(ilu)
-	msg.FatalInfoOnFalse(freeIDs > 0, "no new ID possible: "+fmt.Sprint("min=", min, ", max=", max, ", used=", len(ilu)))
-	id = min
-	if len(ilu) == 0 {
-		return
-	}
-	for {
-	nextTry:
-		for k := range ilu {
-			if id == k { // id used
-				id++
-				goto nextTry
-			}
-		}
-		return
-	}
-}
-
-// newDownwardID provides the biggest free ID inside interval [min,max].
-// The delivered id is usable as key for lut, but not added. So calling fn twice without adding to ilu gives the same value back.
-func (ilu TriceIDLookUp) newDownwardID(min, max TriceID) (id TriceID) {
-	interval := int(max - min + 1)
-	freeIDs := interval - len(ilu)
-	msg.FatalInfoOnFalse(freeIDs > 0, "no new ID possible: "+fmt.Sprint("min=", min, ", max=", max, ", used=", len(ilu)))
-	id = max
-	if len(ilu) == 0 {
-		return
-	}
-	for {
-	nextTry:
-		for k := range ilu {
-			if id == k { // id used
-				id--
-				goto nextTry
-			}
-		}
-		return
+		wrnLimit := int(s.max-s.min+1) >> 3 // 12.5%
+		msg.InfoOnTrue(s.Len() < wrnLimit, "WARNING: Less than 12.5% IDs free!")
+	case "upward", "downward":
+	default:
+		msg.Info(fmt.Sprint("ERROR:", searchMethod, "is unknown ID search method."))
+		return 0
 	}
+	id, ok := s.take(searchMethod)
+	msg.FatalInfoOnFalse(ok, "no new ID possible: "+fmt.Sprint("min=", s.min, ", max=", s.max, ", all used"))
+	return
 }
 
 // FromJSON converts JSON byte slice to ilu.
@@ -337,24 +270,24 @@ const triceFormatStringList_t triceFormatStringList[] = {
 
 	for id, k := range ilu {
 		s = k.Strg
-		switch k.Type {
+		switch withoutParamCount(k.Type) {
 
-		case "TRICE0", "TRICE", "TRICE32", "TRICE32_1", "TRICE32_2", "TRICE32_3", "TRICE32_4", "TRICE32_5", "TRICE32_6", "TRICE32_7", "TRICE32_8", "TRICE32_9", "TRICE32_10", "TRICE32_11", "TRICE32_12":
+		case "TRICE0", "TRICE", "TRICE32":
 			bitWidth = 32
 			paramCount = formatSpecifierCount(s)
 			dataLength = paramCount * 4 // use for checks
 			add = true
-		case "TRICE16", "TRICE16_1", "TRICE16_2", "TRICE16_3", "TRICE16_4", "TRICE16_5", "TRICE16_6", "TRICE16_7", "TRICE16_8", "TRICE16_9", "TRICE16_10", "TRICE16_11", "TRICE16_12":
+		case "TRICE16":
 			bitWidth = 16
 			paramCount = formatSpecifierCount(s)
 			dataLength = paramCount * 2 // use for checks
 			add = true
-		case "TRICE8", "TRICE8_1", "TRICE8_2", "TRICE8_3", "TRICE8_4", "TRICE8_5", "TRICE8_6", "TRICE8_7", "TRICE8_8", "TRICE8_9", "TRICE8_10", "TRICE8_11", "TRICE8_12":
+		case "TRICE8":
 			bitWidth = 8
 			paramCount = formatSpecifierCount(s)
 			dataLength = paramCount * 1 // use for checks
 			add = true
-		case "TRICE64", "TRICE64_1", "TRICE64_2", "TRICE64_3", "TRICE64_4", "TRICE64_5", "TRICE64_6", "TRICE64_7", "TRICE64_8", "TRICE64_9", "TRICE64_10", "TRICE64_11", "TRICE64_12":
+		case "TRICE64":
 			bitWidth = 64
 			paramCount = formatSpecifierCount(s)
 			dataLength = paramCount * 8 // use for checks
@@ -463,24 +396,24 @@ namespace TriceIDList;
 
 	for id, k := range ilu {
 		s = k.Strg
-		switch k.Type {
+		switch withoutParamCount(k.Type) {
 
-		case "TRICE0", "TRICE", "TRICE32", "TRICE32_1", "TRICE32_2", "TRICE32_3", "TRICE32_4", "TRICE32_5", "TRICE32_6", "TRICE32_7", "TRICE32_8", "TRICE32_9", "TRICE32_10", "TRICE32_11", "TRICE32_12":
+		case "TRICE0", "TRICE", "TRICE32":
 			bitWidth = 32
 			paramCount = formatSpecifierCount(s)
 			dataLength = paramCount * 4 // use for checks
 			add = true
-		case "TRICE16", "TRICE16_1", "TRICE16_2", "TRICE16_3", "TRICE16_4", "TRICE16_5", "TRICE16_6", "TRICE16_7", "TRICE16_8", "TRICE16_9", "TRICE16_10", "TRICE16_11", "TRICE16_12":
+		case "TRICE16":
 			bitWidth = 16
 			paramCount = formatSpecifierCount(s)
 			dataLength = paramCount * 2 // use for checks
 			add = true
-		case "TRICE8", "TRICE8_1", "TRICE8_2", "TRICE8_3", "TRICE8_4", "TRICE8_5", "TRICE8_6", "TRICE8_7", "TRICE8_8", "TRICE8_9", "TRICE8_10", "TRICE8_11", "TRICE8_12":
+		case "TRICE8":
 			bitWidth = 8
 			paramCount = formatSpecifierCount(s)
 			dataLength = paramCount * 1 // use for checks
 			add = true
-		case "TRICE64", "TRICE64_1", "TRICE64_2", "TRICE64_3", "TRICE64_4", "TRICE64_5", "TRICE64_6", "TRICE64_7", "TRICE64_8", "TRICE64_9", "TRICE64_10", "TRICE64_11", "TRICE64_12":
+		case "TRICE64":
 			bitWidth = 64
 			paramCount = formatSpecifierCount(s)
 			dataLength = paramCount * 8 // use for checks
@@ -722,3 +655,17 @@ func distance(s string) string {
 		return "                                                                               "
 	}
 }
+
+// withoutParamCount returns triceType without a value count suffix like "_12". Valid value counts are 1 to MaxParamCount.
+// Example: "TRICE16_2" results in "TRICE16", but "TRICE_S" remains unchanged.
+func withoutParamCount(triceType string) string {
+	i := strings.LastIndex(triceType, "_")
+	if i < 0 {
+		return triceType
+	}
+	n, err := strconv.Atoi(triceType[i+1:])
+	if err != nil || n < 1 || MaxParamCount < n {
+		return triceType
+	}
+	return triceType[:i]
+}
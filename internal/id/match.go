@@ -3,93 +3,57 @@
 
 package id
 
-import "strings"
-
 // matchTrice searches in s for the next trice statement. If not found loc is nil.
-// When found, s[loc[0]:loc[1]] is the typeName and at s[loc[2] is the opening parenthesis behind the typeName.
+// When found, s[loc[0]:loc[1]] is the typeName and s[loc[2]-1] is the opening parenthesis behind the typeName.
 // If the found trice statement contains an ID statement, it is s[loc[3]:loc[4]]. Otherwise is loc[3]==loc[4].
 // The associated format string is s[loc[5]:loc[6]].
 //
 // Examples:
 // - TRice( "a" )
-// - 0   12 5 6
+// - 0   1 25 6
 //
 // - TRice   ("a" )
-// - 0   1   25 6
+// - 0   1   56
 //
 // - TRice ( iD(999) ,  "a" )
-// - 0   1 2 3     4    5 6
+// - 0   1  23     4    5 6
 //
 // - TRice(example,example); "string" )
-// -                     `)`
 // - nil
 // - TRice(id,string); "string" )
-// -               `)`
 // - nil
 func matchTrice(s string) (loc []int) {
-	var offset int
-	var clpIndex int
-start:
-	for {
-		triceStartloc := matchAnyTriceStart.FindStringIndex(s)
-		if triceStartloc == nil { // not found
-			return
-		}
-		for {
-			fmtLoc := matchFormatString(s)
-			if fmtLoc == nil { // not found
-				return
-			}
-			// Check, if there is a closing parenthesis after the format string
-			clpIndex = strings.Index(s[fmtLoc[1]:], `)`)
-			if clpIndex == -1 { // no closing parenthesis found after format string
-				return
-			}
-
-			if fmtLoc[1] < triceStartloc[1] { // formatString ends before typeName, continue with reduced string
-				cut := fmtLoc[1]
-				s = s[cut:]
-				triceStartloc[0] -= cut
-				triceStartloc[1] -= cut
-				offset += cut
-				continue // look for next format string
-			}
+	return newTriceMatcher(s).next()
+}
 
-			if fmtLoc[0] < triceStartloc[0] { // typeName is inside format string, start over with reduced string
-				cut := fmtLoc[1]
-				s = s[cut:]
-				triceStartloc[0] -= cut
-				triceStartloc[1] -= cut
-				offset += cut
-				goto start // look for next trice start
-			}
+// triceMatcher delivers the trice statements of a file one after the other in the loc format of matchTrice.
+// The file is lexed only once.
+type triceMatcher struct {
+	lx   *cLexer
+	done int // done is the file position of the previous loc[6], where the caller continues.
+}
 
-			// formatString starts after typeName (normal case)
-			typeNameLoc := matchTypNameTRICE.FindStringIndex(s[triceStartloc[0]:triceStartloc[1]])
-			// now we have: triceStartloc[0], triceStartloc[0]+typeNameLoc[1], triceStartloc[1]:
-			//              TR________________ice                              (
-			rest := s[triceStartloc[1]:fmtLoc[0]]
-			idLoc := matchNbID.FindStringIndex(rest)
-			if idLoc == nil { // no ID statement
-				clpIndex = strings.Index(rest, `)`)
-				// - if `)` is located before format string starts, discard trice
-				// - ExampleY: trice(tid, fmt, ...) ... "y"   ... (y)
-				//  -          0   12 00                5 6
-				//  -                            `)`                       -> discard
-				if clpIndex != -1 { // a closing parenthesis was found before format string
-					return
-				}
-				loc = append(loc, triceStartloc[0], triceStartloc[0]+typeNameLoc[1], triceStartloc[1], 0, 0, fmtLoc[0], fmtLoc[1])
-			} else {
-				loc = append(loc, triceStartloc[0], triceStartloc[0]+typeNameLoc[1], triceStartloc[1], triceStartloc[1]+idLoc[0], triceStartloc[1]+idLoc[1], fmtLoc[0], fmtLoc[1])
-			}
+// newTriceMatcher returns a triceMatcher for the file content s.
+func newTriceMatcher(s string) *triceMatcher {
+	return &triceMatcher{lx: newCLexer(s)}
+}
 
-			if offset != 0 {
-				for i := range loc {
-					loc[i] = loc[i] + offset
-				}
-			}
-			return
+// next returns the location of the next trice statement relative to the file part behind the previous format string.
+// loc is nil, when no further trice statement exists.
+func (m *triceMatcher) next() (loc []int) {
+	for {
+		c, ok := m.lx.next()
+		if !ok {
+			return nil
+		}
+		if c.name[0] < m.done {
+			continue // a trice inside the parameters of the previous one
+		}
+		loc = c.loc()
+		for i := range loc {
+			loc[i] -= m.done
 		}
+		m.done += loc[6]
+		return
 	}
 }
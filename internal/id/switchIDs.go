@@ -8,7 +8,6 @@ package id
 import (
 	"fmt"
 	"io"
-	"math/rand"
 
 	"github.com/rokath/trice/pkg/ant"
 	"github.com/rokath/trice/pkg/msg"
@@ -22,7 +21,7 @@ type idData struct {
 	idToLocRef     TriceIDLookUpLI // idToLocRef is the trice ID location information as reference generated from li.json (if exists) at the begin of SubCmdIdInsert and is not modified at all. At the end of SubCmdIdInsert a new li.json is generated from itemToId.
 	idToLocNew     TriceIDLookUpLI // idToLocNew is the trice ID location information generated during insertTriceIDs. At the end of SubCmdIdInsert a new li.json is generated from idToLocNew.
 	idInitialCount int             // idInitialCount is the initial used ID count.
-	IDSpace        []TriceID       // IDSpace contains unused IDs.
+	IDSpace        idSpace         // IDSpace contains unused IDs.
 }
 
 var (
@@ -32,18 +31,8 @@ var (
 // newID returns a new, so far unused trice ID for usage.
 // The global variable SearchMethod controls the way a new ID is selected.
 func (p *idData) newID() (id TriceID) {
-	if SearchMethod == "random" {
-		index := rand.Intn(len(p.IDSpace))
-		id = p.IDSpace[index]                          // use random
-		p.IDSpace[index] = p.IDSpace[len(p.IDSpace)-1] // overwrite with last
-		p.IDSpace = p.IDSpace[:len(p.IDSpace)-1]       // remove last
-	} else if SearchMethod == "upward" {
-		id = p.IDSpace[0]         // use first
-		p.IDSpace = p.IDSpace[1:] // remove first
-	} else {
-		id = p.IDSpace[len(p.IDSpace)-1]         // use last
-		p.IDSpace = p.IDSpace[:len(p.IDSpace)-1] // remove last
-	}
+	id, ok := p.IDSpace.take(SearchMethod)
+	msg.FatalInfoOnFalse(ok, "no new ID possible: "+fmt.Sprint("IDMin=", Min, ", IDMax=", Max, ", all used"))
 	return
 }
 
@@ -59,13 +48,11 @@ func (p *idData) preProcessing(w io.Writer, fSys *afero.Afero) {
 	p.idToLocNew = make(TriceIDLookUpLI, 4000) // for new li.json
 
 	// create IDSpace
-	p.IDSpace = make([]TriceID, 0, Max-Min+1)
-	for id := Min; id <= Max; id++ {
-		_, usedFmt := p.idToTrice[id]
-		_, usedLoc := p.idToLocRef[id]
-		if !usedFmt && !usedLoc {
-			p.IDSpace = append(p.IDSpace, id)
-		} else if Verbose {
+	p.IDSpace = newIDSpaceFrom(Min, Max, p.idToTrice, p.idToLocRef)
+	if Verbose {
+		for id := Min; id <= Max; id++ {
+			_, usedFmt := p.idToTrice[id]
+			_, usedLoc := p.idToLocRef[id]
 			if usedFmt && !usedLoc {
 				fmt.Fprintln(w, "ID", id, "used, but only inside til.json")
 			}
@@ -76,9 +63,7 @@ func (p *idData) preProcessing(w io.Writer, fSys *afero.Afero) {
 				fmt.Fprintln(w, "ID", id, "used inside til.json and li.json")
 			}
 		}
-	}
-	if Verbose {
-		fmt.Fprintln(w, Max-Min+1, "IDs total space,", len(p.IDSpace), "IDs usable")
+		fmt.Fprintln(w, Max-Min+1, "IDs total space,", p.IDSpace.Len(), "IDs usable")
 	}
 }
 
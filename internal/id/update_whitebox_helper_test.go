@@ -59,11 +59,12 @@ type testTable []struct {
 func checkList(t *testing.T, _ /*sharedIDs*/ bool, min, max TriceID, searchMethod string, tt testTable, eList string, extend bool) {
 	ilu := make(TriceIDLookUp)
 	flu := ilu.reverseS()
+	space := newIDSpaceFrom(min, max, ilu, nil)
 	Verbose = true
 	for _, x := range tt {
 		act0, _ := updateParamCountAndID0(os.Stdout, x.text, extend)
 		listModified := false
-		act, fileModified := updateIDsUniqOrShared(os.Stdout, false /*sharedIDs*/, min, max, searchMethod, act0, ilu, flu, &listModified)
+		act, fileModified := updateIDsUniqOrShared(os.Stdout, false /*sharedIDs*/, &space, searchMethod, act0, ilu, flu, &listModified)
 		assert.Equal(t, x.fileMod, fileModified)
 		assert.Equal(t, x.listMod, listModified)
 		assert.Equal(t, x.exp, act)
@@ -83,11 +84,12 @@ func checkList2(t *testing.T, _ /*sharedIDs*/ bool, min, max TriceID, searchMeth
 	err := ilu.FromJSON([]byte(inJSON))
 	assert.Nil(t, err)
 	flu := ilu.reverseS()
+	space := newIDSpaceFrom(min, max, ilu, nil)
 	Verbose = true
 	for _, x := range tt {
 		act0, _ := updateParamCountAndID0(os.Stdout, x.text, extendMacroName)
 		listModified := false
-		act, fileModified := updateIDsUniqOrShared(os.Stdout, false /*sharedIDs*/, min, max, searchMethod, act0, ilu, flu, &listModified)
+		act, fileModified := updateIDsUniqOrShared(os.Stdout, false /*sharedIDs*/, &space, searchMethod, act0, ilu, flu, &listModified)
 		assert.Equal(t, x.fileMod, fileModified)
 		assert.Equal(t, x.listMod, listModified)
 		assert.Equal(t, x.exp, act)
@@ -123,11 +125,12 @@ func check(t *testing.T, text, expJSON string) {
 func checkList3(t *testing.T, _ /*sharedIDs*/ bool, min, max TriceID, searchMethod string, tt testTable, extendMacroName bool, inMap, expMap TriceIDLookUp) {
 	ilu := inMap
 	flu := ilu.reverseS()
+	space := newIDSpaceFrom(min, max, ilu, nil)
 	Verbose = true
 	for _, x := range tt {
 		act0, _ := updateParamCountAndID0(os.Stdout, x.text, extendMacroName)
 		listModified := false
-		act, fileModified := updateIDsUniqOrShared(os.Stdout, false /*sharedIDs*/, min, max, searchMethod, act0, ilu, flu, &listModified)
+		act, fileModified := updateIDsUniqOrShared(os.Stdout, false /*sharedIDs*/, &space, searchMethod, act0, ilu, flu, &listModified)
 		assert.Equal(t, x.fileMod, fileModified)
 		assert.Equal(t, x.listMod, listModified)
 		assert.Equal(t, x.exp, act)
@@ -145,11 +148,12 @@ func checkList3(t *testing.T, _ /*sharedIDs*/ bool, min, max TriceID, searchMeth
 func checkList4(t *testing.T, _ /*sharedIDs*/ bool, min, max TriceID, searchMethod string, tt testTable, extendMacroName bool, inMap TriceIDLookUp) TriceIDLookUp {
 	ilu := inMap
 	flu := ilu.reverseS()
+	space := newIDSpaceFrom(min, max, ilu, nil)
 	Verbose = true
 	for _, x := range tt {
 		act0, _ := updateParamCountAndID0(os.Stdout, x.text, extendMacroName)
 		listModified := false
-		_, fileModified := updateIDsUniqOrShared(os.Stdout, false /*sharedIDs*/, min, max, searchMethod, act0, ilu, flu, &listModified)
+		_, fileModified := updateIDsUniqOrShared(os.Stdout, false /*sharedIDs*/, &space, searchMethod, act0, ilu, flu, &listModified)
 		assert.Equal(t, x.fileMod, fileModified)
 		assert.Equal(t, x.listMod, listModified)
 	}
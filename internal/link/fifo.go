@@ -0,0 +1,14 @@
+// Copyright 2020 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+//go:build !windows
+// +build !windows
+
+package link
+
+import "syscall"
+
+// mkfifo creates the named pipe fn.
+func mkfifo(fn string) error {
+	return syscall.Mkfifo(fn, 0600)
+}
@@ -15,6 +15,7 @@ import (
 	"os/exec"
 	"path/filepath"
 	"strings"
+	"sync/atomic"
 	"time"
 
 	"github.com/pkg/errors"
@@ -26,6 +27,13 @@ import (
 var (
 	// Verbose gives more information on output if set. The value is injected from main packages.
 	Verbose bool
+
+	// Logger is the RTT logger executable. If empty, JLinkRTTLogger or stRttLogger is used according to the port.
+	Logger string
+
+	// Transfer is the way, the RTT logger data reach trice: "file" or "fifo".
+	// With "fifo" the RTT logger writes into a named pipe instead of a growing temporary file and trice reads it blocking.
+	Transfer = "file"
 )
 
 // Device is the RTT logger reader interface.
@@ -40,6 +48,9 @@ type Device struct {
 	cmd               *exec.Cmd // link command handle
 	tempLogFileName   string
 	tempLogFileHandle afero.File
+	fifo              bool          // fifo is true, when tempLogFileName is a named pipe.
+	exited            chan struct{} // exited is closed, when the RTT logger ended.
+	closing           atomic.Bool
 	Err               error
 	Done              chan bool
 }
@@ -60,6 +71,9 @@ func NewDevice(w io.Writer, fSys *afero.Afero, port, arguments string) *Device {
 	default:
 		log.Panic("Unknown port:", port)
 	}
+	if Logger != "" {
+		p.Exec = Logger
+	}
 	if Verbose {
 		fmt.Fprintln(w, "port:", port, "arguments:", arguments)
 		fmt.Fprintln(w, "LINK executable", p.Exec, "and dynamic lib", p.Lib, "expected to be in path for usage.")
@@ -77,8 +91,8 @@ func NewDevice(w io.Writer, fSys *afero.Afero, port, arguments string) *Device {
 	if lastArgExt == ".bin" {
 		if Verbose {
 			fmt.Printf("An intermediate log file name \"%s\" is specified inside p.args, so use that.\n", lastArg)
-			p.tempLogFileName = lastArg
 		}
+		p.tempLogFileName = lastArg
 	} else {
 		// get a temporary file name in a writable folder temp
 		dir := filepath.Dir(id.FnJSON) // the id list folder is assumed to be writable and readable
@@ -93,12 +107,30 @@ func NewDevice(w io.Writer, fSys *afero.Afero, port, arguments string) *Device {
 		msg.OnErr(e)
 		p.tempLogFileName = fh.Name() // p.tempLogFileName is trice needed to know where to read from
 		msg.OnErr(fh.Close())
+		if Transfer == "fifo" {
+			p.fifo = p.makeFifo()
+		}
 
 		p.args = append(p.args, p.tempLogFileName) // p.tempLogFileName is passed here for JLinkRTTLogger
 	}
 	return p
 }
 
+// makeFifo replaces the temporary logfile with a named pipe and returns true on success.
+// On failure the temporary logfile is created again.
+func (p *Device) makeFifo() bool {
+	msg.OnErr(os.Remove(p.tempLogFileName))
+	e := mkfifo(p.tempLogFileName)
+	if e == nil {
+		return true
+	}
+	fmt.Fprintln(p.w, "Using a temporary logfile, because", e)
+	fh, e := os.Create(p.tempLogFileName)
+	msg.OnErr(e)
+	msg.OnErr(fh.Close())
+	return false
+}
+
 // errorFatal ends in osExit(1) if p.Err not nil.
 func (p *Device) errorFatal() {
 	if nil == p.Err {
@@ -127,10 +159,23 @@ func (p *Device) Close() error {
 		fmt.Fprintln(p.w, "Closing link device.")
 	}
 	// CTRL-C sends SIGTERM also to the started command. It closes the temporary file and terminates itself.
-	// Todo: If trice is terminated not with CTRL-C kill automatically.
-	// p.Err = errors.Wrap(p.Err, p.cmd.Process.Kill().Error())
-	// p.Err = errors.Wrap(p.Err, p.tempLogFileHandle.Close().Error())
-	p.Err = errors.Wrap(p.Err, p.fSys.Remove(p.tempLogFileName).Error())
+	// If trice is terminated not with CTRL-C, the command is killed here.
+	p.closing.Store(true)
+	if p.cmd != nil && p.cmd.Process != nil {
+		select {
+		case <-p.exited:
+		default:
+			p.Err = p.cmd.Process.Kill()
+		}
+	}
+	if p.tempLogFileHandle != nil {
+		if e := p.tempLogFileHandle.Close(); e != nil {
+			p.Err = errors.Wrap(e, "closing "+p.tempLogFileName)
+		}
+	}
+	if e := p.fSys.Remove(p.tempLogFileName); e != nil {
+		p.Err = errors.Wrap(e, "removing "+p.tempLogFileName)
+	}
 	return p.Err
 }
 
@@ -153,16 +198,22 @@ func (p *Device) Open() error {
 	p.Err = p.cmd.Start()
 	p.errorFatal()
 
+	p.exited = make(chan struct{})
 	go func() {
 		e := p.cmd.Wait()
-		if e != nil {
+		if e != nil && !p.closing.Load() {
 			fmt.Println(e)
 		}
+		close(p.exited)
 	}()
 
-	// todo: check if file exists in a loop for more speed
-	time.Sleep(1000 * time.Millisecond)                         // to be sure, log fie is created
-	p.tempLogFileHandle, p.Err = p.fSys.Open(p.tempLogFileName) // Open() opens a file with read only flag.
+	if p.fifo {
+		p.openFifo()
+	} else {
+		// todo: check if file exists in a loop for more speed
+		time.Sleep(1000 * time.Millisecond)                         // to be sure, log fie is created
+		p.tempLogFileHandle, p.Err = p.fSys.Open(p.tempLogFileName) // Open() opens a file with read only flag.
+	}
 	p.errorFatal()
 
 	// p.watchLogfile() // todo: make it working well
@@ -172,6 +223,22 @@ func (p *Device) Open() error {
 	return nil
 }
 
+// openFifo opens the named pipe for reading. Opening a named pipe blocks until the RTT logger opens it for writing.
+// If the RTT logger ends before, p.Err is set. Afterwards each Read waits for data and does not poll.
+func (p *Device) openFifo() {
+	opened := make(chan error, 1)
+	go func() {
+		fh, e := p.fSys.Open(p.tempLogFileName)
+		p.tempLogFileHandle = fh
+		opened <- e
+	}()
+	select {
+	case p.Err = <-opened:
+	case <-p.exited:
+		p.Err = fmt.Errorf("%s ended before opening %s", p.Exec, p.tempLogFileName)
+	}
+}
+
 // watchLogfile creates a new file watcher.
 //  func (p *Device) watchLogfile() {
 //  	var watcher *fsnotify.Watcher
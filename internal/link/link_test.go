@@ -5,8 +5,118 @@
 package link_test
 
 import (
+	"bufio"
+	"bytes"
+	"os"
+	"path/filepath"
+	"runtime"
+	"strconv"
 	"testing"
+	"time"
+
+	"github.com/rokath/trice/internal/id"
+	"github.com/rokath/trice/internal/link"
+	"github.com/spf13/afero"
+	"github.com/stretchr/testify/assert"
 )
 
 func TestDummy(t *testing.T) {
 }
+
+// loggerStandIn emulates an RTT logger. It writes lines with the nanoseconds since epoch every 10 ms into the file
+// given as last parameter and ends after count lines with a line "end".
+const loggerStandIn = `#!/bin/sh
+for out; do :; done
+exec >>"$out"
+i=0
+while [ $i -lt $COUNT ]; do
+	date +%s%N
+	sleep 0.01
+	i=$((i+1))
+done
+echo end
+sleep 5
+`
+
+// TestLoggerStandIn reads the stand-in logger output over a temporary file and over a named pipe
+// and measures the latency and the disk usage of both transfer modes.
+func TestLoggerStandIn(t *testing.T) {
+	if runtime.GOOS == "windows" {
+		t.Skip("needs a shell")
+	}
+	dir := t.TempDir()
+	logger := filepath.Join(dir, "rttLogger.sh")
+	assert.Nil(t, os.WriteFile(logger, []byte(loggerStandIn), 0700))
+	t.Setenv("COUNT", "150")
+	defer func(fn, l, tr string) { id.FnJSON, link.Logger, link.Transfer = fn, l, tr }(id.FnJSON, link.Logger, link.Transfer)
+	id.FnJSON = filepath.Join(dir, "til.json")
+	link.Logger = logger
+	fSys := &afero.Afero{Fs: afero.NewOsFs()}
+
+	for _, transfer := range []string{"file", "fifo"} {
+		t.Run(transfer, func(t *testing.T) {
+			link.Transfer = transfer
+			var out bytes.Buffer
+			p := link.NewDevice(&out, fSys, "J-LINK", "-Device STM32G0B1RE")
+			assert.Equal(t, logger, p.Exec)
+			assert.Nil(t, p.Open())
+			opened := time.Now()
+
+			var lines, measured int
+			var latency time.Duration
+			var diskUsage int64
+			r := bufio.NewReader(readerFunc(func(b []byte) (int, error) {
+				for {
+					n, err := p.Read(b)
+					if n > 0 || time.Now().After(deadline(t)) {
+						return n, err
+					}
+					time.Sleep(10 * time.Millisecond) // polling like the translator
+				}
+			}))
+			for {
+				s, err := r.ReadString('\n')
+				assert.Nil(t, err)
+				if s == "end\n" {
+					break
+				}
+				ns, err := strconv.ParseInt(s[:len(s)-1], 10, 64)
+				assert.Nil(t, err)
+				if stamp := time.Unix(0, ns); stamp.After(opened) { // The file mode waits 1s in Open.
+					latency += time.Since(stamp)
+					measured++
+				}
+				lines++
+			}
+			filepath.Walk(filepath.Join(dir, "temp"), func(_ string, info os.FileInfo, err error) error {
+				if err == nil && info.Mode().IsRegular() {
+					diskUsage += info.Size()
+				}
+				return nil
+			})
+			assert.Nil(t, p.Close())
+			assert.Equal(t, 150, lines)
+			assert.True(t, measured > 0)
+			t.Log(transfer, "mean latency", latency/time.Duration(measured), "disk usage", diskUsage, "bytes")
+			if transfer == "fifo" {
+				assert.Equal(t, int64(0), diskUsage)
+			}
+			entries, err := os.ReadDir(filepath.Join(dir, "temp"))
+			assert.Nil(t, err)
+			assert.Equal(t, 0, len(entries)) // removed by Close
+		})
+	}
+}
+
+// readerFunc is an io.Reader function.
+type readerFunc func([]byte) (int, error)
+
+func (f readerFunc) Read(b []byte) (int, error) { return f(b) }
+
+// deadline returns the latest end of t.
+func deadline(t *testing.T) time.Time {
+	if d, ok := t.Deadline(); ok {
+		return d
+	}
+	return time.Now().Add(time.Minute)
+}
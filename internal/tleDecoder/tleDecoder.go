@@ -11,7 +11,6 @@ import (
 	"log"
 	"math"
 	"strings"
-	"sync"
 
 	cobs "github.com/rokath/cobs/go"
 	"github.com/rokath/trice/internal/decoder"
@@ -38,7 +37,7 @@ type cobsDec struct {
 //
 // l is the trice id list in slice of struct format.
 // in is the usable reader for the input bytes.
-func New(w io.Writer, lut id.TriceIDLookUp, m *sync.RWMutex, li id.TriceIDLookUpLI, in io.Reader, endian bool) decoder.Decoder {
+func New(w io.Writer, lut *id.LutSnapshot, li id.TriceIDLookUpLI, in io.Reader, endian bool) decoder.Decoder {
 	p := &cobsDec{}
 	p.cycle = 0xc0 // start value
 	p.W = w
@@ -46,7 +45,6 @@ func New(w io.Writer, lut id.TriceIDLookUp, m *sync.RWMutex, li id.TriceIDLookUp
 	p.IBuf = make([]byte, 0, decoder.DefaultSize)
 	p.B = make([]byte, 0, decoder.DefaultSize)
 	p.Lut = lut
-	p.LutMutex = m
 	p.Li = li
 	p.Endian = endian
 	return p
@@ -237,9 +235,7 @@ func (p *cobsDec) Read(b []byte) (n int, err error) {
 		decoder.Dump(p.W, p.B[:p.TriceSize])
 	}
 	var ok bool
-	p.LutMutex.RLock()
-	p.Trice, ok = p.Lut[triceID]
-	p.LutMutex.RUnlock()
+	p.Trice, ok = p.Lut.Load()[triceID]
 	if !ok {
 		n += copy(b[n:], fmt.Sprintln("WARNING:unknown ID ", triceID, "- ignoring trice", p.B[:p.TriceSize]))
 		n += copy(b[n:], fmt.Sprintln(decoder.Hints))
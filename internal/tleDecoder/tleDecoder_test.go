@@ -10,7 +10,6 @@ import (
 	"io/ioutil"
 	"os"
 	"strings"
-	"sync"
 	"testing"
 
 	"github.com/rokath/trice/internal/decoder"
@@ -40,11 +39,10 @@ func doCOBSTableTest(t *testing.T, out io.Writer, f decoder.New, endianness bool
 	)
 	ilu := make(id.TriceIDLookUp) // empty
 	//li := make(id.TriceIDLookUpLI) // empty
-	luM := new(sync.RWMutex)
 	assert.Nil(t, ilu.FromJSON([]byte(idl)))
 	ilu.AddFmtCount(os.Stdout)
 	buf := make([]byte, decoder.DefaultSize)
-	dec := f(out, ilu, luM, nil, nil, endianness) // a new decoder instance
+	dec := f(out, id.NewLutSnapshot(ilu), nil, nil, endianness) // a new decoder instance
 	for _, x := range teTa {
 		in := ioutil.NopCloser(bytes.NewBuffer(x.In))
 		dec.SetInput(in)
@@ -0,0 +1,139 @@
+// white-box test
+package translator
+
+import (
+	"bufio"
+	"bytes"
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+	"strconv"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/archive"
+	"github.com/rokath/trice/internal/decoder"
+	"github.com/rokath/trice/internal/id"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// archiveRecords decodes the capture in into a new archive in dir and opens it.
+func archiveRecords(t testing.TB, fSys *afero.Afero, dir, til string, in io.Reader) *archive.Archive {
+	aw, err := archive.Create(fSys, dir, archive.BlockRows)
+	assert.Nil(t, err)
+	Records = aw
+	decodeRecords(t, io.Discard, til, "archive", in)
+	Records = nil
+	assert.Nil(t, aw.Close())
+	a, err := archive.Open(fSys, dir)
+	assert.Nil(t, err)
+	return a
+}
+
+// TestArchive checks, that the archived records are the records of "trice log -logFormat ndjson".
+func TestArchive(t *testing.T) {
+	exp, err := os.ReadFile("testdata/expRecords.ndjson")
+	assert.Nil(t, err)
+	fSys := &afero.Afero{Fs: afero.NewMemMapFs()}
+	a := archiveRecords(t, fSys, "arc", recordTil, bytes.NewReader(recordTestData()))
+	var act bytes.Buffer
+	rw, err := decoder.NewRecordWriter(&act, "ndjson")
+	assert.Nil(t, err)
+	stats, err := a.Query(archive.Query{}, rw.Write)
+	assert.Nil(t, err)
+	assert.Nil(t, rw.Flush())
+	assert.Equal(t, string(exp), act.String())
+	assert.Equal(t, strings.Count(string(exp), "\n"), stats.Records)
+}
+
+// benchIDs is the ID count of the archive benchmark capture.
+const benchIDs = 64
+
+// writeBenchCapture writes a capture file of about size bytes with trices of benchIDs IDs into dir and returns the ID list and the file name.
+func writeBenchCapture(b *testing.B, dir string, size int) (til, fn string) {
+	var s strings.Builder
+	s.WriteString("{")
+	for i := 0; i < benchIDs; i++ {
+		if i > 0 {
+			s.WriteString(",")
+		}
+		fmt.Fprintf(&s, `"%d": {"Type": "TRICE32", "Strg": "val:id %d, count %%d, value %%d\\n"}`, 1000+i, i)
+	}
+	s.WriteString("}")
+	fn = filepath.Join(dir, "trice.bin")
+	f, err := os.Create(fn)
+	assert.Nil(b, err)
+	w := bufio.NewWriter(f)
+	for i, n := 0, 0; n < size; i++ {
+		t := unframedTrice(0xC000|uint16(1000+i%benchIDs), u32(uint32(i)), byte(0xc0+i), u32(uint32(i), uint32(i%1000)))
+		_, err = w.Write(t)
+		assert.Nil(b, err)
+		n += len(t)
+	}
+	assert.Nil(b, w.Flush())
+	assert.Nil(b, f.Close())
+	return s.String(), fn
+}
+
+// idCounter counts the records with ID id.
+type idCounter struct {
+	id id.TriceID
+	n  int
+}
+
+func (p *idCounter) Write(r *decoder.Record) error {
+	if r.ID == p.id {
+		p.n++
+	}
+	return nil
+}
+
+func (p *idCounter) Flush() error { return nil }
+
+// BenchmarkArchiveQuery compares selecting the trices of one ID by decoding the whole capture again with an archive query.
+// The capture size is 4 GB, what takes about an hour: go test -run NONE -bench ArchiveQuery -benchtime 1x -timeout 3h ./internal/translator
+// With -short the capture size is 4 MB. Set TRICE_ARCHIVE_BENCH_MB for other sizes.
+func BenchmarkArchiveQuery(b *testing.B) {
+	mb := 4096
+	if testing.Short() {
+		mb = 4
+	}
+	if s := os.Getenv("TRICE_ARCHIVE_BENCH_MB"); s != "" {
+		var err error
+		mb, err = strconv.Atoi(s)
+		assert.Nil(b, err)
+	}
+	dir := b.TempDir()
+	til, capture := writeBenchCapture(b, dir, mb<<20)
+	open := func() *os.File {
+		f, err := os.Open(capture)
+		assert.Nil(b, err)
+		return f
+	}
+	f := open()
+	a := archiveRecords(b, &afero.Afero{Fs: afero.NewOsFs()}, filepath.Join(dir, "arc"), til, bufio.NewReader(f))
+	assert.Nil(b, f.Close())
+
+	b.Run("decode", func(b *testing.B) {
+		for i := 0; i < b.N; i++ {
+			f := open()
+			c := &idCounter{id: 1000}
+			Records = c
+			decodeRecords(b, io.Discard, til, "archive", bufio.NewReader(f))
+			Records = nil
+			assert.Nil(b, f.Close())
+			b.ReportMetric(float64(c.n), "records")
+		}
+	})
+	b.Run("query", func(b *testing.B) {
+		for i := 0; i < b.N; i++ {
+			c := &idCounter{id: 1000}
+			stats, err := a.Query(archive.Query{IDs: []id.TriceID{1000}}, c.Write)
+			assert.Nil(b, err)
+			b.ReportMetric(float64(c.n), "records")
+			b.ReportMetric(float64(stats.BytesRead), "readBytes")
+		}
+	})
+}
@@ -0,0 +1,103 @@
+package translator
+
+import (
+	"bytes"
+	"io"
+	"log"
+	"time"
+
+	"github.com/rokath/trice/internal/decoder"
+	"github.com/rokath/trice/internal/emitter"
+	"github.com/rokath/trice/internal/id"
+	"github.com/rokath/trice/internal/receiver"
+	"github.com/rokath/trice/pkg/msg"
+)
+
+// RecordSink is the record destination of the structured log formats.
+type RecordSink interface {
+	Write(*decoder.Record) error // Write takes r, which is valid only during the call.
+	Flush() error                // Flush is called, when the decoder waits for data.
+}
+
+// Records, if not nil, gets the records instead of the Translate writer, when decoder.LogFormat is not "text".
+// The archive sub-command uses it.
+var Records RecordSink
+
+// decodeRecordLoop writes the decoded trices as records in the format decoder.LogFormat to w.
+// If Records is not nil, it gets the records instead.
+// It bypasses the line composer, so there are no colors, prefixes and host stamps.
+// The decoder messages around a trice, like cycle errors, become records with ID 0, one per line.
+// decodeRecordLoop returns io.EOF at the end of a predefined buffer and does not return otherwise.
+func decodeRecordLoop(w io.Writer, dec decoder.Decoder, li id.TriceIDLookUpLI) error {
+	rw := Records
+	if rw == nil {
+		recordWriter, err := decoder.NewRecordWriter(w, decoder.LogFormat)
+		msg.FatalOnErr(err)
+		rw = recordWriter
+	}
+	b := make([]byte, decoder.DefaultSize) // intermediate trice string buffer
+	var r decoder.Record
+	bufferReadStartTime := time.Now()
+	sleepCounter := 0
+	for {
+		n, err := dec.Read(b)
+
+		if err != io.EOF && err != nil {
+			log.Fatal(err)
+		}
+
+		if n == 0 {
+			// The records are buffered only as long as data arrive.
+			msg.OnErr(rw.Flush())
+			if (receiver.Port == "FILEBUFFER" || receiver.Port == "BUFFER") && time.Since(bufferReadStartTime) > 100*time.Millisecond { // do not wait if a predefined buffer
+				msg.OnErr(err)
+				return io.EOF
+			}
+			sleepCounter++
+			if sleepCounter > 100 {
+				time.Sleep(100 * time.Millisecond)
+				sleepCounter = 0
+			}
+			continue // read again
+		}
+
+		host := decoder.ReceptionTime()
+		start, end := decoder.LastTriceStart, decoder.LastTriceEnd
+		if start < 0 || end > n { // no trice inside b[:n]
+			start, end = n, n
+		}
+		writeMessageRecords(rw, &r, host, b[:start])
+		if start < end && emitter.BanOrPickFilter(b[start:end]) > 0 {
+			r = decoder.Record{
+				ID:        decoder.LastTriceID,
+				Host:      host,
+				StampSize: decoder.TargetTimestampSize,
+				Stamp:     decoder.TargetStampUnwrapped,
+				Values:    decoder.LastTriceValues,
+			}
+			r.Channel, r.Msg = emitter.SplitChannel(string(b[start:end]))
+			if l, ok := li[r.ID]; ok {
+				r.File, r.Line = l.File, l.Line
+			}
+			msg.OnErr(rw.Write(&r))
+		}
+		writeMessageRecords(rw, &r, host, b[end:n])
+	}
+}
+
+// writeMessageRecords writes each not empty line inside b as record with ID 0 to rw.
+func writeMessageRecords(rw RecordSink, r *decoder.Record, host time.Time, b []byte) {
+	for len(b) > 0 {
+		line := b
+		if i := bytes.IndexByte(b, '\n'); i >= 0 {
+			line, b = b[:i+1], b[i+1:]
+		} else {
+			b = nil
+		}
+		*r = decoder.Record{Host: host}
+		r.Channel, r.Msg = emitter.SplitChannel(string(line))
+		if r.Msg != "" {
+			msg.OnErr(rw.Write(r))
+		}
+	}
+}
@@ -0,0 +1,181 @@
+// white-box test
+package translator
+
+import (
+	"bufio"
+	"bytes"
+	"encoding/binary"
+	"encoding/json"
+	"io"
+	"math"
+	"os"
+	"strings"
+	"testing"
+	"time"
+
+	"github.com/rokath/trice/internal/decoder"
+	"github.com/rokath/trice/internal/emitter"
+	"github.com/rokath/trice/internal/id"
+	"github.com/rokath/trice/internal/receiver"
+	"github.com/rokath/trice/internal/trexDecoder"
+	"github.com/tj/assert"
+)
+
+// recordTil is the ID list for the record tests.
+const recordTil = `{
+	"3713": {"Type": "TRICE16", "Strg": "MSG: 💚 START select = %d\\n"},
+	"935": {"Type": "TRICE", "Strg": "MSG:triceFifoDepthMax = %d of max %d, triceStreamBufferDepthMax = %d of max %d\\n"},
+	"100": {"Type": "TRICE32", "Strg": "att:gain = %f, offset %d\\n"},
+	"101": {"Type": "TRICE_S", "Strg": "rd:name %s\\n"}
+}`
+
+// unframedTrice returns a not framed TREX trice with the type and ID tyID, the optional stamp, the cycle and the params padded to 4 bytes.
+func unframedTrice(tyID uint16, stamp []byte, cycle byte, params []byte) []byte {
+	b := binary.LittleEndian.AppendUint16(nil, tyID)
+	b = append(b, stamp...)
+	b = append(b, cycle, byte(len(params)))
+	b = append(b, params...)
+	for len(params)%4 != 0 {
+		params = append(params, 0)
+		b = append(b, 0)
+	}
+	return b
+}
+
+// u32 returns the little endian bytes of v.
+func u32(v ...uint32) (b []byte) {
+	for _, x := range v {
+		b = binary.LittleEndian.AppendUint32(b, x)
+	}
+	return
+}
+
+// recordTestData returns trices with wrapping 32-bit stamps, float and string values and a cycle error.
+func recordTestData() []byte {
+	const s0, s4 = 0x4000, 0xC000
+	var b []byte
+	b = append(b, unframedTrice(s4|3713, u32(0xFFFFFFF0), 0xc0, []byte{0xb8, 0x01})...)
+	b = append(b, unframedTrice(s4|3713, u32(0x10), 0xc1, []byte{0xb9, 0x01})...)
+	b = append(b, unframedTrice(s0|935, nil, 0xc2, u32(92, 128, 1360, 2048))...)
+	b = append(b, unframedTrice(s0|100, nil, 0xc3, u32(math.Float32bits(2.5), 0xFFFFFFFB))...)
+	b = append(b, unframedTrice(s0|101, nil, 0xc4, []byte(`"trice"`))...)
+	b = append(b, unframedTrice(s0|935, nil, 0xc9, u32(1, 2, 3, 4))...) // cycle 0xc5 expected
+	return b
+}
+
+// runRecordLoop decodes in with format into the returned buffer like "trice log -p BUFFER -logFormat format".
+func runRecordLoop(t testing.TB, format string, in []byte) *bytes.Buffer {
+	var out bytes.Buffer
+	decodeRecords(t, &out, recordTil, format, bytes.NewReader(in))
+	return &out
+}
+
+// decodeRecords decodes in with the ID list til and format into out.
+func decodeRecords(t testing.TB, out io.Writer, til, format string, in io.Reader) {
+	defer func(format, framing, port string, rt func() time.Time) {
+		decoder.LogFormat, decoder.PackageFraming, receiver.Port, decoder.ReceptionTime = format, framing, port, rt
+	}(decoder.LogFormat, decoder.PackageFraming, receiver.Port, decoder.ReceptionTime)
+	decoder.LogFormat = format
+	decoder.PackageFraming = "none"
+	receiver.Port = "BUFFER"
+	decoder.ReceptionTime = func() time.Time { return time.Unix(1700000000, 123456789) }
+	decoder.ResetTargetClocks()
+
+	ilu := make(id.TriceIDLookUp)
+	assert.Nil(t, ilu.FromJSON([]byte(til)))
+	li := id.TriceIDLookUpLI{3713: {File: "main.c", Line: 12}}
+	dec := trexDecoder.New(io.Discard, id.NewLutSnapshot(ilu), li, in, decoder.LittleEndian)
+	if format == "text" {
+		assert.Equal(t, io.EOF, decodeAndComposeLoop(out, emitter.New(out), dec, li))
+	} else {
+		assert.Equal(t, io.EOF, decodeRecordLoop(out, dec, li))
+	}
+}
+
+// TestRecordNDJSON compares the NDJSON records with testdata/expRecords.ndjson.
+func TestRecordNDJSON(t *testing.T) {
+	exp, err := os.ReadFile("testdata/expRecords.ndjson")
+	assert.Nil(t, err)
+	act := runRecordLoop(t, "ndjson", recordTestData())
+	assert.Equal(t, string(exp), act.String())
+}
+
+// TestRecordBinary reads the binary records back and checks, that they encode to the expected NDJSON records.
+func TestRecordBinary(t *testing.T) {
+	exp, err := os.ReadFile("testdata/expRecords.ndjson")
+	assert.Nil(t, err)
+	r := bufio.NewReader(runRecordLoop(t, "binary", recordTestData()))
+	var act bytes.Buffer
+	rw, err := decoder.NewRecordWriter(&act, "ndjson")
+	assert.Nil(t, err)
+	var rec decoder.Record
+	for {
+		err := decoder.ReadRecord(r, &rec)
+		if err == io.EOF {
+			break
+		}
+		assert.Nil(t, err)
+		assert.Nil(t, rw.Write(&rec))
+	}
+	assert.Nil(t, rw.Flush())
+	assert.Equal(t, string(exp), act.String())
+}
+
+// recordIDs returns the "id" values of the NDJSON records in b.
+func recordIDs(t *testing.T, b *bytes.Buffer) (ids []id.TriceID) {
+	for _, line := range strings.Split(strings.TrimSpace(b.String()), "\n") {
+		var r struct{ ID id.TriceID }
+		assert.Nil(t, json.Unmarshal([]byte(line), &r))
+		ids = append(ids, r.ID)
+	}
+	return
+}
+
+// TestRecordIDFilter checks, that the decoder skips trices according to -banID and -pickID and keeps the cycle check.
+func TestRecordIDFilter(t *testing.T) {
+	defer func() { decoder.BanIDs, decoder.PickIDs = decoder.IDSet{}, decoder.IDSet{} }()
+	assert.Nil(t, decoder.PickIDs.Set("935,100"))
+	assert.Equal(t, []id.TriceID{935, 100, 0, 935}, recordIDs(t, runRecordLoop(t, "ndjson", recordTestData())))
+	decoder.PickIDs = decoder.IDSet{}
+	assert.Nil(t, decoder.BanIDs.Set("3713"))
+	assert.Equal(t, []id.TriceID{935, 100, 101, 0, 935}, recordIDs(t, runRecordLoop(t, "ndjson", recordTestData())))
+}
+
+// TestRecordContentFilter checks the -include and -exclude switches for the text and record formats.
+func TestRecordContentFilter(t *testing.T) {
+	defer func(palette string) {
+		emitter.ColorPalette, emitter.Include, emitter.Exclude = palette, emitter.ContentFilter{}, emitter.ContentFilter{}
+	}(emitter.ColorPalette)
+	emitter.ColorPalette = "off"
+	assert.Nil(t, emitter.Include.Set("triceFifoDepthMax"))
+	assert.Nil(t, emitter.Include.Set("rd:"))
+	assert.Nil(t, emitter.Exclude.Set("= 1 of"))
+	assert.Equal(t, []id.TriceID{935, 101, 0}, recordIDs(t, runRecordLoop(t, "ndjson", recordTestData())))
+	text := runRecordLoop(t, "text", recordTestData()).String()
+	assert.True(t, strings.Contains(text, "triceFifoDepthMax = 92"), text)
+	assert.True(t, strings.Contains(text, `name "trice"`), text)
+	assert.False(t, strings.Contains(text, "START"), text)
+	assert.False(t, strings.Contains(text, "triceFifoDepthMax = 1 of"), text)
+}
+
+// BenchmarkRecordLoop decodes trices in the text and in the record formats.
+func BenchmarkRecordLoop(b *testing.B) {
+	for _, format := range []string{"text", "ndjson", "binary"} {
+		b.Run(format, func(b *testing.B) {
+			defer func(palette string) { emitter.ColorPalette = palette }(emitter.ColorPalette)
+			emitter.ColorPalette = "off"
+			in := make([]byte, 0, 32*b.N)
+			for i := 0; i < b.N; i++ {
+				if i%2 == 0 {
+					in = append(in, unframedTrice(0xC000|3713, u32(uint32(i)), byte(0xc0+i), []byte{0xb8, 0x01})...)
+				} else {
+					in = append(in, unframedTrice(0x4000|935, nil, byte(0xc0+i), u32(92, 128, 1360, 2048))...)
+				}
+			}
+			b.SetBytes(int64(len(in) / b.N))
+			b.ResetTimer()
+			out := runRecordLoop(b, format, in)
+			b.ReportMetric(float64(out.Len())/float64(b.N), "outBytes/op")
+		})
+	}
+}
@@ -7,7 +7,6 @@ import (
 	"os"
 	"os/signal"
 	"strings"
-	"sync"
 	"syscall"
 	"time"
 
@@ -40,7 +39,7 @@ var (
 // Bytes are read with rc. Then according decoder.Encoding they are translated into strings.
 // Each read returns the amount of bytes for one trice. rc is called on every
 // Translate returns true on io.EOF or false on hard read error or sigterm.
-func Translate(w io.Writer, sw *emitter.TriceLineComposer, lut id.TriceIDLookUp, m *sync.RWMutex, li id.TriceIDLookUpLI, rwc io.ReadWriteCloser) error {
+func Translate(w io.Writer, sw *emitter.TriceLineComposer, lut *id.LutSnapshot, li id.TriceIDLookUpLI, rwc io.ReadWriteCloser) error {
 	//var dec Decoder //io.Reader
 	if Verbose {
 		fmt.Fprintln(w, "Encoding is", Encoding)
@@ -57,26 +56,36 @@ func Translate(w io.Writer, sw *emitter.TriceLineComposer, lut id.TriceIDLookUp,
 	}
 	switch strings.ToUpper(Encoding) {
 	case "TLE", "COBS":
-		dec = tleDecoder.New(w, lut, m, li, rwc, endian)
+		dec = tleDecoder.New(w, lut, li, rwc, endian)
 		//cobsVariantDecode = cobs.Decode
 		//  case "COBSFF":
 		//  	dec = newCOBSDecoder(w, lut, m, rc, endian)
 		//  	cobsVariantDecode = cobsFFDecode
 	case "TREX":
-		dec = trexDecoder.New(w, lut, m, li, rwc, endian)
+		dec = trexDecoder.New(w, lut, li, rwc, endian)
 	case "CHAR":
-		dec = charDecoder.New(w, lut, m, li, rwc, endian)
+		dec = charDecoder.New(w, lut, li, rwc, endian)
 	case "DUMP":
-		dec = dumpDecoder.New(w, lut, m, li, rwc, endian)
+		dec = dumpDecoder.New(w, lut, li, rwc, endian)
 	default:
 		log.Fatalf(fmt.Sprintln("unknown encoding ", Encoding))
 	}
+	if decoder.LogFormat != "text" && strings.ToUpper(Encoding) != "TREX" {
+		log.Fatalf(fmt.Sprintln("-logFormat", decoder.LogFormat, "needs the TREX encoding"))
+	}
+	if rt, ok := rwc.(interface{ ReceptionTime() time.Time }); ok { // A serial port with -comReader timestamps its reads.
+		decoder.ReceptionTime = rt.ReceptionTime
+	}
+	decoder.ResetTargetClocks() // A new input, like a re-opened serial port, may come from a reset target.
 	if emitter.DisplayRemote {
 		keybcmd.ReadInput(rwc)
 	} else {
 		go handleSIGTERM(w, rwc)
 	}
-	return decodeAndComposeLoop(w, sw, dec, lut, li)
+	if decoder.LogFormat != "text" {
+		return decodeRecordLoop(w, dec, li)
+	}
+	return decodeAndComposeLoop(w, sw, dec, li)
 }
 
 // handleSIGTERM is called on CTRL-C shutdown.
@@ -102,7 +111,7 @@ func handleSIGTERM(w io.Writer, rc io.ReadCloser) {
 const DefaultTargetStamp0 = "time:            "
 
 // decodeAndComposeLoop does not return.
-func decodeAndComposeLoop(w io.Writer, sw *emitter.TriceLineComposer, dec decoder.Decoder, lut id.TriceIDLookUp, li id.TriceIDLookUpLI) error {
+func decodeAndComposeLoop(w io.Writer, sw *emitter.TriceLineComposer, dec decoder.Decoder, li id.TriceIDLookUpLI) error {
 	b := make([]byte, decoder.DefaultSize) // intermediate trice string buffer
 	bufferReadStartTime := time.Now()
 	sleepCounter := 0
@@ -116,6 +125,9 @@ func decodeAndComposeLoop(w io.Writer, sw *emitter.TriceLineComposer, dec decode
 		if !decoder.ShowTargetStamp32Passed {
 			decoder.TargetStamp32 = ""
 		}
+		if !decoder.ShowTargetStamp64Passed {
+			decoder.TargetStamp64 = ""
+		}
 	}
 	if decoder.TargetStamp == "ms" {
 		if !decoder.ShowTargetStamp0Passed {
@@ -127,6 +139,9 @@ func decodeAndComposeLoop(w io.Writer, sw *emitter.TriceLineComposer, dec decode
 		if !decoder.ShowTargetStamp32Passed {
 			decoder.TargetStamp32 = "ms"
 		}
+		if !decoder.ShowTargetStamp64Passed {
+			decoder.TargetStamp64 = "ms"
+		}
 	}
 	if decoder.TargetStamp == "us" || decoder.TargetStamp == "µs" {
 		if !decoder.ShowTargetStamp0Passed {
@@ -138,9 +153,13 @@ func decodeAndComposeLoop(w io.Writer, sw *emitter.TriceLineComposer, dec decode
 		if !decoder.ShowTargetStamp32Passed {
 			decoder.TargetStamp32 = "us"
 		}
+		if !decoder.ShowTargetStamp64Passed {
+			decoder.TargetStamp64 = "us"
+		}
 	}
 	for {
-		n, err := dec.Read(b) // Code to measure, dec.Read can return n=0 in some cases and then wait.
+		decoder.LineOpen = len(sw.Line) > 0 // The decoder skips trices hidden by the log level only at a line start.
+		n, err := dec.Read(b)               // Code to measure, dec.Read can return n=0 in some cases and then wait.
 
 		if err != io.EOF && err != nil {
 			log.Fatal(err)
@@ -197,11 +216,20 @@ func decodeAndComposeLoop(w io.Writer, sw *emitter.TriceLineComposer, dec decode
 			// 	msg.OnErr(err)
 			// }
 
+			if logLineStart && decoder.TargetCore >= 0 && decoder.CoreFormat != "off" && decoder.CoreFormat != "none" {
+				_, err := sw.Write([]byte(fmt.Sprintf(decoder.CoreFormat, decoder.TargetCore)))
+				msg.OnErr(err)
+			}
+
 			var s string
 			if logLineStart {
 				switch decoder.TargetTimestampSize {
-				case 4:
-					switch decoder.TargetStamp32 {
+				case 4, 8:
+					stampFmt := decoder.TargetStamp32
+					if decoder.TargetTimestampSize == 8 {
+						stampFmt = decoder.TargetStamp64
+					}
+					switch stampFmt {
 					case "ms", "hh:mm:ss,ms":
 						ms := decoder.TargetTimestamp % 1000
 						sec := (decoder.TargetTimestamp - ms) / 1000 % 60
@@ -215,7 +243,7 @@ func decodeAndComposeLoop(w io.Writer, sw *emitter.TriceLineComposer, dec decode
 						s = fmt.Sprintf("time:%4d,%03d_%03d", sd, ms, us)
 					case "":
 					default:
-						s = fmt.Sprintf(decoder.TargetStamp32, decoder.TargetTimestamp)
+						s = fmt.Sprintf(stampFmt, decoder.TargetTimestamp)
 					}
 
 				case 2:
@@ -238,6 +266,9 @@ func decodeAndComposeLoop(w io.Writer, sw *emitter.TriceLineComposer, dec decode
 						s = fmt.Sprintf(decoder.TargetStamp0)
 					}
 				}
+				if decoder.TargetStampAbsolute && decoder.TargetTimestampSize != 0 {
+					s = decoder.TargetTime.Format("time:15:04:05.000000")
+				}
 				_, err := sw.Write([]byte(s))
 				msg.OnErr(err)
 				_, err = sw.Write([]byte("default: "))
@@ -0,0 +1,136 @@
+// white-box test
+package translator
+
+import (
+	"bytes"
+	"fmt"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/decoder"
+	"github.com/rokath/trice/internal/emitter"
+	"github.com/tj/assert"
+)
+
+// visibleTil has trices with constant, value dependent and without channels.
+const visibleTil = `{
+	"1": {"Type": "TRICE32", "Strg": "msg:value %d\\n"},
+	"2": {"Type": "TRICE32", "Strg": "err:error %d\\n"},
+	"3": {"Type": "TRICE32", "Strg": "wrn:warning %d\\n"},
+	"4": {"Type": "TRICE32", "Strg": "dbg:debug %d\\n"},
+	"5": {"Type": "TRICE32", "Strg": "no channel %d\\n"},
+	"6": {"Type": "TRICE32", "Strg": "MSG:upper case %d\\n"},
+	"7": {"Type": "TRICE_S", "Strg": "%s\\n"},
+	"8": {"Type": "TRICE32", "Strg": "att:first %d\\ndbg:second line\\n"},
+	"9": {"Type": "TRICE32", "Strg": "info:%d"},
+	"10": {"Type": "TRICE32", "Strg": " %d\\n"}
+}`
+
+// visibleTestData returns trices of all visibleTil IDs in changing order.
+func visibleTestData() []byte {
+	var b []byte
+	for i := 0; i < 40; i++ {
+		tid := uint16(1 + i*7%10)
+		if tid == 7 {
+			s := []string{"err:dynamic", "dbg:dynamic", "dynamic"}[i%3]
+			b = append(b, unframedTrice(0x4000|tid, nil, byte(0xc0+i), []byte(s))...)
+		} else {
+			b = append(b, unframedTrice(0x4000|tid, nil, byte(0xc0+i), u32(uint32(i)))...)
+		}
+	}
+	return b
+}
+
+// withoutEmptyLines returns s without the empty lines and the lines, which contain only the location information "        :0    " and a color reset.
+func withoutEmptyLines(s string) string {
+	var lines []string
+	for _, line := range strings.SplitAfter(s, "\n") {
+		if l := strings.TrimSpace(strings.TrimSuffix(strings.TrimSpace(line), "\x1b[0m")); l != "" && l != ":0" { // maybe with color reset
+			lines = append(lines, line)
+		}
+	}
+	return strings.Join(lines, "")
+}
+
+// TestSkipHidden checks, that skipping hidden trices inside the decoder does not change the output.
+func TestSkipHidden(t *testing.T) {
+	defer func(palette, logLevel, locFmt string, skip bool) {
+		emitter.ColorPalette, emitter.LogLevel, decoder.LocationInformationFormatString, decoder.SkipHidden = palette, logLevel, locFmt, skip
+		emitter.Ban, emitter.Pick = nil, nil
+	}(emitter.ColorPalette, emitter.LogLevel, decoder.LocationInformationFormatString, decoder.SkipHidden)
+	decoder.LocationInformationFormatString = "%8s:%-4d "
+	tt := []struct {
+		ban, pick, logLevel string
+	}{
+		{"", "", "all"},
+		{"dbg", "", "all"},
+		{"", "err:msg", "all"},
+		{"", "", "wrn"},
+		{"", "", "off"},
+		{"dbg", "", "info"},
+	}
+	for _, palette := range []string{"off", "default"} { // Each decoding lasts 100 ms.
+		for _, x := range tt {
+			emitter.Ban, emitter.Pick = nil, nil
+			if x.ban != "" {
+				assert.Nil(t, emitter.Ban.Set(x.ban))
+			}
+			if x.pick != "" {
+				assert.Nil(t, emitter.Pick.Set(x.pick))
+			}
+			emitter.ColorPalette, emitter.LogLevel = palette, x.logLevel
+			var exp, act bytes.Buffer
+			decoder.SkipHidden = false
+			decodeRecords(t, &exp, visibleTil, "text", bytes.NewReader(visibleTestData()))
+			decoder.SkipHidden = true
+			decodeRecords(t, &act, visibleTil, "text", bytes.NewReader(visibleTestData()))
+			info := fmt.Sprintf("%s %+v", palette, x)
+			if x.logLevel == "all" {
+				assert.Equal(t, exp.String(), act.String(), info)
+			} else { // A by -logLevel hidden trice does not leave an empty line or a line with the location only anymore.
+				assert.Equal(t, withoutEmptyLines(exp.String()), withoutEmptyLines(act.String()), info)
+			}
+			if x.ban != "" || x.pick != "" {
+				for _, tag := range []string{"debug", "warning"} {
+					assert.Equal(t, strings.Count(exp.String(), tag), strings.Count(act.String(), tag), info)
+				}
+			}
+			if palette != "off" {
+				continue // The records have no colors.
+			}
+			exp.Reset()
+			act.Reset()
+			decoder.SkipHidden = false
+			decodeRecords(t, &exp, visibleTil, "ndjson", bytes.NewReader(visibleTestData()))
+			decoder.SkipHidden = true
+			decodeRecords(t, &act, visibleTil, "ndjson", bytes.NewReader(visibleTestData()))
+			assert.Equal(t, exp.String(), act.String(), info)
+		}
+	}
+}
+
+// BenchmarkSkipHidden decodes traffic, where the channel filter suppresses 95% of the trices, with and without skipping them inside the decoder.
+func BenchmarkSkipHidden(b *testing.B) {
+	for _, skip := range []bool{false, true} {
+		b.Run(fmt.Sprint("skip=", skip), func(b *testing.B) {
+			defer func(palette string, skip bool) {
+				emitter.ColorPalette, decoder.SkipHidden, emitter.Ban = palette, skip, nil
+			}(emitter.ColorPalette, decoder.SkipHidden)
+			emitter.ColorPalette, decoder.SkipHidden = "off", skip
+			assert.Nil(b, emitter.Ban.Set("dbg"))
+			in := make([]byte, 0, 16*b.N)
+			for i := 0; i < b.N; i++ {
+				tid := uint16(4) // dbg
+				if i%20 == 0 {
+					tid = 1 // msg
+				}
+				in = append(in, unframedTrice(0x4000|tid, nil, byte(0xc0+i), u32(uint32(i)))...)
+			}
+			b.SetBytes(int64(len(in) / b.N))
+			b.ResetTimer()
+			var out bytes.Buffer
+			decodeRecords(b, &out, visibleTil, "text", bytes.NewReader(in))
+			b.ReportMetric(float64(strings.Count(out.String(), "value"))/float64(b.N), "shown/op")
+		})
+	}
+}
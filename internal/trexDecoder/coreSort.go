@@ -0,0 +1,150 @@
+// Copyright 2022 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package trexDecoder
+
+import (
+	"bytes"
+	"sort"
+	"time"
+
+	"github.com/rokath/trice/internal/decoder"
+	"github.com/rokath/trice/internal/id"
+)
+
+// CoreTagTriceID is the reserved ID of the trice, which starts each target transfer with the core ID, when TRICE_CORE_COUNT > 1 (TRICE_CORE_TAG_ID in trice.h).
+const CoreTagTriceID = id.TriceID(0x3FFE)
+
+// coreTrice is a single undecoded trice of a target core.
+type coreTrice struct {
+	core    int       // core is the target core ID.
+	stamp   uint64    // stamp is the target timestamp or for trices without stamp the last stamp of the same core.
+	data    []byte    // data is the trice as received after package decoding.
+	arrival time.Time // arrival is the host time, when the trice was added to the sorter.
+}
+
+// coreSorter merges the trice streams of several target cores by their timestamps.
+//
+// Each target transfer contains the trices of a single core, starting with a core tag trice.
+// The stamps of each core are expected to increase. A trice is released, when all cores seen
+// so far delivered a stamp not smaller than its stamp, so no earlier trice can follow.
+type coreSorter struct {
+	core    int            // core is the core of the actual package.
+	last    map[int]uint64 // last holds for each core its last stamp.
+	pending []coreTrice    // pending holds the not released trices in stamp order.
+}
+
+// add splits the decoded package b into trices and appends them to s.pending.
+// It returns false, when b is not splittable, what lets the caller decode b unsorted.
+func (p *trexDec) add(s *coreSorter, b []byte) bool {
+	var ts []coreTrice
+	core := s.core
+	arrival := time.Now()
+	for len(b) > 0 {
+		if len(b) < tyIdSize+ncSize {
+			return false
+		}
+		tyId := p.ReadU16(b)
+		triceType := int(tyId >> decoder.IDBits)
+		stampSize := 0
+		switch triceType {
+		case typeS2:
+			stampSize = 2
+			if Doubled16BitID {
+				stampSize += tyIdSize
+			}
+		case typeS4:
+			stampSize = 4
+		case typeX0:
+			if !decoder.ShowTargetStamp64Passed {
+				return false // typeX0 is not supported without 64-bit stamps
+			}
+			stampSize = 8
+		}
+		if len(b) < tyIdSize+stampSize+ncSize {
+			return false
+		}
+		stamp, ok := s.last[core]
+		switch triceType {
+		case typeS2:
+			stamp = uint64(p.ReadU16(b[tyIdSize+stampSize-2:]))
+		case typeS4:
+			stamp = uint64(p.ReadU32(b[tyIdSize:]))
+		case typeX0:
+			stamp = p.ReadU64(b[tyIdSize:])
+		}
+		nc := p.ReadU16(b[tyIdSize+stampSize:])
+		paramSpace := int(nc >> 8)
+		if nc>>15 == 1 {
+			paramSpace = int(0x7FFF & nc)
+		}
+		if p.codec != nil { // Encoded payloads are expanded here, because the delta references need the arrival order.
+			var err error
+			if b, paramSpace, err = p.expandPayload(id.TriceID(0x3FFF&tyId), b, tyIdSize+stampSize); err != nil {
+				return false
+			}
+		}
+		size := tyIdSize + stampSize + ncSize + paramSpace
+		if len(b) < size {
+			return false
+		}
+		if id.TriceID(0x3FFF&tyId) == CoreTagTriceID && paramSpace == 4 {
+			core = int(p.ReadU32(b[tyIdSize+stampSize+ncSize:]))
+		} else {
+			if !ok || stamp > s.last[core] {
+				s.last[core] = stamp
+			}
+			ts = append(ts, coreTrice{core, s.last[core], bytes.Clone(b[:size]), arrival})
+		}
+		b = b[size:]
+	}
+	s.core = core
+	s.pending = append(s.pending, ts...)
+	sort.SliceStable(s.pending, func(i, j int) bool { return s.pending[i].stamp < s.pending[j].stamp })
+	return true
+}
+
+// next returns the oldest pending trice, when it cannot be preceded anymore or when flush is true.
+func (s *coreSorter) next(flush bool) (t coreTrice, ok bool) {
+	if len(s.pending) == 0 {
+		return
+	}
+	t = s.pending[0]
+	if !flush {
+		for _, stamp := range s.last {
+			if stamp < t.stamp {
+				return t, false
+			}
+		}
+	}
+	s.pending = s.pending[1:]
+	return t, true
+}
+
+// nextSortedTrice puts the next trice in timestamp order into p.B and sets decoder.TargetCore accordingly.
+//
+// It reads all complete packages first. When no trice is releasable, the oldest pending trice is released only,
+// if the input ended or if it waits already decoder.CoreSortHold. Otherwise p.B stays empty and a later call tries again.
+func (p *trexDec) nextSortedTrice() {
+	if p.sorter == nil {
+		p.sorter = &coreSorter{core: -1, last: make(map[int]uint64)}
+	}
+	for {
+		p.nextPackage()
+		if len(p.B) == 0 && bytes.IndexByte(p.IBuf, 0) == -1 {
+			break // no further complete package
+		}
+		if len(p.B) > 0 && !p.add(p.sorter, p.B) {
+			return // unsortable package, decode it as it is
+		}
+		p.B = p.B[:0]
+	}
+	t, ok := p.sorter.next(false)
+	if !ok && (p.inputEnd || time.Since(t.arrival) >= decoder.CoreSortHold) {
+		t, ok = p.sorter.next(true) // A silent core must not stop the output.
+	}
+	if ok {
+		decoder.TargetCore = t.core
+		p.B = t.data
+	}
+}
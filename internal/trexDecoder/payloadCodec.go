@@ -0,0 +1,126 @@
+// Copyright 2022 Thomas.Hoehenleitner [at] seerose.net
+// Use of this source code is governed by a license that can be found in the LICENSE file.
+
+package trexDecoder
+
+import (
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"strings"
+
+	"github.com/rokath/trice/internal/id"
+)
+
+const (
+	codecSlots     = 16 // codecSlots is the count of IDs with a delta reference (TRICE_CODEC_SLOTS in trice.c).
+	codecSlotWords = 4  // codecSlotWords is the count of leading payload words with a delta reference (TRICE_CODEC_SLOT_WORDS in trice.c).
+	codecMax       = 63 // codecMax is the max encoded payload byte count. Byte counts above codecMax mark encoded payloads (TRICE_CODEC_MAX in trice.c).
+)
+
+// payloadCodec reverses the target payload encoding selected with TRICE_PAYLOAD_CODEC.
+//
+// Each 32-bit payload word is zigzag and varint encoded. With delta encoding the first codecSlotWords
+// words are transmitted as difference to the same words of the last trice with the same ID. Like on the
+// target, codecSlots IDs share the references and a new ID in a slot starts with 0 references.
+type payloadCodec struct {
+	delta bool // delta is true for TRICE_CODEC_DELTA.
+	slot  [codecSlots]struct {
+		id id.TriceID
+		v  [codecSlotWords]uint32
+	}
+}
+
+// newPayloadCodec returns a payload codec for the -payloadCodec value s or nil for "none".
+func newPayloadCodec(s string) (*payloadCodec, error) {
+	switch strings.ToLower(s) {
+	case "", "none", "off":
+		return nil, nil
+	case "varint":
+		return &payloadCodec{}, nil
+	case "delta":
+		return &payloadCodec{delta: true}, nil
+	}
+	return nil, fmt.Errorf("unknown payload codec %q", s)
+}
+
+// references returns the delta references of tid.
+func (c *payloadCodec) references(tid id.TriceID) *[codecSlotWords]uint32 {
+	s := &c.slot[int(tid)%codecSlots]
+	if s.id != tid { // The slot is taken over, so the references start with 0.
+		s.id = tid
+		s.v = [codecSlotWords]uint32{}
+	}
+	return &s.v
+}
+
+// decode returns the raw payload for the encoded payload enc of a trice with ID tid.
+func (c *payloadCodec) decode(tid id.TriceID, enc []byte) ([]byte, error) {
+	var ref *[codecSlotWords]uint32
+	if c.delta {
+		ref = c.references(tid)
+	}
+	raw := make([]byte, 0, 4*len(enc))
+	for i := 0; len(enc) > 0; i++ {
+		z, n := binary.Uvarint(enc)
+		if n <= 0 || z > 0xFFFFFFFF {
+			return nil, errors.New("invalid varint in encoded payload")
+		}
+		enc = enc[n:]
+		v := uint32(z>>1) ^ -uint32(z&1) // zigzag
+		if ref != nil && i < codecSlotWords {
+			v += ref[i]
+			ref[i] = v
+		}
+		raw = binary.LittleEndian.AppendUint32(raw, v)
+	}
+	return raw, nil
+}
+
+// reference updates the delta references of tid with a not encoded payload raw, like the target does it.
+func (c *payloadCodec) reference(tid id.TriceID, raw []byte) {
+	if !c.delta || len(raw) == 0 || len(raw)&3 != 0 {
+		return
+	}
+	ref := c.references(tid)
+	for i := 0; i < codecSlotWords && 4*i < len(raw); i++ {
+		ref[i] = binary.LittleEndian.Uint32(raw[4*i:])
+	}
+}
+
+// expandPayload replaces the payload of the trice in b with its count and cycle value nc at b[ncOffset:] by the raw payload,
+// when it is encoded, and returns the new trice bytes and the raw payload byte count. Long count form trices stay unchanged.
+// Not encoded payloads update the delta references.
+func (p *trexDec) expandPayload(tid id.TriceID, b []byte, ncOffset int) ([]byte, int, error) {
+	nc := p.ReadU16(b[ncOffset:])
+	if nc>>15 == 1 {
+		return b, int(0x7FFF & nc), nil
+	}
+	count := int(nc >> 8)
+	start := ncOffset + ncSize
+	if count <= codecMax {
+		if len(b) >= start+count {
+			p.codec.reference(tid, b[start:start+count])
+		}
+		return b, count, nil
+	}
+	encLen := count - codecMax - 1
+	if len(b) < start+encLen {
+		return b, encLen, errors.New("encoded payload incomplete")
+	}
+	raw, err := p.codec.decode(tid, b[start:start+encLen])
+	if err != nil {
+		return b, encLen, err
+	}
+	nb := make([]byte, 0, len(b)-encLen+len(raw))
+	nb = append(nb, b[:ncOffset]...)
+	nc = uint16(len(raw))<<8 | nc&0xFF
+	if p.Endian {
+		nb = binary.LittleEndian.AppendUint16(nb, nc)
+	} else {
+		nb = binary.BigEndian.AppendUint16(nb, nc)
+	}
+	nb = append(nb, raw...)
+	nb = append(nb, b[start+encLen:]...)
+	return nb, len(raw), nil
+}
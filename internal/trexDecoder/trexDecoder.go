@@ -11,7 +11,6 @@ import (
 	"log"
 	"math"
 	"strings"
-	"sync"
 
 	cobs "github.com/rokath/cobs/go"
 	"github.com/rokath/tcobs/v1"
@@ -29,7 +28,7 @@ const (
 	typeS0 = 1 // regular trice format without stamp     : 011iiiiiI NC ...
 	typeS2 = 2 // regular trice format with 16-bit stamp : 101iiiiiI TT NC ...
 	typeS4 = 3 // regular trice format with 32-bit stamp : 111iiiiiI TT TT NC ...
-	typeX0 = 0 // regular trice format with 32-bit stamp : 001iiiiiI TT TT TT TT NC ...
+	typeX0 = 0 // extended trice format, used for 64-bit stamp : 00iiiiiiI TT TT TT TT NC ...
 	//IDMask = 0x03FFF
 
 	packageFramingNone = iota
@@ -83,13 +82,19 @@ type trexDec struct {
 	pFmt           string // modified trice format string: %u -> %d
 	u              []int  // 1: modified format string positions:  %u -> %d, 2: float (%f)
 	packageFraming int
+	sorter         *coreSorter         // sorter merges the trices of several target cores, when decoder.CoreSort is true.
+	inputEnd       bool                // inputEnd is true, when the last input read in nextPackage returned io.EOF.
+	codec          *payloadCodec       // codec decodes the target payload encoding, when decoder.PayloadCodec is not "none".
+	hidden         bool                // hidden is true, when read skipped a trice not visible according to visible.
+	visible        *decoder.VisibleIDs // visible tells, which IDs of the look-up map visibleLut are to be formatted.
+	visibleLut     *id.TriceIDLookUp   // visibleLut is the look-up map visible belongs to.
 }
 
 // New provides a TREX decoder instance.
 //
 // l is the trice id list in slice of struct format.
 // in is the usable reader for the input bytes.
-func New(w io.Writer, lut id.TriceIDLookUp, m *sync.RWMutex, li id.TriceIDLookUpLI, in io.Reader, endian bool) decoder.Decoder {
+func New(w io.Writer, lut *id.LutSnapshot, li id.TriceIDLookUpLI, in io.Reader, endian bool) decoder.Decoder {
 	// Todo: rewrite using the TCOBS Reader. The provided in io.Reader provides a raw data stream.
 	// https://github.com/rokath/tcobs/blob/master/TCOBSv1/read.go -> use NewDecoder ...
 
@@ -102,9 +107,9 @@ func New(w io.Writer, lut id.TriceIDLookUp, m *sync.RWMutex, li id.TriceIDLookUp
 	p.B0 = make([]byte, decoder.DefaultSize)          // len max
 	p.InnerBuffer = make([]byte, decoder.DefaultSize) // len max
 	p.Lut = lut
-	p.LutMutex = m
 	p.Endian = endian
 	p.Li = li
+	decoder.TargetCore = -1
 
 	switch strings.ToLower(decoder.PackageFraming) {
 	case "cobs":
@@ -118,6 +123,13 @@ func New(w io.Writer, lut id.TriceIDLookUp, m *sync.RWMutex, li id.TriceIDLookUp
 	default:
 		log.Fatal("Invalid framing switch:\a", decoder.PackageFraming)
 	}
+	var err error
+	if p.codec, err = newPayloadCodec(decoder.PayloadCodec); err != nil {
+		log.Fatal(err)
+	}
+	if p.codec != nil && p.packageFraming == packageFramingNone {
+		log.Fatal("The payload codec ", decoder.PayloadCodec, " needs package framing.")
+	}
 	return p
 }
 
@@ -127,7 +139,11 @@ func New(w io.Writer, lut id.TriceIDLookUp, m *sync.RWMutex, li id.TriceIDLookUp
 // That means the incoming data stream is exhausted and a next try should be started a bit later.
 // Some arrived bytes are kept internally and concatenated with the following bytes in a next Read.
 // Afterwards 0 or at least 4 bytes are inside p.B
+// While p.B holds more than a maximum size trice, nothing is read, so a big file does not end up completely in p.B.
 func (p *trexDec) nextData() {
+	if len(p.B) >= decoder.DefaultSize {
+		return
+	}
 	m, err := p.In.Read(p.InnerBuffer)      // use p.InnerBuffer as destination read buffer
 	p.B = append(p.B, p.InnerBuffer[:m]...) // merge with leftovers
 	if err != nil && err != io.EOF {        // some serious error
@@ -150,7 +166,8 @@ func (p *trexDec) nextPackage() {
 	if index == -1 {                    // p.IBuf has no complete COBS data, so try to read more input
 		m, err := p.In.Read(p.InnerBuffer)            // use p.InnerBuffer as bytes read buffer
 		p.IBuf = append(p.IBuf, p.InnerBuffer[:m]...) // merge with leftovers
-		if err != nil && err != io.EOF {              // some serious error
+		p.inputEnd = err == io.EOF
+		if err != nil && err != io.EOF { // some serious error
 			log.Fatal("ERROR:internal reader error\a", err) // exit
 		}
 		index = bytes.IndexByte(p.IBuf, 0) // find terminating 0
@@ -287,7 +304,20 @@ func isZero(bytes []byte) bool {
 // but the start of a following trice package can be already inside the internal buffer.
 // In case of a not matching cycle, a warning message in trice format is prefixed.
 // In case of invalid package data, error messages in trice format are returned and the package is dropped.
+// Trices, which the ID filters or the channel filters would suppress anyway, are consumed without formatting them.
 func (p *trexDec) Read(b []byte) (n int, err error) {
+	for {
+		p.hidden = false
+		n, err = p.read(b)
+		if n > 0 || err != nil || !p.hidden {
+			return // A hidden trice alone must not look like missing data.
+		}
+	}
+}
+
+// read decodes the next trice as described for Read.
+func (p *trexDec) read(b []byte) (n int, err error) {
+	decoder.LastTriceStart = -1
 	if p.packageFraming == packageFramingNone {
 		p.nextData() // returns all unprocessed data inside p.B
 		p.B0 = p.B   // keep data for re-sync
@@ -302,7 +332,11 @@ func (p *trexDec) Read(b []byte) (n int, err error) {
 			p.B = p.B[:0]
 		}
 		if len(p.B) == 0 { // last decoded package exhausted
-			p.nextPackage() // returns one decoded package inside p.B
+			if decoder.CoreSort {
+				p.nextSortedTrice() // returns one trice in timestamp order inside p.B
+			} else {
+				p.nextPackage() // returns one decoded package inside p.B
+			}
 		}
 	}
 	packageSize := len(p.B)
@@ -314,6 +348,7 @@ func (p *trexDec) Read(b []byte) (n int, err error) {
 
 	triceType := int(tyId >> decoder.IDBits) // most significant bit are the triceType
 	triceID := id.TriceID(0x3FFF & tyId)     // 14 least significant bits are the ID
+	lut := p.loadLut()                       // one map snapshot for the whole trice, even when the ID list file gets reloaded meanwhile
 	decoder.LastTriceID = triceID            // used for showID
 
 	switch triceType {
@@ -331,24 +366,18 @@ func (p *trexDec) Read(b []byte) (n int, err error) {
 		}
 	case typeS4: // 32-bit stamp
 		decoder.TargetTimestampSize = 4
-	//case typeS8: // 64-bit stamp
-	//	decoder.TargetTimestampSize = 8
-	case typeX0: // extended trice type X0
-		// todo: implement special case here
-		//case typeX1: // extended trice type X0
-		// todo: implement special case here
-		//case typeX2: // extended trice type X0
-		// todo: implement special case here
-		//case typeX3: // extended trice type X0
-		// todo: implement special case here
-		if p.packageFraming == packageFramingNone && len(p.B) > 0 { // typeX0 is not supported (yet)
-			if decoder.Verbose {
-				n += copy(b[n:], fmt.Sprintln("wrn:\adiscarding byte", p.B0[0]))
+	case typeX0: // extended trice type X0 is used for 64-bit stamps (target TRICE_STAMP64 == 1), when enabled with -ts64
+		if !decoder.ShowTargetStamp64Passed {
+			if p.packageFraming == packageFramingNone && len(p.B) > 0 { // typeX0 is not supported without 64-bit stamps
+				if decoder.Verbose {
+					n += copy(b[n:], fmt.Sprintln("wrn:\adiscarding byte", p.B0[0]))
+				}
+				p.B0 = p.B0[1:] // remove first byte to try to resync
+				p.B = p.B0
 			}
-			p.B0 = p.B0[1:] // remove first byte to try to resync
-			p.B = p.B0
+			return
 		}
-		return
+		decoder.TargetTimestampSize = 8
 	}
 
 	if packageSize < tyIdSize+decoder.TargetTimestampSize+ncSize { // for non typeEX trices
@@ -362,16 +391,27 @@ func (p *trexDec) Read(b []byte) (n int, err error) {
 		decoder.TargetTimestamp = uint64(p.ReadU16(p.B))
 	} else if triceType == typeS4 { // 32-bit stamp
 		decoder.TargetTimestamp = uint64(p.ReadU32(p.B))
-		//} else if triceType == typeS8 { // 64-bit stamp
-		//	decoder.TargetTimestamp = uint64(p.ReadU64(p.B))
+	} else if triceType == typeX0 { // 64-bit stamp
+		decoder.TargetTimestamp = p.ReadU64(p.B)
 	} else {
 		log.Fatal("triceType ", triceType, " not implemented (hint: IDBits value?)")
 	}
 	p.B = p.B[decoder.TargetTimestampSize:]
+	decoder.TrackTargetTimestamp()
 
 	if len(p.B) < 2 {
 		return // wait for more data
 	}
+	if p.codec != nil { // replace an encoded payload by the raw payload
+		l := len(p.B)
+		var e error
+		if p.B, _, e = p.expandPayload(triceID, p.B, 0); e != nil {
+			n += copy(b[n:], fmt.Sprintln("ERROR:\a", e, "- ignoring package", p.B))
+			p.B = p.B[len(p.B):] // discard buffer
+			return
+		}
+		packageSize += len(p.B) - l
+	}
 	nc := p.ReadU16(p.B) // n = number of data bytes (without timestamp), most significant bit is the count encoding, c = cycle
 	p.B = p.B[ncSize:]
 
@@ -386,6 +426,15 @@ func (p *trexDec) Read(b []byte) (n int, err error) {
 		p.ParamSpace = int(nc >> 8) // high byte is 7 bit number of bytes for data count excluding timestamp
 	}
 
+	if triceID == CoreTagTriceID && p.ParamSpace == 4 && len(p.B) >= 4 {
+		_, ok := lut[triceID]
+		if !ok { // A core tag trice has no valid cycle and is not displayed.
+			decoder.TargetCore = int(p.ReadU32(p.B))
+			p.B = p.B[4:]
+			return p.read(b)
+		}
+	}
+
 	p.TriceSize = tyIdSize + decoder.TargetTimestampSize + ncSize + p.ParamSpace
 	if p.TriceSize > packageSize { //  '>' for multiple trices in one package (case TriceOutMultiPackMode), todo: discuss all possible variants
 		if p.packageFraming == packageFramingNone {
@@ -432,9 +481,13 @@ func (p *trexDec) Read(b []byte) (n int, err error) {
 	}
 
 	var ok bool
-	p.LutMutex.RLock()
-	p.Trice, ok = p.Lut[triceID]
-	p.LutMutex.RUnlock()
+	p.Trice, ok = lut[triceID]
+	if !ok && triceID == LostTriceID {
+		p.Trice, ok = lostTrice, true
+	}
+	if !ok && triceID == RateSummaryTriceID {
+		p.Trice, ok = rateSummaryTrice, true
+	}
 	if !ok {
 		if p.packageFraming == packageFramingNone {
 			if decoder.Verbose {
@@ -450,7 +503,22 @@ func (p *trexDec) Read(b []byte) (n int, err error) {
 		return
 	}
 
-	n += p.sprintTrice(b[n:]) // use param info
+	hidden := !p.visible.Visible(triceID)
+	if hidden && p.visible.ByLevel(triceID) {
+		if decoder.LineOpen {
+			hidden = false // The line end is needed and the text output suppresses the rest.
+		} else {
+			emitter.CountChannelEvent(p.Trice.Strg)
+		}
+	}
+	if hidden {
+		p.hidden = true // The parameters are dropped below unformatted.
+	} else {
+		decoder.LastTriceStart = n
+		decoder.SetLastTriceValues() // cleared here, the parameter conversion functions set the values
+		n += p.sprintTrice(b[n:])    // use param info
+		decoder.LastTriceEnd = n
+	}
 	if len(p.B) < p.ParamSpace {
 		if p.packageFraming == packageFramingNone {
 			if decoder.Verbose {
@@ -478,6 +546,40 @@ func (p *trexDec) Read(b []byte) (n int, err error) {
 	return
 }
 
+// loadLut returns the actual ID look-up map and resolves the visible IDs once for each new map.
+func (p *trexDec) loadLut() id.TriceIDLookUp {
+	current := p.Lut.Current()
+	if p.visible == nil || current != p.visibleLut {
+		var lut id.TriceIDLookUp
+		if current != nil {
+			lut = *current
+		}
+		var filter func(string) (bool, bool)
+		if decoder.SkipHidden {
+			text := decoder.LogFormat == "text"
+			filter = func(strg string) (bool, bool) { return emitter.TriceVisibility(strg, text) }
+		}
+		p.visible = decoder.NewVisibleIDs(lut, filter)
+		p.visibleLut = current
+	}
+	if current == nil {
+		return nil
+	}
+	return *current
+}
+
+// LostTriceID is the reserved ID of the trice, which the target ring buffer emits after dropping trices (TRICE_LOST_ID in trice.h).
+const LostTriceID = id.TriceID(0x3FFF)
+
+// lostTrice is used for LostTriceID, when not in til.json. The target transmits the count of dropped trices as 32-bit value.
+var lostTrice = id.TriceFmt{Type: "trice32", Strg: `wrn:%u trices lost\n`}
+
+// RateSummaryTriceID is the reserved ID of the trice, which the target rate limiter emits for suppressed trices (TRICE_RATE_SUMMARY_ID in trice.h).
+const RateSummaryTriceID = id.TriceID(0x3FFD)
+
+// rateSummaryTrice is used for RateSummaryTriceID, when not in til.json. The target transmits the ID and its suppressed count as 32-bit values.
+var rateSummaryTrice = id.TriceFmt{Type: "trice32", Strg: `wrn:ID %u: %u suppressed\n`}
+
 // sprintTrice writes a trice string or appropriate message into b and returns that len.
 //
 // p.Trice.Type is the received trice, in fact the name from til.json.
@@ -545,6 +647,9 @@ func (p *trexDec) sprintTrice(b []byte) (n int) {
 				p.pFmt = strings.TrimRight(p.pFmt, " ")
 			}
 
+			if !p.Endian && s.bitWidth > 8 { // big endian target
+				swapValues(p.B[:p.ParamSpace], s.bitWidth>>3)
+			}
 			n += s.triceFn(p, b, s.bitWidth, s.paramCount) // match found, call handler
 			return
 		}
@@ -554,6 +659,26 @@ func (p *trexDec) sprintTrice(b []byte) (n int) {
 	return
 }
 
+// swapValues reverses the byte order of each size bytes wide value inside b.
+//
+// The payload of a big endian target is converted this way in one pass to little endian before the trice functions read the values.
+func swapValues(b []byte, size int) {
+	switch size {
+	case 2:
+		for i := 0; i+2 <= len(b); i += 2 {
+			b[i], b[i+1] = b[i+1], b[i]
+		}
+	case 4:
+		for i := 0; i+4 <= len(b); i += 4 {
+			binary.LittleEndian.PutUint32(b[i:], binary.BigEndian.Uint32(b[i:]))
+		}
+	case 8:
+		for i := 0; i+8 <= len(b); i += 8 {
+			binary.LittleEndian.PutUint64(b[i:], binary.BigEndian.Uint64(b[i:]))
+		}
+	}
+}
+
 // triceTypeFn is the type for cobsFunctionPtrList elements.
 type triceTypeFn struct {
 	triceType  string                                              // triceType describes if parameters, the parameter bit width or if the parameter is a string.
@@ -563,21 +688,21 @@ type triceTypeFn struct {
 	paramCount int                                                 // paramCount is the amount pf parameters for the format string, which must match the count of format specifiers.
 }
 
-// cobsFunctionPtrList is a function pointer list.
-var cobsFunctionPtrList = [...]triceTypeFn{
-	{"TRICE_S", (*trexDec).triceS, -1, 0, 0},     // do not remove from first position, see cobsFunctionPtrList[0].ParamSpace = ...
-	{"TRICE_N", (*trexDec).triceN, -1, 0, 0},     // do not remove from 2nd position, see cobsFunctionPtrList[1].ParamSpace = ...
-	{"TRICE_B", (*trexDec).trice8B, -1, 0, 0},    // do not remove from 3rd position, see cobsFunctionPtrList[2].ParamSpace = ...
-	{"TRICE8_B", (*trexDec).trice8B, -1, 0, 0},   // do not remove from 4th position, see cobsFunctionPtrList[3].ParamSpace = ...
-	{"TRICE16_B", (*trexDec).trice16B, -1, 0, 0}, // do not remove from 4th position, see cobsFunctionPtrList[4].ParamSpace = ...
-	{"TRICE32_B", (*trexDec).trice32B, -1, 0, 0}, // do not remove from 4th position, see cobsFunctionPtrList[5].ParamSpace = ...
-	{"TRICE64_B", (*trexDec).trice64B, -1, 0, 0}, // do not remove from 4th position, see cobsFunctionPtrList[6].ParamSpace = ...
-
-	{"TRICE_F", (*trexDec).trice8F, -1, 0, 0},    // do not remove from 4th position, see cobsFunctionPtrList[7].ParamSpace = ...
-	{"TRICE8_F", (*trexDec).trice8F, -1, 0, 0},   // do not remove from 4th position, see cobsFunctionPtrList[8].ParamSpace = ...
-	{"TRICE16_F", (*trexDec).trice16F, -1, 0, 0}, // do not remove from 4th position, see cobsFunctionPtrList[9].ParamSpace = ...
-	{"TRICE32_F", (*trexDec).trice32F, -1, 0, 0}, // do not remove from 4th position, see cobsFunctionPtrList[10].ParamSpace = ...
-	{"TRICE64_F", (*trexDec).trice64F, -1, 0, 0}, // do not remove from 4th position, see cobsFunctionPtrList[11].ParamSpace = ...
+// cobsFunctionPtrList is a function pointer list. The entries for more than 12 values are appended in init.
+var cobsFunctionPtrList = []triceTypeFn{
+	{"TRICE_S", (*trexDec).triceS, -1, 0, 0},      // do not remove from first position, see cobsFunctionPtrList[0].ParamSpace = ...
+	{"TRICE_N", (*trexDec).triceN, -1, 0, 0},      // do not remove from 2nd position, see cobsFunctionPtrList[1].ParamSpace = ...
+	{"TRICE_B", (*trexDec).trice8B, -1, 0, 0},     // do not remove from 3rd position, see cobsFunctionPtrList[2].ParamSpace = ...
+	{"TRICE8_B", (*trexDec).trice8B, -1, 0, 0},    // do not remove from 4th position, see cobsFunctionPtrList[3].ParamSpace = ...
+	{"TRICE16_B", (*trexDec).trice16B, -1, 16, 0}, // do not remove from 4th position, see cobsFunctionPtrList[4].ParamSpace = ...
+	{"TRICE32_B", (*trexDec).trice32B, -1, 32, 0}, // do not remove from 4th position, see cobsFunctionPtrList[5].ParamSpace = ...
+	{"TRICE64_B", (*trexDec).trice64B, -1, 64, 0}, // do not remove from 4th position, see cobsFunctionPtrList[6].ParamSpace = ...
+
+	{"TRICE_F", (*trexDec).trice8F, -1, 0, 0},     // do not remove from 4th position, see cobsFunctionPtrList[7].ParamSpace = ...
+	{"TRICE8_F", (*trexDec).trice8F, -1, 0, 0},    // do not remove from 4th position, see cobsFunctionPtrList[8].ParamSpace = ...
+	{"TRICE16_F", (*trexDec).trice16F, -1, 16, 0}, // do not remove from 4th position, see cobsFunctionPtrList[9].ParamSpace = ...
+	{"TRICE32_F", (*trexDec).trice32F, -1, 32, 0}, // do not remove from 4th position, see cobsFunctionPtrList[10].ParamSpace = ...
+	{"TRICE64_F", (*trexDec).trice64F, -1, 64, 0}, // do not remove from 4th position, see cobsFunctionPtrList[11].ParamSpace = ...
 
 	{"TRICE8_0", (*trexDec).trice0, 0, 0, 0},
 	{"TRICE16_0", (*trexDec).trice0, 0, 0, 0},
@@ -634,9 +759,20 @@ var cobsFunctionPtrList = [...]triceTypeFn{
 	{"TRICE64_12", (*trexDec).unSignedOrSignedOut, 96, 64, 12},
 }
 
+// init extends cobsFunctionPtrList with the trice types for 13 to id.MaxParamCount values, see "trice generate".
+func init() {
+	for _, bitWidth := range []int{8, 16, 32, 64} {
+		for count := 13; count <= id.MaxParamCount; count++ {
+			name := fmt.Sprintf("TRICE%d_%d", bitWidth, count)
+			cobsFunctionPtrList = append(cobsFunctionPtrList, triceTypeFn{name, (*trexDec).unSignedOrSignedOut, count * bitWidth >> 3, bitWidth, count})
+		}
+	}
+}
+
 // triceN converts dynamic strings.
 func (p *trexDec) triceN(b []byte, _ int, _ int) int {
 	s := string(p.B[:p.ParamSpace])
+	decoder.SetLastTriceValues(s)
 	// todo: evaluate p.Trice.Strg, use p.SLen and do whatever should be done
 	return copy(b, fmt.Sprintf(p.Trice.Strg, s))
 }
@@ -644,6 +780,7 @@ func (p *trexDec) triceN(b []byte, _ int, _ int) int {
 // triceS converts dynamic strings.
 func (p *trexDec) triceS(b []byte, _ int, _ int) int {
 	s := string(p.B[:p.ParamSpace])
+	decoder.SetLastTriceValues(s)
 	return copy(b, fmt.Sprintf(p.Trice.Strg, s))
 }
 
@@ -653,6 +790,7 @@ func (p *trexDec) trice8B(b []byte, _ int, _ int) (n int) {
 		fmt.Fprintln(p.W, p.B)
 	}
 	s := p.B[:p.ParamSpace]
+	setBufferValues(s, 1)
 	for i := 0; i < len(s); i++ {
 		n += copy(b[n:], fmt.Sprintf(p.Trice.Strg, s[i]))
 	}
@@ -665,6 +803,7 @@ func (p *trexDec) trice16B(b []byte, _ int, _ int) (n int) {
 		fmt.Fprintln(p.W, p.B)
 	}
 	s := p.B[:p.ParamSpace]
+	setBufferValues(s, 2)
 	for i := 0; i < len(s); i += 2 {
 		n += copy(b[n:], fmt.Sprintf(p.Trice.Strg, binary.LittleEndian.Uint16(s[i:])))
 	}
@@ -677,6 +816,7 @@ func (p *trexDec) trice32B(b []byte, _ int, _ int) (n int) {
 		fmt.Fprintln(p.W, p.B)
 	}
 	s := p.B[:p.ParamSpace]
+	setBufferValues(s, 4)
 	for i := 0; i < len(s); i += 4 {
 		n += copy(b[n:], fmt.Sprintf(p.Trice.Strg, binary.LittleEndian.Uint32(s[i:])))
 	}
@@ -689,6 +829,7 @@ func (p *trexDec) trice64B(b []byte, _ int, _ int) (n int) {
 		fmt.Fprintln(p.W, p.B)
 	}
 	s := p.B[:p.ParamSpace]
+	setBufferValues(s, 8)
 	for i := 0; i < len(s); i += 8 {
 		n += copy(b[n:], fmt.Sprintf(p.Trice.Strg, binary.LittleEndian.Uint64(s[i:])))
 	}
@@ -701,6 +842,7 @@ func (p *trexDec) trice8F(b []byte, _ int, _ int) (n int) {
 		fmt.Fprintln(p.W, p.B)
 	}
 	s := p.B[:p.ParamSpace]
+	setBufferValues(s, 1)
 	n += copy(b[n:], fmt.Sprintf(p.Trice.Strg))
 	for i := 0; i < len(s); i++ {
 		n += copy(b[n:], fmt.Sprintf("(%02x)", s[i]))
@@ -715,6 +857,7 @@ func (p *trexDec) trice16F(b []byte, _ int, _ int) (n int) {
 		fmt.Fprintln(p.W, p.B)
 	}
 	s := p.B[:p.ParamSpace]
+	setBufferValues(s, 2)
 	n += copy(b[n:], fmt.Sprintf(p.Trice.Strg))
 	for i := 0; i < len(s); i += 2 {
 		n += copy(b[n:], fmt.Sprintf("(%04x)", binary.LittleEndian.Uint16(s[i:])))
@@ -729,6 +872,7 @@ func (p *trexDec) trice32F(b []byte, _ int, _ int) (n int) {
 		fmt.Fprintln(p.W, p.B)
 	}
 	s := p.B[:p.ParamSpace]
+	setBufferValues(s, 4)
 	n += copy(b[n:], fmt.Sprintf(p.Trice.Strg))
 	for i := 0; i < len(s); i += 4 {
 		n += copy(b[n:], fmt.Sprintf("(%08x)", binary.LittleEndian.Uint32(s[i:])))
@@ -743,6 +887,7 @@ func (p *trexDec) trice64F(b []byte, _ int, _ int) (n int) {
 		fmt.Fprintln(p.W, p.B)
 	}
 	s := p.B[:p.ParamSpace]
+	setBufferValues(s, 8)
 	n += copy(b[n:], fmt.Sprintf(p.Trice.Strg))
 	for i := 0; i < len(s); i += 8 {
 		n += copy(b[n:], fmt.Sprintf("(%016x)", binary.LittleEndian.Uint64(s[i:])))
@@ -751,6 +896,28 @@ func (p *trexDec) trice64F(b []byte, _ int, _ int) (n int) {
 	return
 }
 
+// setBufferValues sets decoder.LastTriceValues to the little endian elements with size bytes inside s.
+func setBufferValues(s []byte, size int) {
+	if decoder.LogFormat == "text" {
+		return
+	}
+	decoder.SetLastTriceValues()
+	for i := 0; i+size <= len(s); i += size {
+		var v uint64
+		switch size {
+		case 1:
+			v = uint64(s[i])
+		case 2:
+			v = uint64(binary.LittleEndian.Uint16(s[i:]))
+		case 4:
+			v = uint64(binary.LittleEndian.Uint32(s[i:]))
+		default:
+			v = binary.LittleEndian.Uint64(s[i:])
+		}
+		decoder.LastTriceValues = append(decoder.LastTriceValues, v)
+	}
+}
+
 // trice0 prints the trice format string.
 func (p *trexDec) trice0(b []byte, _ int, _ int) int {
 	return copy(b, fmt.Sprintf(p.pFmt))
@@ -761,7 +928,7 @@ func (p *trexDec) unSignedOrSignedOut(b []byte, bitwidth, count int) int {
 	if len(p.u) != count {
 		return copy(b, fmt.Sprintln("ERROR: Invalid format specifier count inside", p.Trice.Type, p.Trice.Strg))
 	}
-	v := make([]interface{}, 32768) // theoretical 2^15 bytes could arrive
+	v := make([]interface{}, len(p.u))
 	switch bitwidth {
 	case 8:
 		for i, f := range p.u {
@@ -780,7 +947,7 @@ func (p *trexDec) unSignedOrSignedOut(b []byte, bitwidth, count int) int {
 		}
 	case 16:
 		for i, f := range p.u {
-			n := p.ReadU16(p.B[2*i:])
+			n := binary.LittleEndian.Uint16(p.B[2*i:])
 			switch f {
 			//case decoder.PointerFormatSpecifier:
 			//	v[i] = unsafe.Pointer(uintptr(n))
@@ -796,7 +963,7 @@ func (p *trexDec) unSignedOrSignedOut(b []byte, bitwidth, count int) int {
 		}
 	case 32:
 		for i, f := range p.u {
-			n := p.ReadU32(p.B[4*i:])
+			n := binary.LittleEndian.Uint32(p.B[4*i:])
 			switch f {
 			//case decoder.PointerFormatSpecifier:
 			//	v[i] = unsafe.Pointer(uintptr(n))
@@ -814,7 +981,7 @@ func (p *trexDec) unSignedOrSignedOut(b []byte, bitwidth, count int) int {
 		}
 	case 64:
 		for i, f := range p.u {
-			n := p.ReadU64(p.B[8*i:])
+			n := binary.LittleEndian.Uint64(p.B[8*i:])
 			switch f {
 			//case decoder.PointerFormatSpecifier:
 			//	v[i] = unsafe.Pointer(uintptr(n))
@@ -831,6 +998,7 @@ func (p *trexDec) unSignedOrSignedOut(b []byte, bitwidth, count int) int {
 			}
 		}
 	}
+	decoder.SetLastTriceValues(v[:len(p.u)]...)
 	return copy(b, fmt.Sprintf(p.pFmt, v[:len(p.u)]...))
 }
 
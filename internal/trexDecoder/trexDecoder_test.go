@@ -5,15 +5,19 @@ package trexDecoder
 
 import (
 	"bytes"
+	"encoding/binary"
 	"fmt"
 	"io"
 	"os"
 	"strings"
 	"sync"
 	"testing"
+	"time"
 
+	cobs "github.com/rokath/cobs/go"
 	"github.com/rokath/trice/internal/decoder"
 	"github.com/rokath/trice/internal/id"
+	"github.com/spf13/afero"
 	"github.com/tj/assert"
 )
 
@@ -35,11 +39,10 @@ func doTableTest(t *testing.T, out io.Writer, f decoder.New, endianness bool, te
 	)
 	ilu := make(id.TriceIDLookUp)  // empty
 	li := make(id.TriceIDLookUpLI) // empty
-	luM := new(sync.RWMutex)
 	assert.Nil(t, ilu.FromJSON([]byte(idl)))
 	ilu.AddFmtCount(os.Stdout)
 	buf := make([]byte, decoder.DefaultSize)
-	dec := f(out, ilu, luM, li, nil, endianness) // a new decoder instance
+	dec := f(out, id.NewLutSnapshot(ilu), li, nil, endianness) // a new decoder instance
 	for _, x := range teTa {
 		in := io.NopCloser(bytes.NewBuffer(x.In))
 		dec.SetInput(in)
@@ -77,3 +80,158 @@ func TestTREX(t *testing.T) {
 	doTableTest(t, &out, New, decoder.LittleEndian, tt)
 	assert.Equal(t, "", out.String())
 }
+
+// TestTREXStamp64 checks an unframed trice with a 64-bit target stamp, which uses the typeX0 ID bits.
+func TestTREXStamp64(t *testing.T) {
+	tt := decoder.TestTable{ // little endian
+		//idLo  idHi  ts0   ts1   ts2   ts3   ts4   ts5   ts6   ts7   cycle count vLo   vHi   padding
+		{[]byte{0x81, 0x0e, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0xc0, 0x02, 0xb8, 0x01, 0x00, 0x00}, `MSG: 💚 START select = 440`},
+	}
+	decoder.PackageFraming = "none"
+	decoder.ShowTargetStamp64Passed = true
+	defer func() { decoder.PackageFraming = "TCOBSv1"; decoder.ShowTargetStamp64Passed = false }()
+	var out bytes.Buffer
+	doTableTest(t, &out, New, decoder.LittleEndian, tt)
+	assert.Equal(t, "", out.String())
+	assert.Equal(t, 8, decoder.TargetTimestampSize)
+	assert.Equal(t, uint64(0x0102030405060708), decoder.TargetTimestamp)
+}
+
+// TestTREXStamp64NotPassed checks, that without -ts64 an unframed typeX0 trice is not decoded and its bytes get discarded for resync.
+func TestTREXStamp64NotPassed(t *testing.T) {
+	in := []byte{0x81, 0x0e, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0xc0, 0x02, 0xb8, 0x01, 0x00, 0x00}
+	decoder.PackageFraming = "none"
+	decoder.Verbose = true
+	defer func() { decoder.PackageFraming = "TCOBSv1"; decoder.Verbose = false }()
+	var out bytes.Buffer
+	dec := New(&out, id.NewLutSnapshot(make(id.TriceIDLookUp)), make(id.TriceIDLookUpLI), nil, decoder.LittleEndian)
+	dec.SetInput(io.NopCloser(bytes.NewBuffer(in)))
+	buf := make([]byte, decoder.DefaultSize)
+	n, _ := dec.Read(buf)
+	act := string(buf[:n])
+	assert.True(t, strings.HasPrefix(act, "wrn:\adiscarding byte 129"), act)
+	assert.False(t, strings.Contains(act, "START select"), act)
+}
+
+// TestPayloadCodecDelta checks the zigzag varint delta decoding and the reference handling of not encoded payloads and taken over slots.
+func TestPayloadCodecDelta(t *testing.T) {
+	c, err := newPayloadCodec("delta")
+	assert.Nil(t, err)
+	raw, err := c.decode(5, []byte{0xc8, 0x01, 0x01}) // 100, -1
+	assert.Nil(t, err)
+	assert.Equal(t, []byte{100, 0, 0, 0, 0xff, 0xff, 0xff, 0xff}, raw)
+	raw, err = c.decode(5, []byte{0x02, 0x02}) // +1, +1
+	assert.Nil(t, err)
+	assert.Equal(t, []byte{101, 0, 0, 0, 0, 0, 0, 0}, raw)
+	c.reference(5, []byte{7, 0, 0, 0})
+	raw, _ = c.decode(5, []byte{0x00})
+	assert.Equal(t, []byte{7, 0, 0, 0}, raw)
+	raw, _ = c.decode(5+codecSlots, []byte{0x00}) // same slot, other ID
+	assert.Equal(t, []byte{0, 0, 0, 0}, raw)
+	_, err = c.decode(5, []byte{0x80})
+	assert.NotNil(t, err)
+}
+
+// liveInput is a byte buffer, which does not signal io.EOF, like a serial port without new data.
+type liveInput struct{ bytes.Buffer }
+
+func (p *liveInput) Read(b []byte) (int, error) {
+	n, _ := p.Buffer.Read(b)
+	return n, nil
+}
+
+// corePackage returns a COBS framed package of core with a core tag trice and a trice with a 32-bit stamp and value.
+func corePackage(core, stamp, value uint32, cycle byte) []byte {
+	var b []byte
+	b = binary.LittleEndian.AppendUint16(b, uint16(typeS0)<<14|uint16(CoreTagTriceID))
+	b = append(b, cycle, 4)
+	b = binary.LittleEndian.AppendUint32(b, core)
+	b = binary.LittleEndian.AppendUint16(b, uint16(typeS4)<<14|935)
+	b = binary.LittleEndian.AppendUint32(b, stamp)
+	b = append(b, cycle, 4)
+	b = binary.LittleEndian.AppendUint32(b, value)
+	f := make([]byte, 2*len(b)+2)
+	n := cobs.Encode(f, b)
+	return append(f[:n], 0)
+}
+
+// TestCoreSortHold checks, that -coreSort holds a trice, as long as another core may deliver an earlier stamp,
+// and releases it after decoder.CoreSortHold or at the input end.
+func TestCoreSortHold(t *testing.T) {
+	ilu := make(id.TriceIDLookUp)
+	assert.Nil(t, ilu.FromJSON([]byte(`{"935": {"Type": "TRICE", "Strg": "msg:value %d\n"}}`)))
+	decoder.PackageFraming = "COBS"
+	decoder.CoreSort = true
+	defer func(hold time.Duration) {
+		decoder.PackageFraming = "TCOBSv1"
+		decoder.CoreSort = false
+		decoder.CoreSortHold = hold
+	}(decoder.CoreSortHold)
+	buf := make([]byte, decoder.DefaultSize)
+	read := func(dec decoder.Decoder) string {
+		n, _ := dec.Read(buf)
+		return string(buf[:n])
+	}
+
+	decoder.CoreSortHold = time.Hour
+	in := &liveInput{}
+	in.Write(corePackage(0, 10, 100, 0xc0))
+	in.Write(corePackage(1, 20, 200, 0xc1))
+	dec := New(io.Discard, id.NewLutSnapshot(ilu), make(id.TriceIDLookUpLI), in, decoder.LittleEndian)
+	assert.Equal(t, "msg:value 100\n", read(dec))
+	assert.Equal(t, "", read(dec)) // core 0 could still deliver a stamp < 20
+	decoder.CoreSortHold = 0
+	assert.Equal(t, "msg:value 200\n", read(dec))
+
+	decoder.CoreSortHold = time.Hour
+	dec = New(io.Discard, id.NewLutSnapshot(ilu), make(id.TriceIDLookUpLI), bytes.NewReader(append(corePackage(0, 10, 100, 0xc0), corePackage(1, 20, 200, 0xc1)...)), decoder.LittleEndian)
+	assert.Equal(t, "msg:value 100\n", read(dec))
+	assert.Equal(t, "msg:value 200\n", read(dec)) // input end
+}
+
+// BenchmarkTREXReload decodes a TCOBS framed trice, optionally while the ID look-up map gets reloaded every millisecond.
+// The decoder reads the map without locks, so the reloads should not slow down the decoding noticeably.
+func BenchmarkTREXReload(b *testing.B) {
+	frame := []byte{0x81, 0x8e, 0x09, 0x23, 0xc0, 0x02, 0xb8, 0x01, 0xa4, 0x00}
+	fSys := &afero.Afero{Fs: afero.NewMemMapFs()}
+	fn := "til.json"
+	til := `{"3713":{"Type":"TRICE16","Strg":"MSG: 💚 START select = %d\\n"}}`
+	assert.Nil(b, fSys.WriteFile(fn, []byte(til), 0644))
+	for _, reload := range []bool{false, true} {
+		b.Run(fmt.Sprint("reload=", reload), func(b *testing.B) {
+			lut := id.NewLutSnapshot(make(id.TriceIDLookUp))
+			assert.Nil(b, lut.Reload(io.Discard, fSys, fn))
+			done := make(chan struct{})
+			var wg sync.WaitGroup
+			if reload {
+				wg.Add(1)
+				go func() {
+					defer wg.Done()
+					for {
+						select {
+						case <-done:
+							return
+						case <-time.After(time.Millisecond):
+							assert.Nil(b, lut.Reload(io.Discard, fSys, fn))
+						}
+					}
+				}()
+			}
+			decoder.PackageFraming = "TCOBSv1"
+			dec := New(io.Discard, lut, nil, nil, decoder.LittleEndian)
+			buf := make([]byte, decoder.DefaultSize)
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				dec.SetInput(bytes.NewReader(frame))
+				for {
+					if n, _ := dec.Read(buf); n == 0 {
+						break
+					}
+				}
+			}
+			b.StopTimer()
+			close(done)
+			wg.Wait()
+		})
+	}
+}
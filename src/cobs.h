@@ -10,5 +10,7 @@
 
 size_t COBSEncode(void * restrict out, const void * restrict in, size_t length);
 size_t COBSDecode(void * restrict out, const void * restrict in, size_t length);
+size_t COBSEncodeWordwise(void * out, const void * in, size_t length);
+size_t COBSDecodeWordwise(void * out, const void * in, size_t length);
 
 #endif
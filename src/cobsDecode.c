@@ -1,6 +1,7 @@
 //! \file cobsDecode.c copied from https://github.com/rokath/cobs
 //! \author Thomas.Hoehenleitner [at] seerose.net
 
+#include <string.h>
 #include "cobs.h"
 
 //! COBSDecode decodes data from in buffer.
@@ -30,3 +31,34 @@ size_t COBSDecode(void * restrict out, const void * restrict in, size_t length )
 	}
 	return (size_t)(decode - data);
 }
+
+//! COBSDecodeWordwise decodes data from in buffer and creates the same output as COBSDecode.
+//! Each block is copied in one step instead of byte by byte.
+//! @param in Pointer to encoded input bytes. No alignment needed.
+//! @param length Number of bytes to decode.
+//! @param out Pointer to decoded output data. No alignment needed.
+//! @return Number of bytes successfully decoded.
+//! @note Stops decoding if delimiter byte is found.
+size_t COBSDecodeWordwise(void * out, const void * in, size_t length ) {
+	uint8_t * const data = out;
+	uint8_t * decode = data; // Decoded output byte pointer
+	const uint8_t * byte = in; // Encoded input byte pointer
+	const uint8_t * const limit = byte + length;
+	uint8_t code = 0xff;
+	while( byte < limit ){
+		if( code != 0xff ){ // Encoded zero, write it
+			*decode++ = 0;
+		}
+		code = *byte++; // Next block length
+		if( !code ){ // Delimiter code found
+			break;
+		}
+		size_t count = (size_t)(code - 1);
+		size_t rest = (size_t)(limit - byte);
+		count = count < rest ? count : rest; // a truncated last block is decoded as far as possible
+		memmove( decode, byte, count ); // in-buffer decoding: out and in can overlap
+		decode += count;
+		byte += count;
+	}
+	return (size_t)(decode - data);
+}
@@ -22,17 +22,23 @@ static void triceNonBlockingWriteUartA( void const * buf, size_t nByte );
 static void triceNonBlockingWriteUartB( void const * buf, size_t nByte );
 #endif
 
-#if TRICE_SEGGER_RTT_32BIT_DIRECT_WRITE == 1
+#if (TRICE_SEGGER_RTT_32BIT_DIRECT_WRITE == 1) && (TRICE_SEGGER_RTT_FAST_WRITE == 0)
 static void SEGGER_Write_RTT0_NoCheck32( const uint32_t* pData, unsigned NumW );
 #endif
 
 // local definines:
 
-#define TRICE_TYPE_X0 0 //!< TRICE_TYPE_X0 ist a unspecified trice (reserved)
+#define TRICE_TYPE_X0 0 //!< TRICE_TYPE_X0 ist a unspecified trice (reserved) or with TRICE_STAMP64 == 1 a trice with 64-bit stamp.
 #define TRICE_TYPE_S0 1 //!< TRICE_TYPE_S0 ist a trice without stamp.
 #define TRICE_TYPE_S2 2 //!< TRICE_TYPE_S2 ist a trice with 16-bit stamp.
 #define TRICE_TYPE_S4 3 //!< TRICE_TYPE_S4 ist a trice with 32-bit stamp.
 
+#if TRICE_COBS_WORDWISE == 1
+#define TRICE_COBS_ENCODE COBSEncodeWordwise //!< TRICE_COBS_ENCODE is the used COBS encoder.
+#else
+#define TRICE_COBS_ENCODE COBSEncode //!< TRICE_COBS_ENCODE is the used COBS encoder.
+#endif
+
 // global variables:
 
 //! TriceErrorCount is incremented, when data inside the internal trice buffer are corrupted.
@@ -52,6 +58,11 @@ uint8_t  TriceCycle = 0xc0;
 
 #endif
 
+#if TRICE_SEGGER_RTT_SINGLE_PRODUCER == 1
+static unsigned triceRtt0WrOff; //!< triceRtt0WrOff is a copy of the RTT up-buffer 0 WrOff, which is changed only by TriceWriteRtt0Fast.
+static unsigned triceRtt0Space; //!< triceRtt0Space is the at least free RTT up-buffer 0 space. The host can only increase it by reading.
+#endif
+
 //! TriceInit needs to run before the first trice macro is executed.
 //! Not neseecary for all configurations.
 void TriceInit( void ){
@@ -60,6 +71,10 @@ void TriceInit( void ){
         // This is just to force the INIT() call inside SEGGER_RTT.c what allows to use
         // SEGGER_RTT_WriteNoLock or SEGGER_Write_RTT0_NoCheck32 instead of SEGGER_RTT_Write.
         SEGGER_RTT_Write(0, 0, 0 ); //lint !e534 
+        #if TRICE_SEGGER_RTT_SINGLE_PRODUCER == 1
+            triceRtt0WrOff = _SEGGER_RTT.aUp[0].WrOff;
+            triceRtt0Space = 0; // forces a RdOff read with the next write
+        #endif
     #endif
 
     #ifdef XTEA_ENCRYPT_KEY
@@ -113,9 +128,16 @@ static size_t triceIDAndLen( uint32_t* pBuf, uint8_t** ppStart, int* triceID ){
         case TRICE_TYPE_S4: // S4 = 32-bit stamp
             len = 8 + triceDataLen(pStart + 6); // tyId ts32
             break;
+        #if TRICE_STAMP64 == 1
+        case TRICE_TYPE_X0: // S8 = 64-bit stamp
+            len = 12 + triceDataLen(pStart + 10); // tyId ts64
+            break;
+        #endif
         default:
             //lint -fallthrugh
+        #if TRICE_STAMP64 == 0
         case TRICE_TYPE_X0:
+        #endif
             TriceErrorCount++;
             *triceID = -__LINE__; // extended trices not supported (yet)
             return 0;
@@ -161,9 +183,17 @@ int TriceIDAndBuffer( uint32_t const * const pAddr, int* pWordCount, uint8_t** p
             offset = 0;
             len = 8 + triceDataLen(pStart + 6); // tyId ts32
             break;
+        #if TRICE_STAMP64 == 1
+        case TRICE_TYPE_X0: // S8 = 64-bit stamp
+            offset = 0;
+            len = 12 + triceDataLen(pStart + 10); // tyId ts64
+            break;
+        #endif
         default:
             // fallthrugh
+        #if TRICE_STAMP64 == 0
         case TRICE_TYPE_X0:
+        #endif
             TriceErrorCount++;
             *ppStart = pStart;
             *pLength = 0;
@@ -211,7 +241,12 @@ int TriceNext( uint8_t** buf, size_t* pSize, uint8_t** pStart, size_t* pLen ){
             len = 8 + triceDataLen(*pStart + 6); // tyId ts32
             break;
         case TRICE_TYPE_X0:
+        #if TRICE_STAMP64 == 1 // S8 = 64-bit stamp
+            len = 12 + triceDataLen(*pStart + 10); // tyId ts64
+            break;
+        #else
             return -__LINE__; // extended trices not supported (yet)
+        #endif
     }
     triceSize = (len + offset + 3) & ~3;
     // S16 case example:            triceSize  len   t-0-3   t-o
@@ -231,6 +266,219 @@ int TriceNext( uint8_t** buf, size_t* pSize, uint8_t** pStart, size_t* pLen ){
     return triceID;
 }
 
+#if TRICE_PAYLOAD_CODEC != TRICE_CODEC_NONE
+
+#if TRICE_DIAGNOSTICS == 1
+
+//! TriceCodecBytesIn is the count of trice bytes before the payload encoding.
+unsigned TriceCodecBytesIn = 0;
+
+//! TriceCodecBytesOut is the count of trice bytes after the payload encoding.
+unsigned TriceCodecBytesOut = 0;
+
+//! TriceCodecCycles is the TRICE_CPU_CYCLES sum spent in the payload encoding, when TRICE_CPU_CYCLES is defined.
+unsigned TriceCodecCycles = 0;
+
+#endif // #if TRICE_DIAGNOSTICS == 1
+
+//! TRICE_CODEC_SLOTS is the count of IDs with a delta reference. The trice tool uses the same value.
+#define TRICE_CODEC_SLOTS 16
+
+//! TRICE_CODEC_SLOT_WORDS is the count of leading payload words with a delta reference. The trice tool uses the same value.
+#define TRICE_CODEC_SLOT_WORDS 4
+
+//! TRICE_CODEC_MAX is the max encoded payload byte count. The byte count is transmitted as TRICE_CODEC_MAX + 1 + encoded byte count.
+#define TRICE_CODEC_MAX 63
+
+#if TRICE_PAYLOAD_CODEC == TRICE_CODEC_DELTA
+
+//! triceCodecSlot holds for TRICE_CODEC_SLOTS IDs the leading payload words of their last trice.
+static struct{
+    uint16_t id;
+    uint32_t v[TRICE_CODEC_SLOT_WORDS];
+} triceCodecSlot[TRICE_CODEC_SLOTS];
+
+//! TriceCodecReset clears the delta references. Call it, when the trice tool is restarted.
+void TriceCodecReset( void ){
+    memset( triceCodecSlot, 0, sizeof(triceCodecSlot) );
+}
+
+#endif // #if TRICE_PAYLOAD_CODEC == TRICE_CODEC_DELTA
+
+//! triceVarint writes v zigzag and varint encoded to p and returns the byte count 1-5.
+static unsigned triceVarint( uint8_t* p, uint32_t v ){
+    uint32_t z = (v << 1) ^ (uint32_t)((int32_t)v >> 31);
+    unsigned n = 0;
+    while( z >= 0x80 ){
+        p[n++] = (uint8_t)(z | 0x80);
+        z >>= 7;
+    }
+    p[n++] = (uint8_t)z;
+    return n;
+}
+
+//! triceCodecSingle encodes the payload of the trice at p with length len in place, if it gets shorter, and returns the new trice length.
+//! \param p points to the trice start, that is the ID without the doubled 16-bit ID.
+//! \param len is the netto trice length.
+static size_t triceCodecSingle( uint8_t* p, size_t len ){
+    unsigned tyId = TRICE_TTOHS( *(uint16_t*)p ); //lint !e826
+    unsigned head; // tyId and stamp byte count
+    switch( tyId >> 14 ){
+        case TRICE_TYPE_S0: head = 2; break;
+        case TRICE_TYPE_S2: head = 4; break;
+        case TRICE_TYPE_S4: head = 6; break;
+        default:            head = 10; break; // TRICE_TYPE_X0
+    }
+    uint16_t nc = TRICE_TTOHS( *(uint16_t*)(p + head) ); //lint !e826
+    unsigned count = nc >> 8;
+    if( (nc & 0x8000) || count == 0 || (count & 3) || head + 2 + count != len ){
+        return len; // long count form, no payload or not a multiple of 32-bit words
+    }
+    uint8_t* payload = p + head + 2;
+    uint8_t enc[TRICE_CODEC_MAX + 5];
+    unsigned encLen = 0;
+    #if TRICE_PAYLOAD_CODEC == TRICE_CODEC_DELTA
+    unsigned tid = tyId & 0x3FFF;
+    uint32_t* ref = triceCodecSlot[tid % TRICE_CODEC_SLOTS].v;
+    if( triceCodecSlot[tid % TRICE_CODEC_SLOTS].id != tid ){ // The slot is taken over, so the references start with 0.
+        triceCodecSlot[tid % TRICE_CODEC_SLOTS].id = tid;
+        memset( ref, 0, TRICE_CODEC_SLOT_WORDS<<2 );
+    }
+    #endif
+    for( unsigned i = 0; i < count; i += 4 ){
+        uint32_t v = payload[i] | ((uint32_t)payload[i+1]<<8) | ((uint32_t)payload[i+2]<<16) | ((uint32_t)payload[i+3]<<24);
+        #if TRICE_PAYLOAD_CODEC == TRICE_CODEC_DELTA
+        if( (i>>2) < TRICE_CODEC_SLOT_WORDS ){ // The references are updated also, when the trice is not encoded.
+            uint32_t d = v - ref[i>>2];
+            ref[i>>2] = v;
+            v = d;
+        }
+        #endif
+        if( encLen <= TRICE_CODEC_MAX ){
+            encLen += triceVarint( enc + encLen, v );
+        }
+    }
+    if( encLen >= count || encLen > TRICE_CODEC_MAX ){
+        return len; // not shorter
+    }
+    nc = (uint16_t)(((TRICE_CODEC_MAX + 1 + encLen)<<8) | (nc & 0xFF));
+    *(uint16_t*)(p + head) = TRICE_HTOTS( nc ); //lint !e826
+    memcpy( payload, enc, encLen );
+    return head + 2 + encLen;
+}
+
+//! triceCodec encodes the payloads of the netto trices at buf with total length len in place and returns the new total length.
+//! With TRICE_PACK_MULTI_MODE buf contains several trices without padding bytes in between.
+static size_t triceCodec( uint8_t* buf, size_t len ){
+    #if defined(TRICE_CPU_CYCLES) && (TRICE_DIAGNOSTICS == 1)
+    uint32_t start = TRICE_CPU_CYCLES();
+    #endif
+    uint8_t* r = buf; // read position
+    uint8_t* w = buf; // write position
+    uint8_t* limit = buf + len;
+    while( r + 4 <= limit ){
+        unsigned tyId = TRICE_TTOHS( *(uint16_t*)r ); //lint !e826
+        unsigned head = (tyId >> 14) == TRICE_TYPE_S0 ? 2 : (tyId >> 14) == TRICE_TYPE_S2 ? 4 : (tyId >> 14) == TRICE_TYPE_S4 ? 6 : 10;
+        if( r + head + 2 > limit ){
+            break;
+        }
+        size_t size = head + 2 + triceDataLen( r + head );
+        if( r + size > limit ){
+            break;
+        }
+        memmove( w, r, size );
+        r += size;
+        w += triceCodecSingle( w, size );
+    }
+    memmove( w, r, limit - r ); // keep unparsable rest
+    w += limit - r;
+    #if TRICE_DIAGNOSTICS == 1
+    TriceCodecBytesIn += len;
+    TriceCodecBytesOut += w - buf;
+    #ifdef TRICE_CPU_CYCLES
+    TriceCodecCycles += TRICE_CPU_CYCLES() - start;
+    #endif
+    #endif
+    return w - buf;
+}
+
+#endif // #if TRICE_PAYLOAD_CODEC != TRICE_CODEC_NONE
+
+#if TRICE_RATE_LIMIT == 1
+
+//! triceRateSlot holds the token bucket of each TRICE_RATE_LIMIT_SELECT slot.
+static struct{
+    uint32_t last;       //!< last is the TRICE_RATE_LIMIT_STAMP value of the last token refill.
+    uint16_t tokens;     //!< tokens is the count of available tokens.
+    uint16_t suppressed; //!< suppressed is the count of suppressed trices since the last report.
+    uint16_t tid;        //!< tid is the ID of the last suppressed trice.
+    uint16_t used;       //!< used is 1 after the first trice in this slot.
+} triceRateSlot[TRICE_RATE_LIMIT_SLOTS];
+
+//! triceRateReported is the TRICE_RATE_LIMIT_STAMP value of the last report.
+static uint32_t triceRateReported = 0;
+
+//! triceRateReport writes for each slot with suppressed trices a TRICE_RATE_SUMMARY_ID trice with the ID and the suppressed count.
+//! When IDs share a slot, the last suppressed ID is reported with the count of the whole slot.
+static void triceRateReport( void ){
+    for( unsigned i = 0; i < TRICE_RATE_LIMIT_SLOTS; i++ ){
+        unsigned tid, suppressed;
+        TRICE_ENTER_CRITICAL_SECTION
+        tid = triceRateSlot[i].tid;
+        suppressed = triceRateSlot[i].suppressed;
+        triceRateSlot[i].suppressed = 0;
+        TRICE_LEAVE_CRITICAL_SECTION
+        if( suppressed ){
+            trice32m_2( TRICE_RATE_SUMMARY_ID, tid, suppressed );
+        }
+    }
+}
+
+//! TriceRateLimit takes a token from the bucket of trice ID tid and returns 1 or returns 0, when no token is available.
+//! It is called before the trice enters the buffer. Each TRICE_RATE_LIMIT_REPORT_TICKS it reports the suppressed trices first.
+int TriceRateLimit( unsigned tid ){
+    tid &= 0x3FFF;
+    unsigned slot = TRICE_RATE_LIMIT_SELECT( tid );
+    if( slot >= TRICE_RATE_LIMIT_SLOTS || tid == TRICE_RATE_SUMMARY_ID ){
+        return 1;
+    }
+    uint32_t now = TRICE_RATE_LIMIT_STAMP();
+    int pass = 0;
+    int report = 0;
+    TRICE_ENTER_CRITICAL_SECTION
+    if( !triceRateSlot[slot].used ){
+        triceRateSlot[slot].used = 1;
+        triceRateSlot[slot].last = now;
+        triceRateSlot[slot].tokens = TRICE_RATE_LIMIT_BURST;
+    }
+    uint32_t refill = (now - triceRateSlot[slot].last) / TRICE_RATE_LIMIT_TICKS;
+    if( refill >= (uint32_t)(TRICE_RATE_LIMIT_BURST - triceRateSlot[slot].tokens) ){
+        triceRateSlot[slot].tokens = TRICE_RATE_LIMIT_BURST;
+        triceRateSlot[slot].last = now;
+    }else{
+        triceRateSlot[slot].tokens += refill;
+        triceRateSlot[slot].last += refill * TRICE_RATE_LIMIT_TICKS;
+    }
+    if( triceRateSlot[slot].tokens ){
+        triceRateSlot[slot].tokens--;
+        pass = 1;
+    }else{
+        triceRateSlot[slot].tid = tid;
+        triceRateSlot[slot].suppressed += triceRateSlot[slot].suppressed < 0xFFFF;
+    }
+    if( now - triceRateReported >= TRICE_RATE_LIMIT_REPORT_TICKS ){
+        triceRateReported = now;
+        report = 1;
+    }
+    TRICE_LEAVE_CRITICAL_SECTION
+    if( report ){
+        triceRateReport();
+    }
+    return pass;
+}
+
+#endif // #if TRICE_RATE_LIMIT == 1
+
 //! TriceDeferredEncode expects at buf trice date with netto length len.
 //! ATTENTION: Up to 7 bytes behind len are used as scratch pad!
 //! \param enc is the destination.
@@ -239,6 +487,9 @@ int TriceNext( uint8_t** buf, size_t* pSize, uint8_t** pStart, size_t* pLen ){
 //! \retval is the encoded len with 0-delimiter byte.
 size_t TriceDeferredEncode( uint8_t* enc, uint8_t* buf, size_t len ){ 
     size_t encLen;
+    #if TRICE_PAYLOAD_CODEC != TRICE_CODEC_NONE
+    len = triceCodec( buf, len );
+    #endif
     #ifdef XTEA_ENCRYPT_KEY
     size_t len8 = (len + 7) & ~7; // only multiple of 8 encryptable
     while( len < len8 ){
@@ -250,7 +501,7 @@ size_t TriceDeferredEncode( uint8_t* enc, uint8_t* buf, size_t len ){
     encLen = (size_t)TCOBSEncode(enc, buf, len);
     enc[encLen++] = 0; // Add zero as package delimiter.
     #elif TRICE_DEFERRED_OUT_FRAMING == TRICE_FRAMING_COBS
-    encLen = (size_t)COBSEncode(enc, buf, len);
+    encLen = (size_t)TRICE_COBS_ENCODE(enc, buf, len);
     enc[encLen++] = 0; // Add zero as package delimiter.
     #elif TRICE_DEFERRED_OUT_FRAMING == TRICE_FRAMING_NONE
     memmove( enc, buf, len );
@@ -278,7 +529,7 @@ static size_t triceDirectEncode( uint8_t* enc, uint8_t const* buf, size_t len ){
     encLen = (size_t)TCOBSEncode(enc, buf, len);
     enc[encLen++] = 0; // Add zero as package delimiter.
     #elif TRICE_DIRECT_OUT_FRAMING == TRICE_FRAMING_COBS
-    encLen = (size_t)COBSEncode(enc, buf, len);
+    encLen = (size_t)TRICE_COBS_ENCODE(enc, buf, len);
     enc[encLen++] = 0; // Add zero as package delimiter.
     #elif TRICE_DIRECT_OUT_FRAMING == TRICE_FRAMING_NONE
     memmove( enc, buf, len );
@@ -294,27 +545,102 @@ static size_t triceDirectEncode( uint8_t* enc, uint8_t const* buf, size_t len ){
 #if (TRICE_DIAGNOSTICS ==1) && defined(SEGGER_RTT)
 
 unsigned RTT0_writeSpaceMin = BUFFER_SIZE_UP; //! RTT0_writeSpaceMin is usable for diagnostics.
+unsigned RTT0_skipCount = 0; //! RTT0_skipCount is the count of trices skipped by TriceWriteRtt0Fast because of a full RTT buffer.
+unsigned RTT0_writeCount = 0; //! RTT0_writeCount is the count of RTT up-buffer 0 writes by the direct output, each updating the write offset once.
+
+#if TRICE_SEGGER_RTT_FAST_WRITE == 0
 
 static void triceSeggerRTTDiagnostics( void ){
     unsigned writeSpace = SEGGER_RTT_GetAvailWriteSpace (0);
     RTT0_writeSpaceMin    = RTT0_writeSpaceMin    > writeSpace    ? writeSpace : RTT0_writeSpaceMin;
 }
 
+#endif // #if TRICE_SEGGER_RTT_FAST_WRITE == 0
+
 #endif // #if (TRICE_DIAGNOSTICS ==1) && defined(SEGGER_RTT)
 
 #if (TRICE_SEGGER_RTT_8BIT_DIRECT_WRITE == 1) || (TRICE_SEGGER_RTT_8BIT_DEFERRED_WRITE == 1) || (TRICE_SEGGER_RTT_ROUTED_8BIT_DIRECT_WRITE == 1)
 
 static void TriceWriteDeviceRtt0( uint8_t const * enc, size_t encLen ){
+    #if TRICE_SEGGER_RTT_FAST_WRITE == 1
+    TriceWriteRtt0Fast( enc, encLen );
+    #else
     SEGGER_RTT_WriteNoLock(0, enc, encLen );
 
     #if TRICE_DIAGNOSTICS == 1
     triceSeggerRTTDiagnostics();
     #endif
+    #endif
 }
 
 #endif // (TRICE_SEGGER_RTT_8BIT_DIRECT_WRITE == 1) || (TRICE_SEGGER_RTT_8BIT_DEFERRED_WRITE == 1) || (TRICE_SEGGER_RTT_ROUTED_8BIT_DIRECT_WRITE == 1)
 
-#if TRICE_SEGGER_RTT_32BIT_DIRECT_WRITE == 1
+#if TRICE_SEGGER_RTT_FAST_WRITE == 1
+
+//! triceRttWriteSpace returns the free space in pRing behind WrOff. One byte stays always unused like in SEGGER_RTT.c.
+static inline unsigned triceRttWriteSpace( SEGGER_RTT_BUFFER_UP const * pRing, unsigned size, unsigned WrOff ){
+    unsigned RdOff = pRing->RdOff;
+    return RdOff > WrOff ? RdOff - WrOff - 1u : size - 1u - WrOff + RdOff;
+}
+
+//! TriceWriteRtt0Fast copies NumBytes from pData into the SEGGER RTT up-buffer 0.
+//! The wrap position is computed once, so the data go out with at most 2 memcpy calls and one RTT__DMB before the WrOff update.
+//! If the free space is too small, the data are skipped completely like in SEGGER_RTT_MODE_NO_BLOCK_SKIP mode,
+//! so the host never sees partial trices. It is assumed, that the caller is inside the trice critical section.
+//! With TRICE_SEGGER_RTT_SINGLE_PRODUCER == 1 the uncached RTT control block is read only, when the shadowed free space is exhausted.
+void TriceWriteRtt0Fast( void const * pData, unsigned NumBytes ){
+    // Get "to-host" ring buffer.
+    static SEGGER_RTT_BUFFER_UP * const pRingUp0 = (SEGGER_RTT_BUFFER_UP*)((char*)&_SEGGER_RTT.aUp[0] + SEGGER_RTT_UNCACHED_OFF);  // Access uncached to make sure we see changes made by the J-Link side and all of our changes go into HW directly
+    uint8_t const * pSrc = (uint8_t const *)pData;
+    char * pDst = pRingUp0->pBuffer + SEGGER_RTT_UNCACHED_OFF;
+    unsigned size = pRingUp0->SizeOfBuffer;
+    unsigned WrOff;
+    unsigned space;
+    unsigned rem;
+    #if TRICE_SEGGER_RTT_SINGLE_PRODUCER == 1
+    WrOff = triceRtt0WrOff;
+    space = triceRtt0Space;
+    if( space < NumBytes ){ // only now the host read offset is needed
+        space = triceRttWriteSpace( pRingUp0, size, WrOff );
+    }
+    #else
+    WrOff = pRingUp0->WrOff;
+    space = triceRttWriteSpace( pRingUp0, size, WrOff );
+    #endif
+    if( space < NumBytes ){
+        #if TRICE_SEGGER_RTT_SINGLE_PRODUCER == 1
+        triceRtt0Space = space;
+        #endif
+        #if TRICE_DIAGNOSTICS == 1
+        RTT0_skipCount++;
+        RTT0_writeSpaceMin = 0;
+        #endif
+        return;
+    }
+    rem = size - WrOff;
+    if( rem > NumBytes ){ // All data fit before wrap around.
+        memcpy( pDst + WrOff, pSrc, NumBytes );
+        WrOff += NumBytes;
+    }else{ // We reach the end of the buffer, so need to wrap around.
+        memcpy( pDst + WrOff, pSrc, rem );
+        WrOff = NumBytes - rem;
+        memcpy( pDst, pSrc + rem, WrOff );
+    }
+    RTT__DMB(); // Force data write to be complete before writing the <WrOff>, in case CPU is allowed to change the order of memory accesses
+    pRingUp0->WrOff = WrOff;
+    space -= NumBytes;
+    #if TRICE_SEGGER_RTT_SINGLE_PRODUCER == 1
+    triceRtt0WrOff = WrOff;
+    triceRtt0Space = space;
+    #endif
+    #if TRICE_DIAGNOSTICS == 1
+    RTT0_writeSpaceMin = RTT0_writeSpaceMin > space ? space : RTT0_writeSpaceMin;
+    #endif
+}
+
+#endif // #if TRICE_SEGGER_RTT_FAST_WRITE == 1
+
+#if (TRICE_SEGGER_RTT_32BIT_DIRECT_WRITE == 1) && (TRICE_SEGGER_RTT_FAST_WRITE == 0)
 //! SEGGER_Write_RTT0_NoCheck32 was derived from SEGGER_RTT.c version 7.60g function _WriteNoCheck for speed reasons. If using a different version please review the code first.
 static void SEGGER_Write_RTT0_NoCheck32( const uint32_t* pData, unsigned NumW ) {
     unsigned NumWordsAtOnce;
@@ -349,7 +675,7 @@ static void SEGGER_Write_RTT0_NoCheck32( const uint32_t* pData, unsigned NumW )
     triceSeggerRTTDiagnostics();
     #endif
 }
-#endif // #if TRICE_SEGGER_RTT_32BIT_DIRECT_WRITE == 1
+#endif // #if (TRICE_SEGGER_RTT_32BIT_DIRECT_WRITE == 1) && (TRICE_SEGGER_RTT_FAST_WRITE == 0)
 
 #if TRICE_32BIT_DIRECT_XTEA_AND_COBS
 //! TriceEncryptAndCobsFraming32 does an in-buffer encryption and COBS encoding of a single trice message.
@@ -363,7 +689,7 @@ unsigned TriceEncryptAndCobsFraming32( uint32_t * const triceStart, unsigned wor
     unsigned wcEven = ((wordCount + 1) & ~1); // only multiple of 8 can be encrypted 
     XTEAEncrypt( triceStart, wcEven ); // in-buffer encryption
     uint8_t* enc = ((uint8_t*)triceStart) - TRICE_DATA_OFFSET;
-    unsigned encLen = COBSEncode(enc, triceStart, wcEven<<2);
+    unsigned encLen = TRICE_COBS_ENCODE(enc, triceStart, wcEven<<2);
     do{
         enc[encLen++] = 0; // add 0-delimiter and optional padding zeroes
     }while( (encLen & 3) != 0 ); 
@@ -371,6 +697,70 @@ unsigned TriceEncryptAndCobsFraming32( uint32_t * const triceStart, unsigned wor
 }
 #endif // #if TRICE_SEGGER_RTT_32BIT_DIRECT_XTEA_AND_COBS
 
+#if (TRICE_DIRECT_OUTPUT == 1) && ((TRICE_SEGGER_RTT_32BIT_DIRECT_WRITE == 1) || (TRICE_SEGGER_RTT_8BIT_DIRECT_WRITE == 1))
+
+//! triceRtt0DirectWrite writes wordCount values from pData as a single write into the RTT up-buffer 0.
+static void triceRtt0DirectWrite( uint32_t const * pData, unsigned wordCount ){
+    #if TRICE_SEGGER_RTT_32BIT_DIRECT_WRITE == 1
+        #if TRICE_SEGGER_RTT_FAST_WRITE == 1
+        TriceWriteRtt0Fast( pData, wordCount<<2 );
+        #else
+        SEGGER_Write_RTT0_NoCheck32( pData, wordCount );
+        #endif
+    #else
+        TriceWriteDeviceRtt0( (uint8_t const *)pData, wordCount<<2 );
+    #endif
+    #if TRICE_DIAGNOSTICS == 1
+    RTT0_writeCount++;
+    #endif
+}
+
+#endif // #if (TRICE_DIRECT_OUTPUT == 1) && ((TRICE_SEGGER_RTT_32BIT_DIRECT_WRITE == 1) || (TRICE_SEGGER_RTT_8BIT_DIRECT_WRITE == 1))
+
+#if TRICE_DIRECT_COALESCE_SIZE > 0
+
+static uint32_t triceCoalesceBuffer[TRICE_DIRECT_COALESCE_SIZE>>2]; //!< triceCoalesceBuffer is the staging area for the direct RTT writes.
+static unsigned triceCoalesceDepth = 0; //!< triceCoalesceDepth is the staged word count.
+static unsigned triceCoalesceCount = 0; //!< triceCoalesceCount is the staged trice count.
+
+//! triceCoalesceFlush writes the staged trices as a single RTT write. It is assumed, that the caller is inside the trice critical section.
+static void triceCoalesceFlush( void ){
+    if( triceCoalesceDepth ){
+        triceRtt0DirectWrite( triceCoalesceBuffer, triceCoalesceDepth );
+        triceCoalesceDepth = 0;
+        triceCoalesceCount = 0;
+    }
+}
+
+//! triceCoalesce stages a single trice for the RTT up-buffer 0. It is called inside the trice critical section.
+//! A trice bigger than the staging area is written directly after the staged ones to keep the order.
+static void triceCoalesce( uint32_t const * pData, unsigned wordCount ){
+    if( triceCoalesceDepth + wordCount > (TRICE_DIRECT_COALESCE_SIZE>>2) ){
+        triceCoalesceFlush();
+        if( wordCount > (TRICE_DIRECT_COALESCE_SIZE>>2) ){
+            triceRtt0DirectWrite( pData, wordCount );
+            return;
+        }
+    }
+    memcpy( triceCoalesceBuffer + triceCoalesceDepth, pData, wordCount<<2 );
+    triceCoalesceDepth += wordCount;
+    triceCoalesceCount++;
+    if( triceCoalesceCount >= TRICE_DIRECT_COALESCE_COUNT ){
+        triceCoalesceFlush();
+    }
+}
+
+#endif // #if TRICE_DIRECT_COALESCE_SIZE > 0
+
+//! TriceFlush writes the trices staged for the direct RTT output with TRICE_DIRECT_COALESCE_SIZE > 0. Otherwise it does nothing.
+void TriceFlush( void ){
+    #if TRICE_DIRECT_COALESCE_SIZE > 0
+    TRICE_ENTER_CRITICAL_SECTION
+    triceCoalesceFlush();
+    TRICE_LEAVE_CRITICAL_SECTION
+    #endif
+}
+
 #if TRICE_DIRECT_OUTPUT == 1
 
 //! TriceNonBlockingDirectWrite copies a single trice from triceStart to output.
@@ -391,7 +781,11 @@ void TriceNonBlockingDirectWrite( uint32_t* triceStart, unsigned wordCount ){
             wordCount = TriceEncryptAndCobsFraming32( triceStart, wordCount );
             triceStart -= TRICE_DATA_OFFSET>>2;
         #endif // #if TRICE_SEGGER_RTT_32BIT_DIRECT_XTEA_AND_COBS
-        SEGGER_Write_RTT0_NoCheck32( triceStart, wordCount );
+        #if TRICE_DIRECT_COALESCE_SIZE > 0
+        triceCoalesce( triceStart, wordCount );
+        #else
+        triceRtt0DirectWrite( triceStart, wordCount );
+        #endif
     #endif
 
     #if TRICE_SEGGER_RTT_8BIT_DIRECT_WRITE == 1// normal SEGGER RTT without framing
@@ -400,7 +794,11 @@ void TriceNonBlockingDirectWrite( uint32_t* triceStart, unsigned wordCount ){
             triceStart -= TRICE_DATA_OFFSET>>2;
         #endif // #if TRICE_SEGGER_RTT_32BIT_DIRECT_XTEA_AND_COBS
         // wordCount<<2  is the trice len without TRICE_OFFSET but with padding bytes.
-        TriceWriteDeviceRtt0( (uint8_t*)triceStart, wordCount<<2 );
+        #if TRICE_DIRECT_COALESCE_SIZE > 0
+        triceCoalesce( triceStart, wordCount );
+        #else
+        triceRtt0DirectWrite( triceStart, wordCount );
+        #endif
     #endif
     
     #if (TRICE_DIRECT_OUT_FRAMING == TRICE_FRAMING_NONE) 
@@ -87,6 +87,19 @@ extern "C" {
 //! This is deferred logging using less space but the TRICE macros are executed a bit slower. 
 #define TRICE_RING_BUFFER 2237719049U
 
+//! With TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_UNCHECKED a single ring buffer wraps without any check, overwriting unread trices on overflow.
+//! This is the fastest option, because the TRICE macros write directly into the ring buffer.
+#define TRICE_OVERFLOW_UNCHECKED 1406215263U
+
+//! With TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_DROP_NEW a trice not fitting into its ring is dropped.
+#define TRICE_OVERFLOW_DROP_NEW 2906532749U
+
+//! With TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_DROP_OLDEST the oldest trices of a ring are dropped until the new trice fits.
+#define TRICE_OVERFLOW_DROP_OLDEST 3355078291U
+
+//! With TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_BLOCK the TRICE macros call TRICE_OVERFLOW_WAIT until all rings have space for a trice of max size.
+#define TRICE_OVERFLOW_BLOCK 1189450637U
+
 //! TRICE_FRAMING_TCOBS is recommended for trice transfer over UART.
 #define TRICE_FRAMING_TCOBS 3745917584U
 
@@ -96,6 +109,15 @@ extern "C" {
 //! TRICE_FRAMING_NONE is recommended for RTT in direct mode. One trice costs about 100 clocks and is completely done.
 #define TRICE_FRAMING_NONE  1431860787U
 
+//! With TRICE_PAYLOAD_CODEC == TRICE_CODEC_NONE the trice payload is transmitted as written.
+#define TRICE_CODEC_NONE 1093791858U
+
+//! With TRICE_PAYLOAD_CODEC == TRICE_CODEC_VARINT each 32-bit payload word is transmitted zigzag and varint encoded.
+#define TRICE_CODEC_VARINT 3813817318U
+
+//! With TRICE_PAYLOAD_CODEC == TRICE_CODEC_DELTA the leading payload words are delta encoded against the last trice with the same ID before the zigzag varint encoding.
+#define TRICE_CODEC_DELTA 3313364688U
+
 //! Variadic macros (https://github.com/pfultz2/Cloak/wiki/C-Preprocessor-tricks,-tips,-and-idioms)
 //! See for more explanation https://renenyffenegger.ch/notes/development/languages/C-C-plus-plus/preprocessor/macros/__VA_ARGS__/count-arguments
 //! This is extendable until a 32767 bytes payload.
@@ -146,6 +168,46 @@ extern "C" {
 
 #endif
 
+#ifndef TRICE_SEGGER_RTT_FAST_WRITE
+
+//! TRICE_SEGGER_RTT_FAST_WRITE == 1 replaces SEGGER_Write_RTT0_NoCheck32 and SEGGER_RTT_WriteNoLock with TriceWriteRtt0Fast.
+//! - The wrap position is computed once and the data are copied with at most 2 memcpy calls followed by a single RTT__DMB.
+//! - A trice not fitting into the free RTT up-buffer 0 space is skipped completely instead of overwriting unread data.
+#define TRICE_SEGGER_RTT_FAST_WRITE 0
+
+#endif
+
+#ifndef TRICE_SEGGER_RTT_SINGLE_PRODUCER
+
+//! TRICE_SEGGER_RTT_SINGLE_PRODUCER == 1 is usable together with TRICE_SEGGER_RTT_FAST_WRITE == 1, when RTT channel 0 is written only
+//! by the trice code and never concurrently, for example when interrupts do not emit trices. TRICE_ENTER_CRITICAL_SECTION can be left empty then.
+//! - The write offset and the known free space are kept in shadow variables, so the uncached RTT control block is read only
+//!   when the known free space is exhausted.
+//! - Do not write to RTT channel 0 with other functions after TriceInit.
+#define TRICE_SEGGER_RTT_SINGLE_PRODUCER 0
+
+#endif
+
+#ifndef TRICE_DIRECT_COALESCE_SIZE
+
+//! TRICE_DIRECT_COALESCE_SIZE > 0 collects the direct SEGGER RTT writes of back-to-back trices in a staging area of this byte size.
+//! The staged trices go out as a single RTT write, so the RTT write offset update and the memory barrier happen only once for them.
+//! - The staging area is written, when the next trice does not fit, when TRICE_DIRECT_COALESCE_COUNT trices are staged,
+//!   inside TriceTransfer or with an explicit TriceFlush() call. Call TriceFlush() before the target sleeps or halts.
+//! - Trices bigger than the staging area are written directly after the staged ones.
+//! - 0 writes each trice immediately. The value must be a multiple of 4.
+//! - Needs TRICE_BUFFER == TRICE_DOUBLE_BUFFER or TRICE_BUFFER == TRICE_RING_BUFFER, because only their TriceTransfer flushes the staging area.
+#define TRICE_DIRECT_COALESCE_SIZE 0
+
+#endif
+
+#ifndef TRICE_DIRECT_COALESCE_COUNT
+
+//! TRICE_DIRECT_COALESCE_COUNT is the max count of staged trices, when TRICE_DIRECT_COALESCE_SIZE > 0.
+#define TRICE_DIRECT_COALESCE_COUNT 8
+
+#endif
+
 #if (USE_SEGGER_RTT_LOCK_UNLOCK_MACROS == 1) \
  || (TRICE_SEGGER_RTT_ROUTED_8BIT_DIRECT_WRITE ==1) \
  || (TRICE_SEGGER_RTT_8BIT_DIRECT_WRITE == 1) \
@@ -177,11 +239,15 @@ void TriceLogDiagnosticValues( void );
 void TriceLogSeggerDiagnostics( void );
 void TriceNonBlockingDeferredWrite( int ticeID, uint8_t const * enc, size_t encLen );
 void TriceTransfer( void );
+void TriceFlush( void );
 void TriceWriteDeviceCgo( uint8_t const * buf, unsigned len ); // only needed for testing C-sources from Go
+void TriceWriteRtt0Fast( void const * pData, unsigned NumBytes );
 
 int TCOBSEncode( void * __restrict output, const void * __restrict input, size_t length);
 int TriceIDAndBuffer( uint32_t const * const pAddr, int* pWordCount, uint8_t** ppStart, size_t* pLength );
 int TriceNext( uint8_t** buf, size_t* pSize, uint8_t** pStart, size_t* pLen );
+void TriceRingBufferPush( uint32_t const* pData, unsigned wordCount );
+int TriceRingBufferReserve( void );
 
 unsigned TriceOutDepth( void );
 unsigned TriceOutDepthCGO( void ); // only needed for testing C-sources from Go
@@ -191,6 +257,8 @@ uint32_t Us32( void );
 size_t TriceDepth( void );
 size_t TriceDepthMax( void );
 size_t TriceDeferredEncode( uint8_t* enc, uint8_t* buf, size_t len );
+void TriceCodecReset( void );
+int TriceRateLimit( unsigned tid );
 
 // global variables:
 
@@ -205,11 +273,17 @@ extern const int TriceTypeS2;
 extern const int TriceTypeS4;
 extern const int TriceTypeX0;
 extern unsigned RTT0_writeSpaceMin; //! RTT0_writeSpaceMin is usable for diagnostics.
+extern unsigned RTT0_skipCount; //! RTT0_skipCount is usable for diagnostics.
+extern unsigned RTT0_writeCount; //! RTT0_writeCount is usable for diagnostics.
 extern unsigned TriceErrorCount;
 extern uint32_t* const triceRingBufferLimit;
 extern uint32_t TriceRingBuffer[];
-extern unsigned TriceSingleMaxWordCount;
 extern unsigned TriceRingBufferDepthMax;
+extern unsigned TriceRingBufferOverflowCount[];
+extern unsigned TriceRingBufferLost[];
+extern unsigned TriceCodecBytesIn;
+extern unsigned TriceCodecBytesOut;
+extern unsigned TriceCodecCycles;
 
 #if (TRICE_BUFFER == TRICE_RING_BUFFER) || (TRICE_BUFFER == TRICE_DOUBLE_BUFFER)
 extern uint32_t* TriceBufferWritePosition;
@@ -239,6 +313,211 @@ extern uint32_t* TriceBufferWritePosition;
 
 #endif
 
+#ifndef TRICE_COBS_WORDWISE
+
+//! TRICE_COBS_WORDWISE == 1 selects the COBSEncodeWordwise function for TRICE_FRAMING_COBS instead of COBSEncode.
+//! The output is identical, but the zero byte search is done 4 bytes at a time, what is faster for longer trices.
+#define TRICE_COBS_WORDWISE 0
+
+#endif
+
+#ifndef TRICE_DOUBLE_BUFFER_LOCK_FREE
+
+//! TRICE_DOUBLE_BUFFER_LOCK_FREE == 1 replaces the TRICE_DOUBLE_BUFFER critical sections by an atomic buffer index flip and per buffer writer counts.
+//! - A trice is assembled on the stack and its space in the active half buffer is reserved with a compare-and-swap loop. Interrupts stay enabled.
+//! - TriceTransfer flips the active buffer index and encodes the old half buffer not before all writers in flight are done with it.
+//! - A trice not fitting into the active half buffer is dropped and counted in TriceDoubleBufferOverflowCount.
+//! - Needs C11 <stdatomic.h> and TRICE_DIRECT_OUTPUT == 0.
+#define TRICE_DOUBLE_BUFFER_LOCK_FREE 0
+
+#endif
+
+#if (TRICE_BUFFER == TRICE_DOUBLE_BUFFER) && (TRICE_DOUBLE_BUFFER_LOCK_FREE == 1)
+#include <stdatomic.h>
+extern atomic_uint TriceDoubleBufferOverflowCount;
+extern atomic_uint TriceSingleMaxWordCount;
+extern atomic_uint TriceCriticalSectionCyclesMax;
+void TriceDoubleBufferPush( uint32_t const* pData, unsigned wordCount );
+#else
+extern unsigned TriceSingleMaxWordCount;
+extern unsigned TriceCriticalSectionCyclesMax;
+#endif
+
+#ifndef TRICE_CORE_COUNT
+
+//! TRICE_CORE_COUNT > 1 gives each core of an SMP target its own TRICE_DOUBLE_BUFFER with TRICE_DEFERRED_BUFFER_SIZE bytes.
+//! - The user has to provide `unsigned TriceCoreId( void );` returning 0...TRICE_CORE_COUNT-1 for the calling core.
+//! - Needs TRICE_DOUBLE_BUFFER_LOCK_FREE == 1, so the cores do not need a common spinlock,
+//!   and TRICE_CYCLE_COUNTER == 0, because the cores cannot share a cycle counter.
+//! - TriceTransfer serves the cores round robin. Each transferred half buffer starts with a TRICE_CORE_TAG_ID trice carrying the core ID.
+//! - The trice tool prefixes the lines with the core (-coreFormat) and can sort them by their timestamps (-coreSort).
+#define TRICE_CORE_COUNT 1
+
+#endif
+
+#if TRICE_CORE_COUNT > 1
+unsigned TriceCoreId( void );
+#endif
+
+#ifndef TRICE_RING_BUFFER_COUNT
+
+//! TRICE_RING_BUFFER_COUNT is the number of independent rings inside TriceRingBuffer, when TRICE_BUFFER == TRICE_RING_BUFFER.
+//! - Each ring gets TRICE_DEFERRED_BUFFER_SIZE/TRICE_RING_BUFFER_COUNT bytes and ring 0 has the highest priority.
+//! - With more than 1 ring a trice is assembled on the stack and then copied into the ring selected by TRICE_RING_BUFFER_SELECT.
+//!   The TRICE_OVERFLOW_POLICY acts per ring, so a burst of debug trices cannot overwrite error trices in an other ring.
+//! - TriceTransfer serves the rings in strict priority order. Define TRICE_RING_BUFFER_WEIGHTS as array initializer like { 8, 1 }
+//!   to get a weighted order: Ring n transfers then up to TRICE_RING_BUFFER_WEIGHTS[n] trices in a round.
+//! - Except with TRICE_OVERFLOW_UNCHECKED, TriceTransfer assigns the TRICE_CYCLE_COUNTER values in transfer order, so the changed order
+//!   and dropped trices cause no cycle errors. Dropped trices are reported with TRICE_LOST_ID trices.
+#define TRICE_RING_BUFFER_COUNT 1
+
+#endif
+
+#ifndef TRICE_RING_BUFFER_SELECT
+
+//! TRICE_RING_BUFFER_SELECT returns the ring index 0...TRICE_RING_BUFFER_COUNT-1 for the trice ID tid.
+//! The default splits the ID space into TRICE_RING_BUFFER_COUNT equal ranges, so smaller IDs get a higher priority.
+//! Channels are known only inside til.json. To select rings by channel, insert the IDs of each channel in its own ID range
+//! (trice insert -IDMin -IDMax) and map these ranges here.
+#define TRICE_RING_BUFFER_SELECT(tid) ( ((tid) * TRICE_RING_BUFFER_COUNT) >> 14 )
+
+#endif
+
+#ifndef TRICE_OVERFLOW_POLICY
+
+#if TRICE_RING_BUFFER_COUNT == 1
+
+//! TRICE_OVERFLOW_POLICY selects the TRICE_RING_BUFFER behaviour, when a trice does not fit. Options:
+//! - TRICE_OVERFLOW_UNCHECKED: The ring wraps and overwrites unread trices. Only possible with TRICE_RING_BUFFER_COUNT == 1.
+//! - TRICE_OVERFLOW_DROP_NEW: The new trice is dropped.
+//! - TRICE_OVERFLOW_DROP_OLDEST: The oldest trices in the ring are dropped. While the oldest trice is in transfer, the new trice is dropped instead.
+//! - TRICE_OVERFLOW_BLOCK: The TRICE macro reserves space inside the critical section and calls TRICE_OVERFLOW_WAIT outside of it, until that succeeds.
+//! Except with TRICE_OVERFLOW_UNCHECKED, a trice is assembled on the stack and then copied into its ring.
+//! Dropped trices are reported by a trice with the reserved ID TRICE_LOST_ID, which the trice tool displays as "N trices lost".
+#define TRICE_OVERFLOW_POLICY TRICE_OVERFLOW_UNCHECKED
+
+#else // #if TRICE_RING_BUFFER_COUNT == 1
+
+//! TRICE_OVERFLOW_POLICY selects the TRICE_RING_BUFFER behaviour, when a trice does not fit. See above.
+#define TRICE_OVERFLOW_POLICY TRICE_OVERFLOW_DROP_NEW
+
+#endif // #else // #if TRICE_RING_BUFFER_COUNT == 1
+
+#endif
+
+#ifndef TRICE_OVERFLOW_WAIT
+
+//! TRICE_OVERFLOW_WAIT is called with TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_BLOCK as long the rings are full.
+//! In RTOS contexts it should yield, for example with osThreadYield(). The default is busy waiting.
+#define TRICE_OVERFLOW_WAIT()
+
+#endif
+
+//! TRICE_LOST_ID is the reserved ID of the trice reporting the count of dropped trices as 32-bit value. Do not use it for other trices.
+#define TRICE_LOST_ID 0x3FFF
+
+#ifndef TRICE_PAYLOAD_CODEC
+
+//! TRICE_PAYLOAD_CODEC selects a compression of the deferred trice payload before framing. Options:
+//! - TRICE_CODEC_NONE: No compression.
+//! - TRICE_CODEC_VARINT: Each 32-bit payload word is zigzag and varint encoded, so small values need only 1 or 2 bytes. The trice tool needs switch `-payloadCodec varint`.
+//! - TRICE_CODEC_DELTA: Additionally the first 4 payload words are encoded as difference to the same words of the last trice with the same ID.
+//!   A table of 16 IDs is kept on both sides. The trice tool needs switch `-payloadCodec delta` and has to receive all trices from the target start on.
+//! Only trices with a payload of 4 to 60 bytes as multiple of 4 are encoded and only, when they get shorter. The encoded trices use byte counts 64-127.
+//! Therefore, with a codec, trices with a payload of 64 or more bytes use the long count form without cycle counter.
+//! Direct output is not encoded.
+#define TRICE_PAYLOAD_CODEC TRICE_CODEC_NONE
+
+#endif
+
+#if (TRICE_PAYLOAD_CODEC != TRICE_CODEC_NONE) && (TRICE_PAYLOAD_CODEC != TRICE_CODEC_VARINT) && (TRICE_PAYLOAD_CODEC != TRICE_CODEC_DELTA)
+#error wrong configuration
+#endif
+
+#if TRICE_PAYLOAD_CODEC == TRICE_CODEC_NONE
+
+//! TRICE_SHORT_COUNT_LIMIT is the smallest byte count needing the long count form.
+#define TRICE_SHORT_COUNT_LIMIT 128
+
+#else // #if TRICE_PAYLOAD_CODEC == TRICE_CODEC_NONE
+
+//! TRICE_SHORT_COUNT_LIMIT is the smallest byte count needing the long count form. The byte counts 64-127 mark encoded payloads.
+#define TRICE_SHORT_COUNT_LIMIT 64
+
+#endif // #else // #if TRICE_PAYLOAD_CODEC == TRICE_CODEC_NONE
+
+//! TRICE_CORE_TAG_ID is the reserved ID of the trice starting each half buffer with the core ID as 32-bit value, when TRICE_CORE_COUNT > 1. Do not use it for other trices.
+#define TRICE_CORE_TAG_ID 0x3FFE
+
+#ifndef TRICE_RATE_LIMIT
+
+//! TRICE_RATE_LIMIT == 1 enables a token bucket per trice ID slot, checked before a trice enters the buffer.
+//! - Each slot holds up to TRICE_RATE_LIMIT_BURST tokens and gets a new token every TRICE_RATE_LIMIT_TICKS TRICE_RATE_LIMIT_STAMP ticks.
+//! - A trice without a token is suppressed. Each TRICE_RATE_LIMIT_REPORT_TICKS the suppressed counts are reported with
+//!   TRICE_RATE_SUMMARY_ID trices, which the trice tool displays as "ID x: y suppressed".
+//! - Only the function based trices with an iD(n) or id(n) parameter, like trice32( iD(n), ... ), are limited.
+#define TRICE_RATE_LIMIT 0
+
+#endif
+
+#if TRICE_RATE_LIMIT == 1
+
+#ifndef TRICE_RATE_LIMIT_SLOTS
+
+//! TRICE_RATE_LIMIT_SLOTS is the count of token buckets. Each costs 12 bytes RAM.
+#define TRICE_RATE_LIMIT_SLOTS 32
+
+#endif
+
+#ifndef TRICE_RATE_LIMIT_SELECT
+
+//! TRICE_RATE_LIMIT_SELECT returns the token bucket index for the trice ID tid. IDs sharing a bucket share its tokens.
+//! Return TRICE_RATE_LIMIT_SLOTS or more for IDs, which should not be limited.
+//! To give the hot loop trices own buckets, insert their IDs in a separate ID range (trice insert -IDMin -IDMax) and map this range here.
+#define TRICE_RATE_LIMIT_SELECT(tid) ( (tid) % TRICE_RATE_LIMIT_SLOTS )
+
+#endif
+
+#ifndef TRICE_RATE_LIMIT_BURST
+
+//! TRICE_RATE_LIMIT_BURST is the max token count of a bucket, that is the count of trices passing without delay.
+#define TRICE_RATE_LIMIT_BURST 8
+
+#endif
+
+#ifndef TRICE_RATE_LIMIT_TICKS
+
+//! TRICE_RATE_LIMIT_TICKS is the count of TRICE_RATE_LIMIT_STAMP ticks for a new token. The default allows 1000 trices per second and bucket with a microsecond stamp.
+#define TRICE_RATE_LIMIT_TICKS 1000
+
+#endif
+
+#ifndef TRICE_RATE_LIMIT_REPORT_TICKS
+
+//! TRICE_RATE_LIMIT_REPORT_TICKS is the minimum count of TRICE_RATE_LIMIT_STAMP ticks between 2 reports of the suppressed trices.
+#define TRICE_RATE_LIMIT_REPORT_TICKS 1000000
+
+#endif
+
+#ifndef TRICE_RATE_LIMIT_STAMP
+
+//! TRICE_RATE_LIMIT_STAMP returns the 32-bit time base of the token buckets.
+#define TRICE_RATE_LIMIT_STAMP() TriceStamp32()
+
+#endif
+
+//! TRICE_RATE_LIMIT_CHECK returns from the trice function, when the trice ID tid has no token.
+#define TRICE_RATE_LIMIT_CHECK( tid ) if( !TriceRateLimit( tid ) ){ return; }
+
+#else // #if TRICE_RATE_LIMIT == 1
+
+#define TRICE_RATE_LIMIT_CHECK( tid )
+
+#endif // #else // #if TRICE_RATE_LIMIT == 1
+
+//! TRICE_RATE_SUMMARY_ID is the reserved ID of the trice reporting a trice ID and its suppressed count as 32-bit values, when TRICE_RATE_LIMIT == 1. Do not use it for other trices.
+#define TRICE_RATE_SUMMARY_ID 0x3FFD
+
 #ifndef TRICE_SEGGER_RTT_32BIT_DIRECT_XTEA_AND_COBS
 
 //! TRICE_SEGGER_RTT_32BIT_DIRECT_XTEA_AND_COBS == 1 is a special case for RTT32 encryption and framing. (experimental)
@@ -262,6 +541,15 @@ extern uint32_t* TriceBufferWritePosition;
 
 #endif
 
+#ifndef TRICE_MAX_PARAM_COUNT
+
+//! TRICE_MAX_PARAM_COUNT is the biggest value count used in a single trice macro.
+//! Values bigger than 12 need the files triceMaxParams.h and triceMaxParams.c, generated with "trice generate -max n".
+//! Adapt TRICE_SINGLE_MAX_SIZE accordingly: 32 64-bit values with a 32-bit stamp need 2 + 4 + 2 + 32*8 = 264 bytes.
+#define TRICE_MAX_PARAM_COUNT 12
+
+#endif
+
 #ifndef TRICE_B
 
 //! TRICE_B is a shortcut for TRICE8_B, TRICE16_B, TRICE32_B or TRICE64_B usable in your project.
@@ -276,6 +564,15 @@ extern uint32_t* TriceBufferWritePosition;
 
 #endif
 
+#ifndef TRICE_STAMP64
+
+//! TRICE_STAMP64 == 1 lets the ID(n) macro write a 64-bit TriceStamp64() value instead of the 32-bit TriceStamp32() value.
+//! These trices use the extended type bits 00 and the trice tool decodes them as 64-bit stamped trices. The user has to provide TriceStamp64.
+//! Use this for stamps, which should not wrap, like a free running microseconds or clock cycles counter.
+#define TRICE_STAMP64 0
+
+#endif
+
 #ifndef TRICE_CYCLE_COUNTER
 
 //! TRICE_CYCLE_COUNTER adds a cycle counter to each trice message.
@@ -356,10 +653,28 @@ extern uint32_t* TriceBufferWritePosition;
 #error configuration error
 #endif
 
-#if (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_DEFERRED_BUFFER_SIZE < TRICE_BUFFER_SIZE)
+#if (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_DEFERRED_BUFFER_SIZE/TRICE_RING_BUFFER_COUNT < TRICE_BUFFER_SIZE)
 #error configuration error
 #endif
 
+#if (TRICE_BUFFER == TRICE_RING_BUFFER) && ((TRICE_DEFERRED_BUFFER_SIZE/TRICE_RING_BUFFER_COUNT) & 3)
+#error All ring sizes must be a multiple of 4!
+#endif
+
+#if (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_RING_BUFFER_COUNT > 1) && (TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_UNCHECKED)
+#error wrong configuration
+#endif
+
+//! Except with TRICE_OVERFLOW_UNCHECKED the last TRICE_DATA_OFFSET word in front of each trice in a ring keeps the trice word count.
+//! With encryption the first word in front of each trice can be used as scratch pad by the preceding trice.
+#if (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_OVERFLOW_POLICY != TRICE_OVERFLOW_UNCHECKED) && (TRICE_DATA_OFFSET < 4)
+#error wrong configuration
+#endif
+
+#if (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_OVERFLOW_POLICY != TRICE_OVERFLOW_UNCHECKED) && defined(XTEA_ENCRYPT_KEY) && (TRICE_DATA_OFFSET < 8)
+#error wrong configuration
+#endif
+
 #if (TRICE_SEGGER_RTT_32BIT_DIRECT_WRITE == 1) && (TRICE_BUFFER_SIZE > BUFFER_SIZE_UP)
 #error wrong configuration
 #endif
@@ -380,6 +695,26 @@ extern uint32_t* TriceBufferWritePosition;
 #error wrong configuration
 #endif
 
+#if (TRICE_SEGGER_RTT_FAST_WRITE == 1) && !defined(SEGGER_RTT)
+#error wrong configuration
+#endif
+
+#if (TRICE_SEGGER_RTT_SINGLE_PRODUCER == 1) && (TRICE_SEGGER_RTT_FAST_WRITE != 1)
+#error wrong configuration
+#endif
+
+#if (TRICE_DIRECT_COALESCE_SIZE > 0) && ((TRICE_DIRECT_OUTPUT != 1) || (TRICE_BUFFER == TRICE_STACK_BUFFER) || (TRICE_BUFFER == TRICE_STATIC_BUFFER) || ((TRICE_SEGGER_RTT_32BIT_DIRECT_WRITE == 1) == (TRICE_SEGGER_RTT_8BIT_DIRECT_WRITE == 1)) || (TRICE_DIRECT_COALESCE_SIZE & 3))
+#error wrong configuration
+#endif
+
+#if (TRICE_BUFFER == TRICE_DOUBLE_BUFFER) && (TRICE_DOUBLE_BUFFER_LOCK_FREE == 1) && (TRICE_DIRECT_OUTPUT == 1)
+#error wrong configuration
+#endif
+
+#if (TRICE_CORE_COUNT > 1) && ((TRICE_BUFFER != TRICE_DOUBLE_BUFFER) || (TRICE_DOUBLE_BUFFER_LOCK_FREE != 1) || (TRICE_CYCLE_COUNTER == 1))
+#error wrong configuration
+#endif
+
 #if defined( TRICE_UARTA ) && ( TRICE_BUFFER != TRICE_RING_BUFFER) && ( TRICE_BUFFER != TRICE_DOUBLE_BUFFER)
 #error wrong configuration
 #endif
@@ -429,33 +764,31 @@ extern uint32_t* TriceBufferWritePosition;
 #include "trice32.h"
 #include "trice64.h"
 
+#if TRICE_MAX_PARAM_COUNT > 12
+
+#include "triceMaxParams.h"
+
+#if TRICE_MAX_PARAM_COUNT > TRICE_GENERATED_MAX_PARAM_COUNT
+#error wrong configuration: regenerate triceMaxParams.h and triceMaxParams.c with "trice generate -max n"
+#endif
+
+#endif // #if TRICE_MAX_PARAM_COUNT > 12
+
 
 //! TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN can be defined on little endian MCUs if the trice data are needed in network order,
 //! or on big endian MCUs if the trice data are needed in little endian order. You should avoid using this macro because
-//! it increases the trice storage time and the needed code amount. 
-//! This is not completely implemented and needs automatic tests as well.
-//! The main to implement:
-//! - implement compiler agnostic access macros (byte swapping)
-//! - The TriceIDAndBuffer function and it relatives need to use access macros. 
+//! it increases the trice storage time and the needed code amount.
+//! With big endian transfer order all 16-, 32- and 64-bit fields, stamps and values are transmitted in network order
+//! and the trice tool needs the "-triceEndianness bigEndian" switch. 8-bit values and strings are not affected.
 //#define TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN
 
+#if defined( TRICE_MCU_IS_BIG_ENDIAN ) != defined( TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN )
+#define TRICE_TRANSFER_ORDER_IS_BIG_ENDIAN 1 //!< TRICE_TRANSFER_ORDER_IS_BIG_ENDIAN is derived from TRICE_MCU_IS_BIG_ENDIAN and TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN.
+#else
+#define TRICE_TRANSFER_ORDER_IS_BIG_ENDIAN 0 //!< TRICE_TRANSFER_ORDER_IS_BIG_ENDIAN is derived from TRICE_MCU_IS_BIG_ENDIAN and TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN.
+#endif
+
 #ifdef TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN
-// https://codereview.stackexchange.com/questions/151049/endianness-conversion-in-c
-//#include <byteswap.h>
-
-/*
-// Swap a 16-bit integer (https://www.oryx-embedded.com/doc/cpu__endian_8h_source.html)
-#define TRICE_SWAPINT16(x) ( \
-    (((uint16_t)(x) & 0x00FFU) << 8) | \
-    (((uint16_t)(x) & 0xFF00U) >> 8))
-  
-//Swap a 32-bit integer (https://www.oryx-embedded.com/doc/cpu__endian_8h_source.html)
-#define TRICE_SWAPINT32(x) ( \
-    (((uint32_t)(x) & 0x000000FFUL) << 24) | \
-    (((uint32_t)(x) & 0x0000FF00UL) << 8) | \
-    (((uint32_t)(x) & 0x00FF0000UL) >> 8) | \
-    (((uint32_t)(x) & 0xFF000000UL) >> 24))
-*/
 
 static inline uint16_t Reverse16(uint16_t value)
 {
@@ -471,18 +804,48 @@ TRICE_INLINE uint32_t Reverse32(uint32_t value)
             ((value & 0xFF000000) >> 24));
 }
 
+#if defined( __GNUC__ ) || defined( __clang__ )
+
+    //! TRICE_BSWAP16 reverses the byte order of a 16-bit value. The compiler emits a single REV16 or equivalent instruction.
+    #define TRICE_BSWAP16(x) __builtin_bswap16((uint16_t)(x))
+
+    //! TRICE_BSWAP32 reverses the byte order of a 32-bit value. The compiler emits a single REV or equivalent instruction.
+    #define TRICE_BSWAP32(x) __builtin_bswap32((uint32_t)(x))
+
+#else // #if defined( __GNUC__ ) || defined( __clang__ )
+
+    //! TRICE_BSWAP16 reverses the byte order of a 16-bit value.
+    #define TRICE_BSWAP16(x) Reverse16(x)
+
+    //! TRICE_BSWAP32 reverses the byte order of a 32-bit value.
+    #define TRICE_BSWAP32(x) Reverse32(x)
+
+#endif // #else // #if defined( __GNUC__ ) || defined( __clang__ )
+
     //! TRICE_HTOTS reorders short values from host order into trice transfer order. 
-    #define TRICE_HTOTS(x) Reverse16(x) // __bswap_16((x))) // TRICE_SWAPINT16(x)
+    #define TRICE_HTOTS(x) TRICE_BSWAP16(x)
 
     //! TRICE_HTOTL reorders long values from host order x into trice transfer order. 
-    #define TRICE_HTOTL(x) Reverse32(x) // __bswap_32((x))) // TRICE_SWAPINT32(x)
+    #define TRICE_HTOTL(x) TRICE_BSWAP32(x)
 
     //! TRICE_TTOHS reorders short values from trice transfer order into host order. 
-    #define TRICE_TTOHS(x) Reverse16(x) // __bswap_16((x))) // TRICE_SWAPINT16(x)
+    #define TRICE_TTOHS(x) TRICE_BSWAP16(x)
+
+//! TriceSwapCopy copies len bytes from src to dst and reverses the byte order of each size bytes wide value.
+//! It is used for the TRICE16_B, TRICE32_B and TRICE64_B buffers, which are in MCU order in memory.
+static inline void TriceSwapCopy( void* dst, void const* src, unsigned len, unsigned size ){
+    uint8_t* d = (uint8_t*)dst;
+    uint8_t const* s = (uint8_t const*)src;
+    for( unsigned i = 0; i < len; i += size ){
+        for( unsigned k = 0; k < size; k++ ){
+            d[i+k] = s[i+size-1-k];
+        }
+    }
+}
 
 #else // #ifdef TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN
 
-    //! TRICE_HTOTS reorders short values from hos // t order into trice transfer order.
+    //! TRICE_HTOTS reorders short values from host order into trice transfer order.
     #define TRICE_HTOTS(x) (x)
 
     //! TRICE_HTOTL reorders long values from host order x into trice transfer order. 
@@ -493,22 +856,93 @@ TRICE_INLINE uint32_t Reverse32(uint32_t value)
 
 #endif // #else // #ifdef TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN
 
+#if TRICE_TRANSFER_ORDER_IS_BIG_ENDIAN == 1
+
+//! TRICE_HALF0 is the 16-bit half of the 32-bit value v, which is transmitted first.
+#define TRICE_HALF0(v) ((uint16_t)((uint32_t)(v)>>16))
+
+//! TRICE_HALF1 is the 16-bit half of the 32-bit value v, which is transmitted second.
+#define TRICE_HALF1(v) ((uint16_t)(v))
+
+//! TRICE_WORD0 is the 32-bit half of the 64-bit value v, which is transmitted first.
+#define TRICE_WORD0(v) ((uint32_t)((uint64_t)(v)>>32))
+
+//! TRICE_WORD1 is the 32-bit half of the 64-bit value v, which is transmitted second.
+#define TRICE_WORD1(v) ((uint32_t)(v))
+
+#else // #if TRICE_TRANSFER_ORDER_IS_BIG_ENDIAN == 1
+
+//! TRICE_HALF0 is the 16-bit half of the 32-bit value v, which is transmitted first.
+#define TRICE_HALF0(v) ((uint16_t)(v))
+
+//! TRICE_HALF1 is the 16-bit half of the 32-bit value v, which is transmitted second.
+#define TRICE_HALF1(v) ((uint16_t)((uint32_t)(v)>>16))
+
+//! TRICE_WORD0 is the 32-bit half of the 64-bit value v, which is transmitted first.
+#define TRICE_WORD0(v) ((uint32_t)(v))
+
+//! TRICE_WORD1 is the 32-bit half of the 64-bit value v, which is transmitted second.
+#define TRICE_WORD1(v) ((uint32_t)((uint64_t)(v)>>32))
+
+#endif // #else // #if TRICE_TRANSFER_ORDER_IS_BIG_ENDIAN == 1
+
 #if TRICE_DIAGNOSTICS == 1
 
+#if (TRICE_BUFFER == TRICE_DOUBLE_BUFFER) && (TRICE_DOUBLE_BUFFER_LOCK_FREE == 1)
+
+//! TRICE_DIAGNOSTICS_MAX sets the diagnostics value m to v, if v is bigger.
+//! Without critical sections several writers update m concurrently, so a compare-and-swap loop is needed.
+#define TRICE_DIAGNOSTICS_MAX( m, v ) do { \
+    unsigned triceMaxOld = atomic_load( &(m) ); \
+    while( triceMaxOld < (v) && !atomic_compare_exchange_weak( &(m), &triceMaxOld, (v) ) ){} \
+    } while(0);
+
+#else // #if (TRICE_BUFFER == TRICE_DOUBLE_BUFFER) && (TRICE_DOUBLE_BUFFER_LOCK_FREE == 1)
+
+//! TRICE_DIAGNOSTICS_MAX sets the diagnostics value m to v, if v is bigger.
+//! The TRICE macros call it inside their critical section, so there is only a single writer.
+#define TRICE_DIAGNOSTICS_MAX( m, v ) do { \
+    (m) = ((v) < (m)) ? (m) : (v); \
+    } while(0);
+
+#endif // #else // #if (TRICE_BUFFER == TRICE_DOUBLE_BUFFER) && (TRICE_DOUBLE_BUFFER_LOCK_FREE == 1)
+
 #define TRICE_DIAGNOSTICS_SINGLE_BUFFER_KEEP_START \
     uint32_t* const triceSingleBufferStartWritePosition = TriceBufferWritePosition;
 
 #define TRICE_DIAGNOSTICS_SINGLE_BUFFER do { \
     unsigned wordCount = TriceBufferWritePosition - triceSingleBufferStartWritePosition; \
-    TriceSingleMaxWordCount = (wordCount < TriceSingleMaxWordCount) ? TriceSingleMaxWordCount : wordCount; \
+    TRICE_DIAGNOSTICS_MAX( TriceSingleMaxWordCount, wordCount ) \
     } while(0);
 
 #define TRICE_DIAGNOSTICS_SINGLE_BUFFER_USING_WORDCOUNT do { \
-    TriceSingleMaxWordCount = (wordCount < TriceSingleMaxWordCount) ? TriceSingleMaxWordCount : wordCount; \
+    TRICE_DIAGNOSTICS_MAX( TriceSingleMaxWordCount, wordCount ) \
+    } while(0);
+
+#if defined(TRICE_CPU_CYCLES) && (TRICE_BUFFER == TRICE_DOUBLE_BUFFER)
+
+//! TRICE_DIAGNOSTICS_CS_START starts a TRICE_CPU_CYCLES measurement of a critical section.
+//! Define TRICE_CPU_CYCLES() as a free running 32-bit CPU cycle counter like DWT->CYCCNT to get TriceCriticalSectionCyclesMax.
+//! With TRICE_DOUBLE_BUFFER_LOCK_FREE == 1 the space reservation is measured instead.
+#define TRICE_DIAGNOSTICS_CS_START uint32_t triceCsStart = TRICE_CPU_CYCLES();
+
+//! TRICE_DIAGNOSTICS_CS_STOP ends a TRICE_CPU_CYCLES measurement and updates TriceCriticalSectionCyclesMax.
+#define TRICE_DIAGNOSTICS_CS_STOP do { \
+    uint32_t triceCsCycles = TRICE_CPU_CYCLES() - triceCsStart; \
+    TRICE_DIAGNOSTICS_MAX( TriceCriticalSectionCyclesMax, triceCsCycles ) \
     } while(0);
 
+#else // #if defined(TRICE_CPU_CYCLES) && (TRICE_BUFFER == TRICE_DOUBLE_BUFFER)
+
+#define TRICE_DIAGNOSTICS_CS_START
+#define TRICE_DIAGNOSTICS_CS_STOP
+
+#endif // #else // #if defined(TRICE_CPU_CYCLES) && (TRICE_BUFFER == TRICE_DOUBLE_BUFFER)
+
 #else // #if TRICE_DIAGNOSTICS == 1
 
+#define TRICE_DIAGNOSTICS_CS_START
+#define TRICE_DIAGNOSTICS_CS_STOP
 #define TRICE_DIAGNOSTICS_SINGLE_BUFFER_KEEP_START
 #define TRICE_DIAGNOSTICS_SINGLE_BUFFER
 #define TRICE_DIAGNOSTICS_SINGLE_BUFFER_USING_WORDCOUNT 
@@ -542,20 +976,39 @@ TRICE_INLINE uint32_t Reverse32(uint32_t value)
 //! TRICE_ENTER is the start of TRICE macro.
 #define TRICE_ENTER \
     TRICE_ENTER_CRITICAL_SECTION { \
+    TRICE_DIAGNOSTICS_CS_START \
     uint32_t* const triceSingleBufferStartWritePosition = TriceBufferWritePosition;
 
 #endif // #if (TRICE_BUFFER == TRICE_DOUBLE_BUFFER) && (TRICE_DIRECT_OUTPUT == 1)
 
-#if (TRICE_BUFFER == TRICE_DOUBLE_BUFFER) && (TRICE_DIRECT_OUTPUT == 0)
+#if (TRICE_BUFFER == TRICE_DOUBLE_BUFFER) && (TRICE_DIRECT_OUTPUT == 0) && (TRICE_DOUBLE_BUFFER_LOCK_FREE == 0)
 
 //! TRICE_ENTER is the start of TRICE macro.
 #define TRICE_ENTER \
     TRICE_ENTER_CRITICAL_SECTION { \
+    TRICE_DIAGNOSTICS_CS_START \
     TRICE_DIAGNOSTICS_SINGLE_BUFFER_KEEP_START
 
-#endif // #if (TRICE_BUFFER == TRICE_DOUBLE_BUFFER) && (TRICE_DIRECT_OUTPUT == 0)
+#endif // #if (TRICE_BUFFER == TRICE_DOUBLE_BUFFER) && (TRICE_DIRECT_OUTPUT == 0) && (TRICE_DOUBLE_BUFFER_LOCK_FREE == 0)
+
+#if (TRICE_BUFFER == TRICE_DOUBLE_BUFFER) && (TRICE_DOUBLE_BUFFER_LOCK_FREE == 1)
+
+//! TRICE_ENTER is the start of TRICE macro. The trice is assembled on the stack without a critical section.
+#define TRICE_ENTER { \
+    uint32_t triceSingleBuffer[TRICE_SINGLE_MAX_SIZE>>2]; \
+    uint32_t* const triceSingleBufferStartWritePosition = triceSingleBuffer; \
+    uint32_t* TriceBufferWritePosition = triceSingleBufferStartWritePosition;
+
+//! TRICE_LEAVE is the end of TRICE macro. TriceDoubleBufferPush reserves the space and copies the trice.
+#define TRICE_LEAVE \
+    unsigned wordCount = TriceBufferWritePosition - triceSingleBufferStartWritePosition; \
+    TRICE_DIAGNOSTICS_SINGLE_BUFFER_USING_WORDCOUNT \
+    TriceDoubleBufferPush(triceSingleBufferStartWritePosition, wordCount); \
+    }
+
+#endif // #if (TRICE_BUFFER == TRICE_DOUBLE_BUFFER) && (TRICE_DOUBLE_BUFFER_LOCK_FREE == 1)
 
-#if (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_DIRECT_OUTPUT == 1)
+#if (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_UNCHECKED) && (TRICE_DIRECT_OUTPUT == 1)
 
 //! TRICE_ENTER is the start of TRICE macro.
 #define TRICE_ENTER \
@@ -565,9 +1018,9 @@ TRICE_INLINE uint32_t Reverse32(uint32_t value)
     uint32_t* const triceSingleBufferStartWritePosition = TriceBufferWritePosition; \
     SingleTricesRingCount++; // Because TRICE macros are an atomic instruction normally, this can be done here.
 
-#endif // #if TRICE_BUFFER == TRICE_RING_BUFFER && (TRICE_DIRECT_OUTPUT == 1)
+#endif // #if TRICE_BUFFER == TRICE_RING_BUFFER && (TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_UNCHECKED) && (TRICE_DIRECT_OUTPUT == 1)
 
-#if (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_DIRECT_OUTPUT == 0)
+#if (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_UNCHECKED) && (TRICE_DIRECT_OUTPUT == 0)
 
 //! TRICE_ENTER is the start of TRICE macro.
 #define TRICE_ENTER \
@@ -577,10 +1030,68 @@ TRICE_INLINE uint32_t Reverse32(uint32_t value)
     TRICE_DIAGNOSTICS_SINGLE_BUFFER_KEEP_START \
     SingleTricesRingCount++; // Because TRICE macros are an atomic instruction normally, this can be done here.
 
-#endif // #if TRICE_BUFFER == TRICE_RING_BUFFER && (TRICE_DIRECT_OUTPUT == 0)
+#endif // #if TRICE_BUFFER == TRICE_RING_BUFFER && (TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_UNCHECKED) && (TRICE_DIRECT_OUTPUT == 0)
+
+#if (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_OVERFLOW_POLICY != TRICE_OVERFLOW_UNCHECKED)
+
+#if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_BLOCK
+
+//! TRICE_RING_BUFFER_WAIT waits until it reserved space for a trice of max size in all rings.
+//! The space check and the reservation are inside the critical section, so a concurrent trice cannot take the space.
+//! TRICE_OVERFLOW_WAIT is called outside the critical section.
+#define TRICE_RING_BUFFER_WAIT \
+    for(;;){ \
+        int triceReserved; \
+        TRICE_ENTER_CRITICAL_SECTION \
+        triceReserved = TriceRingBufferReserve(); \
+        TRICE_LEAVE_CRITICAL_SECTION \
+        if( triceReserved ){ \
+            break; \
+        } \
+        TRICE_OVERFLOW_WAIT(); \
+    }
+
+#else // #if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_BLOCK
+
+#define TRICE_RING_BUFFER_WAIT
+
+#endif // #else // #if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_BLOCK
+
+//! TRICE_ENTER is the start of TRICE macro. The ring and the needed space are known only afterwards, so the trice is assembled on the stack.
+#define TRICE_ENTER \
+    TRICE_RING_BUFFER_WAIT \
+    TRICE_ENTER_CRITICAL_SECTION { \
+    uint32_t triceSingleBuffer[TRICE_BUFFER_SIZE>>2]; \
+    uint32_t* const triceSingleBufferStartWritePosition = &triceSingleBuffer[TRICE_DATA_OFFSET>>2]; \
+    uint32_t* TriceBufferWritePosition = triceSingleBufferStartWritePosition;
+
+#endif // #if (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_OVERFLOW_POLICY != TRICE_OVERFLOW_UNCHECKED)
 
 #endif
 
+#if !defined(TRICE_LEAVE) && (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_OVERFLOW_POLICY != TRICE_OVERFLOW_UNCHECKED)
+#if TRICE_DIRECT_OUTPUT == 1
+
+    //! TRICE_LEAVE is the end of TRICE macro. The trice is copied into its ring before the direct write, which may encode in place.
+    #define TRICE_LEAVE \
+        unsigned wordCount = TriceBufferWritePosition - triceSingleBufferStartWritePosition; \
+        TRICE_DIAGNOSTICS_SINGLE_BUFFER_USING_WORDCOUNT \
+        TriceRingBufferPush(triceSingleBufferStartWritePosition, wordCount); \
+        TriceNonBlockingDirectWrite(triceSingleBufferStartWritePosition, wordCount); \
+        } TRICE_LEAVE_CRITICAL_SECTION
+
+#else  //#if TRICE_DIRECT_OUTPUT == 1
+
+    //! TRICE_LEAVE is the end of TRICE macro. The trice is copied into the ring selected by its ID.
+    #define TRICE_LEAVE \
+        unsigned wordCount = TriceBufferWritePosition - triceSingleBufferStartWritePosition; \
+        TRICE_DIAGNOSTICS_SINGLE_BUFFER_USING_WORDCOUNT \
+        TriceRingBufferPush(triceSingleBufferStartWritePosition, wordCount); \
+        } TRICE_LEAVE_CRITICAL_SECTION
+
+#endif // #else  //#if TRICE_DIRECT_OUTPUT == 1
+#endif // #if !defined(TRICE_LEAVE) && (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_OVERFLOW_POLICY != TRICE_OVERFLOW_UNCHECKED)
+
 #ifndef TRICE_LEAVE
 #if TRICE_DIRECT_OUTPUT == 1
 
@@ -591,6 +1102,7 @@ TRICE_INLINE uint32_t Reverse32(uint32_t value)
         unsigned wordCount = TriceBufferWritePosition - triceSingleBufferStartWritePosition; \
         TRICE_DIAGNOSTICS_SINGLE_BUFFER_USING_WORDCOUNT \
         TriceNonBlockingDirectWrite(triceSingleBufferStartWritePosition, wordCount); \
+        TRICE_DIAGNOSTICS_CS_STOP \
         } TRICE_LEAVE_CRITICAL_SECTION
 
 #else  //#if TRICE_DIRECT_OUTPUT == 1
@@ -598,6 +1110,7 @@ TRICE_INLINE uint32_t Reverse32(uint32_t value)
     //! TRICE_LEAVE is the end of TRICE macro. It is the same for all buffer variants.
     #define TRICE_LEAVE \
         TRICE_DIAGNOSTICS_SINGLE_BUFFER \
+        TRICE_DIAGNOSTICS_CS_STOP \
         } TRICE_LEAVE_CRITICAL_SECTION
 
 #endif // #else  //#if TRICE_DIRECT_OUTPUT == 1
@@ -609,14 +1122,18 @@ TRICE_INLINE uint32_t Reverse32(uint32_t value)
 #define TRICE_PUT(x) do{ *TriceBufferWritePosition++ = TRICE_HTOTL(x); }while(0); //! PUT copies a 32 bit x into the TRICE buffer.
 #endif
 
-#if ( defined( TRICE_MCU_IS_BIG_ENDIAN ) &&  defined( TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN ) ) \
-  ||(!defined( TRICE_MCU_IS_BIG_ENDIAN ) && !defined( TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN ) )
+//! TRICE_PUT64 copies a 64 bit x as 2 32-bit values in transfer order into the TRICE buffer.
+#define TRICE_PUT64(x) TRICE_PUT( TRICE_WORD0(x) ); TRICE_PUT( TRICE_WORD1(x) );
 
-    #define TRICE_PUT64(x) TRICE_PUT( (uint32_t)(x) ); TRICE_PUT( (uint32_t)((uint64_t)(x)>>32) ); // little endian
+#if TRICE_TRANSFER_ORDER_IS_BIG_ENDIAN == 1
+
+//! TRICE_PUT_HEAD copies a 32 bit x consisting of 2 16-bit fields into the TRICE buffer. The lower 16 bits are transmitted first.
+#define TRICE_PUT_HEAD(x) do{ uint32_t head_ = (x); TRICE_PUT( (head_<<16) | (head_>>16) ); }while(0)
 
 #else
 
-    #define TRICE_PUT64(x) TRICE_PUT( (uint32_t)((uint64_t)(x)>>32) ); TRICE_PUT( (uint32_t)(x) ); // big endian
+//! TRICE_PUT_HEAD copies a 32 bit x consisting of 2 16-bit fields into the TRICE buffer. The lower 16 bits are transmitted first.
+#define TRICE_PUT_HEAD(x) TRICE_PUT(x)
 
 #endif
 
@@ -627,6 +1144,18 @@ TRICE_INLINE uint32_t Reverse32(uint32_t value)
 
 #endif
 
+#ifdef TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN
+
+//! TRICE_PUTBUFFER_W copies a buffer of size bytes wide values in transfer order into the TRICE buffer.
+#define TRICE_PUTBUFFER_W( buf, len, size ) do{ TriceSwapCopy( TriceBufferWritePosition, buf, len, size ); TriceBufferWritePosition += (len+3)>>2; }while(0)
+
+#else
+
+//! TRICE_PUTBUFFER_W copies a buffer of size bytes wide values in transfer order into the TRICE buffer.
+#define TRICE_PUTBUFFER_W( buf, len, size ) TRICE_PUTBUFFER( buf, len )
+
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // trice time measurement (STM32 only?)
 //
@@ -683,6 +1212,8 @@ void XTEAInitTable(void);
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#ifndef COUNT_ARGUMENTS // triceMaxParams.h defines them for more arguments
+
 //! NTH_ARGUMENT just evaluates to the 15th argument. It is extendable.
 #define NTH_ARGUMENT(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, ...) a14 
 
@@ -696,6 +1227,8 @@ void XTEAInitTable(void);
 //! In case you have to set the C-Language to c11 or c99 you can use the TRICE0 macro directly instead of TRICE when no value parameters.
 #define COUNT_ARGUMENTS(...) NTH_ARGUMENT(dummy, ## __VA_ARGS__, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
 
+#endif // #ifndef COUNT_ARGUMENTS
+
 //! CONCAT concatenates the 2 arguments a and b (helper macro).
 #define CONCAT(a, b) a ## b 
 
@@ -786,27 +1319,43 @@ static inline uint64_t aDouble( double x ){
 //
 // todo: for some reason this macro is not working well wit name len instead of len_, probably when injected len as value.
 //
-#define TRICE_N( tid, pFmt, buf, n) do { \
-    uint32_t limit = TRICE_SINGLE_MAX_SIZE-8; /* 8 = head + max timestamp size --> todo: consider 64-bit stamp! */ \
+#define TRICE_N( tid, pFmt, buf, n) TRICE_NW( tid, pFmt, buf, n, 1 )
+#endif // #ifndef TRICE_N
+
+//! TRICE_NW is TRICE_N for a buffer of size bytes wide values. With TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN the values are reordered.
+#define TRICE_NW( tid, pFmt, buf, n, size ) do { \
+    uint32_t limit = TRICE_SINGLE_MAX_SIZE-TRICE_HEAD_MAX_SIZE; \
     uint32_t len_ = n; /* n could be a constant */ \
     if( len_ > limit ){ \
         TRICE32( id( 5150), "wrn:Transmit buffer truncated from %u to %u\n", len_, limit ); \
         len_ = limit; \
     } \
     TRICE_ENTER tid; \
-    if( len_ <= 127 ){ CNTC(len_); }else{ LCNT(len_); } \
-    TRICE_PUTBUFFER( buf, len_ ); \
+    if( len_ < TRICE_SHORT_COUNT_LIMIT ){ CNTC(len_); }else{ LCNT(len_); } \
+    TRICE_PUTBUFFER_W( buf, len_, size ); \
     TRICE_LEAVE \
 } while(0)
-#endif // #ifndef TRICE_N
+
+#ifndef TRICE_STRLEN
+#if defined( __GNUC__ ) || defined( __clang__ )
+//! TRICE_STRLEN returns the length of the 0-terminated string s.
+//! For string literals and other compile time known strings the compiler folds the builtin to a constant,
+//! also with -fno-builtin, so the truncation check inside TRICE_N vanishes and the copy gets a constant size.
+#define TRICE_STRLEN( s ) __builtin_strlen( s )
+#else
+//! TRICE_STRLEN returns the length of the 0-terminated string s.
+#define TRICE_STRLEN( s ) strlen( s )
+#endif
+#endif // #ifndef TRICE_STRLEN
 
 #ifndef TRICE_S
 //! TRICE_S writes id and dynString.
 //! \param id trice identifier
 //! \param pFmt formatstring for trice (ignored here but used by the trice tool)
 //! \param dynString 0-terminated runtime generated string
+//! Constant strings are better written as part of the format string. "trice insert -inlineStrings" does that automatically.
 #define TRICE_S( id, pFmt, dynString) do { \
-    uint32_t ssiz = strlen( dynString ); \
+    uint32_t ssiz = TRICE_STRLEN( dynString ); \
     TRICE_N( id, pFmt, dynString, ssiz ); \
 } while(0)
 #endif // #ifndef TRICE_S
@@ -818,23 +1367,48 @@ static inline uint64_t aDouble( double x ){
 
 #endif
 
-#ifdef TRICE_MCU_IS_BIG_ENDIAN
-
 //! TRICE_PUT1616 writes a 32-bit value in 2 16-bit steps to avoid memory alignment hard fault.
-#define TRICE_PUT1616( ts ) TRICE_PUT16( ts >> 16 ); TRICE_PUT16( ts ); 
+#define TRICE_PUT1616( ts ) TRICE_PUT16( TRICE_HALF0(ts) ); TRICE_PUT16( TRICE_HALF1(ts) ); 
 
-#else
+//! TRICE_PUT16161616 writes a 64-bit value in 4 16-bit steps to avoid memory alignment hard fault.
+#define TRICE_PUT16161616( ts ) TRICE_PUT1616( TRICE_WORD0(ts) ); TRICE_PUT1616( TRICE_WORD1(ts) ); 
 
-//! TRICE_PUT1616 writes a 32-bit value in 2 16-bit steps to avoid memory alignment hard fault.
-#define TRICE_PUT1616( ts ) TRICE_PUT16( ts );       TRICE_PUT16( ((ts) >> 16) ); 
+#if TRICE_STAMP64 == 1
 
-#endif
+//! TRICE_HEAD_MAX_SIZE is the max byte count in front of the trice payload: 16-bit ID, 64-bit stamp and 16-bit count.
+#define TRICE_HEAD_MAX_SIZE 12
+
+//! ID writes 14-bit id with 00 as 2 most significant bits, followed by a 64-bit stamp.
+//! 00iiiiiiI TT | TT | TT | TT (NC) | ...
+#define ID(n) { uint64_t ts = TriceStamp64(); TRICE_PUT16( (n)); TRICE_PUT16161616(ts); }
+
+//! TRICE_PUT_ID_TS writes the head of the TRice*m_* macros with a 64-bit stamp as 3 32-bit values.
+//! 00iiiiiiI TT | TT TT | TT NC
+#define TRICE_PUT_ID_TS( tid, count ) \
+    uint64_t ts = TriceStamp64(); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_HALF0(TRICE_WORD0(ts))<<16) | tid ); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_HALF0(TRICE_WORD1(ts))<<16) | TRICE_HALF1(TRICE_WORD0(ts)) ); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(count)<<16) | TRICE_HALF1(TRICE_WORD1(ts)) );
+
+#else // #if TRICE_STAMP64 == 1
+
+//! TRICE_HEAD_MAX_SIZE is the max byte count in front of the trice payload: 16-bit ID, 32-bit stamp and 16-bit count.
+#define TRICE_HEAD_MAX_SIZE 8
 
 //! ID writes 14-bit id with 11 as 2 most significant bits, followed by a 32-bit stamp.
 //! 11iiiiiiI TT | TT (NC) | ...
 //! C000 = 1100 0000 0000 0000
 #define ID(n) { uint32_t ts = TriceStamp32(); TRICE_PUT16( (0xC000|(n))); TRICE_PUT1616(ts); }
 
+//! TRICE_PUT_ID_TS writes the head of the TRice*m_* macros with a 32-bit stamp as 2 32-bit values.
+//! 11iiiiiiI TT | TT NC
+#define TRICE_PUT_ID_TS( tid, count ) \
+    uint32_t ts = TriceStamp32(); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_HALF0(ts)<<16) | 0xc000 | tid ); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(count)<<16) | TRICE_HALF1(ts) );
+
+#endif // #else // #if TRICE_STAMP64 == 1
+
 //! Id writes 14-bit id with 10 as 2 most significant bits two times, followed by a 16-bit stamp.
 //! 10iiiiiiI 10iiiiiiI | TT (NC) | ...
 //! 8000 = 1000 0000 0000 0000
@@ -848,8 +1422,8 @@ static inline uint64_t aDouble( double x ){
 //! iD is just a code parsing helper.
 #define iD(n) (n)
 
-//! CNTC writes 7-bit byte count and 8-bit cycle counter.
-#define CNTC(count) do{ uint16_t v = ((count)<<8) | TRICE_CYCLE; TRICE_PUT16( v ); }while(0)
+//! CNTC writes 7-bit byte count and 8-bit cycle counter. Byte counts from TRICE_SHORT_COUNT_LIMIT on are written like with LCNT.
+#define CNTC(count) do{ uint16_t v = TRICE_NC(count); TRICE_PUT16( v ); }while(0)
 
 #if TRICE_CYCLE_COUNTER == 1
 
@@ -863,6 +1437,10 @@ static inline uint64_t aDouble( double x ){
 
 #endif
 
+//! TRICE_NC returns the 16-bit count and cycle value for a compile time constant byte count.
+//! Byte counts from TRICE_SHORT_COUNT_LIMIT on are encoded like with LCNT: The cycle counter is incremented but not transmitted.
+#define TRICE_NC(count) ((count) < TRICE_SHORT_COUNT_LIMIT ? (uint16_t)(((count)<<8) | TRICE_CYCLE) : (uint16_t)(0x8000 | (count) | (0 & TRICE_CYCLE)))
+
 //! TRICE0 writes trice data as fast as possible in a buffer.
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 #define TRICE0( id, pFmt ) \
@@ -883,7 +1461,7 @@ TRICE_INLINE void trice0( uint16_t tid, char const * pFmt ){ trice32m_0( tid );
 
 #endif // #else // #ifdef TRICE_CLEAN
 
-#ifdef TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN
+#if TRICE_TRANSFER_ORDER_IS_BIG_ENDIAN == 1
 
 #define TRICE_BYTE3(v)((uint8_t)(v))
 #define TRICE_BYTE2(v)(0x0000FF00 &  ((uint32_t)(v)<< 8))
@@ -893,7 +1471,7 @@ TRICE_INLINE void trice0( uint16_t tid, char const * pFmt ){ trice32m_0( tid );
 #define TRICE_SHORT1( v ) (uint16_t)(v)
 #define TRICE_SHORT0( v ) ((uint32_t)(v)<<16) 
 
-#else // #ifdef TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN
+#else // #if TRICE_TRANSFER_ORDER_IS_BIG_ENDIAN == 1
 
 #define TRICE_BYTE0(v)((uint8_t)(v))
 #define TRICE_BYTE1(v)(0x0000FF00 &  ((uint32_t)(v)<< 8))
@@ -903,7 +1481,7 @@ TRICE_INLINE void trice0( uint16_t tid, char const * pFmt ){ trice32m_0( tid );
 #define TRICE_SHORT0( v ) (uint16_t)(v)
 #define TRICE_SHORT1( v ) ((uint32_t)(v)<<16) 
 
-#endif // #else // #ifdef TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN
+#endif // #else // #if TRICE_TRANSFER_ORDER_IS_BIG_ENDIAN == 1
 
 #ifdef __cplusplus
 }
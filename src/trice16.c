@@ -10,234 +10,273 @@
 
 #if ENABLE_trice16fn_0 
 void trice16fn_0( uint16_t tid ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice16m_0( tid );
 }
 #endif
 
 #if ENABLE_trice16fn_1 
 void trice16fn_1( uint16_t tid, uint16_t v0 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice16m_1( tid, v0 );
 }
 #endif
 
 #if ENABLE_trice16fn_2
 void trice16fn_2( uint16_t tid,  uint16_t v0, uint16_t v1 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice16m_2( tid, v0, v1 );
 }
 #endif
 
 #if ENABLE_trice16fn_3
 void trice16fn_3( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice16m_3( tid, v0, v1, v2 );
 }
 #endif
 
 #if ENABLE_trice16fn_4
 void trice16fn_4( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice16m_4( tid, v0, v1, v2, v3 );
 }
 #endif
 
 #if ENABLE_trice16fn_5
 void trice16fn_5( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice16m_5( tid, v0, v1, v2, v3, v4 );
 }
 #endif
 
 #if ENABLE_trice16fn_6
 void trice16fn_6( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice16m_6( tid, v0, v1, v2, v3, v4, v5 );
 }
 #endif
 
 #if ENABLE_trice16fn_7
 void trice16fn_7( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice16m_7( tid, v0, v1, v2, v3, v4, v5, v6 );
 }
 #endif
 
 #if ENABLE_trice16fn_8
 void trice16fn_8( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice16m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 );
 }
 #endif
 
 #if ENABLE_trice16fn_9
 void trice16fn_9( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice16m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 );
 }
 #endif
 
 #if ENABLE_trice16fn_10
 void trice16fn_10( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice16m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 );
 }
 #endif
 
 #if ENABLE_trice16fn_11
 void trice16fn_11( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice16m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 );
 }
 #endif
 
 #if ENABLE_trice16fn_12
 void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice16m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 );
 }
 #endif
 
 #if ENABLE_Trice16fn_0
 void Trice16fn_0( uint16_t tid ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice16m_0( tid );
 }
 #endif
 
 #if ENABLE_Trice16fn_1
 void Trice16fn_1( uint16_t tid, uint16_t v0 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice16m_1( tid, v0 );
 }
 #endif
 
 #if ENABLE_Trice16fn_2
 void Trice16fn_2( uint16_t tid, uint16_t v0, uint16_t v1 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice16m_2( tid, v0, v1 );
 }
 #endif
 
 #if ENABLE_Trice16fn_3
 void Trice16fn_3( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice16m_3( tid, v0, v1, v2 );
 }
 #endif
 
 #if ENABLE_Trice16fn_4
 void Trice16fn_4( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice16m_4( tid, v0, v1, v2, v3 );
 }
 #endif
 
 #if ENABLE_Trice16fn_5
 void Trice16fn_5( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice16m_5( tid, v0, v1, v2, v3, v4 );
 }
 #endif
 
 #if ENABLE_Trice16fn_6
 void Trice16fn_6( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice16m_6( tid, v0, v1, v2, v3, v4, v5 );
 }
 #endif
 
 #if ENABLE_Trice16fn_7
 void Trice16fn_7( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice16m_7( tid, v0, v1, v2, v3, v4, v5, v6 );
 }
 #endif
 
 #if ENABLE_Trice16fn_8
 void Trice16fn_8( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice16m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 );
 }
 #endif
 
 #if ENABLE_Trice16fn_9
 void Trice16fn_9( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice16m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 );
 }
 #endif
 
 #if ENABLE_Trice16fn_10
 void Trice16fn_10( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice16m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 );
 }
 #endif
 
 #if ENABLE_Trice16fn_11
 void Trice16fn_11( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice16m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 );
 }
 #endif
 
 #if ENABLE_Trice16fn_12
 void Trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice16m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 );
 }
 #endif
 
 #if ENABLE_TRice16fn_0
 void TRice16fn_0( uint16_t tid ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice16m_0( tid );
 }
 #endif
 
 #if ENABLE_TRice16fn_1
 void TRice16fn_1( uint16_t tid, uint16_t v0 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice16m_1( tid, v0 );
 }
 #endif
 
 #if ENABLE_TRice16fn_2
 void TRice16fn_2( uint16_t tid,  uint16_t v0, uint16_t v1 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice16m_2( tid, v0, v1 );
 }
 #endif
 
 #if ENABLE_TRice16fn_3
 void TRice16fn_3( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice16m_3( tid, v0, v1, v2 );
 }
 #endif
 
 #if ENABLE_TRice16fn_4
 void TRice16fn_4( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice16m_4( tid, v0, v1, v2, v3 );
 }
 #endif
 
 #if ENABLE_TRice16fn_5
 void TRice16fn_5( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice16m_5( tid, v0, v1, v2, v3, v4 );
 }
 #endif
 
 #if ENABLE_TRice16fn_6
 void TRice16fn_6( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice16m_6( tid, v0, v1, v2, v3, v4, v5 );
 }
 #endif
 
 #if ENABLE_TRice16fn_7
 void TRice16fn_7( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice16m_7( tid, v0, v1, v2, v3, v4, v5, v6 );
 }
 #endif
 
 #if ENABLE_TRice16fn_8
 void TRice16fn_8( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice16m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 );
 }
 #endif
 
 #if ENABLE_TRice16fn_9
 void TRice16fn_9( uint16_t tid,  uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice16m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 );
 }
 #endif
 
 #if ENABLE_TRice16fn_10
 void TRice16fn_10( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice16m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 );
 }
 #endif
 
 #if ENABLE_TRice16fn_11
 void TRice16fn_11( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice16m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 );
 }
 #endif
 
 #if ENABLE_TRice16fn_12
 void TRice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice16m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 );
 }
 #endif
@@ -20,7 +20,7 @@
 
 //!TRICE16_B expects inside pFmt only one format specifier, which is used n times by using pFmt n times.
 //! It is usable for showing n 16-bit values.
-#define TRICE16_B( id, pFmt, buf, n) do { TRICE_N( id, pFmt, buf, 2*n); } while(0)
+#define TRICE16_B( id, pFmt, buf, n) do { TRICE_NW( id, pFmt, buf, 2*n, 2); } while(0)
 
 //!TRICE16_F expects inside pFmt just a string which is assumed to be a remote function name.
 //! The trice tool displays the pFmt string followed by n times (16-bit value i).
@@ -189,7 +189,7 @@
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 #define trice16m_0( tid ) \
     TRICE_ENTER \
-    TRICE_PUT( (0<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (0<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_LEAVE
 
 //! trice16m_1 writes trice data as fast as possible in a buffer.
@@ -197,73 +197,73 @@
 //! \param v0 a 16 bit value
 #define trice16m_1( tid, v0 ) \
     TRICE_ENTER \
-    TRICE_PUT( (2<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (2<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT16_1( v0 ) \
     TRICE_LEAVE
 
 #define trice16m_2( tid, v0, v1 ) \
     TRICE_ENTER \
-    TRICE_PUT( (4<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (4<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT16_2( v0, v1); \
     TRICE_LEAVE
 
 #define trice16m_3( tid, v0, v1, v2 ) \
     TRICE_ENTER \
-    TRICE_PUT( (6<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (6<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT16_3 ( v0, v1, v2 ); \
     TRICE_LEAVE
 
 #define trice16m_4( tid, v0, v1, v2, v3 ) \
     TRICE_ENTER \
-    TRICE_PUT( (8<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (8<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT16_4( v0, v1, v2, v3 ); \
     TRICE_LEAVE
 
 #define trice16m_5( tid, v0, v1, v2, v3, v4 ) \
     TRICE_ENTER \
-    TRICE_PUT( (10<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (10<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT16_5( v0, v1, v2, v3, v4 ); \
     TRICE_LEAVE
 
 #define trice16m_6( tid, v0, v1, v2, v3, v4, v5 ) \
     TRICE_ENTER \
-    TRICE_PUT( (12<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (12<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT16_6( v0, v1, v2, v3, v4, v5 ); \
     TRICE_LEAVE
 
 #define trice16m_7( tid, v0, v1, v2, v3, v4, v5, v6 ) \
     TRICE_ENTER \
-    TRICE_PUT( (14<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (14<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT16_7( v0, v1, v2, v3, v4, v5, v6 ); \
     TRICE_LEAVE
 
 #define trice16m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 ) \
     TRICE_ENTER \
-    TRICE_PUT( (16<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (16<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT16_8( v0, v1, v2, v3, v4, v5, v6, v7 ); \
     TRICE_LEAVE
 
 #define trice16m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) \
     TRICE_ENTER \
-    TRICE_PUT( (18<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (18<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT16_9( v0, v1, v2, v3, v4, v5, v6, v7, v8 ); \
     TRICE_LEAVE
 
 #define trice16m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) \
     TRICE_ENTER \
-    TRICE_PUT( (20<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (20<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT16_10( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ); \
     TRICE_LEAVE
 
 #define trice16m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) \
     TRICE_ENTER \
-    TRICE_PUT( (22<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (22<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT16_11( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ); \
     TRICE_LEAVE
 
 #define trice16m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_ENTER \
-    TRICE_PUT( (24<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (24<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT16_12( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_LEAVE
 
@@ -319,7 +319,7 @@ void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 0<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 0<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_LEAVE
 
 //! Trice16m_1 writes trice data as fast as possible in a buffer.
@@ -329,7 +329,7 @@ void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 2<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 2<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT16_1( v0 ) \
     TRICE_LEAVE
 
@@ -337,7 +337,7 @@ void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 4<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 4<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT16_2( v0, v1); \
     TRICE_LEAVE
 
@@ -345,7 +345,7 @@ void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 6<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 6<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT16_3 ( v0, v1, v2 ); \
     TRICE_LEAVE
 
@@ -353,7 +353,7 @@ void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 8<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 8<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT16_4( v0, v1, v2, v3 ); \
     TRICE_LEAVE
 
@@ -361,7 +361,7 @@ void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 10<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 10<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT16_5( v0, v1, v2, v3, v4 ); \
     TRICE_LEAVE
 
@@ -369,7 +369,7 @@ void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 12<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 12<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT16_6( v0, v1, v2, v3, v4, v5 ); \
     TRICE_LEAVE
 
@@ -377,7 +377,7 @@ void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 14<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 14<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT16_7( v0, v1, v2, v3, v4, v5, v6 ); \
     TRICE_LEAVE
 
@@ -385,7 +385,7 @@ void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 16<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 16<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT16_8( v0, v1, v2, v3, v4, v5, v6, v7 ); \
     TRICE_LEAVE
 
@@ -393,7 +393,7 @@ void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 18<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 18<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT16_9( v0, v1, v2, v3, v4, v5, v6, v7, v8 ); \
     TRICE_LEAVE
 
@@ -401,7 +401,7 @@ void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 20<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 20<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT16_10( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ); \
     TRICE_LEAVE
 
@@ -409,7 +409,7 @@ void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 22<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 22<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT16_11( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ); \
     TRICE_LEAVE
 
@@ -417,7 +417,7 @@ void trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 24<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 24<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT16_12( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_LEAVE
 
@@ -471,9 +471,7 @@ void Trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
 
 #define TRice16m_0( tid ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 0<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 0 ) \
     TRICE_LEAVE
 
 //! TRice16m_1 writes trice data as fast as possible in a buffer.
@@ -481,97 +479,73 @@ void Trice16fn_12( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t
 //! \param v0 a 16 bit value
 #define TRice16m_1( tid, v0 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 2<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 2 ) \
     TRICE_PUT16_1( v0 ) \
     TRICE_LEAVE
 
 #define TRice16m_2( tid, v0, v1 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 4<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 4 ) \
     TRICE_PUT16_2( v0, v1); \
     TRICE_LEAVE
 
 #define TRice16m_3( tid, v0, v1, v2 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 6<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 6 ) \
     TRICE_PUT16_3 ( v0, v1, v2 ); \
     TRICE_LEAVE
 
 #define TRice16m_4( tid, v0, v1, v2, v3 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 8<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 8 ) \
     TRICE_PUT16_4( v0, v1, v2, v3 ); \
     TRICE_LEAVE
 
 #define TRice16m_5( tid, v0, v1, v2, v3, v4 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 10<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 10 ) \
     TRICE_PUT16_5( v0, v1, v2, v3, v4 ); \
     TRICE_LEAVE
 
 #define TRice16m_6( tid, v0, v1, v2, v3, v4, v5 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 12<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 12 ) \
     TRICE_PUT16_6( v0, v1, v2, v3, v4, v5 ); \
     TRICE_LEAVE
 
 #define TRice16m_7( tid, v0, v1, v2, v3, v4, v5, v6 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 14<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 14 ) \
     TRICE_PUT16_7( v0, v1, v2, v3, v4, v5, v6 ); \
     TRICE_LEAVE
 
 #define TRice16m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 16<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 16 ) \
     TRICE_PUT16_8( v0, v1, v2, v3, v4, v5, v6, v7 ); \
     TRICE_LEAVE
 
 #define TRice16m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 18<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 18 ) \
     TRICE_PUT16_9( v0, v1, v2, v3, v4, v5, v6, v7, v8 ); \
     TRICE_LEAVE
 
 #define TRice16m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 20<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 20 ) \
     TRICE_PUT16_10( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ); \
     TRICE_LEAVE
 
 #define TRice16m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 22<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 22 ) \
     TRICE_PUT16_11( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ); \
     TRICE_LEAVE
 
 #define TRice16m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 24<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 24 ) \
     TRICE_PUT16_12( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_LEAVE
 
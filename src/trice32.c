@@ -10,234 +10,273 @@
 
 #if ENABLE_trice32fn_0 
 void trice32fn_0( uint16_t tid ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice32m_0( tid );
 }
 #endif
 
 #if ENABLE_trice32fn_1 
 void trice32fn_1( uint16_t tid, uint32_t v0 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice32m_1( tid, v0 );
 }
 #endif
 
 #if ENABLE_trice32fn_2
 void trice32fn_2( uint16_t tid,  uint32_t v0, uint32_t v1 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice32m_2( tid, v0, v1 );
 }
 #endif
 
 #if ENABLE_trice32fn_3
 void trice32fn_3( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice32m_3( tid, v0, v1, v2 );
 }
 #endif
 
 #if ENABLE_trice32fn_4
 void trice32fn_4( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice32m_4( tid, v0, v1, v2, v3 );
 }
 #endif
 
 #if ENABLE_trice32fn_5
 void trice32fn_5( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice32m_5( tid, v0, v1, v2, v3, v4 );
 }
 #endif
 
 #if ENABLE_trice32fn_6
 void trice32fn_6( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice32m_6( tid, v0, v1, v2, v3, v4, v5 );
 }
 #endif
 
 #if ENABLE_trice32fn_7
 void trice32fn_7( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice32m_7( tid, v0, v1, v2, v3, v4, v5, v6 );
 }
 #endif
 
 #if ENABLE_trice32fn_8
 void trice32fn_8( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice32m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 );
 }
 #endif
 
 #if ENABLE_trice32fn_9
 void trice32fn_9( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice32m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 );
 }
 #endif
 
 #if ENABLE_trice32fn_10
 void trice32fn_10( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice32m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 );
 }
 #endif
 
 #if ENABLE_trice32fn_11
 void trice32fn_11( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice32m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 );
 }
 #endif
 
 #if ENABLE_trice32fn_12
 void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice32m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 );
 }
 #endif
 
 #if ENABLE_Trice32fn_0
 void Trice32fn_0( uint16_t tid ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice32m_0( tid );
 }
 #endif
 
 #if ENABLE_Trice32fn_1
 void Trice32fn_1( uint16_t tid, uint32_t v0 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice32m_1( tid, v0 );
 }
 #endif
 
 #if ENABLE_Trice32fn_2
 void Trice32fn_2( uint16_t tid, uint32_t v0, uint32_t v1 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice32m_2( tid, v0, v1 );
 }
 #endif
 
 #if ENABLE_Trice32fn_3
 void Trice32fn_3( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice32m_3( tid, v0, v1, v2 );
 }
 #endif
 
 #if ENABLE_Trice32fn_4
 void Trice32fn_4( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice32m_4( tid, v0, v1, v2, v3 );
 }
 #endif
 
 #if ENABLE_Trice32fn_5
 void Trice32fn_5( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice32m_5( tid, v0, v1, v2, v3, v4 );
 }
 #endif
 
 #if ENABLE_Trice32fn_6
 void Trice32fn_6( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice32m_6( tid, v0, v1, v2, v3, v4, v5 );
 }
 #endif
 
 #if ENABLE_Trice32fn_7
 void Trice32fn_7( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice32m_7( tid, v0, v1, v2, v3, v4, v5, v6 );
 }
 #endif
 
 #if ENABLE_Trice32fn_8
 void Trice32fn_8( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice32m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 );
 }
 #endif
 
 #if ENABLE_Trice32fn_9
 void Trice32fn_9( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice32m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 );
 }
 #endif
 
 #if ENABLE_Trice32fn_10
 void Trice32fn_10( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice32m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 );
 }
 #endif
 
 #if ENABLE_Trice32fn_11
 void Trice32fn_11( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice32m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 );
 }
 #endif
 
 #if ENABLE_Trice32fn_12
 void Trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice32m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 );
 }
 #endif
 
 #if ENABLE_TRice32fn_0
 void TRice32fn_0( uint16_t tid ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice32m_0( tid );
 }
 #endif
 
 #if ENABLE_TRice32fn_1
 void TRice32fn_1( uint16_t tid, uint32_t v0 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice32m_1( tid, v0 );
 }
 #endif
 
 #if ENABLE_TRice32fn_2
 void TRice32fn_2( uint16_t tid,  uint32_t v0, uint32_t v1 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice32m_2( tid, v0, v1 );
 }
 #endif
 
 #if ENABLE_TRice32fn_3
 void TRice32fn_3( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice32m_3( tid, v0, v1, v2 );
 }
 #endif
 
 #if ENABLE_TRice32fn_4
 void TRice32fn_4( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice32m_4( tid, v0, v1, v2, v3 );
 }
 #endif
 
 #if ENABLE_TRice32fn_5
 void TRice32fn_5( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice32m_5( tid, v0, v1, v2, v3, v4 );
 }
 #endif
 
 #if ENABLE_TRice32fn_6
 void TRice32fn_6( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice32m_6( tid, v0, v1, v2, v3, v4, v5 );
 }
 #endif
 
 #if ENABLE_TRice32fn_7
 void TRice32fn_7( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice32m_7( tid, v0, v1, v2, v3, v4, v5, v6 );
 }
 #endif
 
 #if ENABLE_TRice32fn_8
 void TRice32fn_8( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice32m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 );
 }
 #endif
 
 #if ENABLE_TRice32fn_9
 void TRice32fn_9( uint16_t tid,  uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice32m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 );
 }
 #endif
 
 #if ENABLE_TRice32fn_10
 void TRice32fn_10( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice32m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 );
 }
 #endif
 
 #if ENABLE_TRice32fn_11
 void TRice32fn_11( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice32m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 );
 }
 #endif
 
 #if ENABLE_TRice32fn_12
 void TRice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice32m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 );
 }
 #endif
@@ -20,7 +20,7 @@
 
 //!TRICE32_B expects inside pFmt only one format specifier, which is used n times by using pFmt n times.
 //! It is usable for showing n 32-bit values.
-#define TRICE32_B( id, pFmt, buf, n) do { TRICE_N( id, pFmt, buf, 4*n); } while(0)
+#define TRICE32_B( id, pFmt, buf, n) do { TRICE_NW( id, pFmt, buf, 4*n, 4); } while(0)
 
 //!TRICE32_F expects inside pFmt just a string which is assumed to be a remote function name.
 //! The trice tool displays the pFmt string followed by n times (32-bit value i).
@@ -225,7 +225,7 @@
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 #define trice32m_0( tid ) \
     TRICE_ENTER \
-    TRICE_PUT( (0<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (0<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_LEAVE
 
 //! trice32m_1 writes trice data as fast as possible in a buffer.
@@ -233,73 +233,73 @@
 //! \param v0 a 32 bit bit value
 #define trice32m_1( tid, v0 ) \
     TRICE_ENTER \
-    TRICE_PUT( (4<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (4<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT32_1( v0 ) \
     TRICE_LEAVE
 
 #define trice32m_2( tid, v0, v1 ) \
     TRICE_ENTER \
-    TRICE_PUT( (8<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (8<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT32_2( v0, v1); \
     TRICE_LEAVE
 
 #define trice32m_3( tid, v0, v1, v2 ) \
     TRICE_ENTER \
-    TRICE_PUT( (12<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (12<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT32_3 ( v0, v1, v2 ); \
     TRICE_LEAVE
 
 #define trice32m_4( tid, v0, v1, v2, v3 ) \
     TRICE_ENTER \
-    TRICE_PUT( (16<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (16<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT32_4( v0, v1, v2, v3 ); \
     TRICE_LEAVE
 
 #define trice32m_5( tid, v0, v1, v2, v3, v4 ) \
     TRICE_ENTER \
-    TRICE_PUT( (20<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (20<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT32_5( v0, v1, v2, v3, v4 ); \
     TRICE_LEAVE
 
 #define trice32m_6( tid, v0, v1, v2, v3, v4, v5 ) \
     TRICE_ENTER \
-    TRICE_PUT( (24<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (24<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT32_6( v0, v1, v2, v3, v4, v5 ); \
     TRICE_LEAVE
 
 #define trice32m_7( tid, v0, v1, v2, v3, v4, v5, v6 ) \
     TRICE_ENTER \
-    TRICE_PUT( (28<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (28<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT32_7( v0, v1, v2, v3, v4, v5, v6 ); \
     TRICE_LEAVE
 
 #define trice32m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 ) \
     TRICE_ENTER \
-    TRICE_PUT( (32<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (32<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT32_8( v0, v1, v2, v3, v4, v5, v6, v7 ); \
     TRICE_LEAVE
 
 #define trice32m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) \
     TRICE_ENTER \
-    TRICE_PUT( (36<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (36<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT32_9( v0, v1, v2, v3, v4, v5, v6, v7, v8 ); \
     TRICE_LEAVE
 
 #define trice32m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) \
     TRICE_ENTER \
-    TRICE_PUT( (40<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (40<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT32_10( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ); \
     TRICE_LEAVE
 
 #define trice32m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) \
     TRICE_ENTER \
-    TRICE_PUT( (44<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (44<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT32_11( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ); \
     TRICE_LEAVE
 
 #define trice32m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_ENTER \
-    TRICE_PUT( (48<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (48<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT32_12( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_LEAVE
 
@@ -355,7 +355,7 @@ void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 0<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 0<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_LEAVE
 
 //! Trice32m_1 writes trice data as fast as possible in a buffer.
@@ -365,7 +365,7 @@ void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 4<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 4<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT32_1( v0 ) \
     TRICE_LEAVE
 
@@ -373,7 +373,7 @@ void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 8<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 8<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT32_2( v0, v1); \
     TRICE_LEAVE
 
@@ -381,7 +381,7 @@ void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 12<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 12<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT32_3 ( v0, v1, v2 ); \
     TRICE_LEAVE
 
@@ -389,7 +389,7 @@ void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 16<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 16<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT32_4( v0, v1, v2, v3 ); \
     TRICE_LEAVE
 
@@ -397,7 +397,7 @@ void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 20<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 20<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT32_5( v0, v1, v2, v3, v4 ); \
     TRICE_LEAVE
 
@@ -405,7 +405,7 @@ void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 24<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 24<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT32_6( v0, v1, v2, v3, v4, v5 ); \
     TRICE_LEAVE
 
@@ -413,7 +413,7 @@ void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 28<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 28<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT32_7( v0, v1, v2, v3, v4, v5, v6 ); \
     TRICE_LEAVE
 
@@ -421,7 +421,7 @@ void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 32<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 32<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT32_8( v0, v1, v2, v3, v4, v5, v6, v7 ); \
     TRICE_LEAVE
 
@@ -429,7 +429,7 @@ void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 36<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 36<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT32_9( v0, v1, v2, v3, v4, v5, v6, v7, v8 ); \
     TRICE_LEAVE
 
@@ -437,7 +437,7 @@ void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 40<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 40<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT32_10( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ); \
     TRICE_LEAVE
 
@@ -445,7 +445,7 @@ void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 44<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 44<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT32_11( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ); \
     TRICE_LEAVE
 
@@ -453,7 +453,7 @@ void trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 48<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 48<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT32_12( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_LEAVE
 
@@ -507,9 +507,7 @@ void Trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
 
 #define TRice32m_0( tid) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 0<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 0 ) \
     TRICE_LEAVE
 
 //! TRice32m_1 writes trice data as fast as possible in a buffer.
@@ -517,97 +515,73 @@ void Trice32fn_12( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t
 //! \param v0 a 32 bit bit value
 #define TRice32m_1( tid, v0 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 4<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 4 ) \
     TRICE_PUT32_1( v0 ) \
     TRICE_LEAVE
 
 #define TRice32m_2( tid, v0, v1 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 8<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 8 ) \
     TRICE_PUT32_2( v0, v1); \
     TRICE_LEAVE
 
 #define TRice32m_3( tid, v0, v1, v2 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 12<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 12 ) \
     TRICE_PUT32_3 ( v0, v1, v2 ); \
     TRICE_LEAVE
 
 #define TRice32m_4( tid, v0, v1, v2, v3 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 16<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 16 ) \
     TRICE_PUT32_4( v0, v1, v2, v3 ); \
     TRICE_LEAVE
 
 #define TRice32m_5( tid, v0, v1, v2, v3, v4 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 20<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 20 ) \
     TRICE_PUT32_5( v0, v1, v2, v3, v4 ); \
     TRICE_LEAVE
 
 #define TRice32m_6( tid, v0, v1, v2, v3, v4, v5 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 24<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 24 ) \
     TRICE_PUT32_6( v0, v1, v2, v3, v4, v5 ); \
     TRICE_LEAVE
 
 #define TRice32m_7( tid, v0, v1, v2, v3, v4, v5, v6 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 28<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 28 ) \
     TRICE_PUT32_7( v0, v1, v2, v3, v4, v5, v6 ); \
     TRICE_LEAVE
 
 #define TRice32m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 32<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 32 ) \
     TRICE_PUT32_8( v0, v1, v2, v3, v4, v5, v6, v7 ); \
     TRICE_LEAVE
 
 #define TRice32m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 36<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 36 ) \
     TRICE_PUT32_9( v0, v1, v2, v3, v4, v5, v6, v7, v8 ); \
     TRICE_LEAVE
 
 #define TRice32m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 40<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 40 ) \
     TRICE_PUT32_10( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ); \
     TRICE_LEAVE
 
 #define TRice32m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 44<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 44 ) \
     TRICE_PUT32_11( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ); \
     TRICE_LEAVE
 
 #define TRice32m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 48<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 48 ) \
     TRICE_PUT32_12( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_LEAVE
 
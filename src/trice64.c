@@ -11,234 +11,273 @@
 
 #if ENABLE_trice64fn_0 
 void trice64fn_0( uint16_t tid ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice64m_0( tid );
 }
 #endif
 
 #if ENABLE_trice64fn_1 
 void trice64fn_1( uint16_t tid, uint64_t v0 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice64m_1( tid, v0 );
 }
 #endif
 
 #if ENABLE_trice64fn_2
 void trice64fn_2( uint16_t tid,  uint64_t v0, uint64_t v1 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice64m_2( tid, v0, v1 );
 }
 #endif
 
 #if ENABLE_trice64fn_3
 void trice64fn_3( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice64m_3( tid, v0, v1, v2 );
 }
 #endif
 
 #if ENABLE_trice64fn_4
 void trice64fn_4( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice64m_4( tid, v0, v1, v2, v3 );
 }
 #endif
 
 #if ENABLE_trice64fn_5
 void trice64fn_5( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice64m_5( tid, v0, v1, v2, v3, v4 );
 }
 #endif
 
 #if ENABLE_trice64fn_6
 void trice64fn_6( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice64m_6( tid, v0, v1, v2, v3, v4, v5 );
 }
 #endif
 
 #if ENABLE_trice64fn_7
 void trice64fn_7( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice64m_7( tid, v0, v1, v2, v3, v4, v5, v6 );
 }
 #endif
 
 #if ENABLE_trice64fn_8
 void trice64fn_8( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice64m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 );
 }
 #endif
 
 #if ENABLE_trice64fn_9
 void trice64fn_9( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice64m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 );
 }
 #endif
 
 #if ENABLE_trice64fn_10
 void trice64fn_10( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice64m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 );
 }
 #endif
 
 #if ENABLE_trice64fn_11
 void trice64fn_11( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice64m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 );
 }
 #endif
 
 #if ENABLE_trice64fn_12
 void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice64m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 );
 }
 #endif
 
 #if ENABLE_Trice64fn_0
 void Trice64fn_0( uint16_t tid ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice64m_0( tid );
 }
 #endif
 
 #if ENABLE_Trice64fn_1
 void Trice64fn_1( uint16_t tid, uint64_t v0 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice64m_1( tid, v0 );
 }
 #endif
 
 #if ENABLE_Trice64fn_2
 void Trice64fn_2( uint16_t tid, uint64_t v0, uint64_t v1 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice64m_2( tid, v0, v1 );
 }
 #endif
 
 #if ENABLE_Trice64fn_3
 void Trice64fn_3( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice64m_3( tid, v0, v1, v2 );
 }
 #endif
 
 #if ENABLE_Trice64fn_4
 void Trice64fn_4( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice64m_4( tid, v0, v1, v2, v3 );
 }
 #endif
 
 #if ENABLE_Trice64fn_5
 void Trice64fn_5( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice64m_5( tid, v0, v1, v2, v3, v4 );
 }
 #endif
 
 #if ENABLE_Trice64fn_6
 void Trice64fn_6( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice64m_6( tid, v0, v1, v2, v3, v4, v5 );
 }
 #endif
 
 #if ENABLE_Trice64fn_7
 void Trice64fn_7( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice64m_7( tid, v0, v1, v2, v3, v4, v5, v6 );
 }
 #endif
 
 #if ENABLE_Trice64fn_8
 void Trice64fn_8( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice64m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 );
 }
 #endif
 
 #if ENABLE_Trice64fn_9
 void Trice64fn_9( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice64m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 );
 }
 #endif
 
 #if ENABLE_Trice64fn_10
 void Trice64fn_10( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice64m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 );
 }
 #endif
 
 #if ENABLE_Trice64fn_11
 void Trice64fn_11( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice64m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 );
 }
 #endif
 
 #if ENABLE_Trice64fn_12
 void Trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice64m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 );
 }
 #endif
 
 #if ENABLE_TRice64fn_0
 void TRice64fn_0( uint16_t tid ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice64m_0( tid );
 }
 #endif
 
 #if ENABLE_TRice64fn_1
 void TRice64fn_1( uint16_t tid, uint64_t v0 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice64m_1( tid, v0 );
 }
 #endif
 
 #if ENABLE_TRice64fn_2
 void TRice64fn_2( uint16_t tid,  uint64_t v0, uint64_t v1 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice64m_2( tid, v0, v1 );
 }
 #endif
 
 #if ENABLE_TRice64fn_3
 void TRice64fn_3( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice64m_3( tid, v0, v1, v2 );
 }
 #endif
 
 #if ENABLE_TRice64fn_4
 void TRice64fn_4( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice64m_4( tid, v0, v1, v2, v3 );
 }
 #endif
 
 #if ENABLE_TRice64fn_5
 void TRice64fn_5( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice64m_5( tid, v0, v1, v2, v3, v4 );
 }
 #endif
 
 #if ENABLE_TRice64fn_6
 void TRice64fn_6( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice64m_6( tid, v0, v1, v2, v3, v4, v5 );
 }
 #endif
 
 #if ENABLE_TRice64fn_7
 void TRice64fn_7( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice64m_7( tid, v0, v1, v2, v3, v4, v5, v6 );
 }
 #endif
 
 #if ENABLE_TRice64fn_8
 void TRice64fn_8( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice64m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 );
 }
 #endif
 
 #if ENABLE_TRice64fn_9
 void TRice64fn_9( uint16_t tid,  uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice64m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 );
 }
 #endif
 
 #if ENABLE_TRice64fn_10
 void TRice64fn_10( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice64m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 );
 }
 #endif
 
 #if ENABLE_TRice64fn_11
 void TRice64fn_11( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice64m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 );
 }
 #endif
 
 #if ENABLE_TRice64fn_12
 void TRice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice64m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 );
 }
 #endif
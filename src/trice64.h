@@ -20,7 +20,7 @@
 
 //!TRICE64_B expects inside pFmt only one format specifier, which is used n times by using pFmt n times.
 //! It is usable for showing n 64-bit values.
-#define TRICE64_B( id, pFmt, buf, n) do { TRICE_N( id, pFmt, buf, 8*n); } while(0)
+#define TRICE64_B( id, pFmt, buf, n) do { TRICE_NW( id, pFmt, buf, 8*n, 8); } while(0)
 
 //!TRICE64_F expects inside pFmt just a string which is assumed to be a remote function name.
 //! The trice tool displays the pFmt string followed by n times (64-bit value i).
@@ -225,7 +225,7 @@
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 #define trice64m_0( tid ) \
     TRICE_ENTER \
-    TRICE_PUT( (0<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (0<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_LEAVE
 
 //! trice64m_1 writes trice data as fast as possible in a buffer.
@@ -233,73 +233,73 @@
 //! \param v0 a 64 bit value
 #define trice64m_1( tid, v0 ) \
     TRICE_ENTER \
-    TRICE_PUT( (8<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (8<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT64_1( v0 ) \
     TRICE_LEAVE
 
 #define trice64m_2( tid, v0, v1 ) \
     TRICE_ENTER \
-    TRICE_PUT( (16<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (16<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT64_2( v0, v1); \
     TRICE_LEAVE
 
 #define trice64m_3( tid, v0, v1, v2 ) \
     TRICE_ENTER \
-    TRICE_PUT( (24<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (24<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT64_3 ( v0, v1, v2 ); \
     TRICE_LEAVE
 
 #define trice64m_4( tid, v0, v1, v2, v3 ) \
     TRICE_ENTER \
-    TRICE_PUT( (32<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (32<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT64_4( v0, v1, v2, v3 ); \
     TRICE_LEAVE
 
 #define trice64m_5( tid, v0, v1, v2, v3, v4 ) \
     TRICE_ENTER \
-    TRICE_PUT( (40<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (40<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT64_5( v0, v1, v2, v3, v4 ); \
     TRICE_LEAVE
 
 #define trice64m_6( tid, v0, v1, v2, v3, v4, v5 ) \
     TRICE_ENTER \
-    TRICE_PUT( (48<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (48<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT64_6( v0, v1, v2, v3, v4, v5 ); \
     TRICE_LEAVE
 
 #define trice64m_7( tid, v0, v1, v2, v3, v4, v5, v6 ) \
     TRICE_ENTER \
-    TRICE_PUT( (56<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (56<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT64_7( v0, v1, v2, v3, v4, v5, v6 ); \
     TRICE_LEAVE
 
 #define trice64m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 ) \
     TRICE_ENTER \
-    TRICE_PUT( (64<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(64)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT64_8( v0, v1, v2, v3, v4, v5, v6, v7 ); \
     TRICE_LEAVE
 
 #define trice64m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) \
     TRICE_ENTER \
-    TRICE_PUT( (72<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(72)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT64_9( v0, v1, v2, v3, v4, v5, v6, v7, v8 ); \
     TRICE_LEAVE
 
 #define trice64m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) \
     TRICE_ENTER \
-    TRICE_PUT( (80<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(80)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT64_10( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ); \
     TRICE_LEAVE
 
 #define trice64m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) \
     TRICE_ENTER \
-    TRICE_PUT( (88<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(88)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT64_11( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ); \
     TRICE_LEAVE
 
 #define trice64m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_ENTER \
-    TRICE_PUT( (96<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(96)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT64_12( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_LEAVE
 
@@ -353,7 +353,7 @@ void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
 
 #define Trice64m_0( tid ) \
     TRICE_ENTER \
-    TRICE_PUT( (0<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (0<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_LEAVE
 
 //! Trice64m_1 writes trice data as fast as possible in a buffer.
@@ -363,7 +363,7 @@ void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 8<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 8<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT64_1( v0 ) \
     TRICE_LEAVE
 
@@ -371,7 +371,7 @@ void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 16<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 16<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT64_2( v0, v1); \
     TRICE_LEAVE
 
@@ -379,7 +379,7 @@ void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 24<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 24<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT64_3 ( v0, v1, v2 ); \
     TRICE_LEAVE
 
@@ -387,7 +387,7 @@ void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 32<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 32<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT64_4( v0, v1, v2, v3 ); \
     TRICE_LEAVE
 
@@ -395,7 +395,7 @@ void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 40<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 40<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT64_5( v0, v1, v2, v3, v4 ); \
     TRICE_LEAVE
 
@@ -403,7 +403,7 @@ void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 48<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 48<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT64_6( v0, v1, v2, v3, v4, v5 ); \
     TRICE_LEAVE
 
@@ -411,7 +411,7 @@ void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 56<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 56<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT64_7( v0, v1, v2, v3, v4, v5, v6 ); \
     TRICE_LEAVE
 
@@ -419,7 +419,7 @@ void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 64<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(64)<<16) | ts ); \
     TRICE_PUT64_8( v0, v1, v2, v3, v4, v5, v6, v7 ); \
     TRICE_LEAVE
 
@@ -427,7 +427,7 @@ void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 72<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(72)<<16) | ts ); \
     TRICE_PUT64_9( v0, v1, v2, v3, v4, v5, v6, v7, v8 ); \
     TRICE_LEAVE
 
@@ -435,7 +435,7 @@ void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 80<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(80)<<16) | ts ); \
     TRICE_PUT64_10( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ); \
     TRICE_LEAVE
 
@@ -443,7 +443,7 @@ void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 88<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(88)<<16) | ts ); \
     TRICE_PUT64_11( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ); \
     TRICE_LEAVE
 
@@ -451,7 +451,7 @@ void trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 96<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(96)<<16) | ts ); \
     TRICE_PUT64_12( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_LEAVE
 
@@ -507,9 +507,7 @@ void Trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
 //! \param id is a 14 bit Trice id in upper 2 bytes of a 32 bit value
 #define TRice64m_0( tid ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 0<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 0 ) \
     TRICE_LEAVE
 
 
@@ -518,97 +516,73 @@ void Trice64fn_12( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t
 //! \param v0 a 64 bit value
 #define TRice64m_1( tid, v0 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 8<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 8 ) \
     TRICE_PUT64_1( v0 ) \
     TRICE_LEAVE
 
 #define TRice64m_2( tid, v0, v1 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 16<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 16 ) \
     TRICE_PUT64_2( v0, v1); \
     TRICE_LEAVE
 
 #define TRice64m_3( tid, v0, v1, v2 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 24<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 24 ) \
     TRICE_PUT64_3 ( v0, v1, v2 ); \
     TRICE_LEAVE
 
 #define TRice64m_4( tid, v0, v1, v2, v3 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 32<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 32 ) \
     TRICE_PUT64_4( v0, v1, v2, v3 ); \
     TRICE_LEAVE
 
 #define TRice64m_5( tid, v0, v1, v2, v3, v4 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 40<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 40 ) \
     TRICE_PUT64_5( v0, v1, v2, v3, v4 ); \
     TRICE_LEAVE
 
 #define TRice64m_6( tid, v0, v1, v2, v3, v4, v5 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 48<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 48 ) \
     TRICE_PUT64_6( v0, v1, v2, v3, v4, v5 ); \
     TRICE_LEAVE
 
 #define TRice64m_7( tid, v0, v1, v2, v3, v4, v5, v6 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 56<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 56 ) \
     TRICE_PUT64_7( v0, v1, v2, v3, v4, v5, v6 ); \
     TRICE_LEAVE
 
 #define TRice64m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 64<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 64 ) \
     TRICE_PUT64_8( v0, v1, v2, v3, v4, v5, v6, v7 ); \
     TRICE_LEAVE
 
 #define TRice64m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 72<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 72 ) \
     TRICE_PUT64_9( v0, v1, v2, v3, v4, v5, v6, v7, v8 ); \
     TRICE_LEAVE
 
 #define TRice64m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 80<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 80 ) \
     TRICE_PUT64_10( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ); \
     TRICE_LEAVE
 
 #define TRice64m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 88<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 88 ) \
     TRICE_PUT64_11( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ); \
     TRICE_LEAVE
 
 #define TRice64m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 96<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 96 ) \
     TRICE_PUT64_12( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_LEAVE
 
@@ -10,234 +10,273 @@
 
 #if ENABLE_trice8fn_0 
 void trice8fn_0( uint16_t tid ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice8m_0( tid );
 }
 #endif
 
 #if ENABLE_trice8fn_1 
 void trice8fn_1( uint16_t tid, uint8_t v0 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice8m_1( tid, v0 );
 }
 #endif
 
 #if ENABLE_trice8fn_2
 void trice8fn_2( uint16_t tid,  uint8_t v0, uint8_t v1 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice8m_2( tid, v0, v1 );
 }
 #endif
 
 #if ENABLE_trice8fn_3
 void trice8fn_3( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice8m_3( tid, v0, v1, v2 );
 }
 #endif
 
 #if ENABLE_trice8fn_4
 void trice8fn_4( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice8m_4( tid, v0, v1, v2, v3 );
 }
 #endif
 
 #if ENABLE_trice8fn_5
 void trice8fn_5( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice8m_5( tid, v0, v1, v2, v3, v4 );
 }
 #endif
 
 #if ENABLE_trice8fn_6
 void trice8fn_6( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice8m_6( tid, v0, v1, v2, v3, v4, v5 );
 }
 #endif
 
 #if ENABLE_trice8fn_7
 void trice8fn_7( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice8m_7( tid, v0, v1, v2, v3, v4, v5, v6 );
 }
 #endif
 
 #if ENABLE_trice8fn_8
 void trice8fn_8( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice8m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 );
 }
 #endif
 
 #if ENABLE_trice8fn_9
 void trice8fn_9( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice8m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 );
 }
 #endif
 
 #if ENABLE_trice8fn_10
 void trice8fn_10( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice8m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 );
 }
 #endif
 
 #if ENABLE_trice8fn_11
 void trice8fn_11( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice8m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 );
 }
 #endif
 
 #if ENABLE_trice8fn_12
 void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     trice8m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 );
 }
 #endif
 
 #if ENABLE_Trice8fn_0
 void Trice8fn_0( uint16_t tid ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice8m_0( tid );
 }
 #endif
 
 #if ENABLE_Trice8fn_1
 void Trice8fn_1( uint16_t tid, uint8_t v0 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice8m_1( tid, v0 );
 }
 #endif
 
 #if ENABLE_Trice8fn_2
 void Trice8fn_2( uint16_t tid, uint8_t v0, uint8_t v1 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice8m_2( tid, v0, v1 );
 }
 #endif
 
 #if ENABLE_Trice8fn_3
 void Trice8fn_3( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice8m_3( tid, v0, v1, v2 );
 }
 #endif
 
 #if ENABLE_Trice8fn_4
 void Trice8fn_4( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice8m_4( tid, v0, v1, v2, v3 );
 }
 #endif
 
 #if ENABLE_Trice8fn_5
 void Trice8fn_5( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice8m_5( tid, v0, v1, v2, v3, v4 );
 }
 #endif
 
 #if ENABLE_Trice8fn_6
 void Trice8fn_6( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice8m_6( tid, v0, v1, v2, v3, v4, v5 );
 }
 #endif
 
 #if ENABLE_Trice8fn_7
 void Trice8fn_7( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice8m_7( tid, v0, v1, v2, v3, v4, v5, v6 );
 }
 #endif
 
 #if ENABLE_Trice8fn_8
 void Trice8fn_8( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice8m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 );
 }
 #endif
 
 #if ENABLE_Trice8fn_9
 void Trice8fn_9( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice8m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 );
 }
 #endif
 
 #if ENABLE_Trice8fn_10
 void Trice8fn_10( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice8m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 );
 }
 #endif
 
 #if ENABLE_Trice8fn_11
 void Trice8fn_11( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice8m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 );
 }
 #endif
 
 #if ENABLE_Trice8fn_12
 void Trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     Trice8m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 );
 }
 #endif
 
 #if ENABLE_TRice8fn_0
 void TRice8fn_0( uint16_t tid ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice8m_0( tid );
 }
 #endif
 
 #if ENABLE_TRice8fn_1
 void TRice8fn_1( uint16_t tid, uint8_t v0 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice8m_1( tid, v0 );
 }
 #endif
 
 #if ENABLE_TRice8fn_2
 void TRice8fn_2( uint16_t tid,  uint8_t v0, uint8_t v1 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice8m_2( tid, v0, v1 );
 }
 #endif
 
 #if ENABLE_TRice8fn_3
 void TRice8fn_3( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice8m_3( tid, v0, v1, v2 );
 }
 #endif
 
 #if ENABLE_TRice8fn_4
 void TRice8fn_4( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice8m_4( tid, v0, v1, v2, v3 );
 }
 #endif
 
 #if ENABLE_TRice8fn_5
 void TRice8fn_5( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice8m_5( tid, v0, v1, v2, v3, v4 );
 }
 #endif
 
 #if ENABLE_TRice8fn_6
 void TRice8fn_6( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice8m_6( tid, v0, v1, v2, v3, v4, v5 );
 }
 #endif
 
 #if ENABLE_TRice8fn_7
 void TRice8fn_7( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice8m_7( tid, v0, v1, v2, v3, v4, v5, v6 );
 }
 #endif
 
 #if ENABLE_TRice8fn_8
 void TRice8fn_8( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice8m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 );
 }
 #endif
 
 #if ENABLE_TRice8fn_9
 void TRice8fn_9( uint16_t tid,  uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice8m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 );
 }
 #endif
 
 #if ENABLE_TRice8fn_10
 void TRice8fn_10( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice8m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 );
 }
 #endif
 
 #if ENABLE_TRice8fn_11
 void TRice8fn_11( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice8m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 );
 }
 #endif
 
 #if ENABLE_TRice8fn_12
 void TRice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
     TRice8m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 );
 }
 #endif
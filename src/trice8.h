@@ -173,7 +173,7 @@
 //! \param id is a 16 bit Trice id in upper 2 bytes of a 32 bit value
 #define trice8m_0( tid ) \
     TRICE_ENTER \
-    TRICE_PUT( (0<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (0<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_LEAVE
 
 //! trice8m_1 writes trice data as fast as possible in a buffer.
@@ -182,73 +182,73 @@
 //! \param v0 a 8 bit bit value
 #define trice8m_1( tid, v0 ) \
     TRICE_ENTER \
-    TRICE_PUT( (1<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (1<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT8_1( v0 ) \
     TRICE_LEAVE
 
 #define trice8m_2( tid, v0, v1 ) \
     TRICE_ENTER \
-    TRICE_PUT( (2<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (2<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT8_2( v0, v1); \
     TRICE_LEAVE
 
 #define trice8m_3( tid, v0, v1, v2 ) \
     TRICE_ENTER \
-    TRICE_PUT( (3<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (3<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT8_3 ( v0, v1, v2 ); \
     TRICE_LEAVE
 
 #define trice8m_4( tid, v0, v1, v2, v3 ) \
     TRICE_ENTER \
-    TRICE_PUT( (4<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (4<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT8_4( v0, v1, v2, v3 ); \
     TRICE_LEAVE
 
 #define trice8m_5( tid, v0, v1, v2, v3, v4 ) \
     TRICE_ENTER \
-    TRICE_PUT( (5<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (5<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT8_5( v0, v1, v2, v3, v4 ); \
     TRICE_LEAVE
 
 #define trice8m_6( tid, v0, v1, v2, v3, v4, v5 ) \
     TRICE_ENTER \
-    TRICE_PUT( (6<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (6<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT8_6( v0, v1, v2, v3, v4, v5 ); \
     TRICE_LEAVE
 
 #define trice8m_7( tid, v0, v1, v2, v3, v4, v5, v6 ) \
     TRICE_ENTER \
-    TRICE_PUT( (7<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (7<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT8_7( v0, v1, v2, v3, v4, v5, v6 ); \
     TRICE_LEAVE
 
 #define trice8m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 ) \
     TRICE_ENTER \
-    TRICE_PUT( (8<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (8<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT8_8( v0, v1, v2, v3, v4, v5, v6, v7 ); \
     TRICE_LEAVE
 
 #define trice8m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) \
     TRICE_ENTER \
-    TRICE_PUT( (9<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (9<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT8_9( v0, v1, v2, v3, v4, v5, v6, v7, v8 ); \
     TRICE_LEAVE
 
 #define trice8m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) \
     TRICE_ENTER \
-    TRICE_PUT( (10<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (10<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT8_10( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ); \
     TRICE_LEAVE
 
 #define trice8m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) \
     TRICE_ENTER \
-    TRICE_PUT( (11<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (11<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT8_11( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ); \
     TRICE_LEAVE
 
 #define trice8m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_ENTER \
-    TRICE_PUT( (12<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT_HEAD( (12<<24) | ((TRICE_CYCLE)<<16) | (0x4000|(tid)) ); \
     TRICE_PUT8_12( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_LEAVE
 
@@ -307,7 +307,7 @@ void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 0<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 0<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_LEAVE
 
 //! Trice8m_1 writes trice data as fast as possible in a buffer.
@@ -318,7 +318,7 @@ void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 1<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 1<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT8_1( v0 ) \
     TRICE_LEAVE
 
@@ -326,7 +326,7 @@ void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 2<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 2<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT8_2( v0, v1); \
     TRICE_LEAVE
 
@@ -334,7 +334,7 @@ void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 3<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 3<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT8_3 ( v0, v1, v2 ); \
     TRICE_LEAVE
 
@@ -342,7 +342,7 @@ void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 4<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 4<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT8_4( v0, v1, v2, v3 ); \
     TRICE_LEAVE
 
@@ -350,7 +350,7 @@ void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 5<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 5<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT8_5( v0, v1, v2, v3, v4 ); \
     TRICE_LEAVE
 
@@ -358,7 +358,7 @@ void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 6<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 6<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT8_6( v0, v1, v2, v3, v4, v5 ); \
     TRICE_LEAVE
 
@@ -366,7 +366,7 @@ void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 7<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 7<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT8_7( v0, v1, v2, v3, v4, v5, v6 ); \
     TRICE_LEAVE
 
@@ -374,7 +374,7 @@ void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 8<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 8<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT8_8( v0, v1, v2, v3, v4, v5, v6, v7 ); \
     TRICE_LEAVE
 
@@ -382,7 +382,7 @@ void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 9<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 9<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT8_9( v0, v1, v2, v3, v4, v5, v6, v7, v8 ); \
     TRICE_LEAVE
 
@@ -390,7 +390,7 @@ void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 10<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 10<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT8_10( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ); \
     TRICE_LEAVE
 
@@ -398,7 +398,7 @@ void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 11<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 11<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT8_11( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ); \
     TRICE_LEAVE
 
@@ -406,7 +406,7 @@ void trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
     TRICE_ENTER \
     uint16_t ts = TriceStamp16(); \
     TRICE_PUT(0x80008000|(tid<<16)|tid); \
-    TRICE_PUT( 12<<24 | (TRICE_CYCLE<<16) | ts ); \
+    TRICE_PUT_HEAD( 12<<24 | (TRICE_CYCLE<<16) | ts ); \
     TRICE_PUT8_12( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_LEAVE
 
@@ -462,9 +462,7 @@ void Trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
 //! \param id is a 14 bit Trice id in upper 2 bytes of a 32 bit value
 #define TRice8m_0( tid ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 0<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 0 ) \
     TRICE_LEAVE
 
 //! TRice8m_1 writes trice data as fast as possible in a buffer.
@@ -472,97 +470,73 @@ void Trice8fn_12( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3,
 //! \param v0 a 8 bit bit value
 #define TRice8m_1( tid, v0 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 1<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 1 ) \
     TRICE_PUT8_1( v0 ) \
     TRICE_LEAVE
 
 #define TRice8m_2( tid, v0, v1 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 2<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 2 ) \
     TRICE_PUT8_2( v0, v1); \
     TRICE_LEAVE
 
 #define TRice8m_3( tid, v0, v1, v2 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 3<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 3 ) \
     TRICE_PUT8_3 ( v0, v1, v2 ); \
     TRICE_LEAVE
 
 #define TRice8m_4( tid, v0, v1, v2, v3 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 4<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 4 ) \
     TRICE_PUT8_4( v0, v1, v2, v3 ); \
     TRICE_LEAVE
 
 #define TRice8m_5( tid, v0, v1, v2, v3, v4 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 5<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 5 ) \
     TRICE_PUT8_5( v0, v1, v2, v3, v4 ); \
     TRICE_LEAVE
 
 #define TRice8m_6( tid, v0, v1, v2, v3, v4, v5 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 6<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 6 ) \
     TRICE_PUT8_6( v0, v1, v2, v3, v4, v5 ); \
     TRICE_LEAVE
 
 #define TRice8m_7( tid, v0, v1, v2, v3, v4, v5, v6 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 7<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 7 ) \
     TRICE_PUT8_7( v0, v1, v2, v3, v4, v5, v6 ); \
     TRICE_LEAVE
 
 #define TRice8m_8( tid, v0, v1, v2, v3, v4, v5, v6, v7 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 8<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 8 ) \
     TRICE_PUT8_8( v0, v1, v2, v3, v4, v5, v6, v7 ); \
     TRICE_LEAVE
 
 #define TRice8m_9( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 9<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 9 ) \
     TRICE_PUT8_9( v0, v1, v2, v3, v4, v5, v6, v7, v8 ); \
     TRICE_LEAVE
 
 #define TRice8m_10( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 10<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 10 ) \
     TRICE_PUT8_10( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9 ); \
     TRICE_LEAVE
 
 #define TRice8m_11( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 11<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 11 ) \
     TRICE_PUT8_11( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10 ); \
     TRICE_LEAVE
 
 #define TRice8m_12( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_ENTER \
-    uint32_t ts = TRICE_HTOTL(TriceStamp32()); \
-    TRICE_PUT((ts<<16) | 0xc000 | tid); \
-    TRICE_PUT( 12<<24 | (TRICE_CYCLE<<16) | (ts>>16) ); \
+    TRICE_PUT_ID_TS( tid, 12 ) \
     TRICE_PUT8_12( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11 ) \
     TRICE_LEAVE
 
@@ -7,8 +7,169 @@
 
 static void TriceOut( uint32_t* tb, size_t tLen );
 
-//! triceBuffer is a double buffer for better write speed.
-static uint32_t triceBuffer[2][TRICE_DEFERRED_BUFFER_SIZE/8] = {0}; 
+//! triceBuffer is a double buffer for better write speed. With TRICE_CORE_COUNT > 1 each core has its own double buffer.
+static uint32_t triceBuffer[2*TRICE_CORE_COUNT][TRICE_DEFERRED_BUFFER_SIZE/8] = {0}; 
+
+#if TRICE_DIAGNOSTICS == 1
+
+//! TriceHalfBufferDepthMax is a diagnostics value usable to optimize buffer size.
+unsigned TriceHalfBufferDepthMax = 0; 
+
+#if TRICE_DOUBLE_BUFFER_LOCK_FREE == 1
+
+//! TriceSingleMaxWordCount is a diagnostics value usable to optimize buffer size. The writers update it with TRICE_DIAGNOSTICS_MAX.
+atomic_uint TriceSingleMaxWordCount = 0;
+
+//! TriceCriticalSectionCyclesMax is the max TRICE_CPU_CYCLES count of the space reservation, when TRICE_CPU_CYCLES is defined.
+atomic_uint TriceCriticalSectionCyclesMax = 0;
+
+#else // #if TRICE_DOUBLE_BUFFER_LOCK_FREE == 1
+
+//! TriceSingleMaxWordCount is a diagnostics value usable to optimize buffer size.
+unsigned TriceSingleMaxWordCount = 0;
+
+//! TriceCriticalSectionCyclesMax is the max TRICE_CPU_CYCLES count inside a critical section, when TRICE_CPU_CYCLES is defined.
+unsigned TriceCriticalSectionCyclesMax = 0;
+
+#endif // #else // #if TRICE_DOUBLE_BUFFER_LOCK_FREE == 1
+
+#endif
+
+#if TRICE_DOUBLE_BUFFER_LOCK_FREE == 1
+
+#ifdef XTEA_ENCRYPT_KEY
+
+//! TRICE_HALF_BUFFER_LIMIT is the usable uint32 count of a half buffer. Behind the trices up to 7 bytes can be used as scratch pad.
+#define TRICE_HALF_BUFFER_LIMIT ((TRICE_DEFERRED_BUFFER_SIZE/8) - 2)
+
+#else // #ifdef XTEA_ENCRYPT_KEY
+
+//! TRICE_HALF_BUFFER_LIMIT is the usable uint32 count of a half buffer.
+#define TRICE_HALF_BUFFER_LIMIT (TRICE_DEFERRED_BUFFER_SIZE/8)
+
+#endif // #else // #ifdef XTEA_ENCRYPT_KEY
+
+#if TRICE_CORE_COUNT > 1
+
+//! TRICE_HALF_BUFFER_START is the uint32 index of the first trice in a half buffer. The 2 words in front are for the TRICE_CORE_TAG_ID trice.
+#define TRICE_HALF_BUFFER_START ((TRICE_DATA_OFFSET>>2) + 2)
+
+//! TRICE_CORE is the index of the calling core.
+#define TRICE_CORE TriceCoreId()
+
+#else // #if TRICE_CORE_COUNT > 1
+
+//! TRICE_HALF_BUFFER_START is the uint32 index of the first trice in a half buffer.
+#define TRICE_HALF_BUFFER_START (TRICE_DATA_OFFSET>>2)
+
+//! TRICE_CORE is the index of the calling core.
+#define TRICE_CORE 0
+
+#endif // #else // #if TRICE_CORE_COUNT > 1
+
+//! TRICE_HALF_BUFFER_WORDS is the uint32 count usable for trices in a half buffer.
+#define TRICE_HALF_BUFFER_WORDS (TRICE_HALF_BUFFER_LIMIT - TRICE_HALF_BUFFER_START)
+
+//! triceActive holds for each core the index 0 or 1 of the half buffer, where the writers reserve space. Only TriceTransfer changes it.
+static atomic_uint triceActive[TRICE_CORE_COUNT];
+
+//! triceWriteCount holds for each core and half buffer the reserved uint32 count behind TRICE_HALF_BUFFER_START.
+static atomic_uint triceWriteCount[TRICE_CORE_COUNT][2];
+
+//! triceWriters holds for each core and half buffer the count of writers in flight.
+static atomic_uint triceWriters[TRICE_CORE_COUNT][2];
+
+//! triceReadPending holds for each core 1, when the half buffer !triceActive is flipped, but not transferred yet, because of writers in flight.
+static int triceReadPending[TRICE_CORE_COUNT];
+
+//! triceCoreNext is the core TriceTransfer looks at first.
+static unsigned triceCoreNext = 0;
+
+//! TriceDoubleBufferOverflowCount is the count of dropped trices, because the active half buffer was full.
+atomic_uint TriceDoubleBufferOverflowCount = 0;
+
+//! TriceDoubleBufferPush copies the trice at pData with wordCount uint32 values into the active half buffer of the calling core.
+//! The writer registers first in the writer count of the active half buffer, what keeps TriceTransfer from encoding it.
+//! Then the space is reserved with a compare-and-swap loop. A trice not fitting is dropped.
+void TriceDoubleBufferPush( uint32_t const* pData, unsigned wordCount ){
+    TRICE_DIAGNOSTICS_CS_START
+    unsigned core = TRICE_CORE;
+    unsigned active;
+    for(;;){
+        active = atomic_load( &triceActive[core] );
+        atomic_fetch_add( &triceWriters[core][active], 1 );
+        if( active == atomic_load( &triceActive[core] ) ){
+            break;
+        }
+        atomic_fetch_sub( &triceWriters[core][active], 1 ); // TriceTransfer flipped meanwhile
+    }
+    unsigned pos = atomic_load( &triceWriteCount[core][active] );
+    do{
+        if( pos + wordCount > TRICE_HALF_BUFFER_WORDS ){
+            atomic_fetch_sub( &triceWriters[core][active], 1 );
+            atomic_fetch_add( &TriceDoubleBufferOverflowCount, 1 );
+            return;
+        }
+    }while( !atomic_compare_exchange_weak( &triceWriteCount[core][active], &pos, pos + wordCount ) );
+    TRICE_DIAGNOSTICS_CS_STOP
+    memcpy( &triceBuffer[2*core + active][TRICE_HALF_BUFFER_START + pos], pData, wordCount<<2 );
+    atomic_fetch_sub( &triceWriters[core][active], 1 );
+}
+
+//! triceCoreTransfer, if possible, flips the double buffer of core and initiates a write. It returns 1, when a write was initiated.
+//! When writers are still in flight inside the flipped half buffer, the write is done with a later call.
+static int triceCoreTransfer( unsigned core ){
+    unsigned active = atomic_load( &triceActive[core] );
+    if( !triceReadPending[core] ){
+        if( atomic_load( &triceWriteCount[core][active] ) == 0 ){ // nothing to transfer
+            return 0;
+        }
+        atomic_store( &triceWriteCount[core][!active], 0 ); // The last read buffer is transferred completely.
+        atomic_store( &triceActive[core], !active );
+        active = !active;
+        triceReadPending[core] = 1;
+    }
+    if( atomic_load( &triceWriters[core][!active] ) ){ // writers in flight
+        return 0;
+    }
+    triceReadPending[core] = 0;
+    uint32_t* tb = triceBuffer[2*core + !active];
+    #if TRICE_CORE_COUNT > 1
+    uint32_t* TriceBufferWritePosition = &tb[TRICE_DATA_OFFSET>>2];
+    TRICE_PUT_HEAD( (4<<24) | ((TRICE_CYCLE)<<16) | (0x4000|TRICE_CORE_TAG_ID) );
+    TRICE_PUT( core );
+    #endif
+    size_t tLen = ((TRICE_HALF_BUFFER_START + atomic_load( &triceWriteCount[core][!active] ))<<2) - TRICE_DATA_OFFSET; // tlen is always a multiple of 4
+    TriceOut( tb, tLen );
+    return 1;
+}
+
+//! TriceDepth returns the reserved byte count inside the active half buffer of the calling core.
+size_t TriceDepth( void ){
+    unsigned core = TRICE_CORE;
+    return atomic_load( &triceWriteCount[core][atomic_load( &triceActive[core] )] )<<2;
+}
+
+//! TriceTransfer, if possible, flips the double buffer of the next core with data and initiates a write.
+//! The cores are served round robin, so each transfer contains the trices of a single core only.
+//! It is the resposibility of the app to call this function once every 10-100 milliseconds.
+void TriceTransfer( void ){
+    #if TRICE_DIRECT_COALESCE_SIZE > 0
+    TriceFlush(); // The TriceTransfer period limits the direct output coalescing time.
+    #endif
+    if( TriceOutDepth() ){ // transmission not done yet
+        return;
+    }
+    for( unsigned i = 0; i < TRICE_CORE_COUNT; i++ ){
+        unsigned core = triceCoreNext;
+        triceCoreNext = core + 1 < TRICE_CORE_COUNT ? core + 1 : 0;
+        if( triceCoreTransfer( core ) ){
+            return;
+        }
+    }
+}
+
+#else // #if TRICE_DOUBLE_BUFFER_LOCK_FREE == 1
 
 //! triceSwap is the index of the active write buffer. !triceSwap is the active read buffer index.
 static int triceSwap = 0;
@@ -22,22 +183,15 @@ uint32_t* TriceBufferLastWritePosition;
 //! triceBufferWriteLimit is the triceBuffer written limit. 
 static uint32_t* triceBufferWriteLimit = &triceBuffer[1][TRICE_DATA_OFFSET>>2];
 
-#if TRICE_DIAGNOSTICS == 1
-
-//! TriceSingleMaxWordCount is a diagnostics value usable to optimize buffer size.
-unsigned TriceSingleMaxWordCount = 0;
-
-//! TriceHalfBufferDepthMax is a diagnostics value usable to optimize buffer size.
-unsigned TriceHalfBufferDepthMax = 0; 
-
-#endif
 
 //! triceBufferSwap swaps the trice double buffer and returns the read buffer address.
 static uint32_t* triceBufferSwap( void ){
     TRICE_ENTER_CRITICAL_SECTION
+    TRICE_DIAGNOSTICS_CS_START
     triceBufferWriteLimit = TriceBufferWritePosition; // keep end position
     triceSwap = !triceSwap; // exchange the 2 buffers
     TriceBufferWritePosition = &triceBuffer[triceSwap][TRICE_DATA_OFFSET>>2]; // set write position for next TRICE
+    TRICE_DIAGNOSTICS_CS_STOP
     TRICE_LEAVE_CRITICAL_SECTION
     return &triceBuffer[!triceSwap][0]; //lint !e514
 }
@@ -50,9 +204,17 @@ static size_t triceDepth( uint32_t const* tb ){
     return depth - TRICE_DATA_OFFSET;
 }
 
+//! TriceDepth returns the written byte count inside the active half buffer.
+size_t TriceDepth( void ){
+    return ((TriceBufferWritePosition - &triceBuffer[triceSwap][0])<<2) - TRICE_DATA_OFFSET;
+}
+
 //! TriceTransfer, if possible, swaps the double buffer and initiates a write.
 //! It is the resposibility of the app to call this function once every 10-100 milliseconds.
 void TriceTransfer( void ){
+    #if TRICE_DIRECT_COALESCE_SIZE > 0
+    TriceFlush(); // The TriceTransfer period limits the direct output coalescing time.
+    #endif
     if( 0 == TriceOutDepth() ){ // transmission done for slowest output channel, so a swap is possible
         uint32_t* tb = triceBufferSwap(); 
         size_t tLen = triceDepth(tb); // tlen is always a multiple of 4
@@ -62,6 +224,8 @@ void TriceTransfer( void ){
     } // else: transmission not done yet
 }
 
+#endif // #else // #if TRICE_DOUBLE_BUFFER_LOCK_FREE == 1
+
 //! TriceOut encodes trices and writes them in one step to the output.
 //! This function is called only, when the slowest deferred output device has finished its last buffer.
 //! At the half buffer start tb,ls -l are TRICE_DATA_OFFSET bytes space followed by a number of trice messages which all contain
@@ -0,0 +1,1546 @@
+//! \file triceMaxParams.c
+//! ///////////////////////////////////////////////////////////////////////////
+
+//! generated code - do not edit! Created with "trice generate -max 32".
+
+#include "trice.h"
+
+#if TRICE_MAX_PARAM_COUNT > 12
+
+#if TRICE_8_BIT_SUPPORT
+
+#if TRICE_MAX_PARAM_COUNT >= 13
+
+void trice8fn_13( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 );
+}
+
+void Trice8fn_13( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 );
+}
+
+void TRice8fn_13( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 13
+
+#if TRICE_MAX_PARAM_COUNT >= 14
+
+void trice8fn_14( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 );
+}
+
+void Trice8fn_14( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 );
+}
+
+void TRice8fn_14( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 14
+
+#if TRICE_MAX_PARAM_COUNT >= 15
+
+void trice8fn_15( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 );
+}
+
+void Trice8fn_15( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 );
+}
+
+void TRice8fn_15( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 15
+
+#if TRICE_MAX_PARAM_COUNT >= 16
+
+void trice8fn_16( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 );
+}
+
+void Trice8fn_16( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 );
+}
+
+void TRice8fn_16( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 16
+
+#if TRICE_MAX_PARAM_COUNT >= 17
+
+void trice8fn_17( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 );
+}
+
+void Trice8fn_17( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 );
+}
+
+void TRice8fn_17( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 17
+
+#if TRICE_MAX_PARAM_COUNT >= 18
+
+void trice8fn_18( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 );
+}
+
+void Trice8fn_18( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 );
+}
+
+void TRice8fn_18( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 18
+
+#if TRICE_MAX_PARAM_COUNT >= 19
+
+void trice8fn_19( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 );
+}
+
+void Trice8fn_19( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 );
+}
+
+void TRice8fn_19( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 19
+
+#if TRICE_MAX_PARAM_COUNT >= 20
+
+void trice8fn_20( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 );
+}
+
+void Trice8fn_20( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 );
+}
+
+void TRice8fn_20( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 20
+
+#if TRICE_MAX_PARAM_COUNT >= 21
+
+void trice8fn_21( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 );
+}
+
+void Trice8fn_21( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 );
+}
+
+void TRice8fn_21( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 21
+
+#if TRICE_MAX_PARAM_COUNT >= 22
+
+void trice8fn_22( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 );
+}
+
+void Trice8fn_22( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 );
+}
+
+void TRice8fn_22( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 22
+
+#if TRICE_MAX_PARAM_COUNT >= 23
+
+void trice8fn_23( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 );
+}
+
+void Trice8fn_23( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 );
+}
+
+void TRice8fn_23( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 23
+
+#if TRICE_MAX_PARAM_COUNT >= 24
+
+void trice8fn_24( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 );
+}
+
+void Trice8fn_24( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 );
+}
+
+void TRice8fn_24( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 24
+
+#if TRICE_MAX_PARAM_COUNT >= 25
+
+void trice8fn_25( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 );
+}
+
+void Trice8fn_25( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 );
+}
+
+void TRice8fn_25( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 25
+
+#if TRICE_MAX_PARAM_COUNT >= 26
+
+void trice8fn_26( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 );
+}
+
+void Trice8fn_26( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 );
+}
+
+void TRice8fn_26( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 26
+
+#if TRICE_MAX_PARAM_COUNT >= 27
+
+void trice8fn_27( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 );
+}
+
+void Trice8fn_27( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 );
+}
+
+void TRice8fn_27( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 27
+
+#if TRICE_MAX_PARAM_COUNT >= 28
+
+void trice8fn_28( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 );
+}
+
+void Trice8fn_28( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 );
+}
+
+void TRice8fn_28( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 28
+
+#if TRICE_MAX_PARAM_COUNT >= 29
+
+void trice8fn_29( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 );
+}
+
+void Trice8fn_29( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 );
+}
+
+void TRice8fn_29( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 29
+
+#if TRICE_MAX_PARAM_COUNT >= 30
+
+void trice8fn_30( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 );
+}
+
+void Trice8fn_30( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 );
+}
+
+void TRice8fn_30( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 30
+
+#if TRICE_MAX_PARAM_COUNT >= 31
+
+void trice8fn_31( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 );
+}
+
+void Trice8fn_31( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 );
+}
+
+void TRice8fn_31( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 31
+
+#if TRICE_MAX_PARAM_COUNT >= 32
+
+void trice8fn_32( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30, uint8_t v31 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice8m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 );
+}
+
+void Trice8fn_32( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30, uint8_t v31 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice8m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 );
+}
+
+void TRice8fn_32( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30, uint8_t v31 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice8m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 32
+
+#endif // #if TRICE_8_BIT_SUPPORT
+
+#if TRICE_16_BIT_SUPPORT
+
+#if TRICE_MAX_PARAM_COUNT >= 13
+
+void trice16fn_13( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 );
+}
+
+void Trice16fn_13( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 );
+}
+
+void TRice16fn_13( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 13
+
+#if TRICE_MAX_PARAM_COUNT >= 14
+
+void trice16fn_14( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 );
+}
+
+void Trice16fn_14( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 );
+}
+
+void TRice16fn_14( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 14
+
+#if TRICE_MAX_PARAM_COUNT >= 15
+
+void trice16fn_15( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 );
+}
+
+void Trice16fn_15( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 );
+}
+
+void TRice16fn_15( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 15
+
+#if TRICE_MAX_PARAM_COUNT >= 16
+
+void trice16fn_16( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 );
+}
+
+void Trice16fn_16( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 );
+}
+
+void TRice16fn_16( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 16
+
+#if TRICE_MAX_PARAM_COUNT >= 17
+
+void trice16fn_17( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 );
+}
+
+void Trice16fn_17( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 );
+}
+
+void TRice16fn_17( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 17
+
+#if TRICE_MAX_PARAM_COUNT >= 18
+
+void trice16fn_18( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 );
+}
+
+void Trice16fn_18( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 );
+}
+
+void TRice16fn_18( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 18
+
+#if TRICE_MAX_PARAM_COUNT >= 19
+
+void trice16fn_19( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 );
+}
+
+void Trice16fn_19( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 );
+}
+
+void TRice16fn_19( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 19
+
+#if TRICE_MAX_PARAM_COUNT >= 20
+
+void trice16fn_20( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 );
+}
+
+void Trice16fn_20( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 );
+}
+
+void TRice16fn_20( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 20
+
+#if TRICE_MAX_PARAM_COUNT >= 21
+
+void trice16fn_21( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 );
+}
+
+void Trice16fn_21( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 );
+}
+
+void TRice16fn_21( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 21
+
+#if TRICE_MAX_PARAM_COUNT >= 22
+
+void trice16fn_22( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 );
+}
+
+void Trice16fn_22( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 );
+}
+
+void TRice16fn_22( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 22
+
+#if TRICE_MAX_PARAM_COUNT >= 23
+
+void trice16fn_23( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 );
+}
+
+void Trice16fn_23( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 );
+}
+
+void TRice16fn_23( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 23
+
+#if TRICE_MAX_PARAM_COUNT >= 24
+
+void trice16fn_24( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 );
+}
+
+void Trice16fn_24( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 );
+}
+
+void TRice16fn_24( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 24
+
+#if TRICE_MAX_PARAM_COUNT >= 25
+
+void trice16fn_25( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 );
+}
+
+void Trice16fn_25( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 );
+}
+
+void TRice16fn_25( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 25
+
+#if TRICE_MAX_PARAM_COUNT >= 26
+
+void trice16fn_26( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 );
+}
+
+void Trice16fn_26( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 );
+}
+
+void TRice16fn_26( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 26
+
+#if TRICE_MAX_PARAM_COUNT >= 27
+
+void trice16fn_27( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 );
+}
+
+void Trice16fn_27( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 );
+}
+
+void TRice16fn_27( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 27
+
+#if TRICE_MAX_PARAM_COUNT >= 28
+
+void trice16fn_28( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 );
+}
+
+void Trice16fn_28( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 );
+}
+
+void TRice16fn_28( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 28
+
+#if TRICE_MAX_PARAM_COUNT >= 29
+
+void trice16fn_29( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 );
+}
+
+void Trice16fn_29( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 );
+}
+
+void TRice16fn_29( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 29
+
+#if TRICE_MAX_PARAM_COUNT >= 30
+
+void trice16fn_30( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 );
+}
+
+void Trice16fn_30( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 );
+}
+
+void TRice16fn_30( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 30
+
+#if TRICE_MAX_PARAM_COUNT >= 31
+
+void trice16fn_31( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29, uint16_t v30 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 );
+}
+
+void Trice16fn_31( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29, uint16_t v30 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 );
+}
+
+void TRice16fn_31( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29, uint16_t v30 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 31
+
+#if TRICE_MAX_PARAM_COUNT >= 32
+
+void trice16fn_32( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29, uint16_t v30, uint16_t v31 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice16m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 );
+}
+
+void Trice16fn_32( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29, uint16_t v30, uint16_t v31 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice16m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 );
+}
+
+void TRice16fn_32( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29, uint16_t v30, uint16_t v31 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice16m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 32
+
+#endif // #if TRICE_16_BIT_SUPPORT
+
+#if TRICE_32_BIT_SUPPORT
+
+#if TRICE_MAX_PARAM_COUNT >= 13
+
+void trice32fn_13( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 );
+}
+
+void Trice32fn_13( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 );
+}
+
+void TRice32fn_13( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 13
+
+#if TRICE_MAX_PARAM_COUNT >= 14
+
+void trice32fn_14( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 );
+}
+
+void Trice32fn_14( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 );
+}
+
+void TRice32fn_14( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 14
+
+#if TRICE_MAX_PARAM_COUNT >= 15
+
+void trice32fn_15( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 );
+}
+
+void Trice32fn_15( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 );
+}
+
+void TRice32fn_15( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 15
+
+#if TRICE_MAX_PARAM_COUNT >= 16
+
+void trice32fn_16( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 );
+}
+
+void Trice32fn_16( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 );
+}
+
+void TRice32fn_16( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 16
+
+#if TRICE_MAX_PARAM_COUNT >= 17
+
+void trice32fn_17( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 );
+}
+
+void Trice32fn_17( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 );
+}
+
+void TRice32fn_17( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 17
+
+#if TRICE_MAX_PARAM_COUNT >= 18
+
+void trice32fn_18( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 );
+}
+
+void Trice32fn_18( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 );
+}
+
+void TRice32fn_18( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 18
+
+#if TRICE_MAX_PARAM_COUNT >= 19
+
+void trice32fn_19( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 );
+}
+
+void Trice32fn_19( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 );
+}
+
+void TRice32fn_19( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 19
+
+#if TRICE_MAX_PARAM_COUNT >= 20
+
+void trice32fn_20( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 );
+}
+
+void Trice32fn_20( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 );
+}
+
+void TRice32fn_20( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 20
+
+#if TRICE_MAX_PARAM_COUNT >= 21
+
+void trice32fn_21( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 );
+}
+
+void Trice32fn_21( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 );
+}
+
+void TRice32fn_21( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 21
+
+#if TRICE_MAX_PARAM_COUNT >= 22
+
+void trice32fn_22( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 );
+}
+
+void Trice32fn_22( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 );
+}
+
+void TRice32fn_22( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 22
+
+#if TRICE_MAX_PARAM_COUNT >= 23
+
+void trice32fn_23( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 );
+}
+
+void Trice32fn_23( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 );
+}
+
+void TRice32fn_23( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 23
+
+#if TRICE_MAX_PARAM_COUNT >= 24
+
+void trice32fn_24( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 );
+}
+
+void Trice32fn_24( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 );
+}
+
+void TRice32fn_24( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 24
+
+#if TRICE_MAX_PARAM_COUNT >= 25
+
+void trice32fn_25( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 );
+}
+
+void Trice32fn_25( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 );
+}
+
+void TRice32fn_25( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 25
+
+#if TRICE_MAX_PARAM_COUNT >= 26
+
+void trice32fn_26( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 );
+}
+
+void Trice32fn_26( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 );
+}
+
+void TRice32fn_26( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 26
+
+#if TRICE_MAX_PARAM_COUNT >= 27
+
+void trice32fn_27( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 );
+}
+
+void Trice32fn_27( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 );
+}
+
+void TRice32fn_27( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 27
+
+#if TRICE_MAX_PARAM_COUNT >= 28
+
+void trice32fn_28( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 );
+}
+
+void Trice32fn_28( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 );
+}
+
+void TRice32fn_28( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 28
+
+#if TRICE_MAX_PARAM_COUNT >= 29
+
+void trice32fn_29( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 );
+}
+
+void Trice32fn_29( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 );
+}
+
+void TRice32fn_29( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 29
+
+#if TRICE_MAX_PARAM_COUNT >= 30
+
+void trice32fn_30( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 );
+}
+
+void Trice32fn_30( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 );
+}
+
+void TRice32fn_30( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 30
+
+#if TRICE_MAX_PARAM_COUNT >= 31
+
+void trice32fn_31( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29, uint32_t v30 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 );
+}
+
+void Trice32fn_31( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29, uint32_t v30 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 );
+}
+
+void TRice32fn_31( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29, uint32_t v30 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 31
+
+#if TRICE_MAX_PARAM_COUNT >= 32
+
+void trice32fn_32( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29, uint32_t v30, uint32_t v31 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice32m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 );
+}
+
+void Trice32fn_32( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29, uint32_t v30, uint32_t v31 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice32m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 );
+}
+
+void TRice32fn_32( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29, uint32_t v30, uint32_t v31 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice32m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 32
+
+#endif // #if TRICE_32_BIT_SUPPORT
+
+#if TRICE_64_BIT_SUPPORT
+
+#if TRICE_MAX_PARAM_COUNT >= 13
+
+void trice64fn_13( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 );
+}
+
+void Trice64fn_13( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 );
+}
+
+void TRice64fn_13( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 13
+
+#if TRICE_MAX_PARAM_COUNT >= 14
+
+void trice64fn_14( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 );
+}
+
+void Trice64fn_14( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 );
+}
+
+void TRice64fn_14( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 14
+
+#if TRICE_MAX_PARAM_COUNT >= 15
+
+void trice64fn_15( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 );
+}
+
+void Trice64fn_15( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 );
+}
+
+void TRice64fn_15( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 15
+
+#if TRICE_MAX_PARAM_COUNT >= 16
+
+void trice64fn_16( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 );
+}
+
+void Trice64fn_16( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 );
+}
+
+void TRice64fn_16( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 16
+
+#if TRICE_MAX_PARAM_COUNT >= 17
+
+void trice64fn_17( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 );
+}
+
+void Trice64fn_17( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 );
+}
+
+void TRice64fn_17( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 17
+
+#if TRICE_MAX_PARAM_COUNT >= 18
+
+void trice64fn_18( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 );
+}
+
+void Trice64fn_18( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 );
+}
+
+void TRice64fn_18( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 18
+
+#if TRICE_MAX_PARAM_COUNT >= 19
+
+void trice64fn_19( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 );
+}
+
+void Trice64fn_19( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 );
+}
+
+void TRice64fn_19( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 19
+
+#if TRICE_MAX_PARAM_COUNT >= 20
+
+void trice64fn_20( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 );
+}
+
+void Trice64fn_20( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 );
+}
+
+void TRice64fn_20( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 20
+
+#if TRICE_MAX_PARAM_COUNT >= 21
+
+void trice64fn_21( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 );
+}
+
+void Trice64fn_21( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 );
+}
+
+void TRice64fn_21( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 21
+
+#if TRICE_MAX_PARAM_COUNT >= 22
+
+void trice64fn_22( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 );
+}
+
+void Trice64fn_22( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 );
+}
+
+void TRice64fn_22( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 22
+
+#if TRICE_MAX_PARAM_COUNT >= 23
+
+void trice64fn_23( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 );
+}
+
+void Trice64fn_23( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 );
+}
+
+void TRice64fn_23( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 23
+
+#if TRICE_MAX_PARAM_COUNT >= 24
+
+void trice64fn_24( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 );
+}
+
+void Trice64fn_24( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 );
+}
+
+void TRice64fn_24( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 24
+
+#if TRICE_MAX_PARAM_COUNT >= 25
+
+void trice64fn_25( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 );
+}
+
+void Trice64fn_25( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 );
+}
+
+void TRice64fn_25( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 25
+
+#if TRICE_MAX_PARAM_COUNT >= 26
+
+void trice64fn_26( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 );
+}
+
+void Trice64fn_26( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 );
+}
+
+void TRice64fn_26( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 26
+
+#if TRICE_MAX_PARAM_COUNT >= 27
+
+void trice64fn_27( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 );
+}
+
+void Trice64fn_27( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 );
+}
+
+void TRice64fn_27( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 27
+
+#if TRICE_MAX_PARAM_COUNT >= 28
+
+void trice64fn_28( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 );
+}
+
+void Trice64fn_28( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 );
+}
+
+void TRice64fn_28( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 28
+
+#if TRICE_MAX_PARAM_COUNT >= 29
+
+void trice64fn_29( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 );
+}
+
+void Trice64fn_29( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 );
+}
+
+void TRice64fn_29( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 29
+
+#if TRICE_MAX_PARAM_COUNT >= 30
+
+void trice64fn_30( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 );
+}
+
+void Trice64fn_30( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 );
+}
+
+void TRice64fn_30( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 30
+
+#if TRICE_MAX_PARAM_COUNT >= 31
+
+void trice64fn_31( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29, uint64_t v30 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 );
+}
+
+void Trice64fn_31( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29, uint64_t v30 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 );
+}
+
+void TRice64fn_31( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29, uint64_t v30 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 31
+
+#if TRICE_MAX_PARAM_COUNT >= 32
+
+void trice64fn_32( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29, uint64_t v30, uint64_t v31 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    trice64m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 );
+}
+
+void Trice64fn_32( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29, uint64_t v30, uint64_t v31 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    Trice64m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 );
+}
+
+void TRice64fn_32( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29, uint64_t v30, uint64_t v31 ){
+    TRICE_RATE_LIMIT_CHECK( tid )
+    TRice64m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 );
+}
+
+#endif // #if TRICE_MAX_PARAM_COUNT >= 32
+
+#endif // #if TRICE_64_BIT_SUPPORT
+
+#endif // #if TRICE_MAX_PARAM_COUNT > 12
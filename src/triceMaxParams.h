@@ -0,0 +1,4942 @@
+//! \file triceMaxParams.h
+//! ///////////////////////////////////////////////////////////////////////////
+
+//! generated code - do not edit! Created with "trice generate -max 32".
+//! The macros and functions here extend the trice8.h ... trice64.h definitions up to 32 values.
+//! trice.h includes this file when TRICE_MAX_PARAM_COUNT is bigger than 12.
+
+#ifndef TRICE_MAX_PARAMS_H_
+#define TRICE_MAX_PARAMS_H_
+
+//! TRICE_GENERATED_MAX_PARAM_COUNT is the biggest value count of the trice macros generated here.
+#define TRICE_GENERATED_MAX_PARAM_COUNT 32
+
+//! NTH_ARGUMENT just evaluates to the 34th argument.
+#define NTH_ARGUMENT(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23, a24, a25, a26, a27, a28, a29, a30, a31, a32, a33, a34, ...) a34
+
+//! COUNT_ARGUMENTS evaluates to the number of arguments that are passed to the macro, here up to 32.
+#define COUNT_ARGUMENTS(...) NTH_ARGUMENT(dummy, ## __VA_ARGS__, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+
+///////////////////////////////////////////////////////////////////////////////
+// 8-bit values
+//
+
+//! TRICE_PUT8_13 writes 13 8-bit values.
+#define TRICE_PUT8_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE0(v12) );
+
+//! TRICE8_13 writes trice data as fast as possible in a buffer.
+#define TRICE8_13( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER tid; CNTC(13); \
+    TRICE_PUT8_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! trice8m_13 writes trice data as fast as possible in a buffer.
+#define trice8m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(13)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! Trice8m_13 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(13)<<16) | ts ); \
+    TRICE_PUT8_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! TRice8m_13 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 13 ) \
+    TRICE_PUT8_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_14 writes 14 8-bit values.
+#define TRICE_PUT8_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE1(v13) | TRICE_BYTE0(v12) );
+
+//! TRICE8_14 writes trice data as fast as possible in a buffer.
+#define TRICE8_14( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER tid; CNTC(14); \
+    TRICE_PUT8_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! trice8m_14 writes trice data as fast as possible in a buffer.
+#define trice8m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(14)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! Trice8m_14 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(14)<<16) | ts ); \
+    TRICE_PUT8_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! TRice8m_14 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 14 ) \
+    TRICE_PUT8_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_15 writes 15 8-bit values.
+#define TRICE_PUT8_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) );
+
+//! TRICE8_15 writes trice data as fast as possible in a buffer.
+#define TRICE8_15( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER tid; CNTC(15); \
+    TRICE_PUT8_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! trice8m_15 writes trice data as fast as possible in a buffer.
+#define trice8m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(15)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! Trice8m_15 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(15)<<16) | ts ); \
+    TRICE_PUT8_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! TRice8m_15 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 15 ) \
+    TRICE_PUT8_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_16 writes 16 8-bit values.
+#define TRICE_PUT8_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) );
+
+//! TRICE8_16 writes trice data as fast as possible in a buffer.
+#define TRICE8_16( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER tid; CNTC(16); \
+    TRICE_PUT8_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! trice8m_16 writes trice data as fast as possible in a buffer.
+#define trice8m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(16)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! Trice8m_16 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(16)<<16) | ts ); \
+    TRICE_PUT8_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! TRice8m_16 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 16 ) \
+    TRICE_PUT8_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_17 writes 17 8-bit values.
+#define TRICE_PUT8_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE0(v16) );
+
+//! TRICE8_17 writes trice data as fast as possible in a buffer.
+#define TRICE8_17( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER tid; CNTC(17); \
+    TRICE_PUT8_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! trice8m_17 writes trice data as fast as possible in a buffer.
+#define trice8m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(17)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! Trice8m_17 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(17)<<16) | ts ); \
+    TRICE_PUT8_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! TRice8m_17 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 17 ) \
+    TRICE_PUT8_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_18 writes 18 8-bit values.
+#define TRICE_PUT8_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE1(v17) | TRICE_BYTE0(v16) );
+
+//! TRICE8_18 writes trice data as fast as possible in a buffer.
+#define TRICE8_18( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER tid; CNTC(18); \
+    TRICE_PUT8_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! trice8m_18 writes trice data as fast as possible in a buffer.
+#define trice8m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(18)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! Trice8m_18 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(18)<<16) | ts ); \
+    TRICE_PUT8_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! TRice8m_18 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 18 ) \
+    TRICE_PUT8_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_19 writes 19 8-bit values.
+#define TRICE_PUT8_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) );
+
+//! TRICE8_19 writes trice data as fast as possible in a buffer.
+#define TRICE8_19( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER tid; CNTC(19); \
+    TRICE_PUT8_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! trice8m_19 writes trice data as fast as possible in a buffer.
+#define trice8m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(19)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! Trice8m_19 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(19)<<16) | ts ); \
+    TRICE_PUT8_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! TRice8m_19 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 19 ) \
+    TRICE_PUT8_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_20 writes 20 8-bit values.
+#define TRICE_PUT8_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE3(v19) | TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) );
+
+//! TRICE8_20 writes trice data as fast as possible in a buffer.
+#define TRICE8_20( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER tid; CNTC(20); \
+    TRICE_PUT8_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! trice8m_20 writes trice data as fast as possible in a buffer.
+#define trice8m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(20)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! Trice8m_20 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(20)<<16) | ts ); \
+    TRICE_PUT8_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! TRice8m_20 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 20 ) \
+    TRICE_PUT8_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_21 writes 21 8-bit values.
+#define TRICE_PUT8_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE3(v19) | TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) ); \
+    TRICE_PUT( TRICE_BYTE0(v20) );
+
+//! TRICE8_21 writes trice data as fast as possible in a buffer.
+#define TRICE8_21( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER tid; CNTC(21); \
+    TRICE_PUT8_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! trice8m_21 writes trice data as fast as possible in a buffer.
+#define trice8m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(21)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! Trice8m_21 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(21)<<16) | ts ); \
+    TRICE_PUT8_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! TRice8m_21 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 21 ) \
+    TRICE_PUT8_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_22 writes 22 8-bit values.
+#define TRICE_PUT8_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE3(v19) | TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) ); \
+    TRICE_PUT( TRICE_BYTE1(v21) | TRICE_BYTE0(v20) );
+
+//! TRICE8_22 writes trice data as fast as possible in a buffer.
+#define TRICE8_22( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER tid; CNTC(22); \
+    TRICE_PUT8_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! trice8m_22 writes trice data as fast as possible in a buffer.
+#define trice8m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(22)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! Trice8m_22 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(22)<<16) | ts ); \
+    TRICE_PUT8_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! TRice8m_22 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 22 ) \
+    TRICE_PUT8_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_23 writes 23 8-bit values.
+#define TRICE_PUT8_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE3(v19) | TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) ); \
+    TRICE_PUT( TRICE_BYTE2(v22) | TRICE_BYTE1(v21) | TRICE_BYTE0(v20) );
+
+//! TRICE8_23 writes trice data as fast as possible in a buffer.
+#define TRICE8_23( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER tid; CNTC(23); \
+    TRICE_PUT8_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! trice8m_23 writes trice data as fast as possible in a buffer.
+#define trice8m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(23)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! Trice8m_23 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(23)<<16) | ts ); \
+    TRICE_PUT8_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! TRice8m_23 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 23 ) \
+    TRICE_PUT8_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_24 writes 24 8-bit values.
+#define TRICE_PUT8_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE3(v19) | TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) ); \
+    TRICE_PUT( TRICE_BYTE3(v23) | TRICE_BYTE2(v22) | TRICE_BYTE1(v21) | TRICE_BYTE0(v20) );
+
+//! TRICE8_24 writes trice data as fast as possible in a buffer.
+#define TRICE8_24( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER tid; CNTC(24); \
+    TRICE_PUT8_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! trice8m_24 writes trice data as fast as possible in a buffer.
+#define trice8m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(24)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! Trice8m_24 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(24)<<16) | ts ); \
+    TRICE_PUT8_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! TRice8m_24 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 24 ) \
+    TRICE_PUT8_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_25 writes 25 8-bit values.
+#define TRICE_PUT8_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE3(v19) | TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) ); \
+    TRICE_PUT( TRICE_BYTE3(v23) | TRICE_BYTE2(v22) | TRICE_BYTE1(v21) | TRICE_BYTE0(v20) ); \
+    TRICE_PUT( TRICE_BYTE0(v24) );
+
+//! TRICE8_25 writes trice data as fast as possible in a buffer.
+#define TRICE8_25( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER tid; CNTC(25); \
+    TRICE_PUT8_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! trice8m_25 writes trice data as fast as possible in a buffer.
+#define trice8m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(25)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! Trice8m_25 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(25)<<16) | ts ); \
+    TRICE_PUT8_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! TRice8m_25 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 25 ) \
+    TRICE_PUT8_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_26 writes 26 8-bit values.
+#define TRICE_PUT8_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE3(v19) | TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) ); \
+    TRICE_PUT( TRICE_BYTE3(v23) | TRICE_BYTE2(v22) | TRICE_BYTE1(v21) | TRICE_BYTE0(v20) ); \
+    TRICE_PUT( TRICE_BYTE1(v25) | TRICE_BYTE0(v24) );
+
+//! TRICE8_26 writes trice data as fast as possible in a buffer.
+#define TRICE8_26( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER tid; CNTC(26); \
+    TRICE_PUT8_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! trice8m_26 writes trice data as fast as possible in a buffer.
+#define trice8m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(26)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! Trice8m_26 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(26)<<16) | ts ); \
+    TRICE_PUT8_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! TRice8m_26 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 26 ) \
+    TRICE_PUT8_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_27 writes 27 8-bit values.
+#define TRICE_PUT8_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE3(v19) | TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) ); \
+    TRICE_PUT( TRICE_BYTE3(v23) | TRICE_BYTE2(v22) | TRICE_BYTE1(v21) | TRICE_BYTE0(v20) ); \
+    TRICE_PUT( TRICE_BYTE2(v26) | TRICE_BYTE1(v25) | TRICE_BYTE0(v24) );
+
+//! TRICE8_27 writes trice data as fast as possible in a buffer.
+#define TRICE8_27( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER tid; CNTC(27); \
+    TRICE_PUT8_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! trice8m_27 writes trice data as fast as possible in a buffer.
+#define trice8m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(27)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! Trice8m_27 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(27)<<16) | ts ); \
+    TRICE_PUT8_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! TRice8m_27 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 27 ) \
+    TRICE_PUT8_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_28 writes 28 8-bit values.
+#define TRICE_PUT8_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE3(v19) | TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) ); \
+    TRICE_PUT( TRICE_BYTE3(v23) | TRICE_BYTE2(v22) | TRICE_BYTE1(v21) | TRICE_BYTE0(v20) ); \
+    TRICE_PUT( TRICE_BYTE3(v27) | TRICE_BYTE2(v26) | TRICE_BYTE1(v25) | TRICE_BYTE0(v24) );
+
+//! TRICE8_28 writes trice data as fast as possible in a buffer.
+#define TRICE8_28( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER tid; CNTC(28); \
+    TRICE_PUT8_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! trice8m_28 writes trice data as fast as possible in a buffer.
+#define trice8m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(28)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! Trice8m_28 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(28)<<16) | ts ); \
+    TRICE_PUT8_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! TRice8m_28 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 28 ) \
+    TRICE_PUT8_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_29 writes 29 8-bit values.
+#define TRICE_PUT8_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE3(v19) | TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) ); \
+    TRICE_PUT( TRICE_BYTE3(v23) | TRICE_BYTE2(v22) | TRICE_BYTE1(v21) | TRICE_BYTE0(v20) ); \
+    TRICE_PUT( TRICE_BYTE3(v27) | TRICE_BYTE2(v26) | TRICE_BYTE1(v25) | TRICE_BYTE0(v24) ); \
+    TRICE_PUT( TRICE_BYTE0(v28) );
+
+//! TRICE8_29 writes trice data as fast as possible in a buffer.
+#define TRICE8_29( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER tid; CNTC(29); \
+    TRICE_PUT8_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! trice8m_29 writes trice data as fast as possible in a buffer.
+#define trice8m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(29)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! Trice8m_29 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(29)<<16) | ts ); \
+    TRICE_PUT8_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! TRice8m_29 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 29 ) \
+    TRICE_PUT8_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_30 writes 30 8-bit values.
+#define TRICE_PUT8_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE3(v19) | TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) ); \
+    TRICE_PUT( TRICE_BYTE3(v23) | TRICE_BYTE2(v22) | TRICE_BYTE1(v21) | TRICE_BYTE0(v20) ); \
+    TRICE_PUT( TRICE_BYTE3(v27) | TRICE_BYTE2(v26) | TRICE_BYTE1(v25) | TRICE_BYTE0(v24) ); \
+    TRICE_PUT( TRICE_BYTE1(v29) | TRICE_BYTE0(v28) );
+
+//! TRICE8_30 writes trice data as fast as possible in a buffer.
+#define TRICE8_30( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER tid; CNTC(30); \
+    TRICE_PUT8_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! trice8m_30 writes trice data as fast as possible in a buffer.
+#define trice8m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(30)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! Trice8m_30 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(30)<<16) | ts ); \
+    TRICE_PUT8_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! TRice8m_30 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 30 ) \
+    TRICE_PUT8_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_31 writes 31 8-bit values.
+#define TRICE_PUT8_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE3(v19) | TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) ); \
+    TRICE_PUT( TRICE_BYTE3(v23) | TRICE_BYTE2(v22) | TRICE_BYTE1(v21) | TRICE_BYTE0(v20) ); \
+    TRICE_PUT( TRICE_BYTE3(v27) | TRICE_BYTE2(v26) | TRICE_BYTE1(v25) | TRICE_BYTE0(v24) ); \
+    TRICE_PUT( TRICE_BYTE2(v30) | TRICE_BYTE1(v29) | TRICE_BYTE0(v28) );
+
+//! TRICE8_31 writes trice data as fast as possible in a buffer.
+#define TRICE8_31( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER tid; CNTC(31); \
+    TRICE_PUT8_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! trice8m_31 writes trice data as fast as possible in a buffer.
+#define trice8m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(31)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! Trice8m_31 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(31)<<16) | ts ); \
+    TRICE_PUT8_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! TRice8m_31 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 31 ) \
+    TRICE_PUT8_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT8_32 writes 32 8-bit values.
+#define TRICE_PUT8_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_PUT( TRICE_BYTE3(v3) | TRICE_BYTE2(v2) | TRICE_BYTE1(v1) | TRICE_BYTE0(v0) ); \
+    TRICE_PUT( TRICE_BYTE3(v7) | TRICE_BYTE2(v6) | TRICE_BYTE1(v5) | TRICE_BYTE0(v4) ); \
+    TRICE_PUT( TRICE_BYTE3(v11) | TRICE_BYTE2(v10) | TRICE_BYTE1(v9) | TRICE_BYTE0(v8) ); \
+    TRICE_PUT( TRICE_BYTE3(v15) | TRICE_BYTE2(v14) | TRICE_BYTE1(v13) | TRICE_BYTE0(v12) ); \
+    TRICE_PUT( TRICE_BYTE3(v19) | TRICE_BYTE2(v18) | TRICE_BYTE1(v17) | TRICE_BYTE0(v16) ); \
+    TRICE_PUT( TRICE_BYTE3(v23) | TRICE_BYTE2(v22) | TRICE_BYTE1(v21) | TRICE_BYTE0(v20) ); \
+    TRICE_PUT( TRICE_BYTE3(v27) | TRICE_BYTE2(v26) | TRICE_BYTE1(v25) | TRICE_BYTE0(v24) ); \
+    TRICE_PUT( TRICE_BYTE3(v31) | TRICE_BYTE2(v30) | TRICE_BYTE1(v29) | TRICE_BYTE0(v28) );
+
+//! TRICE8_32 writes trice data as fast as possible in a buffer.
+#define TRICE8_32( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER tid; CNTC(32); \
+    TRICE_PUT8_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+//! trice8m_32 writes trice data as fast as possible in a buffer.
+#define trice8m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(32)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT8_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+//! Trice8m_32 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice8m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(32)<<16) | ts ); \
+    TRICE_PUT8_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+//! TRice8m_32 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice8m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 32 ) \
+    TRICE_PUT8_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+#ifdef TRICE_CLEAN
+
+#define trice8_13( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) //!< trice8_13 is a macro calling a function to reduce code size.
+#define trice8_14( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) //!< trice8_14 is a macro calling a function to reduce code size.
+#define trice8_15( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) //!< trice8_15 is a macro calling a function to reduce code size.
+#define trice8_16( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) //!< trice8_16 is a macro calling a function to reduce code size.
+#define trice8_17( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) //!< trice8_17 is a macro calling a function to reduce code size.
+#define trice8_18( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) //!< trice8_18 is a macro calling a function to reduce code size.
+#define trice8_19( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) //!< trice8_19 is a macro calling a function to reduce code size.
+#define trice8_20( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) //!< trice8_20 is a macro calling a function to reduce code size.
+#define trice8_21( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) //!< trice8_21 is a macro calling a function to reduce code size.
+#define trice8_22( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) //!< trice8_22 is a macro calling a function to reduce code size.
+#define trice8_23( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) //!< trice8_23 is a macro calling a function to reduce code size.
+#define trice8_24( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) //!< trice8_24 is a macro calling a function to reduce code size.
+#define trice8_25( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) //!< trice8_25 is a macro calling a function to reduce code size.
+#define trice8_26( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) //!< trice8_26 is a macro calling a function to reduce code size.
+#define trice8_27( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) //!< trice8_27 is a macro calling a function to reduce code size.
+#define trice8_28( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) //!< trice8_28 is a macro calling a function to reduce code size.
+#define trice8_29( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) //!< trice8_29 is a macro calling a function to reduce code size.
+#define trice8_30( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) //!< trice8_30 is a macro calling a function to reduce code size.
+#define trice8_31( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) //!< trice8_31 is a macro calling a function to reduce code size.
+#define trice8_32( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) //!< trice8_32 is a macro calling a function to reduce code size.
+#define Trice8_13( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) //!< Trice8_13 is a macro calling a function to reduce code size.
+#define Trice8_14( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) //!< Trice8_14 is a macro calling a function to reduce code size.
+#define Trice8_15( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) //!< Trice8_15 is a macro calling a function to reduce code size.
+#define Trice8_16( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) //!< Trice8_16 is a macro calling a function to reduce code size.
+#define Trice8_17( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) //!< Trice8_17 is a macro calling a function to reduce code size.
+#define Trice8_18( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) //!< Trice8_18 is a macro calling a function to reduce code size.
+#define Trice8_19( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) //!< Trice8_19 is a macro calling a function to reduce code size.
+#define Trice8_20( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) //!< Trice8_20 is a macro calling a function to reduce code size.
+#define Trice8_21( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) //!< Trice8_21 is a macro calling a function to reduce code size.
+#define Trice8_22( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) //!< Trice8_22 is a macro calling a function to reduce code size.
+#define Trice8_23( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) //!< Trice8_23 is a macro calling a function to reduce code size.
+#define Trice8_24( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) //!< Trice8_24 is a macro calling a function to reduce code size.
+#define Trice8_25( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) //!< Trice8_25 is a macro calling a function to reduce code size.
+#define Trice8_26( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) //!< Trice8_26 is a macro calling a function to reduce code size.
+#define Trice8_27( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) //!< Trice8_27 is a macro calling a function to reduce code size.
+#define Trice8_28( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) //!< Trice8_28 is a macro calling a function to reduce code size.
+#define Trice8_29( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) //!< Trice8_29 is a macro calling a function to reduce code size.
+#define Trice8_30( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) //!< Trice8_30 is a macro calling a function to reduce code size.
+#define Trice8_31( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) //!< Trice8_31 is a macro calling a function to reduce code size.
+#define Trice8_32( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) //!< Trice8_32 is a macro calling a function to reduce code size.
+#define TRice8_13( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) //!< TRice8_13 is a macro calling a function to reduce code size.
+#define TRice8_14( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) //!< TRice8_14 is a macro calling a function to reduce code size.
+#define TRice8_15( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) //!< TRice8_15 is a macro calling a function to reduce code size.
+#define TRice8_16( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) //!< TRice8_16 is a macro calling a function to reduce code size.
+#define TRice8_17( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) //!< TRice8_17 is a macro calling a function to reduce code size.
+#define TRice8_18( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) //!< TRice8_18 is a macro calling a function to reduce code size.
+#define TRice8_19( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) //!< TRice8_19 is a macro calling a function to reduce code size.
+#define TRice8_20( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) //!< TRice8_20 is a macro calling a function to reduce code size.
+#define TRice8_21( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) //!< TRice8_21 is a macro calling a function to reduce code size.
+#define TRice8_22( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) //!< TRice8_22 is a macro calling a function to reduce code size.
+#define TRice8_23( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) //!< TRice8_23 is a macro calling a function to reduce code size.
+#define TRice8_24( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) //!< TRice8_24 is a macro calling a function to reduce code size.
+#define TRice8_25( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) //!< TRice8_25 is a macro calling a function to reduce code size.
+#define TRice8_26( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) //!< TRice8_26 is a macro calling a function to reduce code size.
+#define TRice8_27( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) //!< TRice8_27 is a macro calling a function to reduce code size.
+#define TRice8_28( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) //!< TRice8_28 is a macro calling a function to reduce code size.
+#define TRice8_29( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) //!< TRice8_29 is a macro calling a function to reduce code size.
+#define TRice8_30( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) //!< TRice8_30 is a macro calling a function to reduce code size.
+#define TRice8_31( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) //!< TRice8_31 is a macro calling a function to reduce code size.
+#define TRice8_32( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) //!< TRice8_32 is a macro calling a function to reduce code size.
+
+#else // #ifdef TRICE_CLEAN
+
+#define trice8_13( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) trice8fn_13( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12) ) //!< trice8_13 is a macro calling a function to reduce code size.
+#define trice8_14( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) trice8fn_14( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13) ) //!< trice8_14 is a macro calling a function to reduce code size.
+#define trice8_15( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) trice8fn_15( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14) ) //!< trice8_15 is a macro calling a function to reduce code size.
+#define trice8_16( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) trice8fn_16( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15) ) //!< trice8_16 is a macro calling a function to reduce code size.
+#define trice8_17( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) trice8fn_17( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16) ) //!< trice8_17 is a macro calling a function to reduce code size.
+#define trice8_18( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) trice8fn_18( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17) ) //!< trice8_18 is a macro calling a function to reduce code size.
+#define trice8_19( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) trice8fn_19( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18) ) //!< trice8_19 is a macro calling a function to reduce code size.
+#define trice8_20( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) trice8fn_20( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19) ) //!< trice8_20 is a macro calling a function to reduce code size.
+#define trice8_21( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) trice8fn_21( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20) ) //!< trice8_21 is a macro calling a function to reduce code size.
+#define trice8_22( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) trice8fn_22( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21) ) //!< trice8_22 is a macro calling a function to reduce code size.
+#define trice8_23( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) trice8fn_23( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22) ) //!< trice8_23 is a macro calling a function to reduce code size.
+#define trice8_24( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) trice8fn_24( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23) ) //!< trice8_24 is a macro calling a function to reduce code size.
+#define trice8_25( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) trice8fn_25( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24) ) //!< trice8_25 is a macro calling a function to reduce code size.
+#define trice8_26( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) trice8fn_26( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25) ) //!< trice8_26 is a macro calling a function to reduce code size.
+#define trice8_27( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) trice8fn_27( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26) ) //!< trice8_27 is a macro calling a function to reduce code size.
+#define trice8_28( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) trice8fn_28( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27) ) //!< trice8_28 is a macro calling a function to reduce code size.
+#define trice8_29( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) trice8fn_29( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27), (uint8_t)(v28) ) //!< trice8_29 is a macro calling a function to reduce code size.
+#define trice8_30( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) trice8fn_30( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27), (uint8_t)(v28), (uint8_t)(v29) ) //!< trice8_30 is a macro calling a function to reduce code size.
+#define trice8_31( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) trice8fn_31( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27), (uint8_t)(v28), (uint8_t)(v29), (uint8_t)(v30) ) //!< trice8_31 is a macro calling a function to reduce code size.
+#define trice8_32( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) trice8fn_32( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27), (uint8_t)(v28), (uint8_t)(v29), (uint8_t)(v30), (uint8_t)(v31) ) //!< trice8_32 is a macro calling a function to reduce code size.
+#define Trice8_13( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) Trice8fn_13( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12) ) //!< Trice8_13 is a macro calling a function to reduce code size.
+#define Trice8_14( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) Trice8fn_14( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13) ) //!< Trice8_14 is a macro calling a function to reduce code size.
+#define Trice8_15( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) Trice8fn_15( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14) ) //!< Trice8_15 is a macro calling a function to reduce code size.
+#define Trice8_16( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) Trice8fn_16( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15) ) //!< Trice8_16 is a macro calling a function to reduce code size.
+#define Trice8_17( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) Trice8fn_17( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16) ) //!< Trice8_17 is a macro calling a function to reduce code size.
+#define Trice8_18( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) Trice8fn_18( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17) ) //!< Trice8_18 is a macro calling a function to reduce code size.
+#define Trice8_19( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) Trice8fn_19( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18) ) //!< Trice8_19 is a macro calling a function to reduce code size.
+#define Trice8_20( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) Trice8fn_20( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19) ) //!< Trice8_20 is a macro calling a function to reduce code size.
+#define Trice8_21( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) Trice8fn_21( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20) ) //!< Trice8_21 is a macro calling a function to reduce code size.
+#define Trice8_22( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) Trice8fn_22( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21) ) //!< Trice8_22 is a macro calling a function to reduce code size.
+#define Trice8_23( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) Trice8fn_23( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22) ) //!< Trice8_23 is a macro calling a function to reduce code size.
+#define Trice8_24( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) Trice8fn_24( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23) ) //!< Trice8_24 is a macro calling a function to reduce code size.
+#define Trice8_25( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) Trice8fn_25( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24) ) //!< Trice8_25 is a macro calling a function to reduce code size.
+#define Trice8_26( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) Trice8fn_26( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25) ) //!< Trice8_26 is a macro calling a function to reduce code size.
+#define Trice8_27( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) Trice8fn_27( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26) ) //!< Trice8_27 is a macro calling a function to reduce code size.
+#define Trice8_28( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) Trice8fn_28( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27) ) //!< Trice8_28 is a macro calling a function to reduce code size.
+#define Trice8_29( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) Trice8fn_29( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27), (uint8_t)(v28) ) //!< Trice8_29 is a macro calling a function to reduce code size.
+#define Trice8_30( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) Trice8fn_30( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27), (uint8_t)(v28), (uint8_t)(v29) ) //!< Trice8_30 is a macro calling a function to reduce code size.
+#define Trice8_31( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) Trice8fn_31( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27), (uint8_t)(v28), (uint8_t)(v29), (uint8_t)(v30) ) //!< Trice8_31 is a macro calling a function to reduce code size.
+#define Trice8_32( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) Trice8fn_32( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27), (uint8_t)(v28), (uint8_t)(v29), (uint8_t)(v30), (uint8_t)(v31) ) //!< Trice8_32 is a macro calling a function to reduce code size.
+#define TRice8_13( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) TRice8fn_13( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12) ) //!< TRice8_13 is a macro calling a function to reduce code size.
+#define TRice8_14( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) TRice8fn_14( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13) ) //!< TRice8_14 is a macro calling a function to reduce code size.
+#define TRice8_15( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) TRice8fn_15( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14) ) //!< TRice8_15 is a macro calling a function to reduce code size.
+#define TRice8_16( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) TRice8fn_16( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15) ) //!< TRice8_16 is a macro calling a function to reduce code size.
+#define TRice8_17( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) TRice8fn_17( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16) ) //!< TRice8_17 is a macro calling a function to reduce code size.
+#define TRice8_18( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) TRice8fn_18( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17) ) //!< TRice8_18 is a macro calling a function to reduce code size.
+#define TRice8_19( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) TRice8fn_19( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18) ) //!< TRice8_19 is a macro calling a function to reduce code size.
+#define TRice8_20( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) TRice8fn_20( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19) ) //!< TRice8_20 is a macro calling a function to reduce code size.
+#define TRice8_21( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) TRice8fn_21( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20) ) //!< TRice8_21 is a macro calling a function to reduce code size.
+#define TRice8_22( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) TRice8fn_22( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21) ) //!< TRice8_22 is a macro calling a function to reduce code size.
+#define TRice8_23( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) TRice8fn_23( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22) ) //!< TRice8_23 is a macro calling a function to reduce code size.
+#define TRice8_24( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) TRice8fn_24( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23) ) //!< TRice8_24 is a macro calling a function to reduce code size.
+#define TRice8_25( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) TRice8fn_25( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24) ) //!< TRice8_25 is a macro calling a function to reduce code size.
+#define TRice8_26( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) TRice8fn_26( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25) ) //!< TRice8_26 is a macro calling a function to reduce code size.
+#define TRice8_27( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) TRice8fn_27( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26) ) //!< TRice8_27 is a macro calling a function to reduce code size.
+#define TRice8_28( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) TRice8fn_28( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27) ) //!< TRice8_28 is a macro calling a function to reduce code size.
+#define TRice8_29( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) TRice8fn_29( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27), (uint8_t)(v28) ) //!< TRice8_29 is a macro calling a function to reduce code size.
+#define TRice8_30( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) TRice8fn_30( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27), (uint8_t)(v28), (uint8_t)(v29) ) //!< TRice8_30 is a macro calling a function to reduce code size.
+#define TRice8_31( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) TRice8fn_31( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27), (uint8_t)(v28), (uint8_t)(v29), (uint8_t)(v30) ) //!< TRice8_31 is a macro calling a function to reduce code size.
+#define TRice8_32( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) TRice8fn_32( tid, (uint8_t)(v0), (uint8_t)(v1), (uint8_t)(v2), (uint8_t)(v3), (uint8_t)(v4), (uint8_t)(v5), (uint8_t)(v6), (uint8_t)(v7), (uint8_t)(v8), (uint8_t)(v9), (uint8_t)(v10), (uint8_t)(v11), (uint8_t)(v12), (uint8_t)(v13), (uint8_t)(v14), (uint8_t)(v15), (uint8_t)(v16), (uint8_t)(v17), (uint8_t)(v18), (uint8_t)(v19), (uint8_t)(v20), (uint8_t)(v21), (uint8_t)(v22), (uint8_t)(v23), (uint8_t)(v24), (uint8_t)(v25), (uint8_t)(v26), (uint8_t)(v27), (uint8_t)(v28), (uint8_t)(v29), (uint8_t)(v30), (uint8_t)(v31) ) //!< TRice8_32 is a macro calling a function to reduce code size.
+
+void trice8fn_13( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12 );
+void trice8fn_14( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13 );
+void trice8fn_15( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14 );
+void trice8fn_16( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15 );
+void trice8fn_17( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16 );
+void trice8fn_18( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17 );
+void trice8fn_19( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18 );
+void trice8fn_20( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19 );
+void trice8fn_21( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20 );
+void trice8fn_22( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21 );
+void trice8fn_23( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22 );
+void trice8fn_24( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23 );
+void trice8fn_25( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24 );
+void trice8fn_26( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25 );
+void trice8fn_27( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26 );
+void trice8fn_28( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27 );
+void trice8fn_29( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28 );
+void trice8fn_30( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29 );
+void trice8fn_31( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30 );
+void trice8fn_32( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30, uint8_t v31 );
+void Trice8fn_13( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12 );
+void Trice8fn_14( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13 );
+void Trice8fn_15( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14 );
+void Trice8fn_16( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15 );
+void Trice8fn_17( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16 );
+void Trice8fn_18( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17 );
+void Trice8fn_19( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18 );
+void Trice8fn_20( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19 );
+void Trice8fn_21( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20 );
+void Trice8fn_22( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21 );
+void Trice8fn_23( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22 );
+void Trice8fn_24( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23 );
+void Trice8fn_25( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24 );
+void Trice8fn_26( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25 );
+void Trice8fn_27( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26 );
+void Trice8fn_28( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27 );
+void Trice8fn_29( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28 );
+void Trice8fn_30( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29 );
+void Trice8fn_31( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30 );
+void Trice8fn_32( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30, uint8_t v31 );
+void TRice8fn_13( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12 );
+void TRice8fn_14( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13 );
+void TRice8fn_15( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14 );
+void TRice8fn_16( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15 );
+void TRice8fn_17( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16 );
+void TRice8fn_18( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17 );
+void TRice8fn_19( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18 );
+void TRice8fn_20( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19 );
+void TRice8fn_21( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20 );
+void TRice8fn_22( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21 );
+void TRice8fn_23( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22 );
+void TRice8fn_24( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23 );
+void TRice8fn_25( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24 );
+void TRice8fn_26( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25 );
+void TRice8fn_27( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26 );
+void TRice8fn_28( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27 );
+void TRice8fn_29( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28 );
+void TRice8fn_30( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29 );
+void TRice8fn_31( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30 );
+void TRice8fn_32( uint16_t tid, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30, uint8_t v31 );
+
+#endif // #else // #ifdef TRICE_CLEAN
+
+#if TRICE_DEFAULT_PARAMETER_BIT_WIDTH == 8
+
+#define TRICE_13 TRICE8_13 //!< Default parameter bit width for 13 parameter count TRICE is 8.
+#define TRICE_14 TRICE8_14 //!< Default parameter bit width for 14 parameter count TRICE is 8.
+#define TRICE_15 TRICE8_15 //!< Default parameter bit width for 15 parameter count TRICE is 8.
+#define TRICE_16 TRICE8_16 //!< Default parameter bit width for 16 parameter count TRICE is 8.
+#define TRICE_17 TRICE8_17 //!< Default parameter bit width for 17 parameter count TRICE is 8.
+#define TRICE_18 TRICE8_18 //!< Default parameter bit width for 18 parameter count TRICE is 8.
+#define TRICE_19 TRICE8_19 //!< Default parameter bit width for 19 parameter count TRICE is 8.
+#define TRICE_20 TRICE8_20 //!< Default parameter bit width for 20 parameter count TRICE is 8.
+#define TRICE_21 TRICE8_21 //!< Default parameter bit width for 21 parameter count TRICE is 8.
+#define TRICE_22 TRICE8_22 //!< Default parameter bit width for 22 parameter count TRICE is 8.
+#define TRICE_23 TRICE8_23 //!< Default parameter bit width for 23 parameter count TRICE is 8.
+#define TRICE_24 TRICE8_24 //!< Default parameter bit width for 24 parameter count TRICE is 8.
+#define TRICE_25 TRICE8_25 //!< Default parameter bit width for 25 parameter count TRICE is 8.
+#define TRICE_26 TRICE8_26 //!< Default parameter bit width for 26 parameter count TRICE is 8.
+#define TRICE_27 TRICE8_27 //!< Default parameter bit width for 27 parameter count TRICE is 8.
+#define TRICE_28 TRICE8_28 //!< Default parameter bit width for 28 parameter count TRICE is 8.
+#define TRICE_29 TRICE8_29 //!< Default parameter bit width for 29 parameter count TRICE is 8.
+#define TRICE_30 TRICE8_30 //!< Default parameter bit width for 30 parameter count TRICE is 8.
+#define TRICE_31 TRICE8_31 //!< Default parameter bit width for 31 parameter count TRICE is 8.
+#define TRICE_32 TRICE8_32 //!< Default parameter bit width for 32 parameter count TRICE is 8.
+#define trice_13 trice8_13 //!< Default parameter bit width for 13 parameter count trice is 8.
+#define trice_14 trice8_14 //!< Default parameter bit width for 14 parameter count trice is 8.
+#define trice_15 trice8_15 //!< Default parameter bit width for 15 parameter count trice is 8.
+#define trice_16 trice8_16 //!< Default parameter bit width for 16 parameter count trice is 8.
+#define trice_17 trice8_17 //!< Default parameter bit width for 17 parameter count trice is 8.
+#define trice_18 trice8_18 //!< Default parameter bit width for 18 parameter count trice is 8.
+#define trice_19 trice8_19 //!< Default parameter bit width for 19 parameter count trice is 8.
+#define trice_20 trice8_20 //!< Default parameter bit width for 20 parameter count trice is 8.
+#define trice_21 trice8_21 //!< Default parameter bit width for 21 parameter count trice is 8.
+#define trice_22 trice8_22 //!< Default parameter bit width for 22 parameter count trice is 8.
+#define trice_23 trice8_23 //!< Default parameter bit width for 23 parameter count trice is 8.
+#define trice_24 trice8_24 //!< Default parameter bit width for 24 parameter count trice is 8.
+#define trice_25 trice8_25 //!< Default parameter bit width for 25 parameter count trice is 8.
+#define trice_26 trice8_26 //!< Default parameter bit width for 26 parameter count trice is 8.
+#define trice_27 trice8_27 //!< Default parameter bit width for 27 parameter count trice is 8.
+#define trice_28 trice8_28 //!< Default parameter bit width for 28 parameter count trice is 8.
+#define trice_29 trice8_29 //!< Default parameter bit width for 29 parameter count trice is 8.
+#define trice_30 trice8_30 //!< Default parameter bit width for 30 parameter count trice is 8.
+#define trice_31 trice8_31 //!< Default parameter bit width for 31 parameter count trice is 8.
+#define trice_32 trice8_32 //!< Default parameter bit width for 32 parameter count trice is 8.
+#define Trice_13 Trice8_13 //!< Default parameter bit width for 13 parameter count Trice is 8.
+#define Trice_14 Trice8_14 //!< Default parameter bit width for 14 parameter count Trice is 8.
+#define Trice_15 Trice8_15 //!< Default parameter bit width for 15 parameter count Trice is 8.
+#define Trice_16 Trice8_16 //!< Default parameter bit width for 16 parameter count Trice is 8.
+#define Trice_17 Trice8_17 //!< Default parameter bit width for 17 parameter count Trice is 8.
+#define Trice_18 Trice8_18 //!< Default parameter bit width for 18 parameter count Trice is 8.
+#define Trice_19 Trice8_19 //!< Default parameter bit width for 19 parameter count Trice is 8.
+#define Trice_20 Trice8_20 //!< Default parameter bit width for 20 parameter count Trice is 8.
+#define Trice_21 Trice8_21 //!< Default parameter bit width for 21 parameter count Trice is 8.
+#define Trice_22 Trice8_22 //!< Default parameter bit width for 22 parameter count Trice is 8.
+#define Trice_23 Trice8_23 //!< Default parameter bit width for 23 parameter count Trice is 8.
+#define Trice_24 Trice8_24 //!< Default parameter bit width for 24 parameter count Trice is 8.
+#define Trice_25 Trice8_25 //!< Default parameter bit width for 25 parameter count Trice is 8.
+#define Trice_26 Trice8_26 //!< Default parameter bit width for 26 parameter count Trice is 8.
+#define Trice_27 Trice8_27 //!< Default parameter bit width for 27 parameter count Trice is 8.
+#define Trice_28 Trice8_28 //!< Default parameter bit width for 28 parameter count Trice is 8.
+#define Trice_29 Trice8_29 //!< Default parameter bit width for 29 parameter count Trice is 8.
+#define Trice_30 Trice8_30 //!< Default parameter bit width for 30 parameter count Trice is 8.
+#define Trice_31 Trice8_31 //!< Default parameter bit width for 31 parameter count Trice is 8.
+#define Trice_32 Trice8_32 //!< Default parameter bit width for 32 parameter count Trice is 8.
+#define TRice_13 TRice8_13 //!< Default parameter bit width for 13 parameter count TRice is 8.
+#define TRice_14 TRice8_14 //!< Default parameter bit width for 14 parameter count TRice is 8.
+#define TRice_15 TRice8_15 //!< Default parameter bit width for 15 parameter count TRice is 8.
+#define TRice_16 TRice8_16 //!< Default parameter bit width for 16 parameter count TRice is 8.
+#define TRice_17 TRice8_17 //!< Default parameter bit width for 17 parameter count TRice is 8.
+#define TRice_18 TRice8_18 //!< Default parameter bit width for 18 parameter count TRice is 8.
+#define TRice_19 TRice8_19 //!< Default parameter bit width for 19 parameter count TRice is 8.
+#define TRice_20 TRice8_20 //!< Default parameter bit width for 20 parameter count TRice is 8.
+#define TRice_21 TRice8_21 //!< Default parameter bit width for 21 parameter count TRice is 8.
+#define TRice_22 TRice8_22 //!< Default parameter bit width for 22 parameter count TRice is 8.
+#define TRice_23 TRice8_23 //!< Default parameter bit width for 23 parameter count TRice is 8.
+#define TRice_24 TRice8_24 //!< Default parameter bit width for 24 parameter count TRice is 8.
+#define TRice_25 TRice8_25 //!< Default parameter bit width for 25 parameter count TRice is 8.
+#define TRice_26 TRice8_26 //!< Default parameter bit width for 26 parameter count TRice is 8.
+#define TRice_27 TRice8_27 //!< Default parameter bit width for 27 parameter count TRice is 8.
+#define TRice_28 TRice8_28 //!< Default parameter bit width for 28 parameter count TRice is 8.
+#define TRice_29 TRice8_29 //!< Default parameter bit width for 29 parameter count TRice is 8.
+#define TRice_30 TRice8_30 //!< Default parameter bit width for 30 parameter count TRice is 8.
+#define TRice_31 TRice8_31 //!< Default parameter bit width for 31 parameter count TRice is 8.
+#define TRice_32 TRice8_32 //!< Default parameter bit width for 32 parameter count TRice is 8.
+
+#endif // #if TRICE_DEFAULT_PARAMETER_BIT_WIDTH == 8
+
+///////////////////////////////////////////////////////////////////////////////
+// 16-bit values
+//
+
+//! TRICE_PUT16_13 writes 13 16-bit values.
+#define TRICE_PUT16_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) );
+
+//! TRICE16_13 writes trice data as fast as possible in a buffer.
+#define TRICE16_13( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER tid; CNTC(26); \
+    TRICE_PUT16_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! trice16m_13 writes trice data as fast as possible in a buffer.
+#define trice16m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(26)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! Trice16m_13 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(26)<<16) | ts ); \
+    TRICE_PUT16_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! TRice16m_13 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 26 ) \
+    TRICE_PUT16_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_14 writes 14 16-bit values.
+#define TRICE_PUT16_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) );
+
+//! TRICE16_14 writes trice data as fast as possible in a buffer.
+#define TRICE16_14( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER tid; CNTC(28); \
+    TRICE_PUT16_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! trice16m_14 writes trice data as fast as possible in a buffer.
+#define trice16m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(28)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! Trice16m_14 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(28)<<16) | ts ); \
+    TRICE_PUT16_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! TRice16m_14 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 28 ) \
+    TRICE_PUT16_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_15 writes 15 16-bit values.
+#define TRICE_PUT16_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) );
+
+//! TRICE16_15 writes trice data as fast as possible in a buffer.
+#define TRICE16_15( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER tid; CNTC(30); \
+    TRICE_PUT16_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! trice16m_15 writes trice data as fast as possible in a buffer.
+#define trice16m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(30)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! Trice16m_15 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(30)<<16) | ts ); \
+    TRICE_PUT16_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! TRice16m_15 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 30 ) \
+    TRICE_PUT16_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_16 writes 16 16-bit values.
+#define TRICE_PUT16_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) );
+
+//! TRICE16_16 writes trice data as fast as possible in a buffer.
+#define TRICE16_16( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER tid; CNTC(32); \
+    TRICE_PUT16_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! trice16m_16 writes trice data as fast as possible in a buffer.
+#define trice16m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(32)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! Trice16m_16 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(32)<<16) | ts ); \
+    TRICE_PUT16_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! TRice16m_16 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 32 ) \
+    TRICE_PUT16_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_17 writes 17 16-bit values.
+#define TRICE_PUT16_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) );
+
+//! TRICE16_17 writes trice data as fast as possible in a buffer.
+#define TRICE16_17( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER tid; CNTC(34); \
+    TRICE_PUT16_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! trice16m_17 writes trice data as fast as possible in a buffer.
+#define trice16m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(34)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! Trice16m_17 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(34)<<16) | ts ); \
+    TRICE_PUT16_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! TRice16m_17 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 34 ) \
+    TRICE_PUT16_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_18 writes 18 16-bit values.
+#define TRICE_PUT16_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) );
+
+//! TRICE16_18 writes trice data as fast as possible in a buffer.
+#define TRICE16_18( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER tid; CNTC(36); \
+    TRICE_PUT16_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! trice16m_18 writes trice data as fast as possible in a buffer.
+#define trice16m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(36)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! Trice16m_18 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(36)<<16) | ts ); \
+    TRICE_PUT16_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! TRice16m_18 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 36 ) \
+    TRICE_PUT16_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_19 writes 19 16-bit values.
+#define TRICE_PUT16_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) );
+
+//! TRICE16_19 writes trice data as fast as possible in a buffer.
+#define TRICE16_19( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER tid; CNTC(38); \
+    TRICE_PUT16_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! trice16m_19 writes trice data as fast as possible in a buffer.
+#define trice16m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(38)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! Trice16m_19 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(38)<<16) | ts ); \
+    TRICE_PUT16_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! TRice16m_19 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 38 ) \
+    TRICE_PUT16_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_20 writes 20 16-bit values.
+#define TRICE_PUT16_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) | TRICE_SHORT1(v19) );
+
+//! TRICE16_20 writes trice data as fast as possible in a buffer.
+#define TRICE16_20( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER tid; CNTC(40); \
+    TRICE_PUT16_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! trice16m_20 writes trice data as fast as possible in a buffer.
+#define trice16m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(40)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! Trice16m_20 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(40)<<16) | ts ); \
+    TRICE_PUT16_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! TRice16m_20 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 40 ) \
+    TRICE_PUT16_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_21 writes 21 16-bit values.
+#define TRICE_PUT16_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) | TRICE_SHORT1(v19) ); \
+    TRICE_PUT( TRICE_SHORT0(v20) );
+
+//! TRICE16_21 writes trice data as fast as possible in a buffer.
+#define TRICE16_21( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER tid; CNTC(42); \
+    TRICE_PUT16_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! trice16m_21 writes trice data as fast as possible in a buffer.
+#define trice16m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(42)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! Trice16m_21 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(42)<<16) | ts ); \
+    TRICE_PUT16_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! TRice16m_21 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 42 ) \
+    TRICE_PUT16_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_22 writes 22 16-bit values.
+#define TRICE_PUT16_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) | TRICE_SHORT1(v19) ); \
+    TRICE_PUT( TRICE_SHORT0(v20) | TRICE_SHORT1(v21) );
+
+//! TRICE16_22 writes trice data as fast as possible in a buffer.
+#define TRICE16_22( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER tid; CNTC(44); \
+    TRICE_PUT16_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! trice16m_22 writes trice data as fast as possible in a buffer.
+#define trice16m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(44)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! Trice16m_22 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(44)<<16) | ts ); \
+    TRICE_PUT16_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! TRice16m_22 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 44 ) \
+    TRICE_PUT16_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_23 writes 23 16-bit values.
+#define TRICE_PUT16_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) | TRICE_SHORT1(v19) ); \
+    TRICE_PUT( TRICE_SHORT0(v20) | TRICE_SHORT1(v21) ); \
+    TRICE_PUT( TRICE_SHORT0(v22) );
+
+//! TRICE16_23 writes trice data as fast as possible in a buffer.
+#define TRICE16_23( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER tid; CNTC(46); \
+    TRICE_PUT16_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! trice16m_23 writes trice data as fast as possible in a buffer.
+#define trice16m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(46)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! Trice16m_23 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(46)<<16) | ts ); \
+    TRICE_PUT16_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! TRice16m_23 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 46 ) \
+    TRICE_PUT16_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_24 writes 24 16-bit values.
+#define TRICE_PUT16_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) | TRICE_SHORT1(v19) ); \
+    TRICE_PUT( TRICE_SHORT0(v20) | TRICE_SHORT1(v21) ); \
+    TRICE_PUT( TRICE_SHORT0(v22) | TRICE_SHORT1(v23) );
+
+//! TRICE16_24 writes trice data as fast as possible in a buffer.
+#define TRICE16_24( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER tid; CNTC(48); \
+    TRICE_PUT16_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! trice16m_24 writes trice data as fast as possible in a buffer.
+#define trice16m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(48)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! Trice16m_24 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(48)<<16) | ts ); \
+    TRICE_PUT16_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! TRice16m_24 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 48 ) \
+    TRICE_PUT16_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_25 writes 25 16-bit values.
+#define TRICE_PUT16_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) | TRICE_SHORT1(v19) ); \
+    TRICE_PUT( TRICE_SHORT0(v20) | TRICE_SHORT1(v21) ); \
+    TRICE_PUT( TRICE_SHORT0(v22) | TRICE_SHORT1(v23) ); \
+    TRICE_PUT( TRICE_SHORT0(v24) );
+
+//! TRICE16_25 writes trice data as fast as possible in a buffer.
+#define TRICE16_25( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER tid; CNTC(50); \
+    TRICE_PUT16_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! trice16m_25 writes trice data as fast as possible in a buffer.
+#define trice16m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(50)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! Trice16m_25 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(50)<<16) | ts ); \
+    TRICE_PUT16_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! TRice16m_25 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 50 ) \
+    TRICE_PUT16_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_26 writes 26 16-bit values.
+#define TRICE_PUT16_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) | TRICE_SHORT1(v19) ); \
+    TRICE_PUT( TRICE_SHORT0(v20) | TRICE_SHORT1(v21) ); \
+    TRICE_PUT( TRICE_SHORT0(v22) | TRICE_SHORT1(v23) ); \
+    TRICE_PUT( TRICE_SHORT0(v24) | TRICE_SHORT1(v25) );
+
+//! TRICE16_26 writes trice data as fast as possible in a buffer.
+#define TRICE16_26( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER tid; CNTC(52); \
+    TRICE_PUT16_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! trice16m_26 writes trice data as fast as possible in a buffer.
+#define trice16m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(52)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! Trice16m_26 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(52)<<16) | ts ); \
+    TRICE_PUT16_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! TRice16m_26 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 52 ) \
+    TRICE_PUT16_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_27 writes 27 16-bit values.
+#define TRICE_PUT16_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) | TRICE_SHORT1(v19) ); \
+    TRICE_PUT( TRICE_SHORT0(v20) | TRICE_SHORT1(v21) ); \
+    TRICE_PUT( TRICE_SHORT0(v22) | TRICE_SHORT1(v23) ); \
+    TRICE_PUT( TRICE_SHORT0(v24) | TRICE_SHORT1(v25) ); \
+    TRICE_PUT( TRICE_SHORT0(v26) );
+
+//! TRICE16_27 writes trice data as fast as possible in a buffer.
+#define TRICE16_27( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER tid; CNTC(54); \
+    TRICE_PUT16_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! trice16m_27 writes trice data as fast as possible in a buffer.
+#define trice16m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(54)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! Trice16m_27 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(54)<<16) | ts ); \
+    TRICE_PUT16_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! TRice16m_27 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 54 ) \
+    TRICE_PUT16_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_28 writes 28 16-bit values.
+#define TRICE_PUT16_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) | TRICE_SHORT1(v19) ); \
+    TRICE_PUT( TRICE_SHORT0(v20) | TRICE_SHORT1(v21) ); \
+    TRICE_PUT( TRICE_SHORT0(v22) | TRICE_SHORT1(v23) ); \
+    TRICE_PUT( TRICE_SHORT0(v24) | TRICE_SHORT1(v25) ); \
+    TRICE_PUT( TRICE_SHORT0(v26) | TRICE_SHORT1(v27) );
+
+//! TRICE16_28 writes trice data as fast as possible in a buffer.
+#define TRICE16_28( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER tid; CNTC(56); \
+    TRICE_PUT16_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! trice16m_28 writes trice data as fast as possible in a buffer.
+#define trice16m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(56)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! Trice16m_28 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(56)<<16) | ts ); \
+    TRICE_PUT16_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! TRice16m_28 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 56 ) \
+    TRICE_PUT16_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_29 writes 29 16-bit values.
+#define TRICE_PUT16_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) | TRICE_SHORT1(v19) ); \
+    TRICE_PUT( TRICE_SHORT0(v20) | TRICE_SHORT1(v21) ); \
+    TRICE_PUT( TRICE_SHORT0(v22) | TRICE_SHORT1(v23) ); \
+    TRICE_PUT( TRICE_SHORT0(v24) | TRICE_SHORT1(v25) ); \
+    TRICE_PUT( TRICE_SHORT0(v26) | TRICE_SHORT1(v27) ); \
+    TRICE_PUT( TRICE_SHORT0(v28) );
+
+//! TRICE16_29 writes trice data as fast as possible in a buffer.
+#define TRICE16_29( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER tid; CNTC(58); \
+    TRICE_PUT16_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! trice16m_29 writes trice data as fast as possible in a buffer.
+#define trice16m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(58)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! Trice16m_29 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(58)<<16) | ts ); \
+    TRICE_PUT16_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! TRice16m_29 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 58 ) \
+    TRICE_PUT16_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_30 writes 30 16-bit values.
+#define TRICE_PUT16_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) | TRICE_SHORT1(v19) ); \
+    TRICE_PUT( TRICE_SHORT0(v20) | TRICE_SHORT1(v21) ); \
+    TRICE_PUT( TRICE_SHORT0(v22) | TRICE_SHORT1(v23) ); \
+    TRICE_PUT( TRICE_SHORT0(v24) | TRICE_SHORT1(v25) ); \
+    TRICE_PUT( TRICE_SHORT0(v26) | TRICE_SHORT1(v27) ); \
+    TRICE_PUT( TRICE_SHORT0(v28) | TRICE_SHORT1(v29) );
+
+//! TRICE16_30 writes trice data as fast as possible in a buffer.
+#define TRICE16_30( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER tid; CNTC(60); \
+    TRICE_PUT16_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! trice16m_30 writes trice data as fast as possible in a buffer.
+#define trice16m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(60)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! Trice16m_30 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(60)<<16) | ts ); \
+    TRICE_PUT16_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! TRice16m_30 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 60 ) \
+    TRICE_PUT16_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_31 writes 31 16-bit values.
+#define TRICE_PUT16_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) | TRICE_SHORT1(v19) ); \
+    TRICE_PUT( TRICE_SHORT0(v20) | TRICE_SHORT1(v21) ); \
+    TRICE_PUT( TRICE_SHORT0(v22) | TRICE_SHORT1(v23) ); \
+    TRICE_PUT( TRICE_SHORT0(v24) | TRICE_SHORT1(v25) ); \
+    TRICE_PUT( TRICE_SHORT0(v26) | TRICE_SHORT1(v27) ); \
+    TRICE_PUT( TRICE_SHORT0(v28) | TRICE_SHORT1(v29) ); \
+    TRICE_PUT( TRICE_SHORT0(v30) );
+
+//! TRICE16_31 writes trice data as fast as possible in a buffer.
+#define TRICE16_31( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER tid; CNTC(62); \
+    TRICE_PUT16_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! trice16m_31 writes trice data as fast as possible in a buffer.
+#define trice16m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(62)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! Trice16m_31 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(62)<<16) | ts ); \
+    TRICE_PUT16_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! TRice16m_31 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 62 ) \
+    TRICE_PUT16_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT16_32 writes 32 16-bit values.
+#define TRICE_PUT16_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_PUT( TRICE_SHORT0(v0) | TRICE_SHORT1(v1) ); \
+    TRICE_PUT( TRICE_SHORT0(v2) | TRICE_SHORT1(v3) ); \
+    TRICE_PUT( TRICE_SHORT0(v4) | TRICE_SHORT1(v5) ); \
+    TRICE_PUT( TRICE_SHORT0(v6) | TRICE_SHORT1(v7) ); \
+    TRICE_PUT( TRICE_SHORT0(v8) | TRICE_SHORT1(v9) ); \
+    TRICE_PUT( TRICE_SHORT0(v10) | TRICE_SHORT1(v11) ); \
+    TRICE_PUT( TRICE_SHORT0(v12) | TRICE_SHORT1(v13) ); \
+    TRICE_PUT( TRICE_SHORT0(v14) | TRICE_SHORT1(v15) ); \
+    TRICE_PUT( TRICE_SHORT0(v16) | TRICE_SHORT1(v17) ); \
+    TRICE_PUT( TRICE_SHORT0(v18) | TRICE_SHORT1(v19) ); \
+    TRICE_PUT( TRICE_SHORT0(v20) | TRICE_SHORT1(v21) ); \
+    TRICE_PUT( TRICE_SHORT0(v22) | TRICE_SHORT1(v23) ); \
+    TRICE_PUT( TRICE_SHORT0(v24) | TRICE_SHORT1(v25) ); \
+    TRICE_PUT( TRICE_SHORT0(v26) | TRICE_SHORT1(v27) ); \
+    TRICE_PUT( TRICE_SHORT0(v28) | TRICE_SHORT1(v29) ); \
+    TRICE_PUT( TRICE_SHORT0(v30) | TRICE_SHORT1(v31) );
+
+//! TRICE16_32 writes trice data as fast as possible in a buffer.
+#define TRICE16_32( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER tid; CNTC(64); \
+    TRICE_PUT16_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+//! trice16m_32 writes trice data as fast as possible in a buffer.
+#define trice16m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(64)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT16_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+//! Trice16m_32 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice16m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(64)<<16) | ts ); \
+    TRICE_PUT16_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+//! TRice16m_32 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice16m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 64 ) \
+    TRICE_PUT16_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+#ifdef TRICE_CLEAN
+
+#define trice16_13( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) //!< trice16_13 is a macro calling a function to reduce code size.
+#define trice16_14( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) //!< trice16_14 is a macro calling a function to reduce code size.
+#define trice16_15( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) //!< trice16_15 is a macro calling a function to reduce code size.
+#define trice16_16( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) //!< trice16_16 is a macro calling a function to reduce code size.
+#define trice16_17( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) //!< trice16_17 is a macro calling a function to reduce code size.
+#define trice16_18( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) //!< trice16_18 is a macro calling a function to reduce code size.
+#define trice16_19( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) //!< trice16_19 is a macro calling a function to reduce code size.
+#define trice16_20( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) //!< trice16_20 is a macro calling a function to reduce code size.
+#define trice16_21( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) //!< trice16_21 is a macro calling a function to reduce code size.
+#define trice16_22( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) //!< trice16_22 is a macro calling a function to reduce code size.
+#define trice16_23( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) //!< trice16_23 is a macro calling a function to reduce code size.
+#define trice16_24( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) //!< trice16_24 is a macro calling a function to reduce code size.
+#define trice16_25( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) //!< trice16_25 is a macro calling a function to reduce code size.
+#define trice16_26( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) //!< trice16_26 is a macro calling a function to reduce code size.
+#define trice16_27( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) //!< trice16_27 is a macro calling a function to reduce code size.
+#define trice16_28( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) //!< trice16_28 is a macro calling a function to reduce code size.
+#define trice16_29( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) //!< trice16_29 is a macro calling a function to reduce code size.
+#define trice16_30( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) //!< trice16_30 is a macro calling a function to reduce code size.
+#define trice16_31( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) //!< trice16_31 is a macro calling a function to reduce code size.
+#define trice16_32( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) //!< trice16_32 is a macro calling a function to reduce code size.
+#define Trice16_13( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) //!< Trice16_13 is a macro calling a function to reduce code size.
+#define Trice16_14( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) //!< Trice16_14 is a macro calling a function to reduce code size.
+#define Trice16_15( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) //!< Trice16_15 is a macro calling a function to reduce code size.
+#define Trice16_16( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) //!< Trice16_16 is a macro calling a function to reduce code size.
+#define Trice16_17( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) //!< Trice16_17 is a macro calling a function to reduce code size.
+#define Trice16_18( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) //!< Trice16_18 is a macro calling a function to reduce code size.
+#define Trice16_19( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) //!< Trice16_19 is a macro calling a function to reduce code size.
+#define Trice16_20( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) //!< Trice16_20 is a macro calling a function to reduce code size.
+#define Trice16_21( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) //!< Trice16_21 is a macro calling a function to reduce code size.
+#define Trice16_22( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) //!< Trice16_22 is a macro calling a function to reduce code size.
+#define Trice16_23( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) //!< Trice16_23 is a macro calling a function to reduce code size.
+#define Trice16_24( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) //!< Trice16_24 is a macro calling a function to reduce code size.
+#define Trice16_25( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) //!< Trice16_25 is a macro calling a function to reduce code size.
+#define Trice16_26( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) //!< Trice16_26 is a macro calling a function to reduce code size.
+#define Trice16_27( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) //!< Trice16_27 is a macro calling a function to reduce code size.
+#define Trice16_28( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) //!< Trice16_28 is a macro calling a function to reduce code size.
+#define Trice16_29( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) //!< Trice16_29 is a macro calling a function to reduce code size.
+#define Trice16_30( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) //!< Trice16_30 is a macro calling a function to reduce code size.
+#define Trice16_31( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) //!< Trice16_31 is a macro calling a function to reduce code size.
+#define Trice16_32( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) //!< Trice16_32 is a macro calling a function to reduce code size.
+#define TRice16_13( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) //!< TRice16_13 is a macro calling a function to reduce code size.
+#define TRice16_14( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) //!< TRice16_14 is a macro calling a function to reduce code size.
+#define TRice16_15( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) //!< TRice16_15 is a macro calling a function to reduce code size.
+#define TRice16_16( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) //!< TRice16_16 is a macro calling a function to reduce code size.
+#define TRice16_17( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) //!< TRice16_17 is a macro calling a function to reduce code size.
+#define TRice16_18( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) //!< TRice16_18 is a macro calling a function to reduce code size.
+#define TRice16_19( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) //!< TRice16_19 is a macro calling a function to reduce code size.
+#define TRice16_20( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) //!< TRice16_20 is a macro calling a function to reduce code size.
+#define TRice16_21( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) //!< TRice16_21 is a macro calling a function to reduce code size.
+#define TRice16_22( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) //!< TRice16_22 is a macro calling a function to reduce code size.
+#define TRice16_23( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) //!< TRice16_23 is a macro calling a function to reduce code size.
+#define TRice16_24( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) //!< TRice16_24 is a macro calling a function to reduce code size.
+#define TRice16_25( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) //!< TRice16_25 is a macro calling a function to reduce code size.
+#define TRice16_26( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) //!< TRice16_26 is a macro calling a function to reduce code size.
+#define TRice16_27( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) //!< TRice16_27 is a macro calling a function to reduce code size.
+#define TRice16_28( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) //!< TRice16_28 is a macro calling a function to reduce code size.
+#define TRice16_29( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) //!< TRice16_29 is a macro calling a function to reduce code size.
+#define TRice16_30( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) //!< TRice16_30 is a macro calling a function to reduce code size.
+#define TRice16_31( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) //!< TRice16_31 is a macro calling a function to reduce code size.
+#define TRice16_32( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) //!< TRice16_32 is a macro calling a function to reduce code size.
+
+#else // #ifdef TRICE_CLEAN
+
+#define trice16_13( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) trice16fn_13( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12) ) //!< trice16_13 is a macro calling a function to reduce code size.
+#define trice16_14( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) trice16fn_14( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13) ) //!< trice16_14 is a macro calling a function to reduce code size.
+#define trice16_15( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) trice16fn_15( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14) ) //!< trice16_15 is a macro calling a function to reduce code size.
+#define trice16_16( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) trice16fn_16( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15) ) //!< trice16_16 is a macro calling a function to reduce code size.
+#define trice16_17( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) trice16fn_17( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16) ) //!< trice16_17 is a macro calling a function to reduce code size.
+#define trice16_18( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) trice16fn_18( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17) ) //!< trice16_18 is a macro calling a function to reduce code size.
+#define trice16_19( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) trice16fn_19( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18) ) //!< trice16_19 is a macro calling a function to reduce code size.
+#define trice16_20( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) trice16fn_20( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19) ) //!< trice16_20 is a macro calling a function to reduce code size.
+#define trice16_21( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) trice16fn_21( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20) ) //!< trice16_21 is a macro calling a function to reduce code size.
+#define trice16_22( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) trice16fn_22( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21) ) //!< trice16_22 is a macro calling a function to reduce code size.
+#define trice16_23( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) trice16fn_23( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22) ) //!< trice16_23 is a macro calling a function to reduce code size.
+#define trice16_24( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) trice16fn_24( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23) ) //!< trice16_24 is a macro calling a function to reduce code size.
+#define trice16_25( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) trice16fn_25( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24) ) //!< trice16_25 is a macro calling a function to reduce code size.
+#define trice16_26( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) trice16fn_26( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25) ) //!< trice16_26 is a macro calling a function to reduce code size.
+#define trice16_27( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) trice16fn_27( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26) ) //!< trice16_27 is a macro calling a function to reduce code size.
+#define trice16_28( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) trice16fn_28( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27) ) //!< trice16_28 is a macro calling a function to reduce code size.
+#define trice16_29( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) trice16fn_29( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27), (uint16_t)(v28) ) //!< trice16_29 is a macro calling a function to reduce code size.
+#define trice16_30( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) trice16fn_30( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27), (uint16_t)(v28), (uint16_t)(v29) ) //!< trice16_30 is a macro calling a function to reduce code size.
+#define trice16_31( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) trice16fn_31( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27), (uint16_t)(v28), (uint16_t)(v29), (uint16_t)(v30) ) //!< trice16_31 is a macro calling a function to reduce code size.
+#define trice16_32( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) trice16fn_32( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27), (uint16_t)(v28), (uint16_t)(v29), (uint16_t)(v30), (uint16_t)(v31) ) //!< trice16_32 is a macro calling a function to reduce code size.
+#define Trice16_13( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) Trice16fn_13( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12) ) //!< Trice16_13 is a macro calling a function to reduce code size.
+#define Trice16_14( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) Trice16fn_14( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13) ) //!< Trice16_14 is a macro calling a function to reduce code size.
+#define Trice16_15( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) Trice16fn_15( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14) ) //!< Trice16_15 is a macro calling a function to reduce code size.
+#define Trice16_16( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) Trice16fn_16( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15) ) //!< Trice16_16 is a macro calling a function to reduce code size.
+#define Trice16_17( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) Trice16fn_17( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16) ) //!< Trice16_17 is a macro calling a function to reduce code size.
+#define Trice16_18( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) Trice16fn_18( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17) ) //!< Trice16_18 is a macro calling a function to reduce code size.
+#define Trice16_19( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) Trice16fn_19( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18) ) //!< Trice16_19 is a macro calling a function to reduce code size.
+#define Trice16_20( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) Trice16fn_20( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19) ) //!< Trice16_20 is a macro calling a function to reduce code size.
+#define Trice16_21( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) Trice16fn_21( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20) ) //!< Trice16_21 is a macro calling a function to reduce code size.
+#define Trice16_22( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) Trice16fn_22( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21) ) //!< Trice16_22 is a macro calling a function to reduce code size.
+#define Trice16_23( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) Trice16fn_23( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22) ) //!< Trice16_23 is a macro calling a function to reduce code size.
+#define Trice16_24( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) Trice16fn_24( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23) ) //!< Trice16_24 is a macro calling a function to reduce code size.
+#define Trice16_25( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) Trice16fn_25( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24) ) //!< Trice16_25 is a macro calling a function to reduce code size.
+#define Trice16_26( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) Trice16fn_26( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25) ) //!< Trice16_26 is a macro calling a function to reduce code size.
+#define Trice16_27( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) Trice16fn_27( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26) ) //!< Trice16_27 is a macro calling a function to reduce code size.
+#define Trice16_28( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) Trice16fn_28( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27) ) //!< Trice16_28 is a macro calling a function to reduce code size.
+#define Trice16_29( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) Trice16fn_29( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27), (uint16_t)(v28) ) //!< Trice16_29 is a macro calling a function to reduce code size.
+#define Trice16_30( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) Trice16fn_30( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27), (uint16_t)(v28), (uint16_t)(v29) ) //!< Trice16_30 is a macro calling a function to reduce code size.
+#define Trice16_31( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) Trice16fn_31( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27), (uint16_t)(v28), (uint16_t)(v29), (uint16_t)(v30) ) //!< Trice16_31 is a macro calling a function to reduce code size.
+#define Trice16_32( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) Trice16fn_32( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27), (uint16_t)(v28), (uint16_t)(v29), (uint16_t)(v30), (uint16_t)(v31) ) //!< Trice16_32 is a macro calling a function to reduce code size.
+#define TRice16_13( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) TRice16fn_13( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12) ) //!< TRice16_13 is a macro calling a function to reduce code size.
+#define TRice16_14( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) TRice16fn_14( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13) ) //!< TRice16_14 is a macro calling a function to reduce code size.
+#define TRice16_15( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) TRice16fn_15( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14) ) //!< TRice16_15 is a macro calling a function to reduce code size.
+#define TRice16_16( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) TRice16fn_16( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15) ) //!< TRice16_16 is a macro calling a function to reduce code size.
+#define TRice16_17( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) TRice16fn_17( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16) ) //!< TRice16_17 is a macro calling a function to reduce code size.
+#define TRice16_18( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) TRice16fn_18( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17) ) //!< TRice16_18 is a macro calling a function to reduce code size.
+#define TRice16_19( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) TRice16fn_19( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18) ) //!< TRice16_19 is a macro calling a function to reduce code size.
+#define TRice16_20( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) TRice16fn_20( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19) ) //!< TRice16_20 is a macro calling a function to reduce code size.
+#define TRice16_21( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) TRice16fn_21( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20) ) //!< TRice16_21 is a macro calling a function to reduce code size.
+#define TRice16_22( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) TRice16fn_22( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21) ) //!< TRice16_22 is a macro calling a function to reduce code size.
+#define TRice16_23( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) TRice16fn_23( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22) ) //!< TRice16_23 is a macro calling a function to reduce code size.
+#define TRice16_24( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) TRice16fn_24( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23) ) //!< TRice16_24 is a macro calling a function to reduce code size.
+#define TRice16_25( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) TRice16fn_25( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24) ) //!< TRice16_25 is a macro calling a function to reduce code size.
+#define TRice16_26( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) TRice16fn_26( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25) ) //!< TRice16_26 is a macro calling a function to reduce code size.
+#define TRice16_27( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) TRice16fn_27( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26) ) //!< TRice16_27 is a macro calling a function to reduce code size.
+#define TRice16_28( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) TRice16fn_28( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27) ) //!< TRice16_28 is a macro calling a function to reduce code size.
+#define TRice16_29( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) TRice16fn_29( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27), (uint16_t)(v28) ) //!< TRice16_29 is a macro calling a function to reduce code size.
+#define TRice16_30( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) TRice16fn_30( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27), (uint16_t)(v28), (uint16_t)(v29) ) //!< TRice16_30 is a macro calling a function to reduce code size.
+#define TRice16_31( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) TRice16fn_31( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27), (uint16_t)(v28), (uint16_t)(v29), (uint16_t)(v30) ) //!< TRice16_31 is a macro calling a function to reduce code size.
+#define TRice16_32( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) TRice16fn_32( tid, (uint16_t)(v0), (uint16_t)(v1), (uint16_t)(v2), (uint16_t)(v3), (uint16_t)(v4), (uint16_t)(v5), (uint16_t)(v6), (uint16_t)(v7), (uint16_t)(v8), (uint16_t)(v9), (uint16_t)(v10), (uint16_t)(v11), (uint16_t)(v12), (uint16_t)(v13), (uint16_t)(v14), (uint16_t)(v15), (uint16_t)(v16), (uint16_t)(v17), (uint16_t)(v18), (uint16_t)(v19), (uint16_t)(v20), (uint16_t)(v21), (uint16_t)(v22), (uint16_t)(v23), (uint16_t)(v24), (uint16_t)(v25), (uint16_t)(v26), (uint16_t)(v27), (uint16_t)(v28), (uint16_t)(v29), (uint16_t)(v30), (uint16_t)(v31) ) //!< TRice16_32 is a macro calling a function to reduce code size.
+
+void trice16fn_13( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12 );
+void trice16fn_14( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13 );
+void trice16fn_15( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14 );
+void trice16fn_16( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15 );
+void trice16fn_17( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16 );
+void trice16fn_18( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17 );
+void trice16fn_19( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18 );
+void trice16fn_20( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19 );
+void trice16fn_21( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20 );
+void trice16fn_22( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21 );
+void trice16fn_23( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22 );
+void trice16fn_24( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23 );
+void trice16fn_25( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24 );
+void trice16fn_26( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25 );
+void trice16fn_27( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26 );
+void trice16fn_28( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27 );
+void trice16fn_29( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28 );
+void trice16fn_30( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29 );
+void trice16fn_31( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29, uint16_t v30 );
+void trice16fn_32( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29, uint16_t v30, uint16_t v31 );
+void Trice16fn_13( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12 );
+void Trice16fn_14( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13 );
+void Trice16fn_15( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14 );
+void Trice16fn_16( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15 );
+void Trice16fn_17( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16 );
+void Trice16fn_18( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17 );
+void Trice16fn_19( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18 );
+void Trice16fn_20( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19 );
+void Trice16fn_21( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20 );
+void Trice16fn_22( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21 );
+void Trice16fn_23( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22 );
+void Trice16fn_24( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23 );
+void Trice16fn_25( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24 );
+void Trice16fn_26( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25 );
+void Trice16fn_27( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26 );
+void Trice16fn_28( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27 );
+void Trice16fn_29( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28 );
+void Trice16fn_30( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29 );
+void Trice16fn_31( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29, uint16_t v30 );
+void Trice16fn_32( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29, uint16_t v30, uint16_t v31 );
+void TRice16fn_13( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12 );
+void TRice16fn_14( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13 );
+void TRice16fn_15( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14 );
+void TRice16fn_16( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15 );
+void TRice16fn_17( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16 );
+void TRice16fn_18( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17 );
+void TRice16fn_19( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18 );
+void TRice16fn_20( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19 );
+void TRice16fn_21( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20 );
+void TRice16fn_22( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21 );
+void TRice16fn_23( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22 );
+void TRice16fn_24( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23 );
+void TRice16fn_25( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24 );
+void TRice16fn_26( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25 );
+void TRice16fn_27( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26 );
+void TRice16fn_28( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27 );
+void TRice16fn_29( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28 );
+void TRice16fn_30( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29 );
+void TRice16fn_31( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29, uint16_t v30 );
+void TRice16fn_32( uint16_t tid, uint16_t v0, uint16_t v1, uint16_t v2, uint16_t v3, uint16_t v4, uint16_t v5, uint16_t v6, uint16_t v7, uint16_t v8, uint16_t v9, uint16_t v10, uint16_t v11, uint16_t v12, uint16_t v13, uint16_t v14, uint16_t v15, uint16_t v16, uint16_t v17, uint16_t v18, uint16_t v19, uint16_t v20, uint16_t v21, uint16_t v22, uint16_t v23, uint16_t v24, uint16_t v25, uint16_t v26, uint16_t v27, uint16_t v28, uint16_t v29, uint16_t v30, uint16_t v31 );
+
+#endif // #else // #ifdef TRICE_CLEAN
+
+#if TRICE_DEFAULT_PARAMETER_BIT_WIDTH == 16
+
+#define TRICE_13 TRICE16_13 //!< Default parameter bit width for 13 parameter count TRICE is 16.
+#define TRICE_14 TRICE16_14 //!< Default parameter bit width for 14 parameter count TRICE is 16.
+#define TRICE_15 TRICE16_15 //!< Default parameter bit width for 15 parameter count TRICE is 16.
+#define TRICE_16 TRICE16_16 //!< Default parameter bit width for 16 parameter count TRICE is 16.
+#define TRICE_17 TRICE16_17 //!< Default parameter bit width for 17 parameter count TRICE is 16.
+#define TRICE_18 TRICE16_18 //!< Default parameter bit width for 18 parameter count TRICE is 16.
+#define TRICE_19 TRICE16_19 //!< Default parameter bit width for 19 parameter count TRICE is 16.
+#define TRICE_20 TRICE16_20 //!< Default parameter bit width for 20 parameter count TRICE is 16.
+#define TRICE_21 TRICE16_21 //!< Default parameter bit width for 21 parameter count TRICE is 16.
+#define TRICE_22 TRICE16_22 //!< Default parameter bit width for 22 parameter count TRICE is 16.
+#define TRICE_23 TRICE16_23 //!< Default parameter bit width for 23 parameter count TRICE is 16.
+#define TRICE_24 TRICE16_24 //!< Default parameter bit width for 24 parameter count TRICE is 16.
+#define TRICE_25 TRICE16_25 //!< Default parameter bit width for 25 parameter count TRICE is 16.
+#define TRICE_26 TRICE16_26 //!< Default parameter bit width for 26 parameter count TRICE is 16.
+#define TRICE_27 TRICE16_27 //!< Default parameter bit width for 27 parameter count TRICE is 16.
+#define TRICE_28 TRICE16_28 //!< Default parameter bit width for 28 parameter count TRICE is 16.
+#define TRICE_29 TRICE16_29 //!< Default parameter bit width for 29 parameter count TRICE is 16.
+#define TRICE_30 TRICE16_30 //!< Default parameter bit width for 30 parameter count TRICE is 16.
+#define TRICE_31 TRICE16_31 //!< Default parameter bit width for 31 parameter count TRICE is 16.
+#define TRICE_32 TRICE16_32 //!< Default parameter bit width for 32 parameter count TRICE is 16.
+#define trice_13 trice16_13 //!< Default parameter bit width for 13 parameter count trice is 16.
+#define trice_14 trice16_14 //!< Default parameter bit width for 14 parameter count trice is 16.
+#define trice_15 trice16_15 //!< Default parameter bit width for 15 parameter count trice is 16.
+#define trice_16 trice16_16 //!< Default parameter bit width for 16 parameter count trice is 16.
+#define trice_17 trice16_17 //!< Default parameter bit width for 17 parameter count trice is 16.
+#define trice_18 trice16_18 //!< Default parameter bit width for 18 parameter count trice is 16.
+#define trice_19 trice16_19 //!< Default parameter bit width for 19 parameter count trice is 16.
+#define trice_20 trice16_20 //!< Default parameter bit width for 20 parameter count trice is 16.
+#define trice_21 trice16_21 //!< Default parameter bit width for 21 parameter count trice is 16.
+#define trice_22 trice16_22 //!< Default parameter bit width for 22 parameter count trice is 16.
+#define trice_23 trice16_23 //!< Default parameter bit width for 23 parameter count trice is 16.
+#define trice_24 trice16_24 //!< Default parameter bit width for 24 parameter count trice is 16.
+#define trice_25 trice16_25 //!< Default parameter bit width for 25 parameter count trice is 16.
+#define trice_26 trice16_26 //!< Default parameter bit width for 26 parameter count trice is 16.
+#define trice_27 trice16_27 //!< Default parameter bit width for 27 parameter count trice is 16.
+#define trice_28 trice16_28 //!< Default parameter bit width for 28 parameter count trice is 16.
+#define trice_29 trice16_29 //!< Default parameter bit width for 29 parameter count trice is 16.
+#define trice_30 trice16_30 //!< Default parameter bit width for 30 parameter count trice is 16.
+#define trice_31 trice16_31 //!< Default parameter bit width for 31 parameter count trice is 16.
+#define trice_32 trice16_32 //!< Default parameter bit width for 32 parameter count trice is 16.
+#define Trice_13 Trice16_13 //!< Default parameter bit width for 13 parameter count Trice is 16.
+#define Trice_14 Trice16_14 //!< Default parameter bit width for 14 parameter count Trice is 16.
+#define Trice_15 Trice16_15 //!< Default parameter bit width for 15 parameter count Trice is 16.
+#define Trice_16 Trice16_16 //!< Default parameter bit width for 16 parameter count Trice is 16.
+#define Trice_17 Trice16_17 //!< Default parameter bit width for 17 parameter count Trice is 16.
+#define Trice_18 Trice16_18 //!< Default parameter bit width for 18 parameter count Trice is 16.
+#define Trice_19 Trice16_19 //!< Default parameter bit width for 19 parameter count Trice is 16.
+#define Trice_20 Trice16_20 //!< Default parameter bit width for 20 parameter count Trice is 16.
+#define Trice_21 Trice16_21 //!< Default parameter bit width for 21 parameter count Trice is 16.
+#define Trice_22 Trice16_22 //!< Default parameter bit width for 22 parameter count Trice is 16.
+#define Trice_23 Trice16_23 //!< Default parameter bit width for 23 parameter count Trice is 16.
+#define Trice_24 Trice16_24 //!< Default parameter bit width for 24 parameter count Trice is 16.
+#define Trice_25 Trice16_25 //!< Default parameter bit width for 25 parameter count Trice is 16.
+#define Trice_26 Trice16_26 //!< Default parameter bit width for 26 parameter count Trice is 16.
+#define Trice_27 Trice16_27 //!< Default parameter bit width for 27 parameter count Trice is 16.
+#define Trice_28 Trice16_28 //!< Default parameter bit width for 28 parameter count Trice is 16.
+#define Trice_29 Trice16_29 //!< Default parameter bit width for 29 parameter count Trice is 16.
+#define Trice_30 Trice16_30 //!< Default parameter bit width for 30 parameter count Trice is 16.
+#define Trice_31 Trice16_31 //!< Default parameter bit width for 31 parameter count Trice is 16.
+#define Trice_32 Trice16_32 //!< Default parameter bit width for 32 parameter count Trice is 16.
+#define TRice_13 TRice16_13 //!< Default parameter bit width for 13 parameter count TRice is 16.
+#define TRice_14 TRice16_14 //!< Default parameter bit width for 14 parameter count TRice is 16.
+#define TRice_15 TRice16_15 //!< Default parameter bit width for 15 parameter count TRice is 16.
+#define TRice_16 TRice16_16 //!< Default parameter bit width for 16 parameter count TRice is 16.
+#define TRice_17 TRice16_17 //!< Default parameter bit width for 17 parameter count TRice is 16.
+#define TRice_18 TRice16_18 //!< Default parameter bit width for 18 parameter count TRice is 16.
+#define TRice_19 TRice16_19 //!< Default parameter bit width for 19 parameter count TRice is 16.
+#define TRice_20 TRice16_20 //!< Default parameter bit width for 20 parameter count TRice is 16.
+#define TRice_21 TRice16_21 //!< Default parameter bit width for 21 parameter count TRice is 16.
+#define TRice_22 TRice16_22 //!< Default parameter bit width for 22 parameter count TRice is 16.
+#define TRice_23 TRice16_23 //!< Default parameter bit width for 23 parameter count TRice is 16.
+#define TRice_24 TRice16_24 //!< Default parameter bit width for 24 parameter count TRice is 16.
+#define TRice_25 TRice16_25 //!< Default parameter bit width for 25 parameter count TRice is 16.
+#define TRice_26 TRice16_26 //!< Default parameter bit width for 26 parameter count TRice is 16.
+#define TRice_27 TRice16_27 //!< Default parameter bit width for 27 parameter count TRice is 16.
+#define TRice_28 TRice16_28 //!< Default parameter bit width for 28 parameter count TRice is 16.
+#define TRice_29 TRice16_29 //!< Default parameter bit width for 29 parameter count TRice is 16.
+#define TRice_30 TRice16_30 //!< Default parameter bit width for 30 parameter count TRice is 16.
+#define TRice_31 TRice16_31 //!< Default parameter bit width for 31 parameter count TRice is 16.
+#define TRice_32 TRice16_32 //!< Default parameter bit width for 32 parameter count TRice is 16.
+
+#endif // #if TRICE_DEFAULT_PARAMETER_BIT_WIDTH == 16
+
+///////////////////////////////////////////////////////////////////////////////
+// 32-bit values
+//
+
+//! TRICE_PUT32_13 writes 13 32-bit values.
+#define TRICE_PUT32_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) );
+
+//! TRICE32_13 writes trice data as fast as possible in a buffer.
+#define TRICE32_13( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER tid; CNTC(52); \
+    TRICE_PUT32_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! trice32m_13 writes trice data as fast as possible in a buffer.
+#define trice32m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(52)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! Trice32m_13 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(52)<<16) | ts ); \
+    TRICE_PUT32_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! TRice32m_13 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 52 ) \
+    TRICE_PUT32_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_14 writes 14 32-bit values.
+#define TRICE_PUT32_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) );
+
+//! TRICE32_14 writes trice data as fast as possible in a buffer.
+#define TRICE32_14( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER tid; CNTC(56); \
+    TRICE_PUT32_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! trice32m_14 writes trice data as fast as possible in a buffer.
+#define trice32m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(56)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! Trice32m_14 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(56)<<16) | ts ); \
+    TRICE_PUT32_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! TRice32m_14 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 56 ) \
+    TRICE_PUT32_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_15 writes 15 32-bit values.
+#define TRICE_PUT32_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) );
+
+//! TRICE32_15 writes trice data as fast as possible in a buffer.
+#define TRICE32_15( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER tid; CNTC(60); \
+    TRICE_PUT32_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! trice32m_15 writes trice data as fast as possible in a buffer.
+#define trice32m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(60)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! Trice32m_15 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(60)<<16) | ts ); \
+    TRICE_PUT32_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! TRice32m_15 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 60 ) \
+    TRICE_PUT32_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_16 writes 16 32-bit values.
+#define TRICE_PUT32_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) );
+
+//! TRICE32_16 writes trice data as fast as possible in a buffer.
+#define TRICE32_16( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER tid; CNTC(64); \
+    TRICE_PUT32_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! trice32m_16 writes trice data as fast as possible in a buffer.
+#define trice32m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(64)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! Trice32m_16 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(64)<<16) | ts ); \
+    TRICE_PUT32_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! TRice32m_16 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 64 ) \
+    TRICE_PUT32_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_17 writes 17 32-bit values.
+#define TRICE_PUT32_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) );
+
+//! TRICE32_17 writes trice data as fast as possible in a buffer.
+#define TRICE32_17( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER tid; CNTC(68); \
+    TRICE_PUT32_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! trice32m_17 writes trice data as fast as possible in a buffer.
+#define trice32m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(68)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! Trice32m_17 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(68)<<16) | ts ); \
+    TRICE_PUT32_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! TRice32m_17 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 68 ) \
+    TRICE_PUT32_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_18 writes 18 32-bit values.
+#define TRICE_PUT32_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) );
+
+//! TRICE32_18 writes trice data as fast as possible in a buffer.
+#define TRICE32_18( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER tid; CNTC(72); \
+    TRICE_PUT32_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! trice32m_18 writes trice data as fast as possible in a buffer.
+#define trice32m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(72)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! Trice32m_18 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(72)<<16) | ts ); \
+    TRICE_PUT32_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! TRice32m_18 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 72 ) \
+    TRICE_PUT32_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_19 writes 19 32-bit values.
+#define TRICE_PUT32_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) );
+
+//! TRICE32_19 writes trice data as fast as possible in a buffer.
+#define TRICE32_19( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER tid; CNTC(76); \
+    TRICE_PUT32_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! trice32m_19 writes trice data as fast as possible in a buffer.
+#define trice32m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(76)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! Trice32m_19 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(76)<<16) | ts ); \
+    TRICE_PUT32_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! TRice32m_19 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 76 ) \
+    TRICE_PUT32_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_20 writes 20 32-bit values.
+#define TRICE_PUT32_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) ); \
+    TRICE_PUT( (uint32_t)(v19) );
+
+//! TRICE32_20 writes trice data as fast as possible in a buffer.
+#define TRICE32_20( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER tid; CNTC(80); \
+    TRICE_PUT32_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! trice32m_20 writes trice data as fast as possible in a buffer.
+#define trice32m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(80)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! Trice32m_20 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(80)<<16) | ts ); \
+    TRICE_PUT32_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! TRice32m_20 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 80 ) \
+    TRICE_PUT32_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_21 writes 21 32-bit values.
+#define TRICE_PUT32_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) ); \
+    TRICE_PUT( (uint32_t)(v19) ); \
+    TRICE_PUT( (uint32_t)(v20) );
+
+//! TRICE32_21 writes trice data as fast as possible in a buffer.
+#define TRICE32_21( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER tid; CNTC(84); \
+    TRICE_PUT32_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! trice32m_21 writes trice data as fast as possible in a buffer.
+#define trice32m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(84)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! Trice32m_21 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(84)<<16) | ts ); \
+    TRICE_PUT32_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! TRice32m_21 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 84 ) \
+    TRICE_PUT32_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_22 writes 22 32-bit values.
+#define TRICE_PUT32_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) ); \
+    TRICE_PUT( (uint32_t)(v19) ); \
+    TRICE_PUT( (uint32_t)(v20) ); \
+    TRICE_PUT( (uint32_t)(v21) );
+
+//! TRICE32_22 writes trice data as fast as possible in a buffer.
+#define TRICE32_22( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER tid; CNTC(88); \
+    TRICE_PUT32_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! trice32m_22 writes trice data as fast as possible in a buffer.
+#define trice32m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(88)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! Trice32m_22 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(88)<<16) | ts ); \
+    TRICE_PUT32_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! TRice32m_22 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 88 ) \
+    TRICE_PUT32_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_23 writes 23 32-bit values.
+#define TRICE_PUT32_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) ); \
+    TRICE_PUT( (uint32_t)(v19) ); \
+    TRICE_PUT( (uint32_t)(v20) ); \
+    TRICE_PUT( (uint32_t)(v21) ); \
+    TRICE_PUT( (uint32_t)(v22) );
+
+//! TRICE32_23 writes trice data as fast as possible in a buffer.
+#define TRICE32_23( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER tid; CNTC(92); \
+    TRICE_PUT32_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! trice32m_23 writes trice data as fast as possible in a buffer.
+#define trice32m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(92)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! Trice32m_23 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(92)<<16) | ts ); \
+    TRICE_PUT32_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! TRice32m_23 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 92 ) \
+    TRICE_PUT32_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_24 writes 24 32-bit values.
+#define TRICE_PUT32_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) ); \
+    TRICE_PUT( (uint32_t)(v19) ); \
+    TRICE_PUT( (uint32_t)(v20) ); \
+    TRICE_PUT( (uint32_t)(v21) ); \
+    TRICE_PUT( (uint32_t)(v22) ); \
+    TRICE_PUT( (uint32_t)(v23) );
+
+//! TRICE32_24 writes trice data as fast as possible in a buffer.
+#define TRICE32_24( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER tid; CNTC(96); \
+    TRICE_PUT32_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! trice32m_24 writes trice data as fast as possible in a buffer.
+#define trice32m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(96)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! Trice32m_24 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(96)<<16) | ts ); \
+    TRICE_PUT32_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! TRice32m_24 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 96 ) \
+    TRICE_PUT32_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_25 writes 25 32-bit values.
+#define TRICE_PUT32_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) ); \
+    TRICE_PUT( (uint32_t)(v19) ); \
+    TRICE_PUT( (uint32_t)(v20) ); \
+    TRICE_PUT( (uint32_t)(v21) ); \
+    TRICE_PUT( (uint32_t)(v22) ); \
+    TRICE_PUT( (uint32_t)(v23) ); \
+    TRICE_PUT( (uint32_t)(v24) );
+
+//! TRICE32_25 writes trice data as fast as possible in a buffer.
+#define TRICE32_25( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER tid; CNTC(100); \
+    TRICE_PUT32_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! trice32m_25 writes trice data as fast as possible in a buffer.
+#define trice32m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(100)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! Trice32m_25 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(100)<<16) | ts ); \
+    TRICE_PUT32_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! TRice32m_25 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 100 ) \
+    TRICE_PUT32_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_26 writes 26 32-bit values.
+#define TRICE_PUT32_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) ); \
+    TRICE_PUT( (uint32_t)(v19) ); \
+    TRICE_PUT( (uint32_t)(v20) ); \
+    TRICE_PUT( (uint32_t)(v21) ); \
+    TRICE_PUT( (uint32_t)(v22) ); \
+    TRICE_PUT( (uint32_t)(v23) ); \
+    TRICE_PUT( (uint32_t)(v24) ); \
+    TRICE_PUT( (uint32_t)(v25) );
+
+//! TRICE32_26 writes trice data as fast as possible in a buffer.
+#define TRICE32_26( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER tid; CNTC(104); \
+    TRICE_PUT32_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! trice32m_26 writes trice data as fast as possible in a buffer.
+#define trice32m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(104)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! Trice32m_26 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(104)<<16) | ts ); \
+    TRICE_PUT32_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! TRice32m_26 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 104 ) \
+    TRICE_PUT32_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_27 writes 27 32-bit values.
+#define TRICE_PUT32_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) ); \
+    TRICE_PUT( (uint32_t)(v19) ); \
+    TRICE_PUT( (uint32_t)(v20) ); \
+    TRICE_PUT( (uint32_t)(v21) ); \
+    TRICE_PUT( (uint32_t)(v22) ); \
+    TRICE_PUT( (uint32_t)(v23) ); \
+    TRICE_PUT( (uint32_t)(v24) ); \
+    TRICE_PUT( (uint32_t)(v25) ); \
+    TRICE_PUT( (uint32_t)(v26) );
+
+//! TRICE32_27 writes trice data as fast as possible in a buffer.
+#define TRICE32_27( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER tid; CNTC(108); \
+    TRICE_PUT32_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! trice32m_27 writes trice data as fast as possible in a buffer.
+#define trice32m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(108)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! Trice32m_27 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(108)<<16) | ts ); \
+    TRICE_PUT32_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! TRice32m_27 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 108 ) \
+    TRICE_PUT32_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_28 writes 28 32-bit values.
+#define TRICE_PUT32_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) ); \
+    TRICE_PUT( (uint32_t)(v19) ); \
+    TRICE_PUT( (uint32_t)(v20) ); \
+    TRICE_PUT( (uint32_t)(v21) ); \
+    TRICE_PUT( (uint32_t)(v22) ); \
+    TRICE_PUT( (uint32_t)(v23) ); \
+    TRICE_PUT( (uint32_t)(v24) ); \
+    TRICE_PUT( (uint32_t)(v25) ); \
+    TRICE_PUT( (uint32_t)(v26) ); \
+    TRICE_PUT( (uint32_t)(v27) );
+
+//! TRICE32_28 writes trice data as fast as possible in a buffer.
+#define TRICE32_28( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER tid; CNTC(112); \
+    TRICE_PUT32_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! trice32m_28 writes trice data as fast as possible in a buffer.
+#define trice32m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(112)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! Trice32m_28 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(112)<<16) | ts ); \
+    TRICE_PUT32_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! TRice32m_28 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 112 ) \
+    TRICE_PUT32_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_29 writes 29 32-bit values.
+#define TRICE_PUT32_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) ); \
+    TRICE_PUT( (uint32_t)(v19) ); \
+    TRICE_PUT( (uint32_t)(v20) ); \
+    TRICE_PUT( (uint32_t)(v21) ); \
+    TRICE_PUT( (uint32_t)(v22) ); \
+    TRICE_PUT( (uint32_t)(v23) ); \
+    TRICE_PUT( (uint32_t)(v24) ); \
+    TRICE_PUT( (uint32_t)(v25) ); \
+    TRICE_PUT( (uint32_t)(v26) ); \
+    TRICE_PUT( (uint32_t)(v27) ); \
+    TRICE_PUT( (uint32_t)(v28) );
+
+//! TRICE32_29 writes trice data as fast as possible in a buffer.
+#define TRICE32_29( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER tid; CNTC(116); \
+    TRICE_PUT32_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! trice32m_29 writes trice data as fast as possible in a buffer.
+#define trice32m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(116)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! Trice32m_29 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(116)<<16) | ts ); \
+    TRICE_PUT32_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! TRice32m_29 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 116 ) \
+    TRICE_PUT32_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_30 writes 30 32-bit values.
+#define TRICE_PUT32_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) ); \
+    TRICE_PUT( (uint32_t)(v19) ); \
+    TRICE_PUT( (uint32_t)(v20) ); \
+    TRICE_PUT( (uint32_t)(v21) ); \
+    TRICE_PUT( (uint32_t)(v22) ); \
+    TRICE_PUT( (uint32_t)(v23) ); \
+    TRICE_PUT( (uint32_t)(v24) ); \
+    TRICE_PUT( (uint32_t)(v25) ); \
+    TRICE_PUT( (uint32_t)(v26) ); \
+    TRICE_PUT( (uint32_t)(v27) ); \
+    TRICE_PUT( (uint32_t)(v28) ); \
+    TRICE_PUT( (uint32_t)(v29) );
+
+//! TRICE32_30 writes trice data as fast as possible in a buffer.
+#define TRICE32_30( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER tid; CNTC(120); \
+    TRICE_PUT32_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! trice32m_30 writes trice data as fast as possible in a buffer.
+#define trice32m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(120)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! Trice32m_30 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(120)<<16) | ts ); \
+    TRICE_PUT32_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! TRice32m_30 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 120 ) \
+    TRICE_PUT32_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_31 writes 31 32-bit values.
+#define TRICE_PUT32_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) ); \
+    TRICE_PUT( (uint32_t)(v19) ); \
+    TRICE_PUT( (uint32_t)(v20) ); \
+    TRICE_PUT( (uint32_t)(v21) ); \
+    TRICE_PUT( (uint32_t)(v22) ); \
+    TRICE_PUT( (uint32_t)(v23) ); \
+    TRICE_PUT( (uint32_t)(v24) ); \
+    TRICE_PUT( (uint32_t)(v25) ); \
+    TRICE_PUT( (uint32_t)(v26) ); \
+    TRICE_PUT( (uint32_t)(v27) ); \
+    TRICE_PUT( (uint32_t)(v28) ); \
+    TRICE_PUT( (uint32_t)(v29) ); \
+    TRICE_PUT( (uint32_t)(v30) );
+
+//! TRICE32_31 writes trice data as fast as possible in a buffer.
+#define TRICE32_31( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER tid; CNTC(124); \
+    TRICE_PUT32_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! trice32m_31 writes trice data as fast as possible in a buffer.
+#define trice32m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(124)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! Trice32m_31 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(124)<<16) | ts ); \
+    TRICE_PUT32_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! TRice32m_31 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 124 ) \
+    TRICE_PUT32_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT32_32 writes 32 32-bit values.
+#define TRICE_PUT32_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_PUT( (uint32_t)(v0) ); \
+    TRICE_PUT( (uint32_t)(v1) ); \
+    TRICE_PUT( (uint32_t)(v2) ); \
+    TRICE_PUT( (uint32_t)(v3) ); \
+    TRICE_PUT( (uint32_t)(v4) ); \
+    TRICE_PUT( (uint32_t)(v5) ); \
+    TRICE_PUT( (uint32_t)(v6) ); \
+    TRICE_PUT( (uint32_t)(v7) ); \
+    TRICE_PUT( (uint32_t)(v8) ); \
+    TRICE_PUT( (uint32_t)(v9) ); \
+    TRICE_PUT( (uint32_t)(v10) ); \
+    TRICE_PUT( (uint32_t)(v11) ); \
+    TRICE_PUT( (uint32_t)(v12) ); \
+    TRICE_PUT( (uint32_t)(v13) ); \
+    TRICE_PUT( (uint32_t)(v14) ); \
+    TRICE_PUT( (uint32_t)(v15) ); \
+    TRICE_PUT( (uint32_t)(v16) ); \
+    TRICE_PUT( (uint32_t)(v17) ); \
+    TRICE_PUT( (uint32_t)(v18) ); \
+    TRICE_PUT( (uint32_t)(v19) ); \
+    TRICE_PUT( (uint32_t)(v20) ); \
+    TRICE_PUT( (uint32_t)(v21) ); \
+    TRICE_PUT( (uint32_t)(v22) ); \
+    TRICE_PUT( (uint32_t)(v23) ); \
+    TRICE_PUT( (uint32_t)(v24) ); \
+    TRICE_PUT( (uint32_t)(v25) ); \
+    TRICE_PUT( (uint32_t)(v26) ); \
+    TRICE_PUT( (uint32_t)(v27) ); \
+    TRICE_PUT( (uint32_t)(v28) ); \
+    TRICE_PUT( (uint32_t)(v29) ); \
+    TRICE_PUT( (uint32_t)(v30) ); \
+    TRICE_PUT( (uint32_t)(v31) );
+
+//! TRICE32_32 writes trice data as fast as possible in a buffer.
+#define TRICE32_32( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER tid; LCNT(128); \
+    TRICE_PUT32_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+//! trice32m_32 writes trice data as fast as possible in a buffer.
+#define trice32m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(128)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT32_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+//! Trice32m_32 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice32m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(128)<<16) | ts ); \
+    TRICE_PUT32_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+//! TRice32m_32 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice32m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 128 ) \
+    TRICE_PUT32_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+#ifdef TRICE_CLEAN
+
+#define trice32_13( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) //!< trice32_13 is a macro calling a function to reduce code size.
+#define trice32_14( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) //!< trice32_14 is a macro calling a function to reduce code size.
+#define trice32_15( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) //!< trice32_15 is a macro calling a function to reduce code size.
+#define trice32_16( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) //!< trice32_16 is a macro calling a function to reduce code size.
+#define trice32_17( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) //!< trice32_17 is a macro calling a function to reduce code size.
+#define trice32_18( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) //!< trice32_18 is a macro calling a function to reduce code size.
+#define trice32_19( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) //!< trice32_19 is a macro calling a function to reduce code size.
+#define trice32_20( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) //!< trice32_20 is a macro calling a function to reduce code size.
+#define trice32_21( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) //!< trice32_21 is a macro calling a function to reduce code size.
+#define trice32_22( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) //!< trice32_22 is a macro calling a function to reduce code size.
+#define trice32_23( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) //!< trice32_23 is a macro calling a function to reduce code size.
+#define trice32_24( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) //!< trice32_24 is a macro calling a function to reduce code size.
+#define trice32_25( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) //!< trice32_25 is a macro calling a function to reduce code size.
+#define trice32_26( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) //!< trice32_26 is a macro calling a function to reduce code size.
+#define trice32_27( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) //!< trice32_27 is a macro calling a function to reduce code size.
+#define trice32_28( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) //!< trice32_28 is a macro calling a function to reduce code size.
+#define trice32_29( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) //!< trice32_29 is a macro calling a function to reduce code size.
+#define trice32_30( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) //!< trice32_30 is a macro calling a function to reduce code size.
+#define trice32_31( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) //!< trice32_31 is a macro calling a function to reduce code size.
+#define trice32_32( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) //!< trice32_32 is a macro calling a function to reduce code size.
+#define Trice32_13( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) //!< Trice32_13 is a macro calling a function to reduce code size.
+#define Trice32_14( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) //!< Trice32_14 is a macro calling a function to reduce code size.
+#define Trice32_15( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) //!< Trice32_15 is a macro calling a function to reduce code size.
+#define Trice32_16( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) //!< Trice32_16 is a macro calling a function to reduce code size.
+#define Trice32_17( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) //!< Trice32_17 is a macro calling a function to reduce code size.
+#define Trice32_18( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) //!< Trice32_18 is a macro calling a function to reduce code size.
+#define Trice32_19( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) //!< Trice32_19 is a macro calling a function to reduce code size.
+#define Trice32_20( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) //!< Trice32_20 is a macro calling a function to reduce code size.
+#define Trice32_21( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) //!< Trice32_21 is a macro calling a function to reduce code size.
+#define Trice32_22( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) //!< Trice32_22 is a macro calling a function to reduce code size.
+#define Trice32_23( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) //!< Trice32_23 is a macro calling a function to reduce code size.
+#define Trice32_24( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) //!< Trice32_24 is a macro calling a function to reduce code size.
+#define Trice32_25( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) //!< Trice32_25 is a macro calling a function to reduce code size.
+#define Trice32_26( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) //!< Trice32_26 is a macro calling a function to reduce code size.
+#define Trice32_27( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) //!< Trice32_27 is a macro calling a function to reduce code size.
+#define Trice32_28( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) //!< Trice32_28 is a macro calling a function to reduce code size.
+#define Trice32_29( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) //!< Trice32_29 is a macro calling a function to reduce code size.
+#define Trice32_30( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) //!< Trice32_30 is a macro calling a function to reduce code size.
+#define Trice32_31( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) //!< Trice32_31 is a macro calling a function to reduce code size.
+#define Trice32_32( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) //!< Trice32_32 is a macro calling a function to reduce code size.
+#define TRice32_13( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) //!< TRice32_13 is a macro calling a function to reduce code size.
+#define TRice32_14( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) //!< TRice32_14 is a macro calling a function to reduce code size.
+#define TRice32_15( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) //!< TRice32_15 is a macro calling a function to reduce code size.
+#define TRice32_16( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) //!< TRice32_16 is a macro calling a function to reduce code size.
+#define TRice32_17( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) //!< TRice32_17 is a macro calling a function to reduce code size.
+#define TRice32_18( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) //!< TRice32_18 is a macro calling a function to reduce code size.
+#define TRice32_19( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) //!< TRice32_19 is a macro calling a function to reduce code size.
+#define TRice32_20( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) //!< TRice32_20 is a macro calling a function to reduce code size.
+#define TRice32_21( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) //!< TRice32_21 is a macro calling a function to reduce code size.
+#define TRice32_22( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) //!< TRice32_22 is a macro calling a function to reduce code size.
+#define TRice32_23( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) //!< TRice32_23 is a macro calling a function to reduce code size.
+#define TRice32_24( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) //!< TRice32_24 is a macro calling a function to reduce code size.
+#define TRice32_25( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) //!< TRice32_25 is a macro calling a function to reduce code size.
+#define TRice32_26( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) //!< TRice32_26 is a macro calling a function to reduce code size.
+#define TRice32_27( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) //!< TRice32_27 is a macro calling a function to reduce code size.
+#define TRice32_28( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) //!< TRice32_28 is a macro calling a function to reduce code size.
+#define TRice32_29( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) //!< TRice32_29 is a macro calling a function to reduce code size.
+#define TRice32_30( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) //!< TRice32_30 is a macro calling a function to reduce code size.
+#define TRice32_31( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) //!< TRice32_31 is a macro calling a function to reduce code size.
+#define TRice32_32( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) //!< TRice32_32 is a macro calling a function to reduce code size.
+
+#else // #ifdef TRICE_CLEAN
+
+#define trice32_13( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) trice32fn_13( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12) ) //!< trice32_13 is a macro calling a function to reduce code size.
+#define trice32_14( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) trice32fn_14( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13) ) //!< trice32_14 is a macro calling a function to reduce code size.
+#define trice32_15( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) trice32fn_15( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14) ) //!< trice32_15 is a macro calling a function to reduce code size.
+#define trice32_16( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) trice32fn_16( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15) ) //!< trice32_16 is a macro calling a function to reduce code size.
+#define trice32_17( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) trice32fn_17( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16) ) //!< trice32_17 is a macro calling a function to reduce code size.
+#define trice32_18( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) trice32fn_18( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17) ) //!< trice32_18 is a macro calling a function to reduce code size.
+#define trice32_19( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) trice32fn_19( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18) ) //!< trice32_19 is a macro calling a function to reduce code size.
+#define trice32_20( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) trice32fn_20( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19) ) //!< trice32_20 is a macro calling a function to reduce code size.
+#define trice32_21( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) trice32fn_21( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20) ) //!< trice32_21 is a macro calling a function to reduce code size.
+#define trice32_22( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) trice32fn_22( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21) ) //!< trice32_22 is a macro calling a function to reduce code size.
+#define trice32_23( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) trice32fn_23( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22) ) //!< trice32_23 is a macro calling a function to reduce code size.
+#define trice32_24( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) trice32fn_24( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23) ) //!< trice32_24 is a macro calling a function to reduce code size.
+#define trice32_25( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) trice32fn_25( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24) ) //!< trice32_25 is a macro calling a function to reduce code size.
+#define trice32_26( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) trice32fn_26( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25) ) //!< trice32_26 is a macro calling a function to reduce code size.
+#define trice32_27( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) trice32fn_27( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26) ) //!< trice32_27 is a macro calling a function to reduce code size.
+#define trice32_28( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) trice32fn_28( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27) ) //!< trice32_28 is a macro calling a function to reduce code size.
+#define trice32_29( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) trice32fn_29( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27), (uint32_t)(v28) ) //!< trice32_29 is a macro calling a function to reduce code size.
+#define trice32_30( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) trice32fn_30( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27), (uint32_t)(v28), (uint32_t)(v29) ) //!< trice32_30 is a macro calling a function to reduce code size.
+#define trice32_31( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) trice32fn_31( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27), (uint32_t)(v28), (uint32_t)(v29), (uint32_t)(v30) ) //!< trice32_31 is a macro calling a function to reduce code size.
+#define trice32_32( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) trice32fn_32( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27), (uint32_t)(v28), (uint32_t)(v29), (uint32_t)(v30), (uint32_t)(v31) ) //!< trice32_32 is a macro calling a function to reduce code size.
+#define Trice32_13( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) Trice32fn_13( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12) ) //!< Trice32_13 is a macro calling a function to reduce code size.
+#define Trice32_14( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) Trice32fn_14( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13) ) //!< Trice32_14 is a macro calling a function to reduce code size.
+#define Trice32_15( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) Trice32fn_15( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14) ) //!< Trice32_15 is a macro calling a function to reduce code size.
+#define Trice32_16( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) Trice32fn_16( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15) ) //!< Trice32_16 is a macro calling a function to reduce code size.
+#define Trice32_17( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) Trice32fn_17( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16) ) //!< Trice32_17 is a macro calling a function to reduce code size.
+#define Trice32_18( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) Trice32fn_18( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17) ) //!< Trice32_18 is a macro calling a function to reduce code size.
+#define Trice32_19( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) Trice32fn_19( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18) ) //!< Trice32_19 is a macro calling a function to reduce code size.
+#define Trice32_20( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) Trice32fn_20( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19) ) //!< Trice32_20 is a macro calling a function to reduce code size.
+#define Trice32_21( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) Trice32fn_21( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20) ) //!< Trice32_21 is a macro calling a function to reduce code size.
+#define Trice32_22( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) Trice32fn_22( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21) ) //!< Trice32_22 is a macro calling a function to reduce code size.
+#define Trice32_23( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) Trice32fn_23( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22) ) //!< Trice32_23 is a macro calling a function to reduce code size.
+#define Trice32_24( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) Trice32fn_24( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23) ) //!< Trice32_24 is a macro calling a function to reduce code size.
+#define Trice32_25( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) Trice32fn_25( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24) ) //!< Trice32_25 is a macro calling a function to reduce code size.
+#define Trice32_26( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) Trice32fn_26( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25) ) //!< Trice32_26 is a macro calling a function to reduce code size.
+#define Trice32_27( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) Trice32fn_27( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26) ) //!< Trice32_27 is a macro calling a function to reduce code size.
+#define Trice32_28( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) Trice32fn_28( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27) ) //!< Trice32_28 is a macro calling a function to reduce code size.
+#define Trice32_29( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) Trice32fn_29( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27), (uint32_t)(v28) ) //!< Trice32_29 is a macro calling a function to reduce code size.
+#define Trice32_30( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) Trice32fn_30( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27), (uint32_t)(v28), (uint32_t)(v29) ) //!< Trice32_30 is a macro calling a function to reduce code size.
+#define Trice32_31( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) Trice32fn_31( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27), (uint32_t)(v28), (uint32_t)(v29), (uint32_t)(v30) ) //!< Trice32_31 is a macro calling a function to reduce code size.
+#define Trice32_32( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) Trice32fn_32( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27), (uint32_t)(v28), (uint32_t)(v29), (uint32_t)(v30), (uint32_t)(v31) ) //!< Trice32_32 is a macro calling a function to reduce code size.
+#define TRice32_13( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) TRice32fn_13( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12) ) //!< TRice32_13 is a macro calling a function to reduce code size.
+#define TRice32_14( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) TRice32fn_14( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13) ) //!< TRice32_14 is a macro calling a function to reduce code size.
+#define TRice32_15( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) TRice32fn_15( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14) ) //!< TRice32_15 is a macro calling a function to reduce code size.
+#define TRice32_16( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) TRice32fn_16( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15) ) //!< TRice32_16 is a macro calling a function to reduce code size.
+#define TRice32_17( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) TRice32fn_17( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16) ) //!< TRice32_17 is a macro calling a function to reduce code size.
+#define TRice32_18( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) TRice32fn_18( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17) ) //!< TRice32_18 is a macro calling a function to reduce code size.
+#define TRice32_19( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) TRice32fn_19( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18) ) //!< TRice32_19 is a macro calling a function to reduce code size.
+#define TRice32_20( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) TRice32fn_20( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19) ) //!< TRice32_20 is a macro calling a function to reduce code size.
+#define TRice32_21( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) TRice32fn_21( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20) ) //!< TRice32_21 is a macro calling a function to reduce code size.
+#define TRice32_22( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) TRice32fn_22( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21) ) //!< TRice32_22 is a macro calling a function to reduce code size.
+#define TRice32_23( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) TRice32fn_23( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22) ) //!< TRice32_23 is a macro calling a function to reduce code size.
+#define TRice32_24( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) TRice32fn_24( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23) ) //!< TRice32_24 is a macro calling a function to reduce code size.
+#define TRice32_25( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) TRice32fn_25( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24) ) //!< TRice32_25 is a macro calling a function to reduce code size.
+#define TRice32_26( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) TRice32fn_26( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25) ) //!< TRice32_26 is a macro calling a function to reduce code size.
+#define TRice32_27( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) TRice32fn_27( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26) ) //!< TRice32_27 is a macro calling a function to reduce code size.
+#define TRice32_28( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) TRice32fn_28( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27) ) //!< TRice32_28 is a macro calling a function to reduce code size.
+#define TRice32_29( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) TRice32fn_29( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27), (uint32_t)(v28) ) //!< TRice32_29 is a macro calling a function to reduce code size.
+#define TRice32_30( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) TRice32fn_30( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27), (uint32_t)(v28), (uint32_t)(v29) ) //!< TRice32_30 is a macro calling a function to reduce code size.
+#define TRice32_31( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) TRice32fn_31( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27), (uint32_t)(v28), (uint32_t)(v29), (uint32_t)(v30) ) //!< TRice32_31 is a macro calling a function to reduce code size.
+#define TRice32_32( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) TRice32fn_32( tid, (uint32_t)(v0), (uint32_t)(v1), (uint32_t)(v2), (uint32_t)(v3), (uint32_t)(v4), (uint32_t)(v5), (uint32_t)(v6), (uint32_t)(v7), (uint32_t)(v8), (uint32_t)(v9), (uint32_t)(v10), (uint32_t)(v11), (uint32_t)(v12), (uint32_t)(v13), (uint32_t)(v14), (uint32_t)(v15), (uint32_t)(v16), (uint32_t)(v17), (uint32_t)(v18), (uint32_t)(v19), (uint32_t)(v20), (uint32_t)(v21), (uint32_t)(v22), (uint32_t)(v23), (uint32_t)(v24), (uint32_t)(v25), (uint32_t)(v26), (uint32_t)(v27), (uint32_t)(v28), (uint32_t)(v29), (uint32_t)(v30), (uint32_t)(v31) ) //!< TRice32_32 is a macro calling a function to reduce code size.
+
+void trice32fn_13( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12 );
+void trice32fn_14( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13 );
+void trice32fn_15( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14 );
+void trice32fn_16( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15 );
+void trice32fn_17( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16 );
+void trice32fn_18( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17 );
+void trice32fn_19( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18 );
+void trice32fn_20( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19 );
+void trice32fn_21( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20 );
+void trice32fn_22( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21 );
+void trice32fn_23( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22 );
+void trice32fn_24( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23 );
+void trice32fn_25( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24 );
+void trice32fn_26( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25 );
+void trice32fn_27( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26 );
+void trice32fn_28( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27 );
+void trice32fn_29( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28 );
+void trice32fn_30( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29 );
+void trice32fn_31( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29, uint32_t v30 );
+void trice32fn_32( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29, uint32_t v30, uint32_t v31 );
+void Trice32fn_13( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12 );
+void Trice32fn_14( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13 );
+void Trice32fn_15( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14 );
+void Trice32fn_16( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15 );
+void Trice32fn_17( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16 );
+void Trice32fn_18( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17 );
+void Trice32fn_19( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18 );
+void Trice32fn_20( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19 );
+void Trice32fn_21( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20 );
+void Trice32fn_22( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21 );
+void Trice32fn_23( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22 );
+void Trice32fn_24( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23 );
+void Trice32fn_25( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24 );
+void Trice32fn_26( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25 );
+void Trice32fn_27( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26 );
+void Trice32fn_28( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27 );
+void Trice32fn_29( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28 );
+void Trice32fn_30( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29 );
+void Trice32fn_31( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29, uint32_t v30 );
+void Trice32fn_32( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29, uint32_t v30, uint32_t v31 );
+void TRice32fn_13( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12 );
+void TRice32fn_14( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13 );
+void TRice32fn_15( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14 );
+void TRice32fn_16( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15 );
+void TRice32fn_17( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16 );
+void TRice32fn_18( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17 );
+void TRice32fn_19( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18 );
+void TRice32fn_20( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19 );
+void TRice32fn_21( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20 );
+void TRice32fn_22( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21 );
+void TRice32fn_23( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22 );
+void TRice32fn_24( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23 );
+void TRice32fn_25( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24 );
+void TRice32fn_26( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25 );
+void TRice32fn_27( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26 );
+void TRice32fn_28( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27 );
+void TRice32fn_29( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28 );
+void TRice32fn_30( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29 );
+void TRice32fn_31( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29, uint32_t v30 );
+void TRice32fn_32( uint16_t tid, uint32_t v0, uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5, uint32_t v6, uint32_t v7, uint32_t v8, uint32_t v9, uint32_t v10, uint32_t v11, uint32_t v12, uint32_t v13, uint32_t v14, uint32_t v15, uint32_t v16, uint32_t v17, uint32_t v18, uint32_t v19, uint32_t v20, uint32_t v21, uint32_t v22, uint32_t v23, uint32_t v24, uint32_t v25, uint32_t v26, uint32_t v27, uint32_t v28, uint32_t v29, uint32_t v30, uint32_t v31 );
+
+#endif // #else // #ifdef TRICE_CLEAN
+
+#if TRICE_DEFAULT_PARAMETER_BIT_WIDTH == 32
+
+#define TRICE_13 TRICE32_13 //!< Default parameter bit width for 13 parameter count TRICE is 32.
+#define TRICE_14 TRICE32_14 //!< Default parameter bit width for 14 parameter count TRICE is 32.
+#define TRICE_15 TRICE32_15 //!< Default parameter bit width for 15 parameter count TRICE is 32.
+#define TRICE_16 TRICE32_16 //!< Default parameter bit width for 16 parameter count TRICE is 32.
+#define TRICE_17 TRICE32_17 //!< Default parameter bit width for 17 parameter count TRICE is 32.
+#define TRICE_18 TRICE32_18 //!< Default parameter bit width for 18 parameter count TRICE is 32.
+#define TRICE_19 TRICE32_19 //!< Default parameter bit width for 19 parameter count TRICE is 32.
+#define TRICE_20 TRICE32_20 //!< Default parameter bit width for 20 parameter count TRICE is 32.
+#define TRICE_21 TRICE32_21 //!< Default parameter bit width for 21 parameter count TRICE is 32.
+#define TRICE_22 TRICE32_22 //!< Default parameter bit width for 22 parameter count TRICE is 32.
+#define TRICE_23 TRICE32_23 //!< Default parameter bit width for 23 parameter count TRICE is 32.
+#define TRICE_24 TRICE32_24 //!< Default parameter bit width for 24 parameter count TRICE is 32.
+#define TRICE_25 TRICE32_25 //!< Default parameter bit width for 25 parameter count TRICE is 32.
+#define TRICE_26 TRICE32_26 //!< Default parameter bit width for 26 parameter count TRICE is 32.
+#define TRICE_27 TRICE32_27 //!< Default parameter bit width for 27 parameter count TRICE is 32.
+#define TRICE_28 TRICE32_28 //!< Default parameter bit width for 28 parameter count TRICE is 32.
+#define TRICE_29 TRICE32_29 //!< Default parameter bit width for 29 parameter count TRICE is 32.
+#define TRICE_30 TRICE32_30 //!< Default parameter bit width for 30 parameter count TRICE is 32.
+#define TRICE_31 TRICE32_31 //!< Default parameter bit width for 31 parameter count TRICE is 32.
+#define TRICE_32 TRICE32_32 //!< Default parameter bit width for 32 parameter count TRICE is 32.
+#define trice_13 trice32_13 //!< Default parameter bit width for 13 parameter count trice is 32.
+#define trice_14 trice32_14 //!< Default parameter bit width for 14 parameter count trice is 32.
+#define trice_15 trice32_15 //!< Default parameter bit width for 15 parameter count trice is 32.
+#define trice_16 trice32_16 //!< Default parameter bit width for 16 parameter count trice is 32.
+#define trice_17 trice32_17 //!< Default parameter bit width for 17 parameter count trice is 32.
+#define trice_18 trice32_18 //!< Default parameter bit width for 18 parameter count trice is 32.
+#define trice_19 trice32_19 //!< Default parameter bit width for 19 parameter count trice is 32.
+#define trice_20 trice32_20 //!< Default parameter bit width for 20 parameter count trice is 32.
+#define trice_21 trice32_21 //!< Default parameter bit width for 21 parameter count trice is 32.
+#define trice_22 trice32_22 //!< Default parameter bit width for 22 parameter count trice is 32.
+#define trice_23 trice32_23 //!< Default parameter bit width for 23 parameter count trice is 32.
+#define trice_24 trice32_24 //!< Default parameter bit width for 24 parameter count trice is 32.
+#define trice_25 trice32_25 //!< Default parameter bit width for 25 parameter count trice is 32.
+#define trice_26 trice32_26 //!< Default parameter bit width for 26 parameter count trice is 32.
+#define trice_27 trice32_27 //!< Default parameter bit width for 27 parameter count trice is 32.
+#define trice_28 trice32_28 //!< Default parameter bit width for 28 parameter count trice is 32.
+#define trice_29 trice32_29 //!< Default parameter bit width for 29 parameter count trice is 32.
+#define trice_30 trice32_30 //!< Default parameter bit width for 30 parameter count trice is 32.
+#define trice_31 trice32_31 //!< Default parameter bit width for 31 parameter count trice is 32.
+#define trice_32 trice32_32 //!< Default parameter bit width for 32 parameter count trice is 32.
+#define Trice_13 Trice32_13 //!< Default parameter bit width for 13 parameter count Trice is 32.
+#define Trice_14 Trice32_14 //!< Default parameter bit width for 14 parameter count Trice is 32.
+#define Trice_15 Trice32_15 //!< Default parameter bit width for 15 parameter count Trice is 32.
+#define Trice_16 Trice32_16 //!< Default parameter bit width for 16 parameter count Trice is 32.
+#define Trice_17 Trice32_17 //!< Default parameter bit width for 17 parameter count Trice is 32.
+#define Trice_18 Trice32_18 //!< Default parameter bit width for 18 parameter count Trice is 32.
+#define Trice_19 Trice32_19 //!< Default parameter bit width for 19 parameter count Trice is 32.
+#define Trice_20 Trice32_20 //!< Default parameter bit width for 20 parameter count Trice is 32.
+#define Trice_21 Trice32_21 //!< Default parameter bit width for 21 parameter count Trice is 32.
+#define Trice_22 Trice32_22 //!< Default parameter bit width for 22 parameter count Trice is 32.
+#define Trice_23 Trice32_23 //!< Default parameter bit width for 23 parameter count Trice is 32.
+#define Trice_24 Trice32_24 //!< Default parameter bit width for 24 parameter count Trice is 32.
+#define Trice_25 Trice32_25 //!< Default parameter bit width for 25 parameter count Trice is 32.
+#define Trice_26 Trice32_26 //!< Default parameter bit width for 26 parameter count Trice is 32.
+#define Trice_27 Trice32_27 //!< Default parameter bit width for 27 parameter count Trice is 32.
+#define Trice_28 Trice32_28 //!< Default parameter bit width for 28 parameter count Trice is 32.
+#define Trice_29 Trice32_29 //!< Default parameter bit width for 29 parameter count Trice is 32.
+#define Trice_30 Trice32_30 //!< Default parameter bit width for 30 parameter count Trice is 32.
+#define Trice_31 Trice32_31 //!< Default parameter bit width for 31 parameter count Trice is 32.
+#define Trice_32 Trice32_32 //!< Default parameter bit width for 32 parameter count Trice is 32.
+#define TRice_13 TRice32_13 //!< Default parameter bit width for 13 parameter count TRice is 32.
+#define TRice_14 TRice32_14 //!< Default parameter bit width for 14 parameter count TRice is 32.
+#define TRice_15 TRice32_15 //!< Default parameter bit width for 15 parameter count TRice is 32.
+#define TRice_16 TRice32_16 //!< Default parameter bit width for 16 parameter count TRice is 32.
+#define TRice_17 TRice32_17 //!< Default parameter bit width for 17 parameter count TRice is 32.
+#define TRice_18 TRice32_18 //!< Default parameter bit width for 18 parameter count TRice is 32.
+#define TRice_19 TRice32_19 //!< Default parameter bit width for 19 parameter count TRice is 32.
+#define TRice_20 TRice32_20 //!< Default parameter bit width for 20 parameter count TRice is 32.
+#define TRice_21 TRice32_21 //!< Default parameter bit width for 21 parameter count TRice is 32.
+#define TRice_22 TRice32_22 //!< Default parameter bit width for 22 parameter count TRice is 32.
+#define TRice_23 TRice32_23 //!< Default parameter bit width for 23 parameter count TRice is 32.
+#define TRice_24 TRice32_24 //!< Default parameter bit width for 24 parameter count TRice is 32.
+#define TRice_25 TRice32_25 //!< Default parameter bit width for 25 parameter count TRice is 32.
+#define TRice_26 TRice32_26 //!< Default parameter bit width for 26 parameter count TRice is 32.
+#define TRice_27 TRice32_27 //!< Default parameter bit width for 27 parameter count TRice is 32.
+#define TRice_28 TRice32_28 //!< Default parameter bit width for 28 parameter count TRice is 32.
+#define TRice_29 TRice32_29 //!< Default parameter bit width for 29 parameter count TRice is 32.
+#define TRice_30 TRice32_30 //!< Default parameter bit width for 30 parameter count TRice is 32.
+#define TRice_31 TRice32_31 //!< Default parameter bit width for 31 parameter count TRice is 32.
+#define TRice_32 TRice32_32 //!< Default parameter bit width for 32 parameter count TRice is 32.
+
+#endif // #if TRICE_DEFAULT_PARAMETER_BIT_WIDTH == 32
+
+///////////////////////////////////////////////////////////////////////////////
+// 64-bit values
+//
+
+//! TRICE_PUT64_13 writes 13 64-bit values.
+#define TRICE_PUT64_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 );
+
+//! TRICE64_13 writes trice data as fast as possible in a buffer.
+#define TRICE64_13( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER tid; CNTC(104); \
+    TRICE_PUT64_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! trice64m_13 writes trice data as fast as possible in a buffer.
+#define trice64m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(104)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! Trice64m_13 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(104)<<16) | ts ); \
+    TRICE_PUT64_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! TRice64m_13 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_13( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 104 ) \
+    TRICE_PUT64_13( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_14 writes 14 64-bit values.
+#define TRICE_PUT64_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 );
+
+//! TRICE64_14 writes trice data as fast as possible in a buffer.
+#define TRICE64_14( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER tid; CNTC(112); \
+    TRICE_PUT64_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! trice64m_14 writes trice data as fast as possible in a buffer.
+#define trice64m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(112)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! Trice64m_14 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(112)<<16) | ts ); \
+    TRICE_PUT64_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! TRice64m_14 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_14( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 112 ) \
+    TRICE_PUT64_14( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_15 writes 15 64-bit values.
+#define TRICE_PUT64_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 );
+
+//! TRICE64_15 writes trice data as fast as possible in a buffer.
+#define TRICE64_15( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER tid; CNTC(120); \
+    TRICE_PUT64_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! trice64m_15 writes trice data as fast as possible in a buffer.
+#define trice64m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(120)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! Trice64m_15 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(120)<<16) | ts ); \
+    TRICE_PUT64_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! TRice64m_15 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_15( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 120 ) \
+    TRICE_PUT64_15( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_16 writes 16 64-bit values.
+#define TRICE_PUT64_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 );
+
+//! TRICE64_16 writes trice data as fast as possible in a buffer.
+#define TRICE64_16( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER tid; LCNT(128); \
+    TRICE_PUT64_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! trice64m_16 writes trice data as fast as possible in a buffer.
+#define trice64m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(128)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! Trice64m_16 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(128)<<16) | ts ); \
+    TRICE_PUT64_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! TRice64m_16 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_16( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 128 ) \
+    TRICE_PUT64_16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_17 writes 17 64-bit values.
+#define TRICE_PUT64_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 );
+
+//! TRICE64_17 writes trice data as fast as possible in a buffer.
+#define TRICE64_17( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER tid; LCNT(136); \
+    TRICE_PUT64_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! trice64m_17 writes trice data as fast as possible in a buffer.
+#define trice64m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(136)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! Trice64m_17 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(136)<<16) | ts ); \
+    TRICE_PUT64_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! TRice64m_17 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_17( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 136 ) \
+    TRICE_PUT64_17( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_18 writes 18 64-bit values.
+#define TRICE_PUT64_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 );
+
+//! TRICE64_18 writes trice data as fast as possible in a buffer.
+#define TRICE64_18( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER tid; LCNT(144); \
+    TRICE_PUT64_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! trice64m_18 writes trice data as fast as possible in a buffer.
+#define trice64m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(144)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! Trice64m_18 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(144)<<16) | ts ); \
+    TRICE_PUT64_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! TRice64m_18 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_18( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 144 ) \
+    TRICE_PUT64_18( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_19 writes 19 64-bit values.
+#define TRICE_PUT64_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 );
+
+//! TRICE64_19 writes trice data as fast as possible in a buffer.
+#define TRICE64_19( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER tid; LCNT(152); \
+    TRICE_PUT64_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! trice64m_19 writes trice data as fast as possible in a buffer.
+#define trice64m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(152)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! Trice64m_19 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(152)<<16) | ts ); \
+    TRICE_PUT64_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! TRice64m_19 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_19( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 152 ) \
+    TRICE_PUT64_19( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_20 writes 20 64-bit values.
+#define TRICE_PUT64_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 ); \
+    TRICE_PUT64( v19 );
+
+//! TRICE64_20 writes trice data as fast as possible in a buffer.
+#define TRICE64_20( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER tid; LCNT(160); \
+    TRICE_PUT64_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! trice64m_20 writes trice data as fast as possible in a buffer.
+#define trice64m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(160)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! Trice64m_20 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(160)<<16) | ts ); \
+    TRICE_PUT64_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! TRice64m_20 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_20( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 160 ) \
+    TRICE_PUT64_20( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_21 writes 21 64-bit values.
+#define TRICE_PUT64_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 ); \
+    TRICE_PUT64( v19 ); \
+    TRICE_PUT64( v20 );
+
+//! TRICE64_21 writes trice data as fast as possible in a buffer.
+#define TRICE64_21( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER tid; LCNT(168); \
+    TRICE_PUT64_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! trice64m_21 writes trice data as fast as possible in a buffer.
+#define trice64m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(168)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! Trice64m_21 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(168)<<16) | ts ); \
+    TRICE_PUT64_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! TRice64m_21 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_21( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 168 ) \
+    TRICE_PUT64_21( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_22 writes 22 64-bit values.
+#define TRICE_PUT64_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 ); \
+    TRICE_PUT64( v19 ); \
+    TRICE_PUT64( v20 ); \
+    TRICE_PUT64( v21 );
+
+//! TRICE64_22 writes trice data as fast as possible in a buffer.
+#define TRICE64_22( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER tid; LCNT(176); \
+    TRICE_PUT64_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! trice64m_22 writes trice data as fast as possible in a buffer.
+#define trice64m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(176)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! Trice64m_22 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(176)<<16) | ts ); \
+    TRICE_PUT64_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! TRice64m_22 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_22( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 176 ) \
+    TRICE_PUT64_22( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_23 writes 23 64-bit values.
+#define TRICE_PUT64_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 ); \
+    TRICE_PUT64( v19 ); \
+    TRICE_PUT64( v20 ); \
+    TRICE_PUT64( v21 ); \
+    TRICE_PUT64( v22 );
+
+//! TRICE64_23 writes trice data as fast as possible in a buffer.
+#define TRICE64_23( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER tid; LCNT(184); \
+    TRICE_PUT64_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! trice64m_23 writes trice data as fast as possible in a buffer.
+#define trice64m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(184)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! Trice64m_23 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(184)<<16) | ts ); \
+    TRICE_PUT64_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! TRice64m_23 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_23( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 184 ) \
+    TRICE_PUT64_23( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_24 writes 24 64-bit values.
+#define TRICE_PUT64_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 ); \
+    TRICE_PUT64( v19 ); \
+    TRICE_PUT64( v20 ); \
+    TRICE_PUT64( v21 ); \
+    TRICE_PUT64( v22 ); \
+    TRICE_PUT64( v23 );
+
+//! TRICE64_24 writes trice data as fast as possible in a buffer.
+#define TRICE64_24( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER tid; LCNT(192); \
+    TRICE_PUT64_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! trice64m_24 writes trice data as fast as possible in a buffer.
+#define trice64m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(192)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! Trice64m_24 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(192)<<16) | ts ); \
+    TRICE_PUT64_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! TRice64m_24 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_24( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 192 ) \
+    TRICE_PUT64_24( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_25 writes 25 64-bit values.
+#define TRICE_PUT64_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 ); \
+    TRICE_PUT64( v19 ); \
+    TRICE_PUT64( v20 ); \
+    TRICE_PUT64( v21 ); \
+    TRICE_PUT64( v22 ); \
+    TRICE_PUT64( v23 ); \
+    TRICE_PUT64( v24 );
+
+//! TRICE64_25 writes trice data as fast as possible in a buffer.
+#define TRICE64_25( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER tid; LCNT(200); \
+    TRICE_PUT64_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! trice64m_25 writes trice data as fast as possible in a buffer.
+#define trice64m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(200)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! Trice64m_25 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(200)<<16) | ts ); \
+    TRICE_PUT64_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! TRice64m_25 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_25( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 200 ) \
+    TRICE_PUT64_25( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_26 writes 26 64-bit values.
+#define TRICE_PUT64_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 ); \
+    TRICE_PUT64( v19 ); \
+    TRICE_PUT64( v20 ); \
+    TRICE_PUT64( v21 ); \
+    TRICE_PUT64( v22 ); \
+    TRICE_PUT64( v23 ); \
+    TRICE_PUT64( v24 ); \
+    TRICE_PUT64( v25 );
+
+//! TRICE64_26 writes trice data as fast as possible in a buffer.
+#define TRICE64_26( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER tid; LCNT(208); \
+    TRICE_PUT64_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! trice64m_26 writes trice data as fast as possible in a buffer.
+#define trice64m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(208)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! Trice64m_26 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(208)<<16) | ts ); \
+    TRICE_PUT64_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! TRice64m_26 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_26( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 208 ) \
+    TRICE_PUT64_26( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_27 writes 27 64-bit values.
+#define TRICE_PUT64_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 ); \
+    TRICE_PUT64( v19 ); \
+    TRICE_PUT64( v20 ); \
+    TRICE_PUT64( v21 ); \
+    TRICE_PUT64( v22 ); \
+    TRICE_PUT64( v23 ); \
+    TRICE_PUT64( v24 ); \
+    TRICE_PUT64( v25 ); \
+    TRICE_PUT64( v26 );
+
+//! TRICE64_27 writes trice data as fast as possible in a buffer.
+#define TRICE64_27( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER tid; LCNT(216); \
+    TRICE_PUT64_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! trice64m_27 writes trice data as fast as possible in a buffer.
+#define trice64m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(216)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! Trice64m_27 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(216)<<16) | ts ); \
+    TRICE_PUT64_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! TRice64m_27 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_27( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 216 ) \
+    TRICE_PUT64_27( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_28 writes 28 64-bit values.
+#define TRICE_PUT64_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 ); \
+    TRICE_PUT64( v19 ); \
+    TRICE_PUT64( v20 ); \
+    TRICE_PUT64( v21 ); \
+    TRICE_PUT64( v22 ); \
+    TRICE_PUT64( v23 ); \
+    TRICE_PUT64( v24 ); \
+    TRICE_PUT64( v25 ); \
+    TRICE_PUT64( v26 ); \
+    TRICE_PUT64( v27 );
+
+//! TRICE64_28 writes trice data as fast as possible in a buffer.
+#define TRICE64_28( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER tid; LCNT(224); \
+    TRICE_PUT64_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! trice64m_28 writes trice data as fast as possible in a buffer.
+#define trice64m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(224)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! Trice64m_28 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(224)<<16) | ts ); \
+    TRICE_PUT64_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! TRice64m_28 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_28( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 224 ) \
+    TRICE_PUT64_28( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_29 writes 29 64-bit values.
+#define TRICE_PUT64_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 ); \
+    TRICE_PUT64( v19 ); \
+    TRICE_PUT64( v20 ); \
+    TRICE_PUT64( v21 ); \
+    TRICE_PUT64( v22 ); \
+    TRICE_PUT64( v23 ); \
+    TRICE_PUT64( v24 ); \
+    TRICE_PUT64( v25 ); \
+    TRICE_PUT64( v26 ); \
+    TRICE_PUT64( v27 ); \
+    TRICE_PUT64( v28 );
+
+//! TRICE64_29 writes trice data as fast as possible in a buffer.
+#define TRICE64_29( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER tid; LCNT(232); \
+    TRICE_PUT64_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! trice64m_29 writes trice data as fast as possible in a buffer.
+#define trice64m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(232)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! Trice64m_29 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(232)<<16) | ts ); \
+    TRICE_PUT64_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! TRice64m_29 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_29( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 232 ) \
+    TRICE_PUT64_29( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_30 writes 30 64-bit values.
+#define TRICE_PUT64_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 ); \
+    TRICE_PUT64( v19 ); \
+    TRICE_PUT64( v20 ); \
+    TRICE_PUT64( v21 ); \
+    TRICE_PUT64( v22 ); \
+    TRICE_PUT64( v23 ); \
+    TRICE_PUT64( v24 ); \
+    TRICE_PUT64( v25 ); \
+    TRICE_PUT64( v26 ); \
+    TRICE_PUT64( v27 ); \
+    TRICE_PUT64( v28 ); \
+    TRICE_PUT64( v29 );
+
+//! TRICE64_30 writes trice data as fast as possible in a buffer.
+#define TRICE64_30( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER tid; LCNT(240); \
+    TRICE_PUT64_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! trice64m_30 writes trice data as fast as possible in a buffer.
+#define trice64m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(240)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! Trice64m_30 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(240)<<16) | ts ); \
+    TRICE_PUT64_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! TRice64m_30 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_30( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 240 ) \
+    TRICE_PUT64_30( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_31 writes 31 64-bit values.
+#define TRICE_PUT64_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 ); \
+    TRICE_PUT64( v19 ); \
+    TRICE_PUT64( v20 ); \
+    TRICE_PUT64( v21 ); \
+    TRICE_PUT64( v22 ); \
+    TRICE_PUT64( v23 ); \
+    TRICE_PUT64( v24 ); \
+    TRICE_PUT64( v25 ); \
+    TRICE_PUT64( v26 ); \
+    TRICE_PUT64( v27 ); \
+    TRICE_PUT64( v28 ); \
+    TRICE_PUT64( v29 ); \
+    TRICE_PUT64( v30 );
+
+//! TRICE64_31 writes trice data as fast as possible in a buffer.
+#define TRICE64_31( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER tid; LCNT(248); \
+    TRICE_PUT64_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! trice64m_31 writes trice data as fast as possible in a buffer.
+#define trice64m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(248)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! Trice64m_31 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(248)<<16) | ts ); \
+    TRICE_PUT64_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! TRice64m_31 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_31( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 248 ) \
+    TRICE_PUT64_31( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) \
+    TRICE_LEAVE
+
+//! TRICE_PUT64_32 writes 32 64-bit values.
+#define TRICE_PUT64_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_PUT64( v0 ); \
+    TRICE_PUT64( v1 ); \
+    TRICE_PUT64( v2 ); \
+    TRICE_PUT64( v3 ); \
+    TRICE_PUT64( v4 ); \
+    TRICE_PUT64( v5 ); \
+    TRICE_PUT64( v6 ); \
+    TRICE_PUT64( v7 ); \
+    TRICE_PUT64( v8 ); \
+    TRICE_PUT64( v9 ); \
+    TRICE_PUT64( v10 ); \
+    TRICE_PUT64( v11 ); \
+    TRICE_PUT64( v12 ); \
+    TRICE_PUT64( v13 ); \
+    TRICE_PUT64( v14 ); \
+    TRICE_PUT64( v15 ); \
+    TRICE_PUT64( v16 ); \
+    TRICE_PUT64( v17 ); \
+    TRICE_PUT64( v18 ); \
+    TRICE_PUT64( v19 ); \
+    TRICE_PUT64( v20 ); \
+    TRICE_PUT64( v21 ); \
+    TRICE_PUT64( v22 ); \
+    TRICE_PUT64( v23 ); \
+    TRICE_PUT64( v24 ); \
+    TRICE_PUT64( v25 ); \
+    TRICE_PUT64( v26 ); \
+    TRICE_PUT64( v27 ); \
+    TRICE_PUT64( v28 ); \
+    TRICE_PUT64( v29 ); \
+    TRICE_PUT64( v30 ); \
+    TRICE_PUT64( v31 );
+
+//! TRICE64_32 writes trice data as fast as possible in a buffer.
+#define TRICE64_32( tid, pFmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER tid; LCNT(256); \
+    TRICE_PUT64_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+//! trice64m_32 writes trice data as fast as possible in a buffer.
+#define trice64m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(256)<<16) | (0x4000|(tid)) ); \
+    TRICE_PUT64_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+//! Trice64m_32 writes trice data with a 16-bit stamp as fast as possible in a buffer.
+#define Trice64m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER \
+    uint16_t ts = TriceStamp16(); \
+    TRICE_PUT(0x80008000|(tid<<16)|tid); \
+    TRICE_PUT_HEAD( ((uint32_t)TRICE_NC(256)<<16) | ts ); \
+    TRICE_PUT64_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+//! TRice64m_32 writes trice data with a 32-bit stamp as fast as possible in a buffer.
+#define TRice64m_32( tid, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_ENTER \
+    TRICE_PUT_ID_TS( tid, 256 ) \
+    TRICE_PUT64_32( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) \
+    TRICE_LEAVE
+
+#ifdef TRICE_CLEAN
+
+#define trice64_13( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) //!< trice64_13 is a macro calling a function to reduce code size.
+#define trice64_14( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) //!< trice64_14 is a macro calling a function to reduce code size.
+#define trice64_15( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) //!< trice64_15 is a macro calling a function to reduce code size.
+#define trice64_16( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) //!< trice64_16 is a macro calling a function to reduce code size.
+#define trice64_17( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) //!< trice64_17 is a macro calling a function to reduce code size.
+#define trice64_18( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) //!< trice64_18 is a macro calling a function to reduce code size.
+#define trice64_19( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) //!< trice64_19 is a macro calling a function to reduce code size.
+#define trice64_20( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) //!< trice64_20 is a macro calling a function to reduce code size.
+#define trice64_21( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) //!< trice64_21 is a macro calling a function to reduce code size.
+#define trice64_22( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) //!< trice64_22 is a macro calling a function to reduce code size.
+#define trice64_23( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) //!< trice64_23 is a macro calling a function to reduce code size.
+#define trice64_24( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) //!< trice64_24 is a macro calling a function to reduce code size.
+#define trice64_25( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) //!< trice64_25 is a macro calling a function to reduce code size.
+#define trice64_26( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) //!< trice64_26 is a macro calling a function to reduce code size.
+#define trice64_27( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) //!< trice64_27 is a macro calling a function to reduce code size.
+#define trice64_28( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) //!< trice64_28 is a macro calling a function to reduce code size.
+#define trice64_29( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) //!< trice64_29 is a macro calling a function to reduce code size.
+#define trice64_30( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) //!< trice64_30 is a macro calling a function to reduce code size.
+#define trice64_31( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) //!< trice64_31 is a macro calling a function to reduce code size.
+#define trice64_32( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) //!< trice64_32 is a macro calling a function to reduce code size.
+#define Trice64_13( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) //!< Trice64_13 is a macro calling a function to reduce code size.
+#define Trice64_14( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) //!< Trice64_14 is a macro calling a function to reduce code size.
+#define Trice64_15( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) //!< Trice64_15 is a macro calling a function to reduce code size.
+#define Trice64_16( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) //!< Trice64_16 is a macro calling a function to reduce code size.
+#define Trice64_17( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) //!< Trice64_17 is a macro calling a function to reduce code size.
+#define Trice64_18( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) //!< Trice64_18 is a macro calling a function to reduce code size.
+#define Trice64_19( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) //!< Trice64_19 is a macro calling a function to reduce code size.
+#define Trice64_20( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) //!< Trice64_20 is a macro calling a function to reduce code size.
+#define Trice64_21( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) //!< Trice64_21 is a macro calling a function to reduce code size.
+#define Trice64_22( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) //!< Trice64_22 is a macro calling a function to reduce code size.
+#define Trice64_23( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) //!< Trice64_23 is a macro calling a function to reduce code size.
+#define Trice64_24( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) //!< Trice64_24 is a macro calling a function to reduce code size.
+#define Trice64_25( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) //!< Trice64_25 is a macro calling a function to reduce code size.
+#define Trice64_26( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) //!< Trice64_26 is a macro calling a function to reduce code size.
+#define Trice64_27( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) //!< Trice64_27 is a macro calling a function to reduce code size.
+#define Trice64_28( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) //!< Trice64_28 is a macro calling a function to reduce code size.
+#define Trice64_29( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) //!< Trice64_29 is a macro calling a function to reduce code size.
+#define Trice64_30( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) //!< Trice64_30 is a macro calling a function to reduce code size.
+#define Trice64_31( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) //!< Trice64_31 is a macro calling a function to reduce code size.
+#define Trice64_32( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) //!< Trice64_32 is a macro calling a function to reduce code size.
+#define TRice64_13( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) //!< TRice64_13 is a macro calling a function to reduce code size.
+#define TRice64_14( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) //!< TRice64_14 is a macro calling a function to reduce code size.
+#define TRice64_15( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) //!< TRice64_15 is a macro calling a function to reduce code size.
+#define TRice64_16( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) //!< TRice64_16 is a macro calling a function to reduce code size.
+#define TRice64_17( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) //!< TRice64_17 is a macro calling a function to reduce code size.
+#define TRice64_18( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) //!< TRice64_18 is a macro calling a function to reduce code size.
+#define TRice64_19( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) //!< TRice64_19 is a macro calling a function to reduce code size.
+#define TRice64_20( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) //!< TRice64_20 is a macro calling a function to reduce code size.
+#define TRice64_21( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) //!< TRice64_21 is a macro calling a function to reduce code size.
+#define TRice64_22( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) //!< TRice64_22 is a macro calling a function to reduce code size.
+#define TRice64_23( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) //!< TRice64_23 is a macro calling a function to reduce code size.
+#define TRice64_24( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) //!< TRice64_24 is a macro calling a function to reduce code size.
+#define TRice64_25( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) //!< TRice64_25 is a macro calling a function to reduce code size.
+#define TRice64_26( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) //!< TRice64_26 is a macro calling a function to reduce code size.
+#define TRice64_27( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) //!< TRice64_27 is a macro calling a function to reduce code size.
+#define TRice64_28( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) //!< TRice64_28 is a macro calling a function to reduce code size.
+#define TRice64_29( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) //!< TRice64_29 is a macro calling a function to reduce code size.
+#define TRice64_30( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) //!< TRice64_30 is a macro calling a function to reduce code size.
+#define TRice64_31( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) //!< TRice64_31 is a macro calling a function to reduce code size.
+#define TRice64_32( fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) //!< TRice64_32 is a macro calling a function to reduce code size.
+
+#else // #ifdef TRICE_CLEAN
+
+#define trice64_13( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) trice64fn_13( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12) ) //!< trice64_13 is a macro calling a function to reduce code size.
+#define trice64_14( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) trice64fn_14( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13) ) //!< trice64_14 is a macro calling a function to reduce code size.
+#define trice64_15( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) trice64fn_15( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14) ) //!< trice64_15 is a macro calling a function to reduce code size.
+#define trice64_16( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) trice64fn_16( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15) ) //!< trice64_16 is a macro calling a function to reduce code size.
+#define trice64_17( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) trice64fn_17( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16) ) //!< trice64_17 is a macro calling a function to reduce code size.
+#define trice64_18( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) trice64fn_18( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17) ) //!< trice64_18 is a macro calling a function to reduce code size.
+#define trice64_19( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) trice64fn_19( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18) ) //!< trice64_19 is a macro calling a function to reduce code size.
+#define trice64_20( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) trice64fn_20( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19) ) //!< trice64_20 is a macro calling a function to reduce code size.
+#define trice64_21( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) trice64fn_21( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20) ) //!< trice64_21 is a macro calling a function to reduce code size.
+#define trice64_22( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) trice64fn_22( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21) ) //!< trice64_22 is a macro calling a function to reduce code size.
+#define trice64_23( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) trice64fn_23( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22) ) //!< trice64_23 is a macro calling a function to reduce code size.
+#define trice64_24( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) trice64fn_24( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23) ) //!< trice64_24 is a macro calling a function to reduce code size.
+#define trice64_25( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) trice64fn_25( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24) ) //!< trice64_25 is a macro calling a function to reduce code size.
+#define trice64_26( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) trice64fn_26( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25) ) //!< trice64_26 is a macro calling a function to reduce code size.
+#define trice64_27( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) trice64fn_27( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26) ) //!< trice64_27 is a macro calling a function to reduce code size.
+#define trice64_28( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) trice64fn_28( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27) ) //!< trice64_28 is a macro calling a function to reduce code size.
+#define trice64_29( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) trice64fn_29( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27), (uint64_t)(v28) ) //!< trice64_29 is a macro calling a function to reduce code size.
+#define trice64_30( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) trice64fn_30( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27), (uint64_t)(v28), (uint64_t)(v29) ) //!< trice64_30 is a macro calling a function to reduce code size.
+#define trice64_31( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) trice64fn_31( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27), (uint64_t)(v28), (uint64_t)(v29), (uint64_t)(v30) ) //!< trice64_31 is a macro calling a function to reduce code size.
+#define trice64_32( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) trice64fn_32( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27), (uint64_t)(v28), (uint64_t)(v29), (uint64_t)(v30), (uint64_t)(v31) ) //!< trice64_32 is a macro calling a function to reduce code size.
+#define Trice64_13( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) Trice64fn_13( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12) ) //!< Trice64_13 is a macro calling a function to reduce code size.
+#define Trice64_14( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) Trice64fn_14( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13) ) //!< Trice64_14 is a macro calling a function to reduce code size.
+#define Trice64_15( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) Trice64fn_15( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14) ) //!< Trice64_15 is a macro calling a function to reduce code size.
+#define Trice64_16( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) Trice64fn_16( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15) ) //!< Trice64_16 is a macro calling a function to reduce code size.
+#define Trice64_17( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) Trice64fn_17( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16) ) //!< Trice64_17 is a macro calling a function to reduce code size.
+#define Trice64_18( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) Trice64fn_18( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17) ) //!< Trice64_18 is a macro calling a function to reduce code size.
+#define Trice64_19( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) Trice64fn_19( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18) ) //!< Trice64_19 is a macro calling a function to reduce code size.
+#define Trice64_20( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) Trice64fn_20( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19) ) //!< Trice64_20 is a macro calling a function to reduce code size.
+#define Trice64_21( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) Trice64fn_21( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20) ) //!< Trice64_21 is a macro calling a function to reduce code size.
+#define Trice64_22( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) Trice64fn_22( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21) ) //!< Trice64_22 is a macro calling a function to reduce code size.
+#define Trice64_23( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) Trice64fn_23( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22) ) //!< Trice64_23 is a macro calling a function to reduce code size.
+#define Trice64_24( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) Trice64fn_24( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23) ) //!< Trice64_24 is a macro calling a function to reduce code size.
+#define Trice64_25( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) Trice64fn_25( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24) ) //!< Trice64_25 is a macro calling a function to reduce code size.
+#define Trice64_26( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) Trice64fn_26( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25) ) //!< Trice64_26 is a macro calling a function to reduce code size.
+#define Trice64_27( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) Trice64fn_27( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26) ) //!< Trice64_27 is a macro calling a function to reduce code size.
+#define Trice64_28( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) Trice64fn_28( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27) ) //!< Trice64_28 is a macro calling a function to reduce code size.
+#define Trice64_29( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) Trice64fn_29( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27), (uint64_t)(v28) ) //!< Trice64_29 is a macro calling a function to reduce code size.
+#define Trice64_30( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) Trice64fn_30( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27), (uint64_t)(v28), (uint64_t)(v29) ) //!< Trice64_30 is a macro calling a function to reduce code size.
+#define Trice64_31( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) Trice64fn_31( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27), (uint64_t)(v28), (uint64_t)(v29), (uint64_t)(v30) ) //!< Trice64_31 is a macro calling a function to reduce code size.
+#define Trice64_32( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) Trice64fn_32( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27), (uint64_t)(v28), (uint64_t)(v29), (uint64_t)(v30), (uint64_t)(v31) ) //!< Trice64_32 is a macro calling a function to reduce code size.
+#define TRice64_13( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12 ) TRice64fn_13( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12) ) //!< TRice64_13 is a macro calling a function to reduce code size.
+#define TRice64_14( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13 ) TRice64fn_14( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13) ) //!< TRice64_14 is a macro calling a function to reduce code size.
+#define TRice64_15( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 ) TRice64fn_15( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14) ) //!< TRice64_15 is a macro calling a function to reduce code size.
+#define TRice64_16( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 ) TRice64fn_16( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15) ) //!< TRice64_16 is a macro calling a function to reduce code size.
+#define TRice64_17( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16 ) TRice64fn_17( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16) ) //!< TRice64_17 is a macro calling a function to reduce code size.
+#define TRice64_18( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17 ) TRice64fn_18( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17) ) //!< TRice64_18 is a macro calling a function to reduce code size.
+#define TRice64_19( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18 ) TRice64fn_19( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18) ) //!< TRice64_19 is a macro calling a function to reduce code size.
+#define TRice64_20( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19 ) TRice64fn_20( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19) ) //!< TRice64_20 is a macro calling a function to reduce code size.
+#define TRice64_21( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20 ) TRice64fn_21( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20) ) //!< TRice64_21 is a macro calling a function to reduce code size.
+#define TRice64_22( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21 ) TRice64fn_22( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21) ) //!< TRice64_22 is a macro calling a function to reduce code size.
+#define TRice64_23( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22 ) TRice64fn_23( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22) ) //!< TRice64_23 is a macro calling a function to reduce code size.
+#define TRice64_24( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23 ) TRice64fn_24( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23) ) //!< TRice64_24 is a macro calling a function to reduce code size.
+#define TRice64_25( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24 ) TRice64fn_25( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24) ) //!< TRice64_25 is a macro calling a function to reduce code size.
+#define TRice64_26( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25 ) TRice64fn_26( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25) ) //!< TRice64_26 is a macro calling a function to reduce code size.
+#define TRice64_27( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26 ) TRice64fn_27( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26) ) //!< TRice64_27 is a macro calling a function to reduce code size.
+#define TRice64_28( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27 ) TRice64fn_28( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27) ) //!< TRice64_28 is a macro calling a function to reduce code size.
+#define TRice64_29( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28 ) TRice64fn_29( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27), (uint64_t)(v28) ) //!< TRice64_29 is a macro calling a function to reduce code size.
+#define TRice64_30( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29 ) TRice64fn_30( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27), (uint64_t)(v28), (uint64_t)(v29) ) //!< TRice64_30 is a macro calling a function to reduce code size.
+#define TRice64_31( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30 ) TRice64fn_31( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27), (uint64_t)(v28), (uint64_t)(v29), (uint64_t)(v30) ) //!< TRice64_31 is a macro calling a function to reduce code size.
+#define TRice64_32( tid, fmt, v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31 ) TRice64fn_32( tid, (uint64_t)(v0), (uint64_t)(v1), (uint64_t)(v2), (uint64_t)(v3), (uint64_t)(v4), (uint64_t)(v5), (uint64_t)(v6), (uint64_t)(v7), (uint64_t)(v8), (uint64_t)(v9), (uint64_t)(v10), (uint64_t)(v11), (uint64_t)(v12), (uint64_t)(v13), (uint64_t)(v14), (uint64_t)(v15), (uint64_t)(v16), (uint64_t)(v17), (uint64_t)(v18), (uint64_t)(v19), (uint64_t)(v20), (uint64_t)(v21), (uint64_t)(v22), (uint64_t)(v23), (uint64_t)(v24), (uint64_t)(v25), (uint64_t)(v26), (uint64_t)(v27), (uint64_t)(v28), (uint64_t)(v29), (uint64_t)(v30), (uint64_t)(v31) ) //!< TRice64_32 is a macro calling a function to reduce code size.
+
+void trice64fn_13( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12 );
+void trice64fn_14( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13 );
+void trice64fn_15( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14 );
+void trice64fn_16( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15 );
+void trice64fn_17( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16 );
+void trice64fn_18( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17 );
+void trice64fn_19( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18 );
+void trice64fn_20( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19 );
+void trice64fn_21( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20 );
+void trice64fn_22( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21 );
+void trice64fn_23( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22 );
+void trice64fn_24( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23 );
+void trice64fn_25( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24 );
+void trice64fn_26( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25 );
+void trice64fn_27( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26 );
+void trice64fn_28( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27 );
+void trice64fn_29( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28 );
+void trice64fn_30( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29 );
+void trice64fn_31( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29, uint64_t v30 );
+void trice64fn_32( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29, uint64_t v30, uint64_t v31 );
+void Trice64fn_13( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12 );
+void Trice64fn_14( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13 );
+void Trice64fn_15( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14 );
+void Trice64fn_16( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15 );
+void Trice64fn_17( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16 );
+void Trice64fn_18( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17 );
+void Trice64fn_19( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18 );
+void Trice64fn_20( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19 );
+void Trice64fn_21( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20 );
+void Trice64fn_22( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21 );
+void Trice64fn_23( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22 );
+void Trice64fn_24( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23 );
+void Trice64fn_25( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24 );
+void Trice64fn_26( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25 );
+void Trice64fn_27( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26 );
+void Trice64fn_28( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27 );
+void Trice64fn_29( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28 );
+void Trice64fn_30( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29 );
+void Trice64fn_31( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29, uint64_t v30 );
+void Trice64fn_32( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29, uint64_t v30, uint64_t v31 );
+void TRice64fn_13( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12 );
+void TRice64fn_14( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13 );
+void TRice64fn_15( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14 );
+void TRice64fn_16( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15 );
+void TRice64fn_17( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16 );
+void TRice64fn_18( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17 );
+void TRice64fn_19( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18 );
+void TRice64fn_20( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19 );
+void TRice64fn_21( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20 );
+void TRice64fn_22( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21 );
+void TRice64fn_23( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22 );
+void TRice64fn_24( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23 );
+void TRice64fn_25( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24 );
+void TRice64fn_26( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25 );
+void TRice64fn_27( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26 );
+void TRice64fn_28( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27 );
+void TRice64fn_29( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28 );
+void TRice64fn_30( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29 );
+void TRice64fn_31( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29, uint64_t v30 );
+void TRice64fn_32( uint16_t tid, uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3, uint64_t v4, uint64_t v5, uint64_t v6, uint64_t v7, uint64_t v8, uint64_t v9, uint64_t v10, uint64_t v11, uint64_t v12, uint64_t v13, uint64_t v14, uint64_t v15, uint64_t v16, uint64_t v17, uint64_t v18, uint64_t v19, uint64_t v20, uint64_t v21, uint64_t v22, uint64_t v23, uint64_t v24, uint64_t v25, uint64_t v26, uint64_t v27, uint64_t v28, uint64_t v29, uint64_t v30, uint64_t v31 );
+
+#endif // #else // #ifdef TRICE_CLEAN
+
+#if TRICE_DEFAULT_PARAMETER_BIT_WIDTH == 64
+
+#define TRICE_13 TRICE64_13 //!< Default parameter bit width for 13 parameter count TRICE is 64.
+#define TRICE_14 TRICE64_14 //!< Default parameter bit width for 14 parameter count TRICE is 64.
+#define TRICE_15 TRICE64_15 //!< Default parameter bit width for 15 parameter count TRICE is 64.
+#define TRICE_16 TRICE64_16 //!< Default parameter bit width for 16 parameter count TRICE is 64.
+#define TRICE_17 TRICE64_17 //!< Default parameter bit width for 17 parameter count TRICE is 64.
+#define TRICE_18 TRICE64_18 //!< Default parameter bit width for 18 parameter count TRICE is 64.
+#define TRICE_19 TRICE64_19 //!< Default parameter bit width for 19 parameter count TRICE is 64.
+#define TRICE_20 TRICE64_20 //!< Default parameter bit width for 20 parameter count TRICE is 64.
+#define TRICE_21 TRICE64_21 //!< Default parameter bit width for 21 parameter count TRICE is 64.
+#define TRICE_22 TRICE64_22 //!< Default parameter bit width for 22 parameter count TRICE is 64.
+#define TRICE_23 TRICE64_23 //!< Default parameter bit width for 23 parameter count TRICE is 64.
+#define TRICE_24 TRICE64_24 //!< Default parameter bit width for 24 parameter count TRICE is 64.
+#define TRICE_25 TRICE64_25 //!< Default parameter bit width for 25 parameter count TRICE is 64.
+#define TRICE_26 TRICE64_26 //!< Default parameter bit width for 26 parameter count TRICE is 64.
+#define TRICE_27 TRICE64_27 //!< Default parameter bit width for 27 parameter count TRICE is 64.
+#define TRICE_28 TRICE64_28 //!< Default parameter bit width for 28 parameter count TRICE is 64.
+#define TRICE_29 TRICE64_29 //!< Default parameter bit width for 29 parameter count TRICE is 64.
+#define TRICE_30 TRICE64_30 //!< Default parameter bit width for 30 parameter count TRICE is 64.
+#define TRICE_31 TRICE64_31 //!< Default parameter bit width for 31 parameter count TRICE is 64.
+#define TRICE_32 TRICE64_32 //!< Default parameter bit width for 32 parameter count TRICE is 64.
+#define trice_13 trice64_13 //!< Default parameter bit width for 13 parameter count trice is 64.
+#define trice_14 trice64_14 //!< Default parameter bit width for 14 parameter count trice is 64.
+#define trice_15 trice64_15 //!< Default parameter bit width for 15 parameter count trice is 64.
+#define trice_16 trice64_16 //!< Default parameter bit width for 16 parameter count trice is 64.
+#define trice_17 trice64_17 //!< Default parameter bit width for 17 parameter count trice is 64.
+#define trice_18 trice64_18 //!< Default parameter bit width for 18 parameter count trice is 64.
+#define trice_19 trice64_19 //!< Default parameter bit width for 19 parameter count trice is 64.
+#define trice_20 trice64_20 //!< Default parameter bit width for 20 parameter count trice is 64.
+#define trice_21 trice64_21 //!< Default parameter bit width for 21 parameter count trice is 64.
+#define trice_22 trice64_22 //!< Default parameter bit width for 22 parameter count trice is 64.
+#define trice_23 trice64_23 //!< Default parameter bit width for 23 parameter count trice is 64.
+#define trice_24 trice64_24 //!< Default parameter bit width for 24 parameter count trice is 64.
+#define trice_25 trice64_25 //!< Default parameter bit width for 25 parameter count trice is 64.
+#define trice_26 trice64_26 //!< Default parameter bit width for 26 parameter count trice is 64.
+#define trice_27 trice64_27 //!< Default parameter bit width for 27 parameter count trice is 64.
+#define trice_28 trice64_28 //!< Default parameter bit width for 28 parameter count trice is 64.
+#define trice_29 trice64_29 //!< Default parameter bit width for 29 parameter count trice is 64.
+#define trice_30 trice64_30 //!< Default parameter bit width for 30 parameter count trice is 64.
+#define trice_31 trice64_31 //!< Default parameter bit width for 31 parameter count trice is 64.
+#define trice_32 trice64_32 //!< Default parameter bit width for 32 parameter count trice is 64.
+#define Trice_13 Trice64_13 //!< Default parameter bit width for 13 parameter count Trice is 64.
+#define Trice_14 Trice64_14 //!< Default parameter bit width for 14 parameter count Trice is 64.
+#define Trice_15 Trice64_15 //!< Default parameter bit width for 15 parameter count Trice is 64.
+#define Trice_16 Trice64_16 //!< Default parameter bit width for 16 parameter count Trice is 64.
+#define Trice_17 Trice64_17 //!< Default parameter bit width for 17 parameter count Trice is 64.
+#define Trice_18 Trice64_18 //!< Default parameter bit width for 18 parameter count Trice is 64.
+#define Trice_19 Trice64_19 //!< Default parameter bit width for 19 parameter count Trice is 64.
+#define Trice_20 Trice64_20 //!< Default parameter bit width for 20 parameter count Trice is 64.
+#define Trice_21 Trice64_21 //!< Default parameter bit width for 21 parameter count Trice is 64.
+#define Trice_22 Trice64_22 //!< Default parameter bit width for 22 parameter count Trice is 64.
+#define Trice_23 Trice64_23 //!< Default parameter bit width for 23 parameter count Trice is 64.
+#define Trice_24 Trice64_24 //!< Default parameter bit width for 24 parameter count Trice is 64.
+#define Trice_25 Trice64_25 //!< Default parameter bit width for 25 parameter count Trice is 64.
+#define Trice_26 Trice64_26 //!< Default parameter bit width for 26 parameter count Trice is 64.
+#define Trice_27 Trice64_27 //!< Default parameter bit width for 27 parameter count Trice is 64.
+#define Trice_28 Trice64_28 //!< Default parameter bit width for 28 parameter count Trice is 64.
+#define Trice_29 Trice64_29 //!< Default parameter bit width for 29 parameter count Trice is 64.
+#define Trice_30 Trice64_30 //!< Default parameter bit width for 30 parameter count Trice is 64.
+#define Trice_31 Trice64_31 //!< Default parameter bit width for 31 parameter count Trice is 64.
+#define Trice_32 Trice64_32 //!< Default parameter bit width for 32 parameter count Trice is 64.
+#define TRice_13 TRice64_13 //!< Default parameter bit width for 13 parameter count TRice is 64.
+#define TRice_14 TRice64_14 //!< Default parameter bit width for 14 parameter count TRice is 64.
+#define TRice_15 TRice64_15 //!< Default parameter bit width for 15 parameter count TRice is 64.
+#define TRice_16 TRice64_16 //!< Default parameter bit width for 16 parameter count TRice is 64.
+#define TRice_17 TRice64_17 //!< Default parameter bit width for 17 parameter count TRice is 64.
+#define TRice_18 TRice64_18 //!< Default parameter bit width for 18 parameter count TRice is 64.
+#define TRice_19 TRice64_19 //!< Default parameter bit width for 19 parameter count TRice is 64.
+#define TRice_20 TRice64_20 //!< Default parameter bit width for 20 parameter count TRice is 64.
+#define TRice_21 TRice64_21 //!< Default parameter bit width for 21 parameter count TRice is 64.
+#define TRice_22 TRice64_22 //!< Default parameter bit width for 22 parameter count TRice is 64.
+#define TRice_23 TRice64_23 //!< Default parameter bit width for 23 parameter count TRice is 64.
+#define TRice_24 TRice64_24 //!< Default parameter bit width for 24 parameter count TRice is 64.
+#define TRice_25 TRice64_25 //!< Default parameter bit width for 25 parameter count TRice is 64.
+#define TRice_26 TRice64_26 //!< Default parameter bit width for 26 parameter count TRice is 64.
+#define TRice_27 TRice64_27 //!< Default parameter bit width for 27 parameter count TRice is 64.
+#define TRice_28 TRice64_28 //!< Default parameter bit width for 28 parameter count TRice is 64.
+#define TRice_29 TRice64_29 //!< Default parameter bit width for 29 parameter count TRice is 64.
+#define TRice_30 TRice64_30 //!< Default parameter bit width for 30 parameter count TRice is 64.
+#define TRice_31 TRice64_31 //!< Default parameter bit width for 31 parameter count TRice is 64.
+#define TRice_32 TRice64_32 //!< Default parameter bit width for 32 parameter count TRice is 64.
+
+#endif // #if TRICE_DEFAULT_PARAMETER_BIT_WIDTH == 64
+
+#endif // #ifndef TRICE_MAX_PARAMS_H_
@@ -14,6 +14,28 @@ static int TriceSingleDeferredOut(uint32_t* addr);
 //! TriceRingBuffer is a kind of heap for trice messages.
 uint32_t TriceRingBuffer[TRICE_DEFERRED_BUFFER_SIZE>>2] = {0};
 
+#if TRICE_DIAGNOSTICS == 1
+
+//! SingleTricesRingCountMax holds the max count of trices occurred inside the ring buffer.
+unsigned SingleTricesRingCountMax = 0;
+
+//! TriceSingleMaxWordCount is a diagnostics value usable to optimize buffer size.
+unsigned TriceSingleMaxWordCount = 0;
+
+//! TriceRingBufferDepthMax holds the max occurred ring buffer depth.
+unsigned TriceRingBufferDepthMax = 0;
+
+//! TriceRingBufferOverflowCount holds for each ring the count of dropped trices, because the ring was full.
+//! With TRICE_OVERFLOW_UNCHECKED overflows are not detected.
+unsigned TriceRingBufferOverflowCount[TRICE_RING_BUFFER_COUNT] = {0};
+
+#endif // #if TRICE_DIAGNOSTICS == 1
+
+//! SingleTricesRingCount holds the readable trices count inside TriceRingBuffer.
+unsigned SingleTricesRingCount = 0;
+
+#if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_UNCHECKED
+
 //! TriceBufferWritePosition is used by the TRICE_PUT macros.
 uint32_t* TriceBufferWritePosition = TriceRingBuffer; 
 
@@ -32,9 +54,6 @@ uint32_t* const triceRingBufferLimit = &TriceRingBuffer[TRICE_DEFERRED_BUFFER_SI
 
 #endif // #else // #ifdef XTEA_ENCRYPT_KEY
 
-//! SingleTricesRingCount holds the readable trices count inside TriceRingBuffer.
-unsigned SingleTricesRingCount = 0;
-
 //ARM5 #pragma push
 //ARM5 #pragma diag_suppress=170 //warning:  #170-D: pointer points outside of underlying object
 //! TriceRingBufferReadPosition points to a valid trice message when singleTricesRingCount > 0.
@@ -44,18 +63,6 @@ unsigned SingleTricesRingCount = 0;
 uint32_t* TriceRingBufferReadPosition = TriceRingBuffer - (TRICE_DATA_OFFSET>>2); //lint !e428 Warning 428: negative subscript (-4) in operator 'ptr-int'
 //ARM5 #pragma  pop
 
-#if TRICE_DIAGNOSTICS == 1
-
-//! SingleTricesRingCountMax holds the max count of trices occurred inside the ring buffer.
-unsigned SingleTricesRingCountMax = 0;
-
-//! TriceSingleMaxWordCount is a diagnostics value usable to optimize buffer size.
-unsigned TriceSingleMaxWordCount = 0;
-
-//! TriceRingBufferDepthMax holds the max occurred ring buffer depth.
-unsigned TriceRingBufferDepthMax = 0;
-
-#endif // #if TRICE_DIAGNOSTICS == 1
 
 //! triceNextRingBufferRead returns a single trice data buffer address. The trice are data starting at byte offset TRICE_DATA_OFFSET.
 //! Implicit assumed is SingleTricesRingCount > 0.
@@ -77,8 +84,23 @@ static uint32_t* triceNextRingBufferRead( int lastWordCount ){
     return TriceRingBufferReadPosition; //lint !e674 Warning 674: Returning address of auto through variable 'TriceRingBufferReadPosition'
 }
 
+//! TriceDepth returns the used ring buffer byte count including the trice in transfer, 0 when no trice is readable.
+size_t TriceDepth( void ){
+    if( SingleTricesRingCount == 0 ){
+        return 0;
+    }
+    int depth = (TriceBufferWritePosition - TriceRingBufferReadPosition)<<2;
+    if( depth < 0 ){
+        depth += TRICE_DEFERRED_BUFFER_SIZE;
+    }
+    return depth;
+}
+
 //! TriceTransfer needs to be called cyclically to read out the Ring Buffer.
 void TriceTransfer( void ){
+    #if TRICE_DIRECT_COALESCE_SIZE > 0
+    TriceFlush(); // The TriceTransfer period limits the direct output coalescing time.
+    #endif
     if( SingleTricesRingCount == 0 ){ // no data
         return;
     }
@@ -94,6 +116,298 @@ void TriceTransfer( void ){
     lastWordCount = TriceSingleDeferredOut(addr);
 }
 
+#else // #if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_UNCHECKED
+
+//! TRICE_RING_WORDS is the uint32 count of each ring inside TriceRingBuffer.
+#define TRICE_RING_WORDS ((TRICE_DEFERRED_BUFFER_SIZE/TRICE_RING_BUFFER_COUNT)>>2)
+
+#ifdef XTEA_ENCRYPT_KEY
+
+//! TRICE_RING_LIMIT is the index behind the usable ring space.
+//! With encryption it can happen that 4 bytes following TRICE_RING_LIMIT are used as scratch pad.
+//! See comment inside TriceSingleDeferredOut.
+#define TRICE_RING_LIMIT (TRICE_RING_WORDS - 1)
+
+#else // #ifdef XTEA_ENCRYPT_KEY
+
+//! TRICE_RING_LIMIT is the index behind the usable ring space.
+#define TRICE_RING_LIMIT TRICE_RING_WORDS
+
+#endif // #else // #ifdef XTEA_ENCRYPT_KEY
+
+//! TRICE_RING_COUNT_OFFSET is the uint32 index of the trice word count inside the TRICE_DATA_OFFSET space in front of each trice.
+//! The word count is needed to drop or to skip a trice without decoding it.
+#define TRICE_RING_COUNT_OFFSET ((TRICE_DATA_OFFSET>>2) - 1)
+
+//! TriceRingBufferWriteIndex holds for each ring the uint32 index, where the next trice gets its TRICE_DATA_OFFSET space followed by the trice data.
+unsigned TriceRingBufferWriteIndex[TRICE_RING_BUFFER_COUNT] = {0};
+
+//! TriceRingBufferReadIndex holds for each ring the uint32 index of the next trice to transfer, valid when TriceRingBufferCount is > 0.
+unsigned TriceRingBufferReadIndex[TRICE_RING_BUFFER_COUNT] = {0};
+
+//! TriceRingBufferCount holds for each ring the readable trices count.
+unsigned TriceRingBufferCount[TRICE_RING_BUFFER_COUNT] = {0};
+
+//! TriceRingBufferDepth holds for each ring the used uint32 count including the trice in transfer and the unused space in front of a wrap.
+unsigned TriceRingBufferDepth[TRICE_RING_BUFFER_COUNT] = {0};
+
+//! TriceRingBufferLost holds for each ring the count of dropped trices, not reported yet with a TRICE_LOST_ID trice.
+unsigned TriceRingBufferLost[TRICE_RING_BUFFER_COUNT] = {0};
+
+//! triceRingBufferTransferRing is the ring with a trice in transfer or TRICE_RING_BUFFER_COUNT.
+static unsigned triceRingBufferTransferRing = TRICE_RING_BUFFER_COUNT;
+
+//! triceRingBufferReleased is the uint32 count getting free in triceRingBufferTransferRing after the transfer.
+static unsigned triceRingBufferReleased = 0;
+
+#ifdef TRICE_RING_BUFFER_WEIGHTS
+
+//! triceRingBufferWeights holds for each ring the max count of trices transferred in a round.
+static const unsigned triceRingBufferWeights[TRICE_RING_BUFFER_COUNT] = TRICE_RING_BUFFER_WEIGHTS;
+
+//! triceRingBufferCredits holds for each ring the count of trices still transferable in the actual round.
+static unsigned triceRingBufferCredits[TRICE_RING_BUFFER_COUNT] = TRICE_RING_BUFFER_WEIGHTS;
+
+//! triceRingBufferNext returns the ring to read from next in weighted priority order.
+//! The rings with data are served in priority order, as long they have credits left. A new round starts, when no ring with data has credits.
+//! Implicit assumed is SingleTricesRingCount > 0.
+static unsigned triceRingBufferNext( void ){
+    for( int round = 0; round < 2; round++ ){
+        for( unsigned ring = 0; ring < TRICE_RING_BUFFER_COUNT; ring++ ){
+            if( TriceRingBufferCount[ring] && triceRingBufferCredits[ring] ){
+                triceRingBufferCredits[ring]--;
+                return ring;
+            }
+        }
+        memcpy( triceRingBufferCredits, triceRingBufferWeights, sizeof(triceRingBufferCredits) );
+    }
+    for( unsigned ring = 0; ring < TRICE_RING_BUFFER_COUNT; ring++ ){ // only rings with weight 0 have data
+        if( TriceRingBufferCount[ring] ){
+            return ring;
+        }
+    }
+    return 0;
+}
+
+#else // #ifdef TRICE_RING_BUFFER_WEIGHTS
+
+//! triceRingBufferNext returns the ring to read from next in strict priority order.
+//! Implicit assumed is SingleTricesRingCount > 0.
+static unsigned triceRingBufferNext( void ){
+    for( unsigned ring = 0; ring < TRICE_RING_BUFFER_COUNT; ring++ ){
+        if( TriceRingBufferCount[ring] ){
+            return ring;
+        }
+    }
+    return 0;
+}
+
+#endif // #else // #ifdef TRICE_RING_BUFFER_WEIGHTS
+
+#if TRICE_CYCLE_COUNTER == 1
+
+//! triceRingBufferCycle is the cycle counter of the transferred trices.
+static uint8_t triceRingBufferCycle = 0xc0;
+
+//! triceRingBufferStampCycle replaces the cycle of the trice at pData with the next transfer cycle.
+//! The rings transfer the trices not in write order, so the cycles stamped at write time would look like lost trices.
+//! Dropped trices are reported with TRICE_LOST_ID trices instead.
+static void triceRingBufferStampCycle( uint32_t* pData ){
+    uint8_t* pNC = (uint8_t*)pData;
+    switch( TRICE_TTOHS( *(uint16_t*)pNC ) >> 14 ){
+        case 0:  pNC += 10; break; // tyId ts64
+        case 1:  pNC +=  2; break; // tyId
+        default: pNC +=  6; break; // tyId tyId ts16 or tyId ts32
+    }
+    uint16_t nc = TRICE_TTOHS( *(uint16_t*)pNC );
+    if( (nc & 0x8000) == 0 ){ // A long count has no cycle, but counts nevertheless.
+        *(uint16_t*)pNC = TRICE_HTOTS( (uint16_t)((nc & 0xff00) | triceRingBufferCycle) );
+    }
+    triceRingBufferCycle++;
+}
+
+#endif // #if TRICE_CYCLE_COUNTER == 1
+
+//! triceRingBufferAdvance returns the index behind the trice at index i in ring, which is 0 after a wrap.
+//! \param pUsed gets the uint32 count used by the trice, including the space unused because of a wrap.
+static unsigned triceRingBufferAdvance( unsigned ring, unsigned i, unsigned* pUsed ){
+    unsigned used = (TRICE_DATA_OFFSET>>2) + TriceRingBuffer[ring * TRICE_RING_WORDS + i + TRICE_RING_COUNT_OFFSET];
+    i += used;
+    if( i + (TRICE_BUFFER_SIZE>>2) > TRICE_RING_LIMIT ){ // wrap now, so the next trice fits without a wrap
+        used += TRICE_RING_WORDS - i;
+        i = 0;
+    }
+    *pUsed = used;
+    return i;
+}
+
+#if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_DROP_OLDEST
+
+//! triceRingBufferDropOldest drops the oldest trice in ring, which must not be the ring with a trice in transfer.
+//! A dropped TRICE_LOST_ID trice gives its count back to TriceRingBufferLost.
+static void triceRingBufferDropOldest( unsigned ring ){
+    unsigned r = TriceRingBufferReadIndex[ring];
+    uint32_t const* pData = &TriceRingBuffer[ring * TRICE_RING_WORDS + r + (TRICE_DATA_OFFSET>>2)];
+    if( (0x3FFF & TRICE_TTOHS( *(uint16_t const*)pData )) == TRICE_LOST_ID ){
+        TriceRingBufferLost[ring] += TRICE_HTOTL( pData[1] ); // TRICE_HTOTL is its own inverse
+    }else{
+        TriceRingBufferLost[ring]++;
+        #if TRICE_DIAGNOSTICS == 1
+        TriceRingBufferOverflowCount[ring]++;
+        #endif
+    }
+    unsigned used;
+    TriceRingBufferReadIndex[ring] = triceRingBufferAdvance( ring, r, &used );
+    TriceRingBufferDepth[ring] -= used;
+    TriceRingBufferCount[ring]--;
+    SingleTricesRingCount--;
+}
+
+#endif // #if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_DROP_OLDEST
+
+#if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_BLOCK
+
+//! triceRingBufferReserved is the count of TRICE macros, which reserved space for a trice of max size in all rings.
+static unsigned triceRingBufferReserved = 0;
+
+#endif // #if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_BLOCK
+
+//! triceRingBufferWrite copies the trice at pData with wordCount uint32 values into ring and returns 1.
+//! When the trice does not fit, 0 is returned. With TRICE_OVERFLOW_DROP_OLDEST the oldest trices are dropped before, if that helps.
+static int triceRingBufferWrite( unsigned ring, uint32_t const* pData, unsigned wordCount ){
+    unsigned need = (TRICE_DATA_OFFSET>>2) + wordCount;
+    #if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_DROP_OLDEST
+    // The space of a trice in transfer is blocked until the transfer end, so dropping trices behind it does not help.
+    while( (TriceRingBufferDepth[ring] + need > TRICE_RING_WORDS) && TriceRingBufferCount[ring] && (ring != triceRingBufferTransferRing) ){
+        triceRingBufferDropOldest( ring );
+    }
+    #endif
+    if( TriceRingBufferDepth[ring] + need > TRICE_RING_WORDS ){
+        return 0;
+    }
+    unsigned w = TriceRingBufferWriteIndex[ring];
+    uint32_t* pSlot = &TriceRingBuffer[ring * TRICE_RING_WORDS + w];
+    pSlot[TRICE_RING_COUNT_OFFSET] = wordCount;
+    memcpy( pSlot + (TRICE_DATA_OFFSET>>2), pData, wordCount<<2 );
+    unsigned used;
+    TriceRingBufferWriteIndex[ring] = triceRingBufferAdvance( ring, w, &used );
+    TriceRingBufferDepth[ring] += used;
+    TriceRingBufferCount[ring]++;
+    SingleTricesRingCount++;
+    #if TRICE_DIAGNOSTICS == 1
+    unsigned depth = TriceRingBufferDepth[ring]<<2;
+    TriceRingBufferDepthMax = (depth > TriceRingBufferDepthMax) ? depth : TriceRingBufferDepthMax;
+    #endif
+    return 1;
+}
+
+//! triceRingBufferReport writes a TRICE_LOST_ID trice with the count of dropped trices into ring, when there are unreported ones.
+static void triceRingBufferReport( unsigned ring ){
+    unsigned lost = TriceRingBufferLost[ring];
+    if( lost == 0 ){
+        return;
+    }
+    uint32_t notice[2];
+    uint32_t* TriceBufferWritePosition = notice;
+    TRICE_PUT_HEAD( (4<<24) | ((TRICE_CYCLE)<<16) | (0x4000|TRICE_LOST_ID) );
+    TRICE_PUT( lost );
+    if( triceRingBufferWrite( ring, notice, 2 ) ){
+        TriceRingBufferLost[ring] -= lost; // Writing can drop further trices.
+    }
+}
+
+//! TriceRingBufferPush copies the single trice at pData with wordCount uint32 values into the ring selected by its ID.
+//! When the ring has not enough space, TRICE_OVERFLOW_POLICY is applied. The other rings are not affected.
+//! It is called inside TRICE_LEAVE and therefore inside the TRICE critical section.
+void TriceRingBufferPush( uint32_t const* pData, unsigned wordCount ){
+    unsigned tid = 0x3FFF & TRICE_TTOHS( *(uint16_t const*)pData );
+    unsigned ring = TRICE_RING_BUFFER_SELECT( tid );
+    ring = ring < TRICE_RING_BUFFER_COUNT ? ring : TRICE_RING_BUFFER_COUNT - 1;
+    triceRingBufferReport( ring );
+    if( !triceRingBufferWrite( ring, pData, wordCount ) ){
+        TriceRingBufferLost[ring]++;
+        #if TRICE_DIAGNOSTICS == 1
+        TriceRingBufferOverflowCount[ring]++;
+        #endif
+    }
+    #if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_BLOCK
+    if( triceRingBufferReserved ){
+        triceRingBufferReserved--; // The space reserved in TRICE_RING_BUFFER_WAIT is used now.
+    }
+    #endif
+}
+
+#if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_BLOCK
+
+//! TriceRingBufferReserve reserves space for a trice of max size in all rings and returns 1, when all rings have this space.
+//! It is called by TRICE_RING_BUFFER_WAIT inside the critical section, so no other trice can take the checked space.
+//! TriceRingBufferPush gives the reservation back.
+int TriceRingBufferReserve( void ){
+    unsigned need = (triceRingBufferReserved + 1) * (TRICE_BUFFER_SIZE>>2);
+    for( unsigned ring = 0; ring < TRICE_RING_BUFFER_COUNT; ring++ ){
+        if( TriceRingBufferDepth[ring] + need > TRICE_RING_WORDS ){
+            return 0;
+        }
+    }
+    triceRingBufferReserved++;
+    return 1;
+}
+
+#endif // #if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_BLOCK
+
+//! TriceDepth returns the used byte count of all rings including the trice in transfer and the unused space in front of a wrap.
+size_t TriceDepth( void ){
+    unsigned depth = 0;
+    for( unsigned ring = 0; ring < TRICE_RING_BUFFER_COUNT; ring++ ){
+        depth += TriceRingBufferDepth[ring];
+    }
+    return depth<<2;
+}
+
+//! TriceTransfer needs to be called cyclically to read out the rings. Each call transfers one trice from the ring selected by triceRingBufferNext.
+//! The trice is taken out of the ring before the transfer, but its space is given free only afterwards.
+void TriceTransfer( void ){
+    #if TRICE_DIRECT_COALESCE_SIZE > 0
+    TriceFlush(); // The TriceTransfer period limits the direct output coalescing time.
+    #endif
+    if( SingleTricesRingCount == 0 ){ // no data
+        return;
+    }
+    if( TriceOutDepth() ){ // last transmission not finished
+        return;
+    }
+    #if TRICE_DIAGNOSTICS == 1
+    SingleTricesRingCountMax = (SingleTricesRingCount > SingleTricesRingCountMax) ? SingleTricesRingCount : SingleTricesRingCountMax;
+    #endif
+    uint32_t* pSlot = 0;
+    unsigned ring = TRICE_RING_BUFFER_COUNT;
+    TRICE_ENTER_CRITICAL_SECTION
+    if( SingleTricesRingCount ){ // With TRICE_OVERFLOW_DROP_OLDEST an interrupt could have dropped all trices meanwhile.
+        ring = triceRingBufferNext();
+        unsigned r = TriceRingBufferReadIndex[ring];
+        pSlot = &TriceRingBuffer[ring * TRICE_RING_WORDS + r];
+        TriceRingBufferReadIndex[ring] = triceRingBufferAdvance( ring, r, &triceRingBufferReleased );
+        TriceRingBufferCount[ring]--;
+        SingleTricesRingCount--;
+        triceRingBufferTransferRing = ring;
+    }
+    TRICE_LEAVE_CRITICAL_SECTION
+    if( pSlot == 0 ){
+        return;
+    }
+    #if TRICE_CYCLE_COUNTER == 1
+    triceRingBufferStampCycle( pSlot + (TRICE_DATA_OFFSET>>2) );
+    #endif
+    TriceSingleDeferredOut( pSlot );
+    TRICE_ENTER_CRITICAL_SECTION
+    TriceRingBufferDepth[ring] -= triceRingBufferReleased;
+    triceRingBufferTransferRing = TRICE_RING_BUFFER_COUNT;
+    triceRingBufferReport( ring );
+    TRICE_LEAVE_CRITICAL_SECTION
+}
+
+#endif // #else // #if TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_UNCHECKED
+
 //! TriceSingleDeferredOut expects a single trice at addr with byte offset TRICE_DATA_OFFSET and returns the wordCount of this trice which includes 1-3 padding bytes.
 //! This function is specific to the ring buffer, because the wordCount value needs to be reconstructed.
 //! \param addr points to TRICE_DATA_OFFSET bytes usable space followed by the begin of a single trice.
@@ -0,0 +1,84 @@
+package cgot
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"path"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// triceLogArgs executes the trice logging with additional args on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output.
+func triceLogArgs(t *testing.T, fSys *afero.Afero, buffer string, more ...string) string {
+	var o bytes.Buffer
+	a := []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "COBS"}
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, append(a, more...)))
+	return o.String()
+}
+
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// The core display is switched off, because all test lines are from core 0.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string) string {
+	return triceLogArgs(t, fSys, buffer, "-coreFormat", "off")
+}
+
+func TestLogs(t *testing.T) {
+	triceLogTest(t, triceLog, testLines, deferredTransfer)
+}
+
+// TestSimulate runs the simulator workload against this configuration. Use -args -sim "key=value,..." for other workloads.
+func TestSimulate(t *testing.T) {
+	triceSimulateTest(t, triceLog, deferredTransfer, nil)
+}
+
+// coreLines returns the decoded lines of a stress run with n trices per simulated core.
+// The core format is passed explicitly, because the flag values persist between trice log calls.
+func coreLines(t *testing.T, n int, more ...string) []string {
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	triceClearOutBuffer()
+	buf := fmt.Sprint(triceCoresStress(t, n))
+	act := triceLogArgs(t, &afero.Afero{Fs: afero.NewOsFs()}, buf[1:len(buf)-1], append([]string{"-ts32", "stamp:%d ", "-coreFormat", "core%d "}, more...)...)
+	return strings.Split(strings.TrimSuffix(act, "\n"), "\n")
+}
+
+// checkCoreLines checks the core prefix of each line, the per core sequence order and the line count.
+// It returns the stamps.
+func checkCoreLines(t *testing.T, lines []string, n int) (stamps []int) {
+	last := []int{-1, -1}
+	for _, line := range lines {
+		var prefix, core, stamp, seq int
+		_, err := fmt.Sscanf(line, "core%d stamp:%d default: dbg:core %d seq %d", &prefix, &stamp, &core, &seq)
+		assert.Nil(t, err, line)
+		assert.Equal(t, core, prefix, line)
+		assert.True(t, last[core] < seq, line)
+		last[core] = seq
+		stamps = append(stamps, stamp)
+	}
+	assert.Equal(t, 2*n, len(lines)+triceCoresOverflowCount())
+	return
+}
+
+// TestCores lets 2 threads as simulated cores write trices concurrently into their own double buffers, while a consumer thread transfers them.
+func TestCores(t *testing.T) {
+	const n = 2000
+	lines := coreLines(t, n)
+	checkCoreLines(t, lines, n)
+	t.Log("dropped:", triceCoresOverflowCount())
+}
+
+// TestCoresSorted checks, that the trice tool switch -coreSort merges the lines of both cores in timestamp order.
+func TestCoresSorted(t *testing.T) {
+	const n = 2000
+	lines := coreLines(t, n, "-coreSort")
+	stamps := checkCoreLines(t, lines, n)
+	for i := 1; i < len(stamps); i++ {
+		assert.True(t, stamps[i-1] < stamps[i], lines[i])
+	}
+}
@@ -0,0 +1,95 @@
+/*! \file cores.c
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+#define _GNU_SOURCE // pthread_setaffinity_np
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include "trice.h"
+
+void TriceCapture( void );
+void TriceCaptureReset( void );
+
+//! triceCore is the simulated core of the calling thread.
+static __thread unsigned triceCore = 0;
+
+//! TriceCoreId returns the simulated core of the calling thread.
+unsigned TriceCoreId( void ){
+    return triceCore;
+}
+
+//! triceStamp is a common clock for all simulated cores.
+static atomic_uint triceStamp = 0;
+
+//! triceStampRunning is set during TriceCoresStress. Otherwise TriceCoreStamp32 returns the value expected by the TestLogs.
+static atomic_int triceStampRunning = 0;
+
+//! TriceCoreStamp32 returns the common clock value during TriceCoresStress.
+uint32_t TriceCoreStamp32( void ){
+    if( atomic_load( &triceStampRunning ) ){
+        return atomic_fetch_add( &triceStamp, 1 ) + 1;
+    }
+    return 0x32323232;
+}
+
+//! triceCoresDone is set, when all core threads are finished.
+static atomic_int triceCoresDone = 0;
+
+//! triceCoreTriceCount is the trice count of each core thread.
+static int triceCoreTriceCount = 0;
+
+//! triceCoreThread pins itself to a CPU as simulated core and executes triceCoreTriceCount trices with its core number and a sequence number.
+static void* triceCoreThread( void* arg ){
+    triceCore = (unsigned)(intptr_t)arg;
+    cpu_set_t cpus;
+    CPU_ZERO( &cpus );
+    CPU_SET( triceCore % sysconf( _SC_NPROCESSORS_ONLN ), &cpus );
+    pthread_setaffinity_np( pthread_self(), sizeof(cpus), &cpus ); // a failure does not matter
+    for( int i = 0; i < triceCoreTriceCount; i++ ){
+        TRice( iD(8024), "dbg:core %d seq %d\n", triceCore, i );
+        if( (i & 15) == 15 ){
+            sched_yield(); // give the consumer a chance
+        }
+    }
+    return NULL;
+}
+
+//! triceConsumer calls TriceCapture until the core threads are done and then drains all double buffers.
+static void* triceConsumer( void* arg ){
+    (void)arg;
+    while( !atomic_load( &triceCoresDone ) ){
+        TriceCapture();
+    }
+    for( int i = 0; i < 4*TRICE_CORE_COUNT; i++ ){ // 2 flips per core needed at most
+        TriceCapture();
+    }
+    return NULL;
+}
+
+//! TriceCoresStress runs TRICE_CORE_COUNT core threads with n trices each concurrently to a consumer thread.
+void TriceCoresStress( int n ){
+    pthread_t core[TRICE_CORE_COUNT];
+    pthread_t consumer;
+    TriceCaptureReset();
+    triceCoreTriceCount = n;
+    atomic_store( &triceCoresDone, 0 );
+    atomic_store( &TriceDoubleBufferOverflowCount, 0 );
+    atomic_store( &triceStamp, 0 );
+    atomic_store( &triceStampRunning, 1 );
+    pthread_create( &consumer, NULL, triceConsumer, NULL );
+    for( int c = 0; c < TRICE_CORE_COUNT; c++ ){
+        pthread_create( &core[c], NULL, triceCoreThread, (void*)(intptr_t)c );
+    }
+    for( int c = 0; c < TRICE_CORE_COUNT; c++ ){
+        pthread_join( core[c], NULL );
+    }
+    atomic_store( &triceCoresDone, 1 );
+    pthread_join( consumer, NULL );
+    atomic_store( &triceStampRunning, 0 );
+}
+
+//! TriceCoresOverflowCount returns the count of dropped trices.
+unsigned TriceCoresOverflowCount( void ){
+    return atomic_load( &TriceDoubleBufferOverflowCount );
+}
@@ -0,0 +1,19 @@
+package cgot
+
+// #cgo LDFLAGS: -lpthread
+// void TriceCoresStress( int n );
+// unsigned TriceCoresOverflowCount( void );
+import "C"
+
+import "testing"
+
+// triceCoresStress runs a thread with n trices for each simulated core and a consumer thread and returns the captured output.
+func triceCoresStress(t *testing.T, n int) []byte {
+	C.TriceCoresStress(C.int(n))
+	return triceCaptured(t)
+}
+
+// triceCoresOverflowCount returns the count of dropped trices.
+func triceCoresOverflowCount() int {
+	return int(C.TriceCoresOverflowCount())
+}
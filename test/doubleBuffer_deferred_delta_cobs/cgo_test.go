@@ -0,0 +1,69 @@
+package cgot
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"path"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string) string {
+	var o bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "COBS", "-payloadCodec", "delta"}))
+	return o.String()
+}
+
+// TestLogs works like triceLogTest but resets the target delta references before each test line,
+// because each trice log call starts with empty references.
+func TestLogs(t *testing.T) {
+	osFSys := &afero.Afero{Fs: afero.NewOsFs()}
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	for i, r := range getExpectedResults(osFSys, path.Join(triceDir, "./test/testdata/triceCheck.c")) {
+		if testLines >= 0 && i+1 >= testLines {
+			return
+		}
+		triceCodecReset()
+		triceCheck(r.line)
+		triceTransfer()
+		buf := fmt.Sprint(out[:triceOutDepth()])
+		act := triceLog(t, osFSys, buf[1:len(buf)-1])
+		triceClearOutBuffer()
+		assert.Equal(t, r.exps, strings.TrimSuffix(act, "\n"), r.line)
+	}
+}
+
+// TestSimulate runs the simulator workload against this configuration. Use -args -sim "key=value,..." for other workloads.
+func TestSimulate(t *testing.T) {
+	triceSimulateTest(t, triceLog, deferredTransfer, triceCodecReset)
+}
+
+// TestDeltaSequence decodes a sequence of separately transferred trices with slowly changing values in one stream
+// and reports the payload codec byte reduction and the spent cycles.
+func TestDeltaSequence(t *testing.T) {
+	const n = 20
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	triceClearOutBuffer()
+	triceCodecReset()
+	in0, out0, cycles0 := triceCodecStatistics()
+	buf := fmt.Sprint(triceDeltaSequence(t, n))
+	in1, out1, cycles1 := triceCodecStatistics()
+	act := triceLog(t, &afero.Afero{Fs: afero.NewOsFs()}, buf[1:len(buf)-1])
+	var exp strings.Builder
+	for i := 0; i < n; i++ {
+		exp.WriteString(fmt.Sprintf("time:            default: msg:delta %d %d %d\n", 100000+3*i, -7*i, 0x12345678))
+	}
+	assert.Equal(t, exp.String(), act)
+	in, enc, cycles := in1-in0, out1-out0, cycles1-cycles0
+	assert.True(t, 2*enc < in)
+	t.Logf("payload codec: %d -> %d bytes (%.1f%% saved), %d cycles (%.1f cycles per byte)", in, enc, 100*float64(in-enc)/float64(in), cycles, float64(cycles)/float64(in))
+}
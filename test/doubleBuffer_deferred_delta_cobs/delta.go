@@ -0,0 +1,27 @@
+package cgot
+
+// #include <stdint.h>
+// void TriceDeltaSequence( int n );
+// void TriceCodecReset( void );
+// unsigned TriceCodecBytesInCGO( void );
+// unsigned TriceCodecBytesOutCGO( void );
+// unsigned TriceCodecCyclesCGO( void );
+import "C"
+
+import "testing"
+
+// triceDeltaSequence writes n trices with slowly changing values, each transferred separately, and returns the captured output.
+func triceDeltaSequence(t *testing.T, n int) []byte {
+	C.TriceDeltaSequence(C.int(n))
+	return triceCaptured(t)
+}
+
+// triceCodecReset clears the target delta references.
+func triceCodecReset() {
+	C.TriceCodecReset()
+}
+
+// triceCodecStatistics returns the summed byte counts before and after the payload encoding and the spent cycles.
+func triceCodecStatistics() (in, out, cycles int) {
+	return int(C.TriceCodecBytesInCGO()), int(C.TriceCodecBytesOutCGO()), int(C.TriceCodecCyclesCGO())
+}
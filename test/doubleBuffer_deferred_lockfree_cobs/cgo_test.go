@@ -0,0 +1,71 @@
+package cgot
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"path"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string) string {
+	var o bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "COBS"}))
+	return o.String()
+}
+
+func TestLogs(t *testing.T) {
+	triceLogTest(t, triceLog, testLines, deferredTransfer)
+}
+
+// TestSimulate runs the simulator workload against this configuration. Use -args -sim "key=value,..." for other workloads.
+func TestSimulate(t *testing.T) {
+	triceSimulateTest(t, triceLog, deferredTransfer, nil)
+}
+
+// TestLockFreeStress lets 4 threads write trices concurrently into the double buffer, while a consumer thread transfers them.
+// Each received thread sequence must be strictly increasing and the received plus dropped trices must match the written ones.
+func TestLockFreeStress(t *testing.T) {
+	const threads, n = 4, 2000
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	triceClearOutBuffer()
+	buf := fmt.Sprint(triceLockFreeStress(t, threads, n))
+	act := triceLog(t, &afero.Afero{Fs: afero.NewOsFs()}, buf[1:len(buf)-1])
+	lines := strings.Split(strings.TrimSuffix(act, "\n"), "\n")
+	last := make([]int, threads)
+	for i := range last {
+		last[i] = -1
+	}
+	for _, line := range lines {
+		var thread, seq int
+		_, err := fmt.Sscanf(line, "time:            default: dbg:thread %d seq %d", &thread, &seq)
+		assert.Nil(t, err, line)
+		assert.True(t, last[thread] < seq, line)
+		last[thread] = seq
+	}
+	assert.Equal(t, threads*n, len(lines)+triceLockFreeOverflowCount())
+	t.Log("dropped:", triceLockFreeOverflowCount(), "max reservation cycles:", triceLockFreeCyclesMax())
+}
+
+// TestCriticalSectionCycles runs the single threaded workload of the locked double buffer baseline
+// in doubleBuffer_deferred_multi_cobs against the lock-free space reservation.
+func TestCriticalSectionCycles(t *testing.T) {
+	const n = 1000
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	triceClearOutBuffer()
+	cycles := triceCriticalSectionCycles(n)
+	buf := fmt.Sprint(triceCaptured(t))
+	act := triceLog(t, &afero.Afero{Fs: afero.NewOsFs()}, buf[1:len(buf)-1])
+	assert.Equal(t, n, len(strings.Split(strings.TrimSuffix(act, "\n"), "\n")))
+	assert.True(t, cycles > 0)
+	t.Log("lock-free double buffer max reservation cycles:", cycles)
+}
@@ -0,0 +1,70 @@
+/*! \file lockFree.c
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include "trice.h"
+
+void TriceCapture( void );
+void TriceCaptureReset( void );
+
+//! triceWritersDone is set, when all writer threads are finished.
+static atomic_int triceWritersDone = 0;
+
+//! triceWriterCount is the trice count of each writer thread.
+static int triceWriterCount = 0;
+
+//! triceWriter executes triceWriterCount trices with its thread number and a sequence number.
+static void* triceWriter( void* arg ){
+    int t = (int)(intptr_t)arg;
+    for( int i = 0; i < triceWriterCount; i++ ){
+        trice( iD(8023), "dbg:thread %d seq %d\n", t, i );
+        if( (i & 15) == 15 ){
+            sched_yield(); // give the consumer a chance
+        }
+    }
+    return NULL;
+}
+
+//! triceConsumer calls TriceCapture until the writers are done and then drains both half buffers.
+static void* triceConsumer( void* arg ){
+    (void)arg;
+    while( !atomic_load( &triceWritersDone ) ){
+        TriceCapture();
+    }
+    for( int i = 0; i < 4; i++ ){ // 2 flips needed at most
+        TriceCapture();
+    }
+    return NULL;
+}
+
+//! TriceLockFreeStress runs threads writer threads with n trices each concurrently to a consumer thread.
+void TriceLockFreeStress( int threads, int n ){
+    pthread_t writer[16];
+    pthread_t consumer;
+    TriceCaptureReset();
+    triceWriterCount = n;
+    atomic_store( &triceWritersDone, 0 );
+    atomic_store( &TriceDoubleBufferOverflowCount, 0 );
+    TriceCriticalSectionCyclesMax = 0;
+    pthread_create( &consumer, NULL, triceConsumer, NULL );
+    for( int t = 0; t < threads; t++ ){
+        pthread_create( &writer[t], NULL, triceWriter, (void*)(intptr_t)t );
+    }
+    for( int t = 0; t < threads; t++ ){
+        pthread_join( writer[t], NULL );
+    }
+    atomic_store( &triceWritersDone, 1 );
+    pthread_join( consumer, NULL );
+}
+
+//! TriceLockFreeOverflowCount returns the count of dropped trices.
+unsigned TriceLockFreeOverflowCount( void ){
+    return atomic_load( &TriceDoubleBufferOverflowCount );
+}
+
+//! TriceLockFreeCyclesMax returns the max cycle count of a space reservation.
+unsigned TriceLockFreeCyclesMax( void ){
+    return TriceCriticalSectionCyclesMax;
+}
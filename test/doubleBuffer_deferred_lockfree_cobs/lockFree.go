@@ -0,0 +1,25 @@
+package cgot
+
+// #cgo LDFLAGS: -lpthread
+// void TriceLockFreeStress( int threads, int n );
+// unsigned TriceLockFreeOverflowCount( void );
+// unsigned TriceLockFreeCyclesMax( void );
+import "C"
+
+import "testing"
+
+// triceLockFreeStress runs threads concurrent writer threads with n trices each and a consumer thread and returns the captured output.
+func triceLockFreeStress(t *testing.T, threads, n int) []byte {
+	C.TriceLockFreeStress(C.int(threads), C.int(n))
+	return triceCaptured(t)
+}
+
+// triceLockFreeOverflowCount returns the count of dropped trices.
+func triceLockFreeOverflowCount() int {
+	return int(C.TriceLockFreeOverflowCount())
+}
+
+// triceLockFreeCyclesMax returns the max cycle count of a space reservation.
+func triceLockFreeCyclesMax() int {
+	return int(C.TriceLockFreeCyclesMax())
+}
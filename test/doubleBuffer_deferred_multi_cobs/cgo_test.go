@@ -2,8 +2,10 @@ package cgot
 
 import (
 	"bytes"
+	"fmt"
 	"io"
 	"path"
+	"strings"
 	"testing"
 
 	"github.com/rokath/trice/internal/args"
@@ -11,15 +13,34 @@ import (
 	"github.com/tj/assert"
 )
 
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string) string {
+	var o bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "COBS"}))
+	return o.String()
+}
+
 func TestLogs(t *testing.T) {
+	triceLogTest(t, triceLog, testLines, deferredTransfer)
+}
 
-	// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
-	// It uses the inside fSys specified til.json and returns the log output.
-	triceLog := func(t *testing.T, fSys *afero.Afero, buffer string) string {
-		var o bytes.Buffer
-		assert.Nil(t, args.Handler(io.Writer(&o), fSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "COBS"}))
-		return o.String()
-	}
+// TestSimulate runs the simulator workload against this configuration. Use -args -sim "key=value,..." for other workloads.
+func TestSimulate(t *testing.T) {
+	triceSimulateTest(t, triceLog, deferredTransfer, nil)
+}
 
-	triceLogTest(t, triceLog, testLines, deferredTransfer)
+// TestCriticalSectionCycles runs a single threaded workload with locked critical sections as baseline
+// for the lock-free space reservation in doubleBuffer_deferred_lockfree_cobs, which runs the same workload.
+func TestCriticalSectionCycles(t *testing.T) {
+	const n = 1000
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	triceClearOutBuffer()
+	cycles := triceCriticalSectionCycles(n)
+	buf := fmt.Sprint(triceCaptured(t))
+	act := triceLog(t, &afero.Afero{Fs: afero.NewOsFs()}, buf[1:len(buf)-1])
+	assert.Equal(t, n, len(strings.Split(strings.TrimSuffix(act, "\n"), "\n")))
+	assert.True(t, cycles > 0)
+	t.Log("locked double buffer max critical section cycles:", cycles)
 }
@@ -0,0 +1,9 @@
+package cgot
+
+// #include "../testdata/criticalSection.c"
+import "C"
+
+// triceCriticalSectionCycles writes n trices and returns the max critical section cycle count.
+func triceCriticalSectionCycles(n int) int {
+	return int(C.TriceCriticalSectionCycles(C.int(n)))
+}
@@ -18,6 +18,14 @@ package cgot
 // unsigned TriceOutDepth( void );
 // void CgoSetTriceBuffer( uint8_t* buf );
 // void CgoClearTriceBuffer( void );
+// void TriceCaptureReset( void );
+// unsigned TriceSimWrite( int kind, uint32_t seq );
+// int TriceSimFits( void );
+// int TriceSimOverwrites( void );
+// unsigned TriceSimTransfer( void );
+// unsigned TriceSimDepthMax( void );
+// unsigned TriceSimSingleMax( void );
+// void TriceSimResetDiagnostics( void );
 // #cgo CFLAGS: -g -I../../src
 // #include "../../src/cobsDecode.c"
 // #include "../../src/cobsEncode.c"
@@ -28,6 +36,7 @@ package cgot
 // #include "../../src/trice32.c"
 // #include "../../src/trice64.c"
 // #include "../../src/trice8.c"
+// #include "../../src/triceMaxParams.c"
 // #include "../../src/triceAuxiliary.c"
 // #include "../../src/triceDoubleBuffer.c"
 // #include "../../src/triceRingBuffer.c"
@@ -36,15 +45,22 @@ package cgot
 // #include "../../src/xtea.c"
 // #include "../testdata/triceCheck.c"
 // #include "../testdata/cgoTrice.c"
+// #include "../testdata/cgoSim.c"
 import "C"
 
 import (
 	"bufio"
+	"errors"
+	"flag"
 	"fmt"
+	"math/rand"
 	"path"
 	"runtime"
+	"sort"
+	"strconv"
 	"strings"
 	"testing"
+	"time"
 	"unsafe"
 
 	"github.com/rokath/trice/pkg/msg"
@@ -98,6 +114,48 @@ func triceClearOutBuffer() {
 	C.CgoClearTriceBuffer()
 }
 
+// triceCaptureReset empties the captured deferred output.
+func triceCaptureReset() {
+	C.TriceCaptureReset()
+}
+
+// triceCaptured returns the deferred output collected by the C function TriceCapture since the last triceCaptureReset.
+// It fails the test, when output got lost, because the capture buffer was too small.
+func triceCaptured(t *testing.T) []byte {
+	if C.triceCapturedLost != 0 {
+		t.Fatalf("%d captured bytes lost, the capture buffer of %d bytes is too small", C.triceCapturedLost, len(C.triceCaptured))
+	}
+	return C.GoBytes(unsafe.Pointer(&C.triceCaptured[0]), C.int(C.triceCapturedDepth))
+}
+
+// cPtr returns the C address of b or nil for an empty b.
+func cPtr(b []byte) unsafe.Pointer {
+	if len(b) == 0 {
+		return nil
+	}
+	return unsafe.Pointer(&b[0])
+}
+
+// cobsEncode encodes in into out with the reference C function COBSEncode and returns the encoded length.
+func cobsEncode(out, in []byte) int {
+	return int(C.COBSEncode(cPtr(out), cPtr(in), C.size_t(len(in))))
+}
+
+// cobsEncodeWordwise encodes in into out with the C function COBSEncodeWordwise and returns the encoded length.
+func cobsEncodeWordwise(out, in []byte) int {
+	return int(C.COBSEncodeWordwise(cPtr(out), cPtr(in), C.size_t(len(in))))
+}
+
+// cobsDecode decodes in into out with the reference C function COBSDecode and returns the decoded length.
+func cobsDecode(out, in []byte) int {
+	return int(C.COBSDecode(cPtr(out), cPtr(in), C.size_t(len(in))))
+}
+
+// cobsDecodeWordwise decodes in into out with the C function COBSDecodeWordwise and returns the decoded length.
+func cobsDecodeWordwise(out, in []byte) int {
+	return int(C.COBSDecodeWordwise(cPtr(out), cPtr(in), C.size_t(len(in))))
+}
+
 // linesInFile does get the lines in a file and stores them in a string slice.
 func linesInFile(fh afero.File) []string { // https://www.dotnetperls.com/lines-file-go
 	// Create new Scanner.
@@ -240,3 +298,290 @@ func triceLogTest2(t *testing.T, triceLog0, triceLog1 logF, limit int) {
 		assert.Equal(t, r.exps, strings.TrimSuffix(act, "\n"))
 	}
 }
+
+// simConfig describes a simulated target workload and the link to the host.
+type simConfig struct {
+	duration time.Duration // duration is the time, the workload writes trices.
+	tick     time.Duration // tick is the simulated time step. Deferred configurations call TriceTransfer once per tick, when the link is idle.
+	rate     float64       // rate is the count of steady trices per second.
+	burst    int           // burst is the count of additional trices at the start of each period.
+	period   time.Duration // period is the burst interval.
+	mix      [4]int        // mix holds the weights of the trice kinds 0...3 in cgoSim.c.
+	baud     int           // baud is the link speed. Each byte takes 10 bits. 0 is for an unlimited link.
+	latency  time.Duration // latency is added to each transmission.
+	seed     int64         // seed initializes the trice kind selection.
+}
+
+// defaultSim is a small workload keeping the regular test runs fast.
+var defaultSim = simConfig{
+	duration: 100 * time.Millisecond,
+	tick:     time.Millisecond,
+	rate:     1000,
+	burst:    20,
+	period:   50 * time.Millisecond,
+	mix:      [4]int{60, 25, 10, 5},
+	baud:     115200,
+	latency:  time.Millisecond,
+	seed:     1,
+}
+
+// simFlag holds the workload for TestSimulate, for example: go test -run TestSimulate -v -args -sim "rate=5000,burst=100,baud=921600".
+var simFlag = flag.String("sim", "", "simulator workload as comma separated key=value list with the keys duration, tick, rate, burst, period, mix (like 60/25/10/5), baud, latency and seed")
+
+// parseSim returns defaultSim modified by the key=value list in s.
+func parseSim(s string) (c simConfig, err error) {
+	c = defaultSim
+	for _, kv := range strings.Split(s, ",") {
+		if strings.TrimSpace(kv) == "" {
+			continue
+		}
+		k, v, ok := strings.Cut(kv, "=")
+		if !ok {
+			return c, fmt.Errorf("missing '=' in %q", kv)
+		}
+		k, v = strings.TrimSpace(k), strings.TrimSpace(v)
+		switch k {
+		case "duration":
+			c.duration, err = time.ParseDuration(v)
+		case "tick":
+			c.tick, err = time.ParseDuration(v)
+		case "period":
+			c.period, err = time.ParseDuration(v)
+		case "latency":
+			c.latency, err = time.ParseDuration(v)
+		case "rate":
+			c.rate, err = strconv.ParseFloat(v, 64)
+		case "burst":
+			c.burst, err = strconv.Atoi(v)
+		case "baud":
+			c.baud, err = strconv.Atoi(v)
+		case "seed":
+			c.seed, err = strconv.ParseInt(v, 10, 64)
+		case "mix":
+			w := strings.Split(v, "/")
+			if len(w) != len(c.mix) {
+				return c, fmt.Errorf("mix %q needs %d weights", v, len(c.mix))
+			}
+			for i := range w {
+				if c.mix[i], err = strconv.Atoi(w[i]); err != nil {
+					break
+				}
+			}
+		default:
+			return c, fmt.Errorf("unknown simulator key %q", k)
+		}
+		if err != nil {
+			return c, fmt.Errorf("%s: %w", k, err)
+		}
+	}
+	if c.tick <= 0 {
+		return c, errors.New("tick needs to be positive")
+	}
+	if c.mix[0]+c.mix[1]+c.mix[2]+c.mix[3] <= 0 {
+		return c, errors.New("mix needs a positive weight")
+	}
+	return
+}
+
+// simReport holds the simulation results.
+type simReport struct {
+	written     int             // written is the count of trices written by the workload.
+	overwritten int             // overwritten is the count of unread trices lost, because a full unchecked ring buffer was overwritten.
+	overflows   int             // overflows is the count of trices not written, because they would have been written behind a full double buffer half.
+	delivered   int             // delivered is the count of trices decoded on the host side.
+	bytes       int             // bytes is the count of bytes sent over the link.
+	busy        time.Duration   // busy is the time, the link was transmitting.
+	end         time.Duration   // end is the simulated time, when the last byte arrived.
+	latency     []time.Duration // latency holds the sorted times from writing to decoding for the delivered trices.
+	depthMax    int             // depthMax is the max buffer depth in bytes, when the configuration provides it.
+	singleMax   int             // singleMax is the max single trice size in bytes, when the configuration provides it.
+	writeNs     int             // writeNs is the sum of the write durations.
+	writeNsMax  int             // writeNsMax is the longest write duration.
+	transferNs  int             // transferNs is the sum of the TriceTransfer durations.
+	transfers   int             // transfers is the count of TriceTransfer calls.
+}
+
+// percentile returns the latency, which p percent of the delivered trices do not exceed.
+func (r simReport) percentile(p int) time.Duration {
+	if len(r.latency) == 0 {
+		return 0
+	}
+	return r.latency[(len(r.latency)-1)*p/100]
+}
+
+func (r simReport) String() string {
+	var b strings.Builder
+	dropped := r.written - r.delivered
+	written, end, transfers := r.written, r.end, r.transfers // divisors
+	if written == 0 {
+		written = 1
+	}
+	if end == 0 {
+		end = 1
+	}
+	if transfers == 0 {
+		transfers = 1
+	}
+	fmt.Fprintf(&b, "trices:  %d written, %d delivered, %d dropped (%.1f%%), %d overwritten, %d overflows\n", r.written, r.delivered, dropped, 100*float64(dropped)/float64(written), r.overwritten, r.overflows)
+	fmt.Fprintf(&b, "link:    %d bytes, %.1f%% busy until %v\n", r.bytes, 100*float64(r.busy)/float64(end), r.end)
+	fmt.Fprintf(&b, "latency: min %v, p50 %v, p90 %v, p99 %v, max %v\n", r.percentile(0), r.percentile(50), r.percentile(90), r.percentile(99), r.percentile(100))
+	fmt.Fprintf(&b, "buffer:  depth max %d bytes, single trice max %d bytes (0 without TRICE_DIAGNOSTICS)\n", r.depthMax, r.singleMax)
+	fmt.Fprintf(&b, "cpu:     %d ns per trice (max %d ns), %d ns per TriceTransfer\n", r.writeNs/written, r.writeNsMax, r.transferNs/transfers)
+	return b.String()
+}
+
+// triceSimulate runs the workload c against the compiled target code and sends its output over a simulated link to triceLog.
+//
+// The time is simulated in c.tick steps. In each step the workload trices are written. With mode deferredTransfer
+// TriceTransfer is called, when the link finished the previous transmission, so a slow link backs up into the
+// target buffers. With mode directTransfer each trice is sent immediately and queues up on the link. The host
+// decodes each transmission after its arrival and finds the trices by their sequence numbers. beforeTransfer,
+// if not nil, is called before each TriceTransfer. Direct output of twin configurations is not simulated.
+//
+// A full unchecked ring buffer overwrites its oldest unread trices. That is modelled by transferring them into
+// the void before the write, because executing the real overwrite lets the target reader desynchronize and
+// read behind the ring. The garbage a real target would send then is not modelled. A full double buffer
+// without lock free writes behind its half buffer, so these trices are only counted as overflows.
+func triceSimulate(t *testing.T, triceLog logF, mode triceMode, c simConfig, beforeTransfer func()) (r simReport) {
+	osFSys := &afero.Afero{Fs: afero.NewOsFs()}
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	triceClearOutBuffer()
+	C.TriceSimResetDiagnostics()
+	if mode == directTransfer { // The double buffer takes the direct trices too and has no overflow check, so empty it.
+		for i := 0; i < 2; i++ {
+			C.TriceSimTransfer()
+			triceClearOutBuffer()
+		}
+	}
+
+	rnd := rand.New(rand.NewSource(c.seed))
+	weights := c.mix[0] + c.mix[1] + c.mix[2] + c.mix[3]
+	pending := make(map[uint32]time.Duration) // pending holds the write times of the not delivered trices.
+	var linkFree time.Duration                // linkFree is the time, the link finishes its actual transmission.
+
+	// send transmits b over the link at time now and decodes it at arrival.
+	send := func(now time.Duration, b []byte) {
+		if len(b) == 0 {
+			return
+		}
+		start := now
+		if linkFree > start {
+			start = linkFree
+		}
+		var d time.Duration
+		if c.baud > 0 {
+			d = time.Duration(len(b)) * 10 * time.Second / time.Duration(c.baud)
+		}
+		linkFree = start + d
+		r.bytes += len(b)
+		r.busy += d
+		r.end = linkFree + c.latency
+		buf := fmt.Sprint(b)
+		for _, line := range strings.Split(triceLog(t, osFSys, buf[1:len(buf)-1]), "\n") {
+			var seq uint32
+			i := strings.Index(line, "sim:")
+			if i < 0 {
+				continue
+			}
+			if _, err := fmt.Sscanf(line[i:], "sim:%d", &seq); err != nil {
+				continue
+			}
+			if w, ok := pending[seq]; ok {
+				delete(pending, seq)
+				r.delivered++
+				r.latency = append(r.latency, r.end-w)
+			}
+		}
+	}
+	// capture returns a copy of the actual output and clears it.
+	capture := func() []byte {
+		b := append([]byte(nil), out[:triceOutDepth()]...)
+		triceClearOutBuffer()
+		return b
+	}
+
+	var due float64   // due is the fraction of a not yet written steady trice.
+	idle := 0         // idle counts the transfers without output after the workload end.
+	var direct []byte // direct collects the direct output of a tick.
+	for now := time.Duration(0); now < c.duration+time.Minute; now += c.tick {
+		n := 0
+		if now < c.duration {
+			due += c.rate * c.tick.Seconds()
+			n = int(due)
+			due -= float64(n)
+			if c.period > 0 && now%c.period < c.tick {
+				n += c.burst
+			}
+		}
+		for i := 0; i < n; i++ {
+			kind, w := 0, rnd.Intn(weights)
+			for w >= c.mix[kind] {
+				w -= c.mix[kind]
+				kind++
+			}
+			if C.TriceSimFits() == 0 && C.TriceSimOverwrites() == 0 {
+				r.overflows++ // The target would write behind the half buffer, what cannot be executed here.
+				continue
+			}
+			for C.TriceSimFits() == 0 { // The oldest unread trices get lost, but their sequence numbers stay pending.
+				C.TriceSimTransfer()
+				triceClearOutBuffer()
+				r.overwritten++
+			}
+			seq := uint32(r.written)
+			pending[seq] = now
+			ns := int(C.TriceSimWrite(C.int(kind), C.uint32_t(seq)))
+			r.written++
+			r.writeNs += ns
+			if ns > r.writeNsMax {
+				r.writeNsMax = ns
+			}
+			if mode == directTransfer {
+				direct = append(direct, capture()...)
+			} else {
+				triceClearOutBuffer()
+			}
+		}
+		if mode == directTransfer {
+			send(now, direct) // The direct output of a tick is decoded at once, what is much faster.
+			direct = direct[:0]
+			C.TriceSimTransfer() // keeps the double buffer from overflowing
+			triceClearOutBuffer()
+			if now >= c.duration {
+				break
+			}
+			continue
+		}
+		if linkFree > now {
+			continue
+		}
+		if beforeTransfer != nil {
+			beforeTransfer()
+		}
+		r.transferNs += int(C.TriceSimTransfer())
+		r.transfers++
+		b := capture()
+		send(now, b)
+		if now < c.duration || len(b) > 0 {
+			idle = 0
+		} else if idle++; idle > 4 { // more than one transfer could be needed to drain the buffers
+			break
+		}
+	}
+	sort.Slice(r.latency, func(i, j int) bool { return r.latency[i] < r.latency[j] })
+	r.depthMax = int(C.TriceSimDepthMax())
+	r.singleMax = int(C.TriceSimSingleMax())
+	return
+}
+
+// triceSimulateTest runs the workload given with the -sim flag and logs the report.
+func triceSimulateTest(t *testing.T, triceLog logF, mode triceMode, beforeTransfer func()) {
+	c, err := parseSim(*simFlag)
+	assert.Nil(t, err)
+	r := triceSimulate(t, triceLog, mode, c, beforeTransfer)
+	t.Log("\n" + r.String())
+	assert.True(t, r.written > 0)
+	assert.True(t, r.delivered > 0)
+	assert.True(t, r.delivered <= r.written)
+}
@@ -55,6 +55,11 @@ extern "C" {
 //! When TRICE_BUFFER == TRICE_RING_BUFFER, this is the whole buffer. 
 #define TRICE_DEFERRED_BUFFER_SIZE 0x400 // must be a multiple of 4
 
+uint32_t TriceCpuCycles( void );
+
+//! TRICE_CPU_CYCLES measures the locked critical sections inside TriceCriticalSectionCyclesMax as baseline for doubleBuffer_deferred_lockfree_cobs.
+#define TRICE_CPU_CYCLES() TriceCpuCycles()
+
 //! TRICE_MCU_IS_BIG_ENDIAN needs to be defined for TRICE64 macros on big endian MCUs for correct 64-bit values and 32-bit timestamp encoding-
 //#define TRICE_MCU_IS_BIG_ENDIAN 
 
@@ -0,0 +1,30 @@
+package cgot
+
+import (
+	"bytes"
+	"io"
+	"path"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// TestLogs checks all triceCheck.c lines with big endian transfer order, forced by TRICE_TRANSFER_ORDER_IS_NOT_MCU_ENDIAN.
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string) string {
+	var o bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "COBS", "-triceEndianness", "bigEndian"}))
+	return o.String()
+}
+
+func TestLogs(t *testing.T) {
+	triceLogTest(t, triceLog, -1, deferredTransfer)
+}
+
+// TestSimulate runs the simulator workload against this configuration. Use -args -sim "key=value,..." for other workloads.
+func TestSimulate(t *testing.T) {
+	triceSimulateTest(t, triceLog, deferredTransfer, nil)
+}
@@ -0,0 +1,54 @@
+package cgot
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"path"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// rateLines returns the decoded lines of n rate limited trices, with the fake clock moved by step before each.
+func rateLines(t *testing.T, n int, step uint32) []string {
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	triceClearOutBuffer()
+	buf := fmt.Sprint(triceRateSequence(t, n, step))
+	var o bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&o), &afero.Afero{Fs: afero.NewOsFs()}, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buf[1 : len(buf)-1], "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "COBS"}))
+	return strings.Split(strings.TrimSuffix(o.String(), "\n"), "\n")
+}
+
+// rateLine returns the expected line for the rate limited trice with value i.
+func rateLine(i int) string {
+	return fmt.Sprintf("time:            default: msg:rate %d", i)
+}
+
+// TestRateLimit checks the token bucket with a fake clock, which wraps during the test.
+// The configuration allows bursts of 4 trices and 1 trice each 100 ticks and reports each 10000 ticks.
+func TestRateLimit(t *testing.T) {
+	setFakeStamp32(0xFFFFD000)
+
+	// A burst of 20 trices at the same time passes only 4.
+	assert.Equal(t, []string{rateLine(0), rateLine(1), rateLine(2), rateLine(3)}, rateLines(t, 20, 0))
+
+	// After the report period the suppressed count is reported first and the bucket is full again.
+	setFakeStamp32(fakeStamp32() + 10000)
+	assert.Equal(t, []string{"time:            default: wrn:ID 8026: 16 suppressed", rateLine(0)}, rateLines(t, 1, 0))
+
+	// With 1 trice each 100 ticks nothing is suppressed. The fake clock wraps here.
+	lines := rateLines(t, 40, 100)
+	assert.Equal(t, 40, len(lines))
+	for i, line := range lines {
+		assert.Equal(t, rateLine(i), line)
+	}
+
+	// With 1 trice each 50 ticks every 2nd trice is suppressed after the remaining tokens are used.
+	lines = rateLines(t, 40, 50)
+	assert.True(t, 20 < len(lines) && len(lines) < 26, len(lines))
+}
@@ -0,0 +1,22 @@
+/*! \file rateLimit.c
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include <stdint.h>
+#include "trice.h"
+
+void TriceCapture( void );
+void TriceCaptureReset( void );
+
+//! triceFakeStamp32 is the TriceStamp32 value. The tests move it forward.
+uint32_t triceFakeStamp32 = 0x32323232;
+
+//! TriceRateSequence writes n trices with the same ID, moving the fake clock by step before each, and captures them.
+void TriceRateSequence( int n, uint32_t step ){
+    TriceCaptureReset();
+    for( int i = 0; i < n; i++ ){
+        triceFakeStamp32 += step;
+        trice32( iD(8026), "msg:rate %d\n", i );
+    }
+    TriceCapture();
+    TriceCapture(); // The double buffer needs a 2nd transfer for the last trices.
+}
@@ -0,0 +1,24 @@
+package cgot
+
+// #include <stdint.h>
+// extern uint32_t triceFakeStamp32;
+// void TriceRateSequence( int n, uint32_t step );
+import "C"
+
+import "testing"
+
+// setFakeStamp32 sets the target TriceStamp32 value.
+func setFakeStamp32(stamp uint32) {
+	C.triceFakeStamp32 = C.uint32_t(stamp)
+}
+
+// fakeStamp32 returns the target TriceStamp32 value.
+func fakeStamp32() uint32 {
+	return uint32(C.triceFakeStamp32)
+}
+
+// triceRateSequence writes n trices with the same ID, moving the fake clock by step before each, and returns the captured output.
+func triceRateSequence(t *testing.T, n int, step uint32) []byte {
+	C.TriceRateSequence(C.int(n), C.uint32_t(step))
+	return triceCaptured(t)
+}
@@ -0,0 +1,55 @@
+package cgot
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"path"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output. Additional log switches are passed in ts.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string, ts ...string) string {
+	var o bytes.Buffer
+	a := []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "COBS"}
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, append(a, ts...)))
+	return o.String()
+}
+
+// stamp64Stream executes the stamp64.c trices and returns the deferred output as space separated numbers.
+func stamp64Stream() string {
+	out := make([]byte, 4096)
+	setTriceBuffer(out)
+	triceClearOutBuffer()
+	triceStamp64Check()
+	triceTransfer()
+	buf := fmt.Sprint(out[:triceOutDepth()])
+	return buf[1 : len(buf)-1]
+}
+
+// TestStamp64NotPassed checks, that without -ts64 the trices with 64-bit stamps are not decoded.
+// It needs to run before TestStamp64, because the log flag set remembers the passed flags.
+func TestStamp64NotPassed(t *testing.T) {
+	osFSys := &afero.Afero{Fs: afero.NewOsFs()}
+	act := triceLog(t, osFSys, stamp64Stream(), "-ts16", "s%04x ")
+	assert.True(t, strings.HasPrefix(act, "time:            default: msg:no stamp 0\ns1616 default: msg:16-bit stamp 16\n"), act)
+	assert.False(t, strings.Contains(act, "64-bit stamp"), act)
+}
+
+// TestStamp64 checks, that the 12-byte trice heads with 64-bit stamps are transferred and decoded with -ts64.
+func TestStamp64(t *testing.T) {
+	osFSys := &afero.Afero{Fs: afero.NewOsFs()}
+	act := triceLog(t, osFSys, stamp64Stream(), "-ts16", "s%04x ", "-ts64", "x%016x ")
+	exp := `time:            default: msg:no stamp 0
+s1616 default: msg:16-bit stamp 16
+x6464646432323232 default: msg:64-bit stamp 64
+x6464646432323232 default: msg:64-bit stamp and value 1234605616436508552
+`
+	assert.Equal(t, exp, act)
+}
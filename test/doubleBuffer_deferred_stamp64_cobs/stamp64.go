@@ -0,0 +1,9 @@
+package cgot
+
+// #include "../testdata/stamp64.c"
+import "C"
+
+// triceStamp64Check executes the trices inside stamp64.c.
+func triceStamp64Check() {
+	C.TriceStamp64Check()
+}
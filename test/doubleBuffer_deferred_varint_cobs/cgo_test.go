@@ -0,0 +1,47 @@
+package cgot
+
+import (
+	"bytes"
+	"io"
+	"path"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string) string {
+	var o bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "COBS", "-payloadCodec", "varint"}))
+	return o.String()
+}
+
+func TestLogs(t *testing.T) {
+	triceLogTest(t, triceLog, testLines, deferredTransfer)
+}
+
+// TestSimulate runs the simulator workload against this configuration. Use -args -sim "key=value,..." for other workloads.
+func TestSimulate(t *testing.T) {
+	triceSimulateTest(t, triceLog, deferredTransfer, nil)
+}
+
+// TestCodecReduction executes all triceCheck.c test lines and reports the payload codec byte reduction and the spent cycles.
+func TestCodecReduction(t *testing.T) {
+	osFSys := &afero.Afero{Fs: afero.NewOsFs()}
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	in0, out0, cycles0 := triceCodecStatistics()
+	for _, r := range getExpectedResults(osFSys, path.Join(triceDir, "./test/testdata/triceCheck.c")) {
+		triceCheck(r.line)
+		triceTransfer()
+		triceClearOutBuffer()
+	}
+	in1, out1, cycles1 := triceCodecStatistics()
+	in, enc, cycles := in1-in0, out1-out0, cycles1-cycles0
+	assert.True(t, in > 0)
+	assert.True(t, enc < in)
+	t.Logf("payload codec: %d -> %d bytes (%.1f%% saved), %d cycles (%.1f cycles per byte)", in, enc, 100*float64(in-enc)/float64(in), cycles, float64(cycles)/float64(in))
+}
@@ -0,0 +1,32 @@
+/*! \file codec.c
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include <stdint.h>
+#include <time.h>
+#include "trice.h"
+
+//! TriceCpuCycles returns a free running 32-bit cycle count for TRICE_CPU_CYCLES.
+uint32_t TriceCpuCycles( void ){
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__builtin_ia32_rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (uint32_t)ts.tv_nsec;
+#endif
+}
+
+//! TriceCodecBytesInCGO returns TriceCodecBytesIn.
+unsigned TriceCodecBytesInCGO( void ){
+    return TriceCodecBytesIn;
+}
+
+//! TriceCodecBytesOutCGO returns TriceCodecBytesOut.
+unsigned TriceCodecBytesOutCGO( void ){
+    return TriceCodecBytesOut;
+}
+
+//! TriceCodecCyclesCGO returns TriceCodecCycles.
+unsigned TriceCodecCyclesCGO( void ){
+    return TriceCodecCycles;
+}
@@ -0,0 +1,11 @@
+package cgot
+
+// unsigned TriceCodecBytesInCGO( void );
+// unsigned TriceCodecBytesOutCGO( void );
+// unsigned TriceCodecCyclesCGO( void );
+import "C"
+
+// triceCodecStatistics returns the summed byte counts before and after the payload encoding and the spent cycles.
+func triceCodecStatistics() (in, out, cycles int) {
+	return int(C.TriceCodecBytesInCGO()), int(C.TriceCodecBytesOutCGO()), int(C.TriceCodecCyclesCGO())
+}
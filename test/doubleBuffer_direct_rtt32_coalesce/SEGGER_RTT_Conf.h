@@ -0,0 +1,20 @@
+/*! \file SEGGER_RTT_Conf.h
+\brief Host configuration for compiling SEGGER_RTT.c into the cgo tests.
+\details The RTT control block lives in host memory. Locks and memory barriers are not needed, because the tests are single threaded.
+*******************************************************************************/
+
+#ifndef SEGGER_RTT_CONF_H
+#define SEGGER_RTT_CONF_H
+
+#define SEGGER_RTT_MAX_NUM_UP_BUFFERS   (1)  // Max. number of up-buffers (T->H) available on this target
+#define SEGGER_RTT_MAX_NUM_DOWN_BUFFERS (1)  // Max. number of down-buffers (H->T) available on this target
+#define BUFFER_SIZE_UP                  (1024) // Small enough, that the tests wrap around several times.
+#define BUFFER_SIZE_DOWN                (16) // Size of the buffer for terminal input to target from host
+#define SEGGER_RTT_PRINTF_BUFFER_SIZE   (64u) // Size of buffer for RTT printf to bulk-send chars via RTT
+#define SEGGER_RTT_MODE_DEFAULT         SEGGER_RTT_MODE_NO_BLOCK_SKIP // Mode for pre-initialized terminal channel (buffer 0)
+#define SEGGER_RTT_MEMCPY_USE_BYTELOOP  0 // 0: Use memcpy/SEGGER_RTT_MEMCPY, 1: Use a simple byte-loop
+
+#define SEGGER_RTT_LOCK()
+#define SEGGER_RTT_UNLOCK()
+
+#endif // #ifndef SEGGER_RTT_CONF_H
@@ -0,0 +1,145 @@
+package cgot
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"math/rand"
+	"path"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// rttLog decodes the RTT data b and returns the log output.
+func rttLog(t *testing.T, b []byte) string {
+	if len(b) == 0 {
+		return ""
+	}
+	buf := fmt.Sprint(b)
+	var o bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&o), &afero.Afero{Fs: afero.NewOsFs()}, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buf[1 : len(buf)-1], "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "NONE", "-d16"}))
+	return o.String()
+}
+
+// rttReadAll reads the RTT up-buffer 0 until it is empty.
+func rttReadAll() []byte {
+	var all []byte
+	b := make([]byte, 2048)
+	for n := rttRead(b); n > 0; n = rttRead(b) {
+		all = append(all, b[:n]...)
+	}
+	return all
+}
+
+// rttExpected returns the expected log line of rttTrice(kind, v). The trices have no stamp, so the line starts with the -ts0 default.
+func rttExpected(kind int, v uint32) string {
+	count := []int{1, 12, 8}[kind]
+	return "time:            default: rtt:" + strings.TrimSpace(strings.Repeat(fmt.Sprint(v, " "), count)) + "\n"
+}
+
+// rttReset writes the staged trices and empties the double buffer, which takes the trices too and has no overflow check.
+func rttReset() {
+	triceTransfer()
+	triceTransfer()
+	rttDrain()
+}
+
+// TestLogs checks the triceCheck.c trices, which are flushed after each line.
+func TestLogs(t *testing.T) {
+	osFSys := &afero.Afero{Fs: afero.NewOsFs()}
+	result := getExpectedResults(osFSys, path.Join(triceDir, "./test/testdata/triceCheck.c"))
+	rttReset()
+
+	for i, r := range result {
+		if testLines >= 0 && i+1 >= testLines {
+			return
+		}
+		fmt.Println(i, r)
+
+		triceCheck(r.line)
+		triceFlush()
+		assert.Equal(t, r.exps, strings.TrimSuffix(rttLog(t, rttReadAll()), "\n"))
+		rttReset()
+	}
+}
+
+// TestCoalesceCount checks, that the staged trices show up, when TRICE_DIRECT_COALESCE_COUNT is reached, with a single RTT write.
+func TestCoalesceCount(t *testing.T) {
+	rttReset()
+	writeCount := rttWriteCount()
+	var exp string
+	for i := uint32(0); i < 3; i++ {
+		rttTrice(0, i)
+		exp += rttExpected(0, i)
+		assert.Equal(t, 0, len(rttReadAll()))
+	}
+	rttTrice(0, 3)
+	exp += rttExpected(0, 3)
+	assert.Equal(t, exp, rttLog(t, rttReadAll()))
+	assert.Equal(t, writeCount+1, rttWriteCount())
+}
+
+// TestCoalesceFlush checks, that TriceFlush writes the staged trices and does nothing on an empty staging area.
+func TestCoalesceFlush(t *testing.T) {
+	rttReset()
+	writeCount := rttWriteCount()
+	rttTrice(0, 7)
+	rttTrice(0, 8)
+	assert.Equal(t, 0, len(rttReadAll()))
+	triceFlush()
+	assert.Equal(t, rttExpected(0, 7)+rttExpected(0, 8), rttLog(t, rttReadAll()))
+	triceFlush()
+	assert.Equal(t, writeCount+1, rttWriteCount())
+}
+
+// TestCoalesceFill checks, that a trice not fitting into the staging area writes the staged trices first,
+// and that a trice bigger than the staging area follows them directly.
+func TestCoalesceFill(t *testing.T) {
+	rttReset()
+	writeCount := rttWriteCount()
+	rttTrice(1, 1) // 52 bytes
+	assert.Equal(t, 0, len(rttReadAll()))
+	rttTrice(1, 2) // does not fit into the 64 bytes
+	assert.Equal(t, rttExpected(1, 1), rttLog(t, rttReadAll()))
+	rttTrice(2, 3) // 68 bytes, bigger than the staging area
+	assert.Equal(t, rttExpected(1, 2)+rttExpected(2, 3), rttLog(t, rttReadAll()))
+	assert.Equal(t, writeCount+3, rttWriteCount())
+}
+
+// TestCoalesceOrder checks, that a random trice sequence with random TriceFlush calls and regular TriceTransfer calls arrives unchanged and in order.
+func TestCoalesceOrder(t *testing.T) {
+	rnd := rand.New(rand.NewSource(1))
+	rttReset()
+	var exp, act string
+	for i := uint32(0); i < 300; i++ {
+		kind := rnd.Intn(3)
+		rttTrice(kind, i)
+		exp += rttExpected(kind, i)
+		switch rnd.Intn(10) {
+		case 0:
+			triceFlush()
+		case 1, 2:
+			act += rttLog(t, rttReadAll())
+		}
+		if i%4 == 3 { // keeps the double buffer half from overflowing
+			triceTransfer()
+		}
+	}
+	triceFlush()
+	act += rttLog(t, rttReadAll())
+	assert.Equal(t, exp, act)
+}
+
+// BenchmarkRttTrice measures small trices with coalesced direct RTT output and reports the RTT write offset updates per trice.
+func BenchmarkRttTrice(b *testing.B) {
+	rttReset()
+	triceInit()
+	writeCount := rttWriteCount()
+	b.ResetTimer()
+	rttTriceLoop(b.N)
+	b.ReportMetric(float64(rttWriteCount()-writeCount)/float64(b.N), "WrOff/trice")
+}
@@ -0,0 +1,36 @@
+/*! \file rttTrice.c
+\brief trices for the direct RTT output tests and benchmarks
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include <stdint.h>
+#include "trice.h"
+
+//! CgoRttTrice writes a small (kind 0), a 52 bytes (kind 1) or a 68 bytes (kind 2) trice with value v.
+void CgoRttTrice( int kind, uint32_t v ){
+    switch( kind ){
+        case 0:
+            trice32( iD(8035), "rtt:%u\n", v );
+            break;
+        case 1:
+            trice32( iD(8036), "rtt:%u %u %u %u %u %u %u %u %u %u %u %u\n", v, v, v, v, v, v, v, v, v, v, v, v );
+            break;
+        default:
+            trice64( iD(8037), "rtt:%d %d %d %d %d %d %d %d\n", (int64_t)v, (int64_t)v, (int64_t)v, (int64_t)v, (int64_t)v, (int64_t)v, (int64_t)v, (int64_t)v );
+            break;
+    }
+}
+
+//! CgoRttTriceLoop writes n small trices and lets the host side read the RTT up-buffer 0 instantly after each trice.
+//! TriceTransfer is called after each 16 trices, because the double buffer takes the trices too and has no overflow check.
+void CgoRttTriceLoop( int n ){
+    SEGGER_RTT_BUFFER_UP* pRing = &_SEGGER_RTT.aUp[0];
+    for( int i = 0; i < n; i++ ){
+        CgoRttTrice( 0, i );
+        pRing->RdOff = pRing->WrOff;
+        if( (i & 15) == 15 ){
+            TriceTransfer();
+        }
+    }
+    TriceFlush();
+    pRing->RdOff = pRing->WrOff;
+}
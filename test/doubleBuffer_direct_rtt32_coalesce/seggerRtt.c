@@ -0,0 +1,36 @@
+/*! \file seggerRtt.c
+\brief SEGGER RTT on the host for tests
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include <stdint.h>
+#include "../../src/SEGGER_RTT.c"
+
+void TriceWriteRtt0Fast( void const * pData, unsigned NumBytes );
+
+// CgoRttRead copies up to max bytes from the RTT up-buffer 0 into buf and returns the copied byte count.
+// It does, what the J-Link does on the host side: reading from RdOff to WrOff and advancing RdOff.
+unsigned CgoRttRead( uint8_t* buf, unsigned max ){
+    SEGGER_RTT_BUFFER_UP* pRing = &_SEGGER_RTT.aUp[0];
+    unsigned count = 0;
+    while( count < max && pRing->RdOff != pRing->WrOff ){
+        buf[count++] = (uint8_t)pRing->pBuffer[pRing->RdOff++];
+        if( pRing->RdOff == pRing->SizeOfBuffer ){
+            pRing->RdOff = 0;
+        }
+    }
+    return count;
+}
+
+// CgoRttWriteLoop writes buf loops times into the RTT up-buffer 0 and lets the host side read it instantly.
+// With fast != 0 TriceWriteRtt0Fast is used, otherwise SEGGER_RTT_WriteNoLock.
+void CgoRttWriteLoop( int fast, void const * buf, unsigned len, int loops ){
+    SEGGER_RTT_BUFFER_UP* pRing = &_SEGGER_RTT.aUp[0];
+    while( loops-- ){
+        if( fast ){
+            TriceWriteRtt0Fast( buf, len );
+        }else{
+            SEGGER_RTT_WriteNoLock( 0, buf, len );
+        }
+        pRing->RdOff = pRing->WrOff;
+    }
+}
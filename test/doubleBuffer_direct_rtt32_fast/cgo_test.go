@@ -0,0 +1,118 @@
+package cgot
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"math/rand"
+	"path"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+func TestLogs(t *testing.T) {
+	osFSys := &afero.Afero{Fs: afero.NewOsFs()}
+	result := getExpectedResults(osFSys, path.Join(triceDir, "./test/testdata/triceCheck.c"))
+	rtt := make([]byte, 2048)
+	rttDrain()
+
+	for i, r := range result {
+		if testLines >= 0 && i+1 >= testLines {
+			return
+		}
+		fmt.Println(i, r)
+
+		triceCheck(r.line)
+		n := rttRead(rtt)
+		buf := fmt.Sprint(rtt[:n])
+		buffer := buf[1 : len(buf)-1]
+
+		var o bytes.Buffer
+		assert.Nil(t, args.Handler(io.Writer(&o), osFSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "NONE", "-d16"}))
+		assert.Equal(t, r.exps, strings.TrimSuffix(o.String(), "\n"))
+	}
+}
+
+// TestRttWrap checks, that TriceWriteRtt0Fast delivers a byte stream unchanged over many RTT buffer wraps.
+// Packages not fitting into the buffer are skipped completely and must not show up in the stream.
+func TestRttWrap(t *testing.T) {
+	rnd := rand.New(rand.NewSource(1))
+	rttDrain()
+	var exp, act bytes.Buffer
+	rtt := make([]byte, 2048)
+	skipped := 0
+	for i := 0; i < 2000; i++ {
+		b := make([]byte, 1+rnd.Intn(300))
+		rnd.Read(b)
+		skipCount := rttSkipCount()
+		rttWrite(b)
+		if rttSkipCount() == skipCount {
+			exp.Write(b)
+		} else {
+			skipped++
+		}
+		if rnd.Intn(3) == 0 { // let the buffer fill sometimes
+			continue
+		}
+		n := rttRead(rtt)
+		act.Write(rtt[:n])
+	}
+	n := rttRead(rtt)
+	act.Write(rtt[:n])
+	assert.True(t, skipped > 0)
+	assert.Equal(t, exp.Bytes(), act.Bytes())
+}
+
+// TestRttSkip checks, that a full RTT buffer is not overwritten.
+func TestRttSkip(t *testing.T) {
+	rttDrain()
+	b := make([]byte, 1000)
+	for i := range b {
+		b[i] = byte(i)
+	}
+	skipCount := rttSkipCount()
+	rttWrite(b)
+	rttWrite(b[:100]) // only 23 bytes free
+	assert.Equal(t, skipCount+1, rttSkipCount())
+	rttWrite(b[:23])
+	assert.Equal(t, skipCount+1, rttSkipCount())
+	rtt := make([]byte, 2048)
+	n := rttRead(rtt)
+	assert.Equal(t, append(b, b[:23]...), rtt[:n])
+}
+
+func benchmarkRtt(b *testing.B, fast bool) {
+	for _, size := range []int{8, 32, 128, 512} {
+		data := make([]byte, size)
+		b.Run(fmt.Sprint(size), func(b *testing.B) {
+			b.SetBytes(int64(size))
+			rttWriteLoop(fast, data, b.N)
+		})
+	}
+}
+
+// BenchmarkRttWriteFast measures TriceWriteRtt0Fast.
+func BenchmarkRttWriteFast(b *testing.B) {
+	triceInit()
+	benchmarkRtt(b, true)
+}
+
+// BenchmarkRttWriteNoLock measures SEGGER_RTT_WriteNoLock for comparison.
+func BenchmarkRttWriteNoLock(b *testing.B) {
+	benchmarkRtt(b, false)
+	triceInit() // The TriceWriteRtt0Fast shadow write offset is outdated now.
+}
+
+// BenchmarkRttTrice measures small trices with direct RTT output and reports the RTT write offset updates per trice.
+func BenchmarkRttTrice(b *testing.B) {
+	triceInit()
+	rttDrain()
+	writeCount := rttWriteCount()
+	b.ResetTimer()
+	rttTriceLoop(b.N)
+	b.ReportMetric(float64(rttWriteCount()-writeCount)/float64(b.N), "WrOff/trice")
+}
@@ -0,0 +1,73 @@
+package cgot
+
+// #cgo CFLAGS: -I${SRCDIR}
+// #include <stdint.h>
+// unsigned CgoRttRead( uint8_t* buf, unsigned max );
+// void TriceWriteRtt0Fast( void const * pData, unsigned NumBytes );
+// extern unsigned RTT0_skipCount;
+// void TriceInit( void );
+// void CgoRttWriteLoop( int fast, void const * buf, unsigned len, int loops );
+// void CgoRttTrice( int kind, uint32_t v );
+// void CgoRttTriceLoop( int n );
+// void TriceFlush( void );
+// extern unsigned RTT0_writeCount;
+import "C"
+
+import "unsafe"
+
+// rttRead reads the RTT up-buffer 0 like a J-Link into b and returns the read byte count.
+func rttRead(b []byte) int {
+	return int(C.CgoRttRead((*C.uint8_t)(unsafe.Pointer(&b[0])), C.unsigned(len(b))))
+}
+
+// rttWrite writes b with TriceWriteRtt0Fast into the RTT up-buffer 0.
+func rttWrite(b []byte) {
+	C.TriceWriteRtt0Fast(cPtr(b), C.unsigned(len(b)))
+}
+
+// rttWriteLoop writes b n times into the RTT up-buffer 0, with TriceWriteRtt0Fast if fast is true, otherwise with SEGGER_RTT_WriteNoLock.
+// The host side read is simulated instantly after each write.
+func rttWriteLoop(fast bool, b []byte, n int) {
+	var f C.int
+	if fast {
+		f = 1
+	}
+	C.CgoRttWriteLoop(f, cPtr(b), C.unsigned(len(b)), C.int(n))
+}
+
+// rttSkipCount returns the count of writes skipped by TriceWriteRtt0Fast.
+func rttSkipCount() int {
+	return int(C.RTT0_skipCount)
+}
+
+// rttDrain reads the RTT up-buffer 0 until it is empty.
+func rttDrain() {
+	b := make([]byte, 256)
+	for rttRead(b) > 0 {
+	}
+}
+
+// triceInit re-initializes the trice runtime, what synchronizes the TriceWriteRtt0Fast shadow values with the RTT control block.
+func triceInit() {
+	C.TriceInit()
+}
+
+// rttTrice writes a small (kind 0), a 52 bytes (kind 1) or a 68 bytes (kind 2) trice with value v.
+func rttTrice(kind int, v uint32) {
+	C.CgoRttTrice(C.int(kind), C.uint32_t(v))
+}
+
+// rttTriceLoop writes n small trices, each read instantly by the host side.
+func rttTriceLoop(n int) {
+	C.CgoRttTriceLoop(C.int(n))
+}
+
+// rttWriteCount returns the count of RTT up-buffer 0 writes by the direct output, which is the count of write offset updates.
+func rttWriteCount() int {
+	return int(C.RTT0_writeCount)
+}
+
+// triceFlush writes the staged trices into the RTT up-buffer 0.
+func triceFlush() {
+	C.TriceFlush()
+}
@@ -0,0 +1,52 @@
+package cgot
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"path"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string) string {
+	var o bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-packageFraming", "COBS"}))
+	return o.String()
+}
+
+func TestLogs(t *testing.T) {
+	triceLogTest(t, triceLog, testLines, deferredTransfer)
+}
+
+// TestSimulate runs the simulator workload against this configuration. Use -args -sim "key=value,..." for other workloads.
+func TestSimulate(t *testing.T) {
+	triceSimulateTest(t, triceLog, deferredTransfer, nil)
+}
+
+// floodLines returns the decoded lines of n flood trices with a consumer transferring a trice after each every-th trice.
+func floodLines(t *testing.T, n, every int) []string {
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	triceClearOutBuffer()
+	buf := fmt.Sprint(triceFlood(t, n, every))
+	act := triceLog(t, &afero.Afero{Fs: afero.NewOsFs()}, buf[1:len(buf)-1])
+	return strings.Split(strings.TrimSuffix(act, "\n"), "\n")
+}
+
+// TestBlock floods the ring without transferring. The TRICE macros have to wait for the consumer, so no trice gets lost.
+func TestBlock(t *testing.T) {
+	const floodCount = 400
+	lines := floodLines(t, floodCount, 0)
+	assert.Equal(t, floodCount, len(lines))
+	for i, line := range lines {
+		assert.Equal(t, fmt.Sprintf("time:            default: dbg:flood %d", i), line)
+	}
+	assert.Equal(t, 0, triceFloodOverflowCount())
+}
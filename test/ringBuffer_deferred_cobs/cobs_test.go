@@ -0,0 +1,98 @@
+package cgot
+
+import (
+	"fmt"
+	"math/rand"
+	"testing"
+
+	cobs "github.com/rokath/cobs/go"
+	"github.com/tj/assert"
+)
+
+// cobsTestData returns n random bytes. About every zeroEvery-th byte is 0. With zeroEvery == 0 no zeroes are inside.
+func cobsTestData(rnd *rand.Rand, n, zeroEvery int) []byte {
+	b := make([]byte, n)
+	for i := range b {
+		if zeroEvery > 0 && rnd.Intn(zeroEvery) == 0 {
+			continue
+		}
+		b[i] = byte(1 + rnd.Intn(255))
+	}
+	return b
+}
+
+// TestCOBSWordwiseEquivalence checks the word-wise COBS functions against the reference C code and the Go decoder.
+func TestCOBSWordwiseEquivalence(t *testing.T) {
+	rnd := rand.New(rand.NewSource(1))
+	for i := 0; i < 20000; i++ {
+		n := 4 + rnd.Intn(1100)
+		if i%100 == 0 {
+			n = 4096 + rnd.Intn(16)
+		}
+		in := cobsTestData(rnd, n, []int{0, 1, 2, 5, 50, 300}[i%6])
+		in = in[rnd.Intn(4):] // vary alignment and also get short inputs
+
+		// +2: COBSEncode uses sometimes 1 scratch byte behind the encoded length
+		exp := make([]byte, len(in)+len(in)/254+2)
+		act := make([]byte, len(in)+len(in)/254+2)
+		expLen := cobsEncode(exp, in)
+		actLen := cobsEncodeWordwise(act, in)
+		assert.Equal(t, exp[:expLen], act[:actLen])
+
+		// in-buffer encoding like inside the trice code with TRICE_DATA_OFFSET space in front
+		buf := make([]byte, 16+len(in)+len(in)/254+2)
+		copy(buf[16:], in)
+		bufLen := cobsEncodeWordwise(buf, buf[16:16+len(in)])
+		assert.Equal(t, exp[:expLen], buf[:bufLen])
+
+		dec := make([]byte, len(in))
+		n, e := cobs.Decode(dec, act[:actLen])
+		assert.Nil(t, e)
+		assert.Equal(t, in, dec[:n])
+
+		n = cobsDecode(dec, act[:actLen])
+		assert.Equal(t, in, dec[:n])
+
+		dec = make([]byte, len(in)+1)
+		n = cobsDecodeWordwise(dec, act[:actLen])
+		assert.Equal(t, in, dec[:n])
+	}
+}
+
+// TestCOBSWordwiseDecodeEdges checks the word-wise decoder against the reference decoder on inconsistent and delimited data.
+func TestCOBSWordwiseDecodeEdges(t *testing.T) {
+	rnd := rand.New(rand.NewSource(2))
+	for i := 0; i < 5000; i++ {
+		in := make([]byte, rnd.Intn(600))
+		rnd.Read(in)
+		exp := make([]byte, len(in)+1)
+		act := make([]byte, len(in)+1)
+		expLen := cobsDecode(exp, in)
+		actLen := cobsDecodeWordwise(act, in)
+		assert.Equal(t, exp[:expLen], act[:actLen])
+	}
+}
+
+// benchmarkCOBS reports the encoding speed for packages of different sizes containing rarely zeroes.
+func benchmarkCOBS(b *testing.B, encode func(out, in []byte) int) {
+	rnd := rand.New(rand.NewSource(3))
+	for _, size := range []int{16, 64, 256, 1024, 4096} {
+		in := cobsTestData(rnd, size, 64)
+		out := make([]byte, size+size/254+2)
+		b.Run(fmt.Sprint(size, "B"), func(b *testing.B) {
+			b.SetBytes(int64(size))
+			for i := 0; i < b.N; i++ {
+				encode(out, in)
+			}
+			b.ReportMetric(float64(b.Elapsed().Nanoseconds())/float64(b.N)/float64(size), "ns/B")
+		})
+	}
+}
+
+func BenchmarkCOBSEncode(b *testing.B) {
+	benchmarkCOBS(b, cobsEncode)
+}
+
+func BenchmarkCOBSEncodeWordwise(b *testing.B) {
+	benchmarkCOBS(b, cobsEncodeWordwise)
+}
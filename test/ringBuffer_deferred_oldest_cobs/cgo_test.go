@@ -0,0 +1,66 @@
+package cgot
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"path"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string) string {
+	var o bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-packageFraming", "COBS"}))
+	return o.String()
+}
+
+func TestLogs(t *testing.T) {
+	triceLogTest(t, triceLog, testLines, deferredTransfer)
+}
+
+// floodLines returns the decoded lines of n flood trices with a consumer transferring a trice after each every-th trice.
+func floodLines(t *testing.T, n, every int) []string {
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	triceClearOutBuffer()
+	buf := fmt.Sprint(triceFlood(t, n, every))
+	act := triceLog(t, &afero.Afero{Fs: afero.NewOsFs()}, buf[1:len(buf)-1])
+	return strings.Split(strings.TrimSuffix(act, "\n"), "\n")
+}
+
+// TestDropOldest floods the ring with a consumer 8 times slower than the producer. The newest trices must survive
+// and the "trices lost" reports must sum up to the gaps in the received trices.
+func TestDropOldest(t *testing.T) {
+	const floodCount = 400
+	var lost, received int
+	last := -1
+	for _, line := range floodLines(t, floodCount, 8) {
+		var i, n int
+		if _, err := fmt.Sscanf(line, "time:            default: dbg:flood %d", &i); err == nil {
+			assert.True(t, i > last, line)
+			last = i
+			received++
+		} else {
+			_, err := fmt.Sscanf(line, "time:            default: wrn:%d trices lost", &n)
+			assert.Nil(t, err, line)
+			lost += n
+		}
+	}
+	assert.Equal(t, floodCount-1, last)
+	assert.True(t, lost > 0)
+	assert.Equal(t, floodCount, received+lost)
+	assert.Equal(t, lost, triceFloodOverflowCount())
+}
+
+// TestSimulate runs the simulator workload against this configuration. Use -args -sim "key=value,..." for other workloads.
+// It runs last, because the flood tests expect unchanged overflow counters.
+func TestSimulate(t *testing.T) {
+	triceSimulateTest(t, triceLog, deferredTransfer, nil)
+}
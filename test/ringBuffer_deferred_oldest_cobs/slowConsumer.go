@@ -0,0 +1,19 @@
+package cgot
+
+// #include "../testdata/slowConsumer.c"
+// void TriceFlood( int n, int every );
+// unsigned TriceFloodOverflowCount( void );
+import "C"
+
+import "testing"
+
+// triceFlood executes n trices with a consumer transferring a trice after each every-th trice and returns the captured output.
+func triceFlood(t *testing.T, n, every int) []byte {
+	C.TriceFlood(C.int(n), C.int(every))
+	return triceCaptured(t)
+}
+
+// triceFloodOverflowCount returns the count of dropped trices.
+func triceFloodOverflowCount() int {
+	return int(C.TriceFloodOverflowCount())
+}
@@ -0,0 +1,69 @@
+package cgot
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"path"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string) string {
+	var o bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-packageFraming", "COBS"}))
+	return o.String()
+}
+
+func TestLogs(t *testing.T) {
+	triceLogTest(t, triceLog, testLines, deferredTransfer)
+}
+
+// TestPriorityFlood floods the low priority ring and checks, that all error trices arrive in order before the debug trices.
+// The debug trices arrive in order too, followed by the report of the trices dropped on ring overflow.
+func TestPriorityFlood(t *testing.T) {
+	osFSys := &afero.Afero{Fs: afero.NewOsFs()}
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	triceClearOutBuffer()
+
+	const floodCount = 400
+	tricePrioFlood(floodCount)
+
+	var lines []string
+	for {
+		triceTransfer()
+		length := triceOutDepth()
+		if length == 0 {
+			break
+		}
+		buf := fmt.Sprint(out[:length])
+		lines = append(lines, strings.TrimSuffix(triceLog(t, osFSys, buf[1:len(buf)-1]), "\n"))
+		triceClearOutBuffer()
+	}
+
+	assert.Equal(t, 0, tricePrioOverflowCount(0))
+	dropped := tricePrioOverflowCount(1)
+	assert.True(t, dropped > 0)
+	alarms := floodCount / 16
+	assert.Equal(t, alarms+floodCount-dropped+1, len(lines))
+	for i := 0; i < alarms; i++ {
+		assert.Equal(t, fmt.Sprintf("time:            default: err:alarm %d", i), lines[i])
+	}
+	for i, line := range lines[alarms : len(lines)-1] {
+		assert.Equal(t, fmt.Sprintf("time:            default: dbg:flood %d", i), line)
+	}
+	assert.Equal(t, fmt.Sprintf("time:            default: wrn:%d trices lost", dropped), lines[len(lines)-1])
+}
+
+// TestSimulate runs the simulator workload against this configuration. Use -args -sim "key=value,..." for other workloads.
+// It runs last, because the flood tests expect unchanged overflow counters.
+func TestSimulate(t *testing.T) {
+	triceSimulateTest(t, triceLog, deferredTransfer, nil)
+}
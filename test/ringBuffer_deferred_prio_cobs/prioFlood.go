@@ -0,0 +1,14 @@
+package cgot
+
+// #include "../testdata/prioFlood.c"
+import "C"
+
+// tricePrioFlood executes n debug trices mixed with n/16 error trices inside prioFlood.c.
+func tricePrioFlood(n int) {
+	C.TricePrioFlood(C.int(n))
+}
+
+// tricePrioOverflowCount returns the count of dropped trices in ring.
+func tricePrioOverflowCount(ring int) int {
+	return int(C.TricePrioOverflowCount(C.int(ring)))
+}
@@ -0,0 +1,60 @@
+package cgot
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"path"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string) string {
+	var o bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-packageFraming", "COBS"}))
+	return o.String()
+}
+
+// TestPriorityCycle floods the low priority ring with the cycle counter enabled and decodes all transfers in one go.
+// The error trices overtake the debug trices and debug trices get dropped, but no cycle error is reported,
+// because TriceTransfer assigns the cycles in transfer order. The TestLogs of the other packages are not usable here,
+// because they decode each trice with a new decoder, which expects a fresh cycle.
+func TestPriorityCycle(t *testing.T) {
+	osFSys := &afero.Afero{Fs: afero.NewOsFs()}
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	triceClearOutBuffer()
+
+	const floodCount = 400
+	tricePrioFlood(floodCount)
+
+	var stream []byte
+	for {
+		triceTransfer()
+		length := triceOutDepth()
+		if length == 0 {
+			break
+		}
+		stream = append(stream, out[:length]...)
+		triceClearOutBuffer()
+	}
+	buf := fmt.Sprint(stream)
+	log := triceLog(t, osFSys, buf[1:len(buf)-1])
+	assert.False(t, strings.Contains(log, "CYCLE"), log)
+
+	lines := strings.Split(strings.TrimSuffix(log, "\n"), "\n")
+	dropped := tricePrioOverflowCount(1)
+	assert.True(t, dropped > 0)
+	alarms := floodCount / 16
+	assert.Equal(t, alarms+floodCount-dropped+1, len(lines))
+	for i := 0; i < alarms; i++ {
+		assert.Equal(t, fmt.Sprintf("time:            default: err:alarm %d", i), lines[i])
+	}
+	assert.Equal(t, fmt.Sprintf("time:            default: wrn:%d trices lost", dropped), lines[len(lines)-1])
+}
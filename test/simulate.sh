@@ -0,0 +1,51 @@
+#!/usr/bin/env bash
+
+# simulate.sh runs the host simulator (triceSimulate in ./testdata/cgoPackage.go) against a target configuration.
+#
+# Usage:
+#   ./simulate.sh <cgo test folder> [-sim "key=value,..."]
+#   ./simulate.sh <path/to/triceConfig.h> [-sim "key=value,..."] [-simLog "trice log switches"] [-simDirect]
+#
+# A cgo test folder like ringBuffer_deferred_cobs runs its own TestSimulate.
+# A triceConfig.h is compiled together with the ../src files in a temporary package folder.
+# -simLog passes the trice log switches matching the configuration, default is "-pf COBS".
+# -simDirect is needed for configurations with direct output only.
+#
+# The simulator is no trice subcommand, because it executes the target C code compiled with the triceConfig.h
+# under test. The trice binary does not contain that code and a C compiler is not available to it, so a host
+# with the Go toolchain, cgo and this source tree is needed anyway. That is, what "go test" provides.
+#
+# Example:
+#   ./simulate.sh ringBuffer_deferred_cobs -sim "rate=5000,burst=50,baud=921600,duration=1s"
+
+if [ $# -lt 1 ]; then
+    sed -n '5,7p' "$0"
+    exit 1
+fi
+
+target=$1
+shift
+config=$(realpath "$target" 2>/dev/null)
+
+cd "$(dirname "$0")"
+
+if [ -d "./$target" ]; then
+    go test "./$target" -run TestSimulate -count=1 -v -args "$@"
+    exit $?
+fi
+
+if [ ! -f "$config" ]; then
+    echo "$target is neither a cgo test folder nor a triceConfig.h"
+    exit 1
+fi
+
+d=simulate_tmp
+rm -rf ./$d
+mkdir ./$d
+cp "$config" ./$d/triceConfig.h
+cp ./testdata/cgoPackage.go ./$d/generated_cgoPackage.go
+cp ./testdata/cgoSimulate_test.go ./$d/cgoSimulate_test.go
+go test ./$d -run TestSimulate -count=1 -v -args "$@"
+rc=$?
+rm -rf ./$d
+exit $rc
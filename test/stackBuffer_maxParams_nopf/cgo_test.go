@@ -0,0 +1,59 @@
+package cgot
+
+import (
+	"bytes"
+	"fmt"
+	"io"
+	"path"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string) string {
+	var o bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "NONE", "-d16"}))
+	return o.String()
+}
+
+func TestLogs(t *testing.T) {
+	triceLogTest(t, triceLog, testLines, directTransfer)
+}
+
+// TestSimulate runs the simulator workload against this configuration. Use -args -sim "key=value,..." for other workloads.
+func TestSimulate(t *testing.T) {
+	triceSimulateTest(t, triceLog, directTransfer, nil)
+}
+
+// TestMaxParams checks the trices with 32 values in each bit width and stamp size, executed by maxParams.c.
+func TestMaxParams(t *testing.T) {
+	osFSys := &afero.Afero{Fs: afero.NewOsFs()}
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+
+	scale := map[int]int64{8: 1, 16: 1000, 32: 100000, 64: 10000000000}
+	stamp := map[string]string{"trice": "time:            ", "Trice": "time:       5_654", "TRice": "time: 842,150_450"}
+	n := 0
+	for _, bitWidth := range []int{8, 16, 32, 64} {
+		for _, name := range []string{"trice", "Trice", "TRice"} {
+			exp := fmt.Sprintf("%sdefault: info:%s%d", stamp[name], name, bitWidth)
+			for i := int64(0); i < 32; i++ {
+				exp += fmt.Sprintf(" %d", (i-16)*scale[bitWidth])
+			}
+
+			triceMaxParams(n)
+			length := triceOutDepth()
+			buf := fmt.Sprint(out[:length])
+			act := triceLog(t, osFSys, buf[1:len(buf)-1])
+			triceClearOutBuffer()
+
+			assert.Equal(t, exp, strings.TrimSuffix(act, "\n"))
+			n++
+		}
+	}
+}
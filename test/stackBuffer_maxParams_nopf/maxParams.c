@@ -0,0 +1,24 @@
+/*! \file maxParams.c
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include <stdint.h>
+#include "trice.h"
+
+//! TriceMaxParams executes the trice with index n from a list of trices with 32 values in each bit width.
+void TriceMaxParams( int n ){
+    switch( n ){
+        default:
+        break; case 0: trice8( iD(8001), "info:trice8 %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d\n", -16, -15, -14, -13, -12, -11, -10, -9, -8, -7, -6, -5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+        break; case 1: Trice8( iD(8002), "info:Trice8 %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d\n", -16, -15, -14, -13, -12, -11, -10, -9, -8, -7, -6, -5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+        break; case 2: TRice8( iD(8003), "info:TRice8 %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d\n", -16, -15, -14, -13, -12, -11, -10, -9, -8, -7, -6, -5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+        break; case 3: trice16( iD(8004), "info:trice16 %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d\n", -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000, 11000, 12000, 13000, 14000, 15000 );
+        break; case 4: Trice16( iD(8005), "info:Trice16 %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d\n", -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000, 11000, 12000, 13000, 14000, 15000 );
+        break; case 5: TRice16( iD(8006), "info:TRice16 %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d\n", -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000, 11000, 12000, 13000, 14000, 15000 );
+        break; case 6: trice32( iD(8007), "info:trice32 %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d\n", -1600000, -1500000, -1400000, -1300000, -1200000, -1100000, -1000000, -900000, -800000, -700000, -600000, -500000, -400000, -300000, -200000, -100000, 0, 100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000, 1100000, 1200000, 1300000, 1400000, 1500000 );
+        break; case 7: Trice32( iD(8008), "info:Trice32 %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d\n", -1600000, -1500000, -1400000, -1300000, -1200000, -1100000, -1000000, -900000, -800000, -700000, -600000, -500000, -400000, -300000, -200000, -100000, 0, 100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000, 1100000, 1200000, 1300000, 1400000, 1500000 );
+        break; case 8: TRice32( iD(8009), "info:TRice32 %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d\n", -1600000, -1500000, -1400000, -1300000, -1200000, -1100000, -1000000, -900000, -800000, -700000, -600000, -500000, -400000, -300000, -200000, -100000, 0, 100000, 200000, 300000, 400000, 500000, 600000, 700000, 800000, 900000, 1000000, 1100000, 1200000, 1300000, 1400000, 1500000 );
+        break; case 9: trice64( iD(8010), "info:trice64 %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d\n", -160000000000LL, -150000000000LL, -140000000000LL, -130000000000LL, -120000000000LL, -110000000000LL, -100000000000LL, -90000000000LL, -80000000000LL, -70000000000LL, -60000000000LL, -50000000000LL, -40000000000LL, -30000000000LL, -20000000000LL, -10000000000LL, 0, 10000000000LL, 20000000000LL, 30000000000LL, 40000000000LL, 50000000000LL, 60000000000LL, 70000000000LL, 80000000000LL, 90000000000LL, 100000000000LL, 110000000000LL, 120000000000LL, 130000000000LL, 140000000000LL, 150000000000LL );
+        break; case 10: Trice64( iD(8011), "info:Trice64 %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d\n", -160000000000LL, -150000000000LL, -140000000000LL, -130000000000LL, -120000000000LL, -110000000000LL, -100000000000LL, -90000000000LL, -80000000000LL, -70000000000LL, -60000000000LL, -50000000000LL, -40000000000LL, -30000000000LL, -20000000000LL, -10000000000LL, 0, 10000000000LL, 20000000000LL, 30000000000LL, 40000000000LL, 50000000000LL, 60000000000LL, 70000000000LL, 80000000000LL, 90000000000LL, 100000000000LL, 110000000000LL, 120000000000LL, 130000000000LL, 140000000000LL, 150000000000LL );
+        break; case 11: TRice64( iD(8012), "info:TRice64 %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d\n", -160000000000LL, -150000000000LL, -140000000000LL, -130000000000LL, -120000000000LL, -110000000000LL, -100000000000LL, -90000000000LL, -80000000000LL, -70000000000LL, -60000000000LL, -50000000000LL, -40000000000LL, -30000000000LL, -20000000000LL, -10000000000LL, 0, 10000000000LL, 20000000000LL, 30000000000LL, 40000000000LL, 50000000000LL, 60000000000LL, 70000000000LL, 80000000000LL, 90000000000LL, 100000000000LL, 110000000000LL, 120000000000LL, 130000000000LL, 140000000000LL, 150000000000LL );
+    }
+}
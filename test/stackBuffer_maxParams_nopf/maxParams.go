@@ -0,0 +1,9 @@
+package cgot
+
+// void TriceMaxParams( int n );
+import "C"
+
+// triceMaxParams executes the trice with index n inside maxParams.c.
+func triceMaxParams(n int) {
+	C.TriceMaxParams(C.int(n))
+}
@@ -2,8 +2,10 @@ package cgot
 
 import (
 	"bytes"
+	"fmt"
 	"io"
 	"path"
+	"strings"
 	"testing"
 
 	"github.com/rokath/trice/internal/args"
@@ -11,15 +13,53 @@ import (
 	"github.com/tj/assert"
 )
 
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string) string {
+	var o bytes.Buffer
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "NONE", "-d16"}))
+	return o.String()
+}
+
 func TestLogs(t *testing.T) {
+	triceLogTest(t, triceLog, testLines, directTransfer)
+}
+
+// TestSimulate runs the simulator workload against this configuration. Use -args -sim "key=value,..." for other workloads.
+func TestSimulate(t *testing.T) {
+	triceSimulateTest(t, triceLog, directTransfer, nil)
+}
 
-	// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
-	// It uses the inside fSys specified til.json and returns the log output.
-	triceLog := func(t *testing.T, fSys *afero.Afero, buffer string) string {
-		var o bytes.Buffer
-		assert.Nil(t, args.Handler(io.Writer(&o), fSys, []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off", "-pf", "NONE", "-d16"}))
-		return o.String()
+// longString is the TRICE_LONG_STRING value inside constStrings.c.
+const longString = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789abcdefghijklmnopqrstuvwxyz+#"
+
+// TestStrings checks the constant, runtime and inlined string trices inside constStrings.c.
+func TestStrings(t *testing.T) {
+	osFSys := &afero.Afero{Fs: afero.NewOsFs()}
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+
+	for n, s := range []string{"short", longString, "short", longString, "short", longString} {
+		triceStrings(n)
+		length := triceOutDepth()
+		buf := fmt.Sprint(out[:length])
+		act := triceLog(t, osFSys, buf[1:len(buf)-1])
+		triceClearOutBuffer()
+		assert.Equal(t, "time: 842,150_450default: msg:"+s, strings.TrimSuffix(act, "\n"))
 	}
+}
 
-	triceLogTest(t, triceLog, testLines, directTransfer)
+// BenchmarkStrings compares the target execution time of constant and runtime strings with TRICE_S
+// and of strings inlined into the format string, as done by "trice insert -inlineStrings".
+func BenchmarkStrings(b *testing.B) {
+	out := make([]byte, 32768)
+	setTriceBuffer(out)
+	for n, name := range []string{"ConstShort", "ConstLong", "RuntimeShort", "RuntimeLong", "InlinedShort", "InlinedLong"} {
+		b.Run(name, func(b *testing.B) {
+			for i := 0; i < b.N; i++ {
+				triceStrings(n)
+				triceClearOutBuffer()
+			}
+		})
+	}
 }
@@ -0,0 +1,25 @@
+/*! \file constStrings.c
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include <stdint.h>
+#include "trice.h"
+
+//! TRICE_LONG_STRING is a string with 100 characters.
+#define TRICE_LONG_STRING "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789abcdefghijklmnopqrstuvwxyz+#"
+
+//! triceRuntimeShort and triceRuntimeLong are not constant, so their length is computed during runtime.
+char triceRuntimeShort[] = "short";
+char triceRuntimeLong[] = TRICE_LONG_STRING;
+
+//! TriceStrings executes the trice with index n from a list of trices with constant, runtime and inlined strings.
+void TriceStrings( int n ){
+    switch( n ){
+        default:
+        break; case 0: TRICE_S( ID(8013), "msg:%s\n", "short" );
+        break; case 1: TRICE_S( ID(8014), "msg:%s\n", TRICE_LONG_STRING );
+        break; case 2: TRICE_S( ID(8015), "msg:%s\n", triceRuntimeShort );
+        break; case 3: TRICE_S( ID(8016), "msg:%s\n", triceRuntimeLong );
+        break; case 4: TRICE( ID(8017), "msg:short\n" );
+        break; case 5: TRICE( ID(8018), "msg:0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789abcdefghijklmnopqrstuvwxyz+#\n" );
+    }
+}
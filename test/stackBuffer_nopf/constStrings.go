@@ -0,0 +1,9 @@
+package cgot
+
+// void TriceStrings( int n );
+import "C"
+
+// triceStrings executes the trice with index n inside constStrings.c.
+func triceStrings(n int) {
+	C.TriceStrings(C.int(n))
+}
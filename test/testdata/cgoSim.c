@@ -0,0 +1,97 @@
+/*! \file cgoSim.c
+\brief workload and diagnostics helpers for the simulator in cgoPackage.go
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+//! triceSimNs returns a monotonic nanosecond count.
+static int64_t triceSimNs( void ){
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+//! TriceSimWrite writes a workload trice of kind 0...3 with the sequence number seq and returns the spent nanoseconds.
+//! - kind 0: 4 bytes payload without stamp
+//! - kind 1: 16 bytes payload with 32-bit stamp
+//! - kind 2: 48 bytes payload with 16-bit stamp
+//! - kind 3: 40 bytes runtime string without stamp
+unsigned TriceSimWrite( int kind, uint32_t seq ){
+    char s[48];
+    if( kind == 3 ){
+        snprintf( s, sizeof(s), "%u %-30s", seq, "simulated runtime string" );
+    }
+    int64_t start = triceSimNs();
+    switch( kind ){
+        default:
+        case 0: trice32( iD(8027), "sim:%u\n", seq ); break;
+        case 1: TRice32( iD(8028), "sim:%u %u %u %u\n", seq, 1, 2, 3 ); break;
+        case 2: Trice32( iD(8029), "sim:%u %u %u %u %u %u %u %u %u %u %u %u\n", seq, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 ); break;
+        case 3: TRICE_S( id(8030), "sim:%s\n", s ); break;
+    }
+    return (unsigned)(triceSimNs() - start);
+}
+
+//! TriceSimFits returns 0, when a trice of max size could overflow a buffer without overflow check, what is the TRICE_DOUBLE_BUFFER
+//! without TRICE_DOUBLE_BUFFER_LOCK_FREE and the TRICE_RING_BUFFER with TRICE_OVERFLOW_UNCHECKED.
+//! The fill level is taken from TriceDepth, so the simulator does not depend on the buffer internals.
+int TriceSimFits( void ){
+#if (TRICE_BUFFER == TRICE_DOUBLE_BUFFER) && (TRICE_DOUBLE_BUFFER_LOCK_FREE == 0)
+    return TriceDepth() + TRICE_SINGLE_MAX_SIZE <= TRICE_DEFERRED_BUFFER_SIZE/2 - TRICE_DATA_OFFSET;
+#elif (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_UNCHECKED)
+    return TriceDepth() + 2*TRICE_BUFFER_SIZE <= TRICE_DEFERRED_BUFFER_SIZE; // The wrap can waste up to TRICE_BUFFER_SIZE bytes.
+#else
+    return 1;
+#endif
+}
+
+//! TriceSimOverwrites returns 1 for the TRICE_RING_BUFFER with TRICE_OVERFLOW_UNCHECKED, where an overflow overwrites the oldest unread trices.
+int TriceSimOverwrites( void ){
+#if (TRICE_BUFFER == TRICE_RING_BUFFER) && (TRICE_OVERFLOW_POLICY == TRICE_OVERFLOW_UNCHECKED)
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+//! TriceSimTransfer calls TriceTransfer and returns the spent nanoseconds.
+unsigned TriceSimTransfer( void ){
+    int64_t start = triceSimNs();
+    TriceTransfer();
+    return (unsigned)(triceSimNs() - start);
+}
+
+//! TriceSimDepthMax returns the max half buffer depth with TRICE_DOUBLE_BUFFER, the max ring buffer depth with TRICE_RING_BUFFER
+//! or 0 otherwise. Values are in bytes and need TRICE_DIAGNOSTICS == 1.
+unsigned TriceSimDepthMax( void ){
+#if (TRICE_DIAGNOSTICS == 1) && (TRICE_BUFFER == TRICE_DOUBLE_BUFFER)
+    return TriceHalfBufferDepthMax;
+#elif (TRICE_DIAGNOSTICS == 1) && (TRICE_BUFFER == TRICE_RING_BUFFER)
+    return TriceRingBufferDepthMax;
+#else
+    return 0;
+#endif
+}
+
+//! TriceSimSingleMax returns the max single trice size in bytes, when TRICE_DIAGNOSTICS == 1.
+unsigned TriceSimSingleMax( void ){
+#if TRICE_DIAGNOSTICS == 1
+    return TriceSingleMaxWordCount<<2;
+#else
+    return 0;
+#endif
+}
+
+//! TriceSimResetDiagnostics clears the diagnostics values used by the simulator.
+void TriceSimResetDiagnostics( void ){
+#if TRICE_DIAGNOSTICS == 1
+    TriceSingleMaxWordCount = 0;
+#if TRICE_BUFFER == TRICE_DOUBLE_BUFFER
+    TriceHalfBufferDepthMax = 0;
+#elif TRICE_BUFFER == TRICE_RING_BUFFER
+    TriceRingBufferDepthMax = 0;
+#endif
+#endif
+}
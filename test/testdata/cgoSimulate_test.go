@@ -0,0 +1,39 @@
+package cgot
+
+// This file is copied by test/simulate.sh together with cgoPackage.go and a triceConfig.h into a temporary
+// package folder to run the simulator against a target configuration without an own test package.
+
+import (
+	"bytes"
+	"flag"
+	"io"
+	"path"
+	"strings"
+	"testing"
+
+	"github.com/rokath/trice/internal/args"
+	"github.com/spf13/afero"
+	"github.com/tj/assert"
+)
+
+var (
+	simLog    = flag.String("simLog", "-pf COBS", "trice log switches matching the simulated triceConfig.h")
+	simDirect = flag.Bool("simDirect", false, "simulate direct output instead of deferred output")
+)
+
+// triceLog is the log function for executing the trice logging on binary log data in buffer as space separated numbers.
+// It uses the inside fSys specified til.json and returns the log output.
+func triceLog(t *testing.T, fSys *afero.Afero, buffer string) string {
+	var o bytes.Buffer
+	a := []string{"trice", "log", "-i", path.Join(triceDir, "/test/testdata/til.json"), "-p", "BUFFER", "-args", buffer, "-hs", "off", "-prefix", "off", "-li", "off", "-color", "off"}
+	assert.Nil(t, args.Handler(io.Writer(&o), fSys, append(a, strings.Fields(*simLog)...)))
+	return o.String()
+}
+
+func TestSimulate(t *testing.T) {
+	mode := deferredTransfer
+	if *simDirect {
+		mode = directTransfer
+	}
+	triceSimulateTest(t, triceLog, mode, nil)
+}
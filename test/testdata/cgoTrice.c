@@ -34,3 +34,31 @@ void TriceWriteDeviceCgo( uint8_t const * buf, unsigned len ){
     memcpy(cgoTriceBuffer, buf, len);
     cgoTriceBufferDepth = len;
 }
+
+//! triceCaptured holds the deferred output collected by TriceCapture calls.
+uint8_t triceCaptured[0x40000];
+
+//! triceCapturedDepth is the valid byte count inside triceCaptured.
+unsigned triceCapturedDepth = 0;
+
+//! triceCapturedLost is the deferred output byte count not fitting into triceCaptured.
+unsigned triceCapturedLost = 0;
+
+//! TriceCaptureReset empties triceCaptured.
+void TriceCaptureReset( void ){
+    triceCapturedDepth = 0;
+    triceCapturedLost = 0;
+}
+
+//! TriceCapture transfers the deferred trices and appends their output to triceCaptured.
+//! The tests with own workloads share it. Only a single thread may call it.
+void TriceCapture( void ){
+    TriceTransfer();
+    if( triceCapturedDepth + cgoTriceBufferDepth <= sizeof(triceCaptured) ){
+        memcpy( triceCaptured + triceCapturedDepth, cgoTriceBuffer, cgoTriceBufferDepth );
+        triceCapturedDepth += cgoTriceBufferDepth;
+    }else{
+        triceCapturedLost += cgoTriceBufferDepth;
+    }
+    CgoClearTriceBuffer();
+}
@@ -0,0 +1,37 @@
+/*! \file criticalSection.c
+\brief critical section cycle measurement for the doubleBuffer_deferred_lockfree and doubleBuffer_deferred_multi cgo tests
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include <stdint.h>
+#include <time.h>
+#include "trice.h"
+
+void TriceCapture( void );
+void TriceCaptureReset( void );
+
+//! TriceCpuCycles returns a free running 32-bit cycle count for TRICE_CPU_CYCLES.
+uint32_t TriceCpuCycles( void ){
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__builtin_ia32_rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (uint32_t)ts.tv_nsec;
+#endif
+}
+
+//! TriceCriticalSectionCycles writes n trices from a single thread and returns TriceCriticalSectionCyclesMax.
+//! The same workload runs with and without TRICE_DOUBLE_BUFFER_LOCK_FREE, so both results are comparable.
+unsigned TriceCriticalSectionCycles( int n ){
+    TriceCaptureReset();
+    TriceCriticalSectionCyclesMax = 0;
+    for( int i = 0; i < n; i++ ){
+        trice( iD(4978), "dbg:cs %d\n", i );
+        if( (i & 15) == 15 ){
+            TriceCapture();
+        }
+    }
+    TriceCapture(); // 2 flips needed at most
+    TriceCapture();
+    return TriceCriticalSectionCyclesMax;
+}
@@ -0,0 +1,22 @@
+/*! \file prioFlood.c
+\brief priority ring workload shared by the ringBuffer_deferred_prio cgo tests
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include <stdint.h>
+#include "trice.h"
+
+//! TricePrioFlood writes n debug trices into the low priority ring and after each 16th of them an error trice into the high priority ring.
+//! Nothing is transferred here, so the low priority ring overflows for big n.
+void TricePrioFlood( int n ){
+    for( int i = 0; i < n; i++ ){
+        trice( iD(8020), "dbg:flood %d\n", i );
+        if( (i & 15) == 15 ){
+            trice( iD(8019), "err:alarm %d\n", i >> 4 );
+        }
+    }
+}
+
+//! TricePrioOverflowCount returns the count of dropped trices in ring.
+unsigned TricePrioOverflowCount( int ring ){
+    return TriceRingBufferOverflowCount[ring];
+}
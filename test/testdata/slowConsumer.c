@@ -0,0 +1,29 @@
+/*! \file slowConsumer.c
+\brief slow consumer workload for the ringBuffer_deferred_block and ringBuffer_deferred_oldest cgo tests
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include <stdint.h>
+#include "trice.h"
+
+void TriceCapture( void );
+void TriceCaptureReset( void );
+
+//! TriceFlood writes n trices and calls TriceCapture after each every-th trice, what simulates a slow consumer.
+//! With every == 0 TriceCapture is called only, when TRICE_OVERFLOW_WAIT calls it. At the end all trices get consumed.
+void TriceFlood( int n, int every ){
+    TriceCaptureReset();
+    for( int i = 0; i < n; i++ ){
+        trice( iD(3676), "dbg:flood %d\n", i );
+        if( every && (i % every) == every - 1 ){
+            TriceCapture();
+        }
+    }
+    while( SingleTricesRingCount ){
+        TriceCapture();
+    }
+}
+
+//! TriceFloodOverflowCount returns the count of dropped trices.
+unsigned TriceFloodOverflowCount( void ){
+    return TriceRingBufferOverflowCount[0];
+}
@@ -0,0 +1,14 @@
+/*! \file stamp64.c
+\brief 64-bit stamp workload for the doubleBuffer_deferred_stamp64 cgo test
+\author thomas.hoehenleitner [at] seerose.net
+*******************************************************************************/
+#include <stdint.h>
+#include "trice.h"
+
+//! TriceStamp64Check writes trices without, with 16-bit and with 64-bit stamps.
+void TriceStamp64Check( void ){
+    trice( iD(8196), "msg:no stamp %d\n", 0 );
+    Trice( iD(8288), "msg:16-bit stamp %d\n", 16 );
+    TRice( iD(5054), "msg:64-bit stamp %d\n", 64 );
+    TRice64( iD(5789), "msg:64-bit stamp and value %d\n", 0x1122334455667788LL );
+}
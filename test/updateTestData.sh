@@ -6,7 +6,8 @@ cp ./testdata/triceCheck.c.txt ./testdata/triceCheck.c
 touch ./testdata/til.json ./testdata/li.json
 
 #  insert IDs into source code
-trice insert -i ./testdata/til.json -li ./testdata/li.json -liPathIsRelative -IDMin 1000 -IDMax 7999
+#  The C files of single test packages use IDs from 8000 on. Some of their configurations select rings by these ID ranges.
+trice insert -i ./testdata/til.json -li ./testdata/li.json -liPathIsRelative -IDMin 1000 -IDMax 8999
 
 # The file cgoPackage.go is the same in all cgo test packages, but must be inside the folders.
 # os agnostic links would be better.
@@ -18,18 +19,33 @@ staticBuffer_nopf
 stackBuffer_tcobs
 stackBuffer_cobs
 stackBuffer_nopf
+stackBuffer_maxParams_nopf
+stackBuffer_swap_nopf
 
 ringBuffer_deferred_tcobs
 ringBuffer_deferred_cobs
 ringBuffer_deferred_xtea_cobs
+ringBuffer_deferred_prio_cobs
+ringBuffer_deferred_prio_cycle_cobs
+ringBuffer_deferred_oldest_cobs
+ringBuffer_deferred_block_cobs
 
 doubleBuffer_deferred_single_tcobs
 doubleBuffer_deferred_multi_tcobs
 doubleBuffer_deferred_single_cobs
 doubleBuffer_deferred_multi_cobs
 doubleBuffer_deferred_multi_xtea_cobs
+doubleBuffer_deferred_multi_swap_cobs
+doubleBuffer_deferred_lockfree_cobs
+doubleBuffer_deferred_cores_cobs
+doubleBuffer_deferred_varint_cobs
+doubleBuffer_deferred_delta_cobs
+doubleBuffer_deferred_ratelimit_cobs
+doubleBuffer_deferred_stamp64_cobs
 
 doubleBuffer_direct_noRouting_nopf
+doubleBuffer_direct_rtt32_fast
+doubleBuffer_direct_rtt32_coalesce
 doubleBuffer_twin_direct_noRouting_nopf_deferred_multi_cobs
 "
 for d in $CGOTESTDIRS